@@ -99,6 +99,7 @@ class Axom(CachedCMakePackage, CudaPackage, ROCmPackage):
     variant("lua", default=True, description="Build with Lua")
     variant("scr", default=False, description="Build with SCR")
     variant("umpire", default=True, description="Build with umpire")
+    variant("zlib", default=False, description="Build with zlib")
 
     variant("raja", default=True, description="Build with raja")
 
@@ -129,6 +130,8 @@ class Axom(CachedCMakePackage, CudaPackage, ROCmPackage):
 
     depends_on("lua", when="+lua")
 
+    depends_on("zlib", when="+zlib")
+
     depends_on("scr", when="+scr")
     depends_on("scr~fortran", when="+scr~fortran")
 
@@ -489,7 +492,7 @@ class Axom(CachedCMakePackage, CudaPackage, ROCmPackage):
         entries.append(cmake_cache_path("CONDUIT_DIR", conduit_dir))
 
         # optional tpls
-        for dep in ("c2c", "mfem", "hdf5", "lua", "raja", "umpire"):
+        for dep in ("c2c", "mfem", "hdf5", "lua", "raja", "umpire", "zlib"):
             if "+%s" % dep in spec:
                 dep_dir = get_spec_path(spec, dep, path_replacements)
                 entries.append(cmake_cache_path("%s_DIR" % dep.upper(), dep_dir))
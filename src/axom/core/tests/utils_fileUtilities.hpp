@@ -103,3 +103,48 @@ TEST(utils_fileUtilities, changeCWD_smoke)
   EXPECT_EQ(origCWD, fs::getCWD());
   std::cout << "[cwd after change]: '" << fs::getCWD() << "'" << std::endl;
 }
+
+TEST(utils_fileUtilities, mappedFile)
+{
+  std::cout << "Testing 'MappedFile'" << std::endl;
+
+  const std::string fileName = "mapped_file_test.txt";
+  const std::string contents = "The quick brown fox jumps over the lazy dog";
+  {
+    std::ofstream ofs(fileName, std::ios::out | std::ios::binary);
+    ofs << contents;
+  }
+
+  // Map the file and check its contents
+  fs::MappedFile file;
+  EXPECT_FALSE(file.isOpen());
+  EXPECT_TRUE(file.open(fileName));
+  EXPECT_TRUE(file.isOpen());
+  ASSERT_EQ(contents.size(), file.size());
+  EXPECT_EQ(contents, std::string(file.data(), file.size()));
+
+  // Moving transfers ownership of the mapping
+  fs::MappedFile moved(std::move(file));
+  EXPECT_FALSE(file.isOpen());
+  EXPECT_EQ(nullptr, file.data());
+  EXPECT_TRUE(moved.isOpen());
+  EXPECT_EQ(contents, std::string(moved.data(), moved.size()));
+
+  moved.close();
+  EXPECT_FALSE(moved.isOpen());
+  EXPECT_EQ(0, moved.size());
+
+  // Empty files can be opened, but have no data
+  {
+    std::ofstream ofs(fileName, std::ios::out | std::ios::trunc);
+  }
+  EXPECT_TRUE(moved.open(fileName));
+  EXPECT_EQ(0, moved.size());
+  EXPECT_EQ(nullptr, moved.data());
+  moved.close();
+
+  EXPECT_EQ(0, fs::removeFile(fileName));
+
+  // Missing files cannot be opened
+  EXPECT_FALSE(fs::MappedFile(fileName).isOpen());
+}
@@ -9,6 +9,7 @@
 #include <fstream>
 #include <sstream>
 #include <cerrno>
+#include <utility>
 
 #include <cstdio>  // defines FILENAME_MAX
 
@@ -23,6 +24,10 @@
 #else
   #include <unistd.h>    // for getcwd
   #include <sys/stat.h>  // for stat
+  #include <sys/mman.h>  // for mmap
+  #include <fcntl.h>     // for open
+
+  #define AXOM_HAVE_MMAP
 
   #define GetCurrentDir getcwd
   #define ChangeCurrentDir chdir
@@ -125,6 +130,93 @@ void getDirName(std::string& dir, const std::string& path)
 //-----------------------------------------------------------------------------
 int removeFile(const std::string& filename) { return Unlink(filename.c_str()); }
 
+//-----------------------------------------------------------------------------
+bool MappedFile::open(const std::string& fileName)
+{
+  close();
+
+#ifdef AXOM_HAVE_MMAP
+  const int fd = ::open(fileName.c_str(), O_RDONLY);
+  if(fd < 0)
+  {
+    return false;
+  }
+
+  struct stat info;
+  if(fstat(fd, &info) != 0)
+  {
+    ::close(fd);
+    return false;
+  }
+
+  m_size = static_cast<std::size_t>(info.st_size);
+  if(m_size > 0)
+  {
+    void* addr = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(addr == MAP_FAILED)
+    {
+      ::close(fd);
+      m_size = 0;
+      return false;
+    }
+    m_data = static_cast<const char*>(addr);
+    m_isMapped = true;
+  }
+
+  // the mapping remains valid after the file descriptor is closed
+  ::close(fd);
+#else
+  std::ifstream ifs(fileName, std::ios::in | std::ios::binary);
+  if(!ifs.is_open())
+  {
+    return false;
+  }
+
+  ifs.seekg(0, std::ios::end);
+  m_size = static_cast<std::size_t>(ifs.tellg());
+  ifs.seekg(0, std::ios::beg);
+  if(m_size > 0)
+  {
+    char* buffer = new char[m_size];
+    ifs.read(buffer, m_size);
+    m_data = buffer;
+  }
+#endif
+
+  m_isOpen = true;
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+void MappedFile::close()
+{
+  if(m_data != nullptr)
+  {
+#ifdef AXOM_HAVE_MMAP
+    if(m_isMapped)
+    {
+      munmap(const_cast<char*>(m_data), m_size);
+    }
+#else
+    delete[] m_data;
+#endif
+  }
+
+  m_data = nullptr;
+  m_size = 0;
+  m_isOpen = false;
+  m_isMapped = false;
+}
+
+//-----------------------------------------------------------------------------
+void MappedFile::swap(MappedFile& other) noexcept
+{
+  std::swap(m_data, other.m_data);
+  std::swap(m_size, other.m_size);
+  std::swap(m_isOpen, other.m_isOpen);
+  std::swap(m_isMapped, other.m_isMapped);
+}
+
 }  // end namespace filesystem
 }  // end namespace utilities
 }  // end namespace axom
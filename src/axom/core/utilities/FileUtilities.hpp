@@ -6,6 +6,7 @@
 #ifndef COMMON_FILE_UTILITIES_H_
 #define COMMON_FILE_UTILITIES_H_
 
+#include <cstddef>
 #include <string>
 
 namespace axom
@@ -91,6 +92,83 @@ void getDirName(std::string& dir, const std::string& path);
  */
 int removeFile(const std::string& filename);
 
+/*!
+ * \brief Provides read-only access to the contents of a file through a
+ *  memory mapping.
+ *
+ *  The file is mapped into the address space of the process, so that its
+ *  contents are read from disk on demand, as they are accessed, without an
+ *  intermediate copy. The mapping is released when the MappedFile is closed
+ *  or destroyed.
+ *
+ *  Usage example:
+ *  \code{.cpp}
+ *    MappedFile file;
+ *    if(file.open("data.bin"))
+ *    {
+ *      const char* bytes = file.data();
+ *      const std::size_t nbytes = file.size();
+ *      ...
+ *    }
+ *  \endcode
+ *
+ * \note On platforms without mmap() support, the contents of the file are
+ *  read into memory instead.
+ */
+class MappedFile
+{
+public:
+  MappedFile() = default;
+
+  /// \brief Maps the given file, check isOpen() for success
+  explicit MappedFile(const std::string& fileName) { open(fileName); }
+
+  ~MappedFile() { close(); }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  MappedFile(MappedFile&& other) noexcept { swap(other); }
+  MappedFile& operator=(MappedFile&& other) noexcept
+  {
+    if(this != &other)
+    {
+      close();
+      swap(other);
+    }
+    return *this;
+  }
+
+  /*!
+   * \brief Maps the given file, closing the currently mapped file, if any.
+   * \param [in] fileName the name of the file
+   * \return true if the file was mapped successfully, false otherwise
+   *
+   * \note An empty file can be opened, in which case data() is nullptr.
+   */
+  bool open(const std::string& fileName);
+
+  /// \brief Releases the mapping
+  void close();
+
+  /// \brief Checks if a file is currently mapped
+  bool isOpen() const { return m_isOpen; }
+
+  /// \brief Returns a pointer to the first byte of the mapped file
+  const char* data() const { return m_data; }
+
+  /// \brief Returns the size of the mapped file in bytes
+  std::size_t size() const { return m_size; }
+
+private:
+  void swap(MappedFile& other) noexcept;
+
+  const char* m_data {nullptr};
+  std::size_t m_size {0};
+  bool m_isOpen {false};
+  bool m_isMapped {false};
+};
+
 }  // end namespace filesystem
 }  // end namespace utilities
 }  // end namespace axom
@@ -17,6 +17,8 @@
 
 #include "axom/lumberjack/Message.hpp"
 
+#include <cstddef>
+
 namespace axom
 {
 namespace lumberjack
@@ -30,6 +32,11 @@ namespace lumberjack
  *  Concrete instances need to inherit from this class and implement these
  *  functions. You will need to add your Combiner using Lumberjack::addCombiner
  *
+ *  Combiners may optionally provide a hash key for Messages by overriding
+ *  hasMessageKey and messageKey. When every held Combiner provides a key,
+ *  Lumberjack indexes Messages by key and only compares Messages whose keys
+ *  match, which makes combining close to linear in the number of Messages.
+ *
  * \see MessageEqualityCombiner Lumberjack
  *******************************************************************************
  */
@@ -76,6 +83,31 @@ public:
   virtual void combine(Message& combined,
                        const Message& combinee,
                        const int ranksLimit) = 0;
+
+  /*!
+   *****************************************************************************
+   * \brief Returns whether this Combiner provides a hash key via messageKey.
+   *
+   * The default implementation returns false, which makes Lumberjack compare
+   * every pair of Messages with shouldMessagesBeCombined.
+   *****************************************************************************
+   */
+  virtual bool hasMessageKey() { return false; }
+
+  /*!
+   *****************************************************************************
+   * \brief Returns a hash key for the given Message.
+   *
+   * Lumberjack only calls shouldMessagesBeCombined on Messages whose keys are
+   * equal, so the key must be consistent with it: if two Messages should be
+   * combined, their keys must be equal. Unequal Messages may share a key.
+   *
+   * \param [in] message The Message to be hashed.
+   *
+   * \pre hasMessageKey() is true
+   *****************************************************************************
+   */
+  virtual std::size_t messageKey(const Message& /* message */) { return 0; }
 };
 
 }  // end namespace lumberjack
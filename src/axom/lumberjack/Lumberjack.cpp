@@ -15,6 +15,11 @@
 
 #include "axom/lumberjack/Lumberjack.hpp"
 
+#include "axom/core/FlatMap.hpp"
+
+#include <cstddef>
+#include <utility>
+
 namespace axom
 {
 namespace lumberjack
@@ -121,7 +126,7 @@ void Lumberjack::pushMessagesOnce()
   if(!m_communicator->isOutputNode())
   {
     combineMessages();
-    packedMessagesToBeSent = packMessages(m_messages);
+    packedMessagesToBeSent = packMessagesBinary(m_messages);
     clearMessages();
   }
   std::vector<const char*> receivedPackedMessages;
@@ -154,7 +159,7 @@ void Lumberjack::pushMessagesFully()
     if(!m_communicator->isOutputNode())
     {
       combineMessages();
-      packedMessagesToBeSent = packMessages(m_messages);
+      packedMessagesToBeSent = packMessagesBinary(m_messages);
       clearMessages();
     }
 
@@ -187,6 +192,17 @@ void Lumberjack::combineMessages()
     return;
   }
 
+  bool allCombinersKeyed = true;
+  for(Combiner* combiner : m_combiners)
+  {
+    allCombinersKeyed = allCombinersKeyed && combiner->hasMessageKey();
+  }
+  if(allCombinersKeyed)
+  {
+    combineMessagesByKey();
+    return;
+  }
+
   std::vector<Message*> finalMessages;
   std::vector<int> indexesToBeDeleted;
   int combinersSize = (int)m_combiners.size();
@@ -228,5 +244,82 @@ void Lumberjack::combineMessages()
   }
   m_messages.swap(finalMessages);
 }
+
+void Lumberjack::combineMessagesByKey()
+{
+  const int messagesSize = (int)m_messages.size();
+  const int combinersSize = (int)m_combiners.size();
+
+  // For each Combiner, maps a key to the first and last final Message with
+  // that key. Final Messages sharing a key are chained in increasing order
+  // through nextWithKey, so the first match found is the one the pairwise
+  // comparison in combineMessages would have found.
+  using KeyChain = std::pair<int, int>;
+  std::vector<axom::FlatMap<std::size_t, KeyChain>> chains(combinersSize);
+  std::vector<int> nextWithKey(combinersSize * messagesSize, -1);
+  std::vector<std::size_t> keys(combinersSize);
+
+  std::vector<Message*> finalMessages;
+  finalMessages.reserve(messagesSize);
+  for(int allIndex = 0; allIndex < messagesSize; ++allIndex)
+  {
+    Message* message = m_messages[allIndex];
+
+    // Find the earliest final Message that any Combiner matches; ties go to
+    // the Combiner that was added first
+    int matchIndex = -1;
+    int matchCombiner = -1;
+    for(int combinerIndex = 0; combinerIndex < combinersSize; ++combinerIndex)
+    {
+      Combiner* combiner = m_combiners[combinerIndex];
+      keys[combinerIndex] = combiner->messageKey(*message);
+
+      auto it = chains[combinerIndex].find(keys[combinerIndex]);
+      if(it == chains[combinerIndex].end())
+      {
+        continue;
+      }
+
+      const int* next = &nextWithKey[combinerIndex * messagesSize];
+      for(int finalIndex = it->second.first;
+          finalIndex != -1 && (matchIndex == -1 || finalIndex < matchIndex);
+          finalIndex = next[finalIndex])
+      {
+        if(combiner->shouldMessagesBeCombined(*finalMessages[finalIndex],
+                                              *message))
+        {
+          matchIndex = finalIndex;
+          matchCombiner = combinerIndex;
+          break;
+        }
+      }
+    }
+
+    if(matchIndex != -1)
+    {
+      m_combiners[matchCombiner]->combine(*finalMessages[matchIndex],
+                                          *message,
+                                          m_ranksLimit);
+      delete message;
+      continue;
+    }
+
+    const int finalIndex = (int)finalMessages.size();
+    finalMessages.push_back(message);
+    for(int combinerIndex = 0; combinerIndex < combinersSize; ++combinerIndex)
+    {
+      auto inserted = chains[combinerIndex].insert(
+        {keys[combinerIndex], KeyChain(finalIndex, finalIndex)});
+      if(!inserted.second)
+      {
+        KeyChain& chain = inserted.first->second;
+        nextWithKey[combinerIndex * messagesSize + chain.second] = finalIndex;
+        chain.second = finalIndex;
+      }
+    }
+  }
+
+  m_messages.swap(finalMessages);
+}
 }  // end namespace lumberjack
 }  // end namespace axom
@@ -238,6 +238,18 @@ private:
    */
   void combineMessages();
 
+  /*!
+   *****************************************************************************
+   * \brief Combines all Message classes using the Combiner::messageKey of
+   *  every held Combiner to only compare Messages with matching keys.
+   *
+   * Produces the same result as comparing every pair of Messages.
+   *
+   * \pre Combiner::hasMessageKey is true for all held Combiner classes
+   *****************************************************************************
+   */
+  void combineMessagesByKey();
+
   Communicator* m_communicator;
   int m_ranksLimit;
   std::vector<Combiner*> m_combiners;
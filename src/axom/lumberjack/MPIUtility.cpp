@@ -14,8 +14,7 @@
  */
 
 #include "axom/lumberjack/MPIUtility.hpp"
-
-#include <cstring>
+#include "axom/lumberjack/Message.hpp"
 
 namespace axom
 {
@@ -55,7 +54,7 @@ void mpiNonBlockingSendMessages(MPI_Comm comm,
 {
   MPI_Request mpiRequest;
   MPI_Isend(const_cast<char*>(packedMessagesToBeSent),
-            strlen(packedMessagesToBeSent),
+            static_cast<int>(packedMessagesSize(packedMessagesToBeSent)),
             MPI_CHAR,
             destinationRank,
             LJ_TAG,
@@ -15,7 +15,10 @@
 
 #include "axom/lumberjack/Message.hpp"
 
+#include "axom/core/FlatMap.hpp"
+
 #include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <string>
 
@@ -23,6 +26,100 @@ namespace axom
 {
 namespace lumberjack
 {
+namespace
+{
+// Binary packed messages start with this marker and their total size in bytes
+const char binaryMarker[] = {'L', 'J', 'B', '1'};
+constexpr std::size_t binaryMarkerSize = sizeof(binaryMarker);
+constexpr std::size_t binaryHeaderSize =
+  binaryMarkerSize + sizeof(std::uint64_t);
+
+// Appends value as a little-endian base 128 variable-length integer
+void writeVarint(std::string& packed, std::uint64_t value)
+{
+  while(value >= 0x80)
+  {
+    packed += static_cast<char>((value & 0x7f) | 0x80);
+    value >>= 7;
+  }
+  packed += static_cast<char>(value);
+}
+
+// Appends value zigzag encoded so that small negative values stay small
+void writeSignedVarint(std::string& packed, std::int64_t value)
+{
+  writeVarint(packed,
+              (static_cast<std::uint64_t>(value) << 1) ^
+                static_cast<std::uint64_t>(value >> 63));
+}
+
+void writeString(std::string& packed, const std::string& value)
+{
+  writeVarint(packed, value.size());
+  packed += value;
+}
+
+/*!
+ * \brief Reads the binary packed messages, checking that no value is read past
+ *  the end of the buffer.
+ */
+class BinaryReader
+{
+public:
+  BinaryReader(const char* begin, const char* end) : m_pos(begin), m_end(end)
+  { }
+
+  bool good() const { return m_good; }
+
+  std::uint64_t readVarint()
+  {
+    std::uint64_t value = 0;
+    for(int shift = 0; shift < 64; shift += 7)
+    {
+      if(m_pos == m_end)
+      {
+        m_good = false;
+        return 0;
+      }
+      const unsigned char byte = static_cast<unsigned char>(*m_pos++);
+      value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+      if((byte & 0x80) == 0)
+      {
+        return value;
+      }
+    }
+    m_good = false;
+    return 0;
+  }
+
+  std::int64_t readSignedVarint()
+  {
+    const std::uint64_t value = readVarint();
+    return static_cast<std::int64_t>(value >> 1) ^
+      -static_cast<std::int64_t>(value & 1);
+  }
+
+  std::string readString()
+  {
+    const std::uint64_t size = readVarint();
+    if(!m_good || size > static_cast<std::uint64_t>(m_end - m_pos))
+    {
+      m_good = false;
+      return std::string();
+    }
+    std::string value(m_pos, size);
+    m_pos += size;
+    return value;
+  }
+
+private:
+  const char* m_pos;
+  const char* m_end;
+  bool m_good {true};
+};
+
+}  // end anonymous namespace
+
 //Getters
 
 std::string Message::text() const { return m_text; }
@@ -331,6 +428,12 @@ void unpackMessages(std::vector<Message*>& messages,
                     const char* packedMessages,
                     const int ranksLimit)
 {
+  if(isPackedMessagesBinary(packedMessages))
+  {
+    unpackMessagesBinary(messages, packedMessages, ranksLimit);
+    return;
+  }
+
   std::string packedMessagesString = std::string(packedMessages);
   std::size_t start, end;
   std::string tempSubString = "";
@@ -361,5 +464,171 @@ void unpackMessages(std::vector<Message*>& messages,
   }
 }
 
+const char* packMessagesBinary(const std::vector<Message*>& messages)
+{
+  if(messages.size() == 0)
+  {
+    return zeroMessage;
+  }
+
+  // Assign an index to each distinct file name and tag
+  std::vector<std::string> dictionary;
+  axom::FlatMap<std::string, int> dictionaryIndices;
+  std::vector<int> fileNameIndices(messages.size());
+  std::vector<int> tagIndices(messages.size());
+  auto getIndex = [&](const std::string& value) {
+    auto inserted =
+      dictionaryIndices.insert({value, static_cast<int>(dictionary.size())});
+    if(inserted.second)
+    {
+      dictionary.push_back(value);
+    }
+    return inserted.first->second;
+  };
+  for(std::size_t i = 0; i < messages.size(); ++i)
+  {
+    fileNameIndices[i] = getIndex(messages[i]->fileName());
+    tagIndices[i] = getIndex(messages[i]->tag());
+  }
+
+  std::string packed(binaryHeaderSize, '\0');
+  std::memcpy(&packed[0], binaryMarker, binaryMarkerSize);
+
+  writeVarint(packed, messages.size());
+  writeVarint(packed, dictionary.size());
+  for(const std::string& entry : dictionary)
+  {
+    writeString(packed, entry);
+  }
+
+  for(std::size_t i = 0; i < messages.size(); ++i)
+  {
+    const Message& message = *messages[i];
+    writeString(packed, message.text());
+    writeVarint(packed, fileNameIndices[i]);
+    writeVarint(packed, tagIndices[i]);
+    writeSignedVarint(packed, message.lineNumber());
+    writeSignedVarint(packed, message.level());
+    writeVarint(packed, message.count());
+
+    // Write the ranks as runs of consecutive ranks, each starting at an
+    // offset from the end of the previous run
+    const std::vector<int> ranks = message.ranks();
+    const int ranksSize = (int)ranks.size();
+    int runsCount = 0;
+    for(int r = 0; r < ranksSize; ++r)
+    {
+      if(r == 0 || ranks[r] != ranks[r - 1] + 1)
+      {
+        ++runsCount;
+      }
+    }
+    writeVarint(packed, runsCount);
+    std::int64_t expectedRank = 0;
+    for(int runStart = 0; runStart < ranksSize;)
+    {
+      int runEnd = runStart + 1;
+      while(runEnd < ranksSize && ranks[runEnd] == ranks[runEnd - 1] + 1)
+      {
+        ++runEnd;
+      }
+      writeSignedVarint(packed, ranks[runStart] - expectedRank);
+      writeVarint(packed, runEnd - runStart);
+      expectedRank = std::int64_t(ranks[runEnd - 1]) + 1;
+      runStart = runEnd;
+    }
+  }
+
+  const std::uint64_t packedSize = packed.size();
+  std::memcpy(&packed[binaryMarkerSize], &packedSize, sizeof(packedSize));
+
+  // Null terminate like the text format
+  char* packedMessages = new char[packedSize + 1];
+  std::memcpy(packedMessages, packed.data(), packedSize);
+  packedMessages[packedSize] = '\0';
+  return packedMessages;
+}
+
+void unpackMessagesBinary(std::vector<Message*>& messages,
+                          const char* packedMessages,
+                          const int ranksLimit)
+{
+  const std::size_t packedSize = packedMessagesSize(packedMessages);
+  BinaryReader reader(packedMessages + binaryHeaderSize,
+                      packedMessages + packedSize);
+
+  const std::uint64_t messageCount = reader.readVarint();
+  const std::uint64_t dictionarySize = reader.readVarint();
+  std::vector<std::string> dictionary;
+  for(std::uint64_t i = 0; i < dictionarySize && reader.good(); ++i)
+  {
+    dictionary.push_back(reader.readString());
+  }
+
+  std::vector<int> ranks;
+  for(std::uint64_t j = 0; j < messageCount && reader.good(); ++j)
+  {
+    const std::string text = reader.readString();
+    const std::uint64_t fileNameIndex = reader.readVarint();
+    const std::uint64_t tagIndex = reader.readVarint();
+    const int lineNumber = static_cast<int>(reader.readSignedVarint());
+    const int level = static_cast<int>(reader.readSignedVarint());
+    const int count = static_cast<int>(reader.readVarint());
+
+    ranks.clear();
+    const std::uint64_t runsCount = reader.readVarint();
+    std::int64_t expectedRank = 0;
+    for(std::uint64_t r = 0; r < runsCount && reader.good(); ++r)
+    {
+      const std::int64_t runStart = expectedRank + reader.readSignedVarint();
+      const std::uint64_t runSize = reader.readVarint();
+      // Ranks past the limit are not tracked
+      for(std::uint64_t k = 0;
+          k < runSize && (int)ranks.size() < ranksLimit;
+          ++k)
+      {
+        ranks.push_back(static_cast<int>(runStart + k));
+      }
+      expectedRank = runStart + runSize;
+    }
+
+    if(!reader.good() || fileNameIndex >= dictionary.size() ||
+       tagIndex >= dictionary.size())
+    {
+      std::cerr << "Error: Lumberjack received truncated or malformed "
+                << "binary packed messages." << std::endl;
+      return;
+    }
+
+    messages.push_back(new Message(text,
+                                   ranks,
+                                   count,
+                                   ranksLimit,
+                                   dictionary[fileNameIndex],
+                                   lineNumber,
+                                   level,
+                                   dictionary[tagIndex]));
+  }
+}
+
+bool isPackedMessagesBinary(const char* packedMessages)
+{
+  return (packedMessages != nullptr) &&
+    (std::strncmp(packedMessages, binaryMarker, binaryMarkerSize) == 0);
+}
+
+std::size_t packedMessagesSize(const char* packedMessages)
+{
+  if(isPackedMessagesBinary(packedMessages))
+  {
+    std::uint64_t packedSize = 0;
+    std::memcpy(&packedSize,
+                packedMessages + binaryMarkerSize,
+                sizeof(packedSize));
+    return packedSize;
+  }
+  return (packedMessages == nullptr) ? 0 : std::strlen(packedMessages);
+}
+
 }  // end namespace lumberjack
 }  // end namespace axom
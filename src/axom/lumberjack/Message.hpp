@@ -14,6 +14,7 @@
 #ifndef MESSAGE_HPP
 #define MESSAGE_HPP
 
+#include <cstddef>
 #include <cstring>
 #include <string>
 #include <vector>
@@ -337,7 +338,8 @@ const char* packMessages(const std::vector<Message*>& messages);
  * The messages are packed into the following format:
  *  <message count>[*<packed message size>*<packed message>]...
  * This function only adds to the messages vector and does not alter the
- * packagedMessages parameter.
+ * packagedMessages parameter. Messages packed by packMessagesBinary are
+ * unpacked with unpackMessagesBinary.
  *
  * \note It is the caller's responsibility to deallocate the Message added 
  * to the \a messages vector
@@ -351,6 +353,71 @@ void unpackMessages(std::vector<Message*>& messages,
                     const char* packedMessages,
                     const int ranksLimit);
 
+/*!
+ *****************************************************************************
+ * \brief This packs all given Message classes into one contiguous binary
+ *  buffer.
+ *
+ * The buffer starts with a marker and its total size in bytes, as a 64-bit
+ * integer in native byte order. It is followed by the message count, a
+ * dictionary of the distinct file names and tags, and the messages. Each
+ * message holds its length-prefixed text, the dictionary indices of its file
+ * name and tag, its line number, level and count, and its ranks as runs of
+ * consecutive ranks. Integers are variable-length encoded. This function does
+ * not alter the messages vector.
+ *
+ * \param [in] messages Message classes to be packed for sending
+ *
+ * \return Packed char array of all given messages, or zeroMessage if there
+ *  are no messages
+ * \note It is the caller's responsibility to deallocate the returned buffer
+ *  unless it is zeroMessage
+ * \note The buffer may contain null characters, use packedMessagesSize() to
+ *  get its size
+ * \sa unpackMessages
+ *****************************************************************************
+ */
+const char* packMessagesBinary(const std::vector<Message*>& messages);
+
+/*!
+ *****************************************************************************
+ * \brief This unpacks the given binary buffer created by packMessagesBinary
+ *  and adds the created Messages classes to the given vector.
+ *
+ * \note It is the caller's responsibility to deallocate the Message added
+ * to the \a messages vector
+ *
+ * \param [in,out] messages Vector to append created messages to
+ * \param [in]  packedMessages Packed messages to be unpacked
+ * \param [in]  ranksLimit Limits how many ranks are tracked per Message.
+ *
+ * \pre isPackedMessagesBinary(packedMessages) is true
+ *****************************************************************************
+ */
+void unpackMessagesBinary(std::vector<Message*>& messages,
+                          const char* packedMessages,
+                          const int ranksLimit);
+
+/*!
+ *****************************************************************************
+ * \brief This checks if the given packed messages were packed by
+ *  packMessagesBinary.
+ *
+ * \param [in]  packedMessages Packed messages to be checked.
+ *****************************************************************************
+ */
+bool isPackedMessagesBinary(const char* packedMessages);
+
+/*!
+ *****************************************************************************
+ * \brief Returns the size in bytes of the given packed messages, not
+ *  including the null terminator of the text format.
+ *
+ * \param [in]  packedMessages Packed messages in either format.
+ *****************************************************************************
+ */
+std::size_t packedMessagesSize(const char* packedMessages);
+
 /*!
  *****************************************************************************
  * \brief This checks if a given set of packed messages is empty.
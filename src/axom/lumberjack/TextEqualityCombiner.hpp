@@ -18,6 +18,8 @@
 #include "axom/lumberjack/Combiner.hpp"
 #include "axom/lumberjack/Message.hpp"
 
+#include <cstddef>
+#include <functional>
 #include <string>
 
 namespace axom
@@ -91,6 +93,26 @@ public:
     combined.addRanks(combinee.ranks(), combinee.count(), ranksLimit);
   }
 
+  /*!
+   *****************************************************************************
+   * \brief Returns true since this Combiner provides a Message key.
+   *****************************************************************************
+   */
+  bool hasMessageKey() { return true; }
+
+  /*!
+   *****************************************************************************
+   * \brief Returns a hash of Message::text, which is equal for all
+   *  Messages that this Combiner combines.
+   *
+   * \param [in] message The Message to be hashed.
+   *****************************************************************************
+   */
+  std::size_t messageKey(const Message& message)
+  {
+    return std::hash<std::string> {}(message.text());
+  }
+
 private:
   const std::string m_id = "TextEqualityCombiner";
 };
@@ -18,6 +18,8 @@
 #include "axom/lumberjack/Combiner.hpp"
 #include "axom/lumberjack/Message.hpp"
 
+#include <cstddef>
+#include <functional>
 #include <string>
 
 namespace axom
@@ -90,6 +92,30 @@ public:
     combined.addRanks(combinee.ranks(), combinee.count(), ranksLimit);
   }
 
+  /*!
+   *****************************************************************************
+   * \brief Returns true since this Combiner provides a Message key.
+   *****************************************************************************
+   */
+  bool hasMessageKey() { return true; }
+
+  /*!
+   *****************************************************************************
+   * \brief Returns a hash of Message::text and Message::tag, which is equal
+   *  for all Messages that this Combiner combines.
+   *
+   * \param [in] message The Message to be hashed.
+   *****************************************************************************
+   */
+  std::size_t messageKey(const Message& message)
+  {
+    // combine the hashes as in boost's hash_combine()
+    std::size_t key = std::hash<std::string> {}(message.text());
+    key ^= std::hash<std::string> {}(message.tag()) + 0x9e3779b9 + (key << 6) +
+      (key >> 2);
+    return key;
+  }
+
 private:
   const std::string m_id = "TextTagCombiner";
 };
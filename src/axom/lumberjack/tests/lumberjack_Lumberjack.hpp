@@ -9,6 +9,7 @@
 
 #include "axom/lumberjack/Communicator.hpp"
 #include "axom/lumberjack/Message.hpp"
+#include "axom/lumberjack/TextEqualityCombiner.hpp"
 
 #include <stdlib.h>
 #include <time.h>
@@ -48,6 +49,39 @@ private:
   bool m_isOutputNode;
 };
 
+// Combines Messages whose text has the same length; every Message shares the
+// same key when keyed, so the key index must still defer to the comparison
+class TextLengthCombiner : public axom::lumberjack::Combiner
+{
+public:
+  TextLengthCombiner(bool keyed) : m_keyed(keyed) { }
+
+  const std::string id() { return "TextLengthCombiner"; }
+
+  bool shouldMessagesBeCombined(const axom::lumberjack::Message& leftMessage,
+                                const axom::lumberjack::Message& rightMessage)
+  {
+    return leftMessage.text().size() == rightMessage.text().size();
+  }
+
+  void combine(axom::lumberjack::Message& combined,
+               const axom::lumberjack::Message& combinee,
+               const int ranksLimit)
+  {
+    combined.addRanks(combinee.ranks(), combinee.count(), ranksLimit);
+  }
+
+  bool hasMessageKey() { return m_keyed; }
+
+  std::size_t messageKey(const axom::lumberjack::Message& /* message */)
+  {
+    return 0;
+  }
+
+private:
+  bool m_keyed;
+};
+
 TEST(lumberjack_Lumberjack, combineMessagesPushOnce01)
 {
   int ranksLimit = 5;
@@ -437,3 +471,78 @@ TEST(lumberjack_Lumberjack, combineMessagesLargeMessages)
   lumberjack.finalize();
   communicator.finalize();
 }
+
+TEST(lumberjack_Lumberjack, combineMessagesCollidingKeys)
+{
+  // The same Messages should be combined the same way whether or not the
+  // Combiners provide keys, even when unequal Messages share a key
+  for(bool keyed : {true, false})
+  {
+    int ranksLimit = 5;
+    TestCommunicator communicator;
+    communicator.initialize(MPI_COMM_NULL, ranksLimit);
+    axom::lumberjack::Lumberjack lumberjack;
+    lumberjack.initialize(&communicator, ranksLimit);
+    lumberjack.addCombiner(new TextLengthCombiner(keyed));
+
+    lumberjack.queueMessage("aa");
+    lumberjack.queueMessage("bbb");
+    lumberjack.queueMessage("cc");
+    lumberjack.queueMessage("aa");
+    lumberjack.queueMessage("dddd");
+    lumberjack.queueMessage("bbb");
+    lumberjack.queueMessage("eee");
+
+    lumberjack.pushMessagesFully();
+
+    std::vector<axom::lumberjack::Message*> messages =
+      lumberjack.getMessages();
+
+    // Repeated texts are combined by the TextTagCombiner, while "cc" and
+    // "eee" are combined into "aa" and "bbb" by the TextLengthCombiner
+    ASSERT_EQ((int)messages.size(), 3);
+    EXPECT_EQ(messages[0]->text(), "aa");
+    EXPECT_EQ(messages[0]->count(), 3);
+    EXPECT_EQ(messages[1]->text(), "bbb");
+    EXPECT_EQ(messages[1]->count(), 3);
+    EXPECT_EQ(messages[2]->text(), "dddd");
+    EXPECT_EQ(messages[2]->count(), 1);
+
+    lumberjack.finalize();
+    communicator.finalize();
+  }
+}
+
+TEST(lumberjack_Lumberjack, combineMessagesManyKeyedMessages)
+{
+  int ranksLimit = 5;
+  const int loopCount = 100000;
+  const int uniqueCount = 1000;
+
+  TestCommunicator communicator;
+  communicator.initialize(MPI_COMM_NULL, ranksLimit);
+  axom::lumberjack::Lumberjack lumberjack;
+  lumberjack.initialize(&communicator, ranksLimit);
+  lumberjack.addCombiner(new axom::lumberjack::TextEqualityCombiner);
+
+  for(int i = 0; i < loopCount; ++i)
+  {
+    std::string s = "Should be combined " + std::to_string(i % uniqueCount);
+    lumberjack.queueMessage(s);
+  }
+
+  lumberjack.pushMessagesFully();
+
+  std::vector<axom::lumberjack::Message*> messages = lumberjack.getMessages();
+
+  ASSERT_EQ((int)messages.size(), uniqueCount);
+  for(int i = 0; i < uniqueCount; ++i)
+  {
+    std::string s = "Should be combined " + std::to_string(i);
+    EXPECT_EQ(messages[i]->text(), s);
+    EXPECT_EQ(messages[i]->count(), loopCount / uniqueCount);
+  }
+
+  lumberjack.finalize();
+  communicator.finalize();
+}
@@ -5,6 +5,7 @@
 
 #include "gtest/gtest.h"
 
+#include <cstdint>
 #include <cstring>
 #include <string>
 #include <vector>
@@ -727,3 +728,145 @@ TEST(lumberjack_Message, unpackMessages)
   }
   messages.clear();
 }
+
+TEST(lumberjack_Message, packMessagesBinary)
+{
+  std::vector<axom::lumberjack::Message*> messages;
+  std::vector<TestData> testData = getTestData();
+  for(auto& td : testData)
+  {
+    messages.push_back(new axom::lumberjack::Message(td.text,
+                                                     td.rank,
+                                                     td.fileName,
+                                                     td.lineNumber,
+                                                     td.level,
+                                                     td.tag));
+  }
+
+  const char* packedMessages = axom::lumberjack::packMessagesBinary(messages);
+  EXPECT_TRUE(axom::lumberjack::isPackedMessagesBinary(packedMessages));
+  EXPECT_FALSE(axom::lumberjack::isPackedMessagesEmpty(packedMessages));
+
+  std::vector<axom::lumberjack::Message*> unpackedMessages;
+  axom::lumberjack::unpackMessages(unpackedMessages, packedMessages, 100);
+
+  ASSERT_EQ(unpackedMessages.size(), testData.size());
+  for(int i = 0; i < (int)unpackedMessages.size(); ++i)
+  {
+    axom::lumberjack::Message* m = unpackedMessages[i];
+    TestData td = testData[i];
+
+    EXPECT_EQ(m->text(), td.text);
+    ASSERT_EQ(m->ranks().size(), (std::vector<int>::size_type)1);
+    EXPECT_EQ(m->ranks()[0], td.rank);
+    EXPECT_EQ(m->count(), 1);
+    EXPECT_EQ(m->fileName(), td.fileName);
+    EXPECT_EQ(m->lineNumber(), td.lineNumber);
+    EXPECT_EQ(m->level(), td.level);
+    EXPECT_EQ(m->tag(), td.tag);
+  }
+
+  // cleanup
+  delete[] packedMessages;
+  for(auto* _m : messages)
+  {
+    delete _m;
+  }
+  for(auto* _m : unpackedMessages)
+  {
+    delete _m;
+  }
+}
+
+TEST(lumberjack_Message, packMessagesBinaryCombined)
+{
+  // Messages from many ranks with shared file names and tags
+  const int ranksLimit = 1000;
+  const int messageCount = 50;
+  std::vector<int> ranks;
+  for(int r = 0; r < 400; ++r)
+  {
+    ranks.push_back(r < 200 ? r : r + 400);
+  }
+  ranks.push_back(7);
+  ranks.push_back(100000);
+
+  std::vector<axom::lumberjack::Message*> messages;
+  for(int i = 0; i < messageCount; ++i)
+  {
+    messages.push_back(new axom::lumberjack::Message(
+      "Message " + std::to_string(i),
+      ranks,
+      (int)ranks.size() + i,
+      ranksLimit,
+      i % 2 ? "src/physics/hydro.cpp" : "src/physics/diffusion.cpp",
+      -i,
+      i % 5,
+      i % 3 ? "" : "solver"));
+  }
+
+  const char* textPackedMessages = axom::lumberjack::packMessages(messages);
+  const char* packedMessages = axom::lumberjack::packMessagesBinary(messages);
+  EXPECT_LT(axom::lumberjack::packedMessagesSize(packedMessages),
+            axom::lumberjack::packedMessagesSize(textPackedMessages) / 10);
+
+  // Ranks past the limit should be dropped while the count is kept
+  const int unpackedRanksLimit = 300;
+  std::vector<axom::lumberjack::Message*> unpackedMessages;
+  axom::lumberjack::unpackMessages(unpackedMessages,
+                                   packedMessages,
+                                   unpackedRanksLimit);
+
+  ASSERT_EQ((int)unpackedMessages.size(), messageCount);
+  for(int i = 0; i < messageCount; ++i)
+  {
+    axom::lumberjack::Message* m = unpackedMessages[i];
+    EXPECT_EQ(m->text(), messages[i]->text());
+    EXPECT_EQ(m->count(), messages[i]->count());
+    EXPECT_EQ(m->fileName(), messages[i]->fileName());
+    EXPECT_EQ(m->lineNumber(), messages[i]->lineNumber());
+    EXPECT_EQ(m->level(), messages[i]->level());
+    EXPECT_EQ(m->tag(), messages[i]->tag());
+    EXPECT_EQ(m->ranks(),
+              std::vector<int>(ranks.begin(),
+                               ranks.begin() + unpackedRanksLimit));
+  }
+
+  // Truncated buffers should not create partial messages. The size of the
+  // buffer follows its 4 byte marker.
+  std::vector<char> truncated(packedMessages,
+                              packedMessages +
+                                axom::lumberjack::packedMessagesSize(
+                                  packedMessages));
+  std::vector<axom::lumberjack::Message*> truncatedMessages;
+  const std::uint64_t truncatedSize = truncated.size() / 2;
+  std::memcpy(&truncated[4], &truncatedSize, sizeof(truncatedSize));
+  axom::lumberjack::unpackMessages(truncatedMessages,
+                                   truncated.data(),
+                                   ranksLimit);
+  EXPECT_LT((int)truncatedMessages.size(), messageCount);
+
+  // cleanup
+  delete[] textPackedMessages;
+  delete[] packedMessages;
+  for(auto* _m : messages)
+  {
+    delete _m;
+  }
+  for(auto* _m : unpackedMessages)
+  {
+    delete _m;
+  }
+  for(auto* _m : truncatedMessages)
+  {
+    delete _m;
+  }
+}
+
+TEST(lumberjack_Message, packMessagesBinaryEmpty)
+{
+  std::vector<axom::lumberjack::Message*> messages;
+  const char* packedMessages = axom::lumberjack::packMessagesBinary(messages);
+  EXPECT_TRUE(axom::lumberjack::isPackedMessagesEmpty(packedMessages));
+  EXPECT_FALSE(axom::lumberjack::isPackedMessagesBinary(packedMessages));
+}
@@ -26,6 +26,8 @@ TEST(lumberjack_TextEqualityCombiner, case01)
   axom::lumberjack::TextEqualityCombiner c;
 
   bool shouldMessagesBeCombined = c.shouldMessagesBeCombined(m1, m2);
+  EXPECT_TRUE(c.hasMessageKey());
+  EXPECT_EQ(c.messageKey(m1), c.messageKey(m2));
 
   c.combine(m1, m2, 5);
 
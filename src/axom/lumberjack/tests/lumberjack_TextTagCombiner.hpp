@@ -28,6 +28,8 @@ TEST(lumberjack_TextTagCombiner, case01)
   axom::lumberjack::TextTagCombiner c;
 
   bool shouldMessagesBeCombined = c.shouldMessagesBeCombined(m1, m2);
+  EXPECT_TRUE(c.hasMessageKey());
+  EXPECT_EQ(c.messageKey(m1), c.messageKey(m2));
 
   c.combine(m1, m2, 5);
 
@@ -0,0 +1,117 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "benchmark/benchmark_api.h"
+
+#include "axom/lumberjack/Lumberjack.hpp"
+#include "axom/lumberjack/Communicator.hpp"
+#include "axom/lumberjack/Message.hpp"
+#include "axom/lumberjack/TextTagCombiner.hpp"
+
+#include <string>
+#include <vector>
+
+/*!
+ * \file
+ *
+ * Benchmarks Lumberjack's Message combining on a single output node with
+ * 10^5 queued Messages and a varying number of distinct Messages.
+ *
+ * The keyed benchmarks use the default TextTagCombiner, which lets Lumberjack
+ * index the Messages by key. The pairwise benchmarks use a TextTagCombiner
+ * without a key, which compares every pair of held Messages.
+ */
+
+namespace
+{
+const int NUM_MESSAGES = 100000;
+
+// A Communicator for a single output node that does not communicate
+class LocalCommunicator : public axom::lumberjack::Communicator
+{
+public:
+  void initialize(MPI_Comm /* comm */, int ranksLimit)
+  {
+    m_ranksLimit = ranksLimit;
+  }
+
+  void finalize() { }
+
+  int rank() { return 0; }
+
+  void ranksLimit(int value) { m_ranksLimit = value; }
+
+  int ranksLimit() { return m_ranksLimit; }
+
+  int numPushesToFlush() { return 1; }
+
+  void push(const char* /* packedMessagesToBeSent */,
+            std::vector<const char*>& /* receivedPackedMessages */)
+  { }
+
+  bool isOutputNode() { return true; }
+
+private:
+  int m_ranksLimit;
+};
+
+// A TextTagCombiner that does not provide a Message key
+class PairwiseTextTagCombiner : public axom::lumberjack::TextTagCombiner
+{
+public:
+  bool hasMessageKey() { return false; }
+};
+
+void combineMessages(benchmark::State& state, bool keyed)
+{
+  const int numDistinct = state.range(0);
+
+  std::vector<std::string> texts(numDistinct);
+  for(int i = 0; i < numDistinct; ++i)
+  {
+    texts[i] = "Solver failed to converge in zone " + std::to_string(i);
+  }
+
+  LocalCommunicator communicator;
+  communicator.initialize(MPI_COMM_NULL, 5);
+  axom::lumberjack::Lumberjack lumberjack;
+  lumberjack.initialize(&communicator, 5);
+  if(!keyed)
+  {
+    lumberjack.clearCombiners();
+    lumberjack.addCombiner(new PairwiseTextTagCombiner);
+  }
+
+  while(state.KeepRunning())
+  {
+    state.PauseTiming();
+    lumberjack.clearMessages();
+    for(int i = 0; i < NUM_MESSAGES; ++i)
+    {
+      lumberjack.queueMessage(texts[i % numDistinct], "file.cpp", 42, 0, "");
+    }
+    state.ResumeTiming();
+
+    lumberjack.pushMessagesOnce();
+  }
+  state.SetItemsProcessed(state.iterations() * NUM_MESSAGES);
+
+  lumberjack.finalize();
+  communicator.finalize();
+}
+
+void combineKeyed(benchmark::State& state) { combineMessages(state, true); }
+
+void combinePairwise(benchmark::State& state)
+{
+  combineMessages(state, false);
+}
+
+}  // end anonymous namespace
+
+BENCHMARK(combineKeyed)->Arg(1)->Arg(100)->Arg(10000)->Arg(NUM_MESSAGES);
+BENCHMARK(combinePairwise)->Arg(1)->Arg(100)->Arg(1000);
+
+BENCHMARK_MAIN();
@@ -6,9 +6,15 @@
 #include "axom/mint/mesh/internal/MeshHelpers.hpp"
 #include "axom/mint/mesh/Mesh.hpp"
 #include "axom/core/utilities/Utilities.hpp"
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/execution/for_all.hpp"
+
+#ifdef AXOM_USE_RAJA
+  #include "RAJA/RAJA.hpp"
+#endif
 
 #include <algorithm>
-#include <unordered_map>
+#include <cstdint>
 #include <vector>
 
 namespace axom
@@ -51,21 +57,48 @@ IndexType otherSide(IndexType* f2c, IndexType thisSide)
 }
 
 //------------------------------------------------------------------------------
-struct FaceTypeCellsNodes
+// The cells are accessed through the Mesh interface, which lives on the host,
+// so the face relations are built with a host execution space.
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+using FaceExecSpace = axom::OMP_EXEC;
+#else
+using FaceExecSpace = axom::SEQ_EXEC;
+#endif
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief The sorted node IDs of a face, padded with -1 up to MAX_FACE_NODES.
+ *
+ *  Since the padding is smaller than any node ID, keys compare in the same
+ *  lexicographic order as the sorted node lists they are made of.
+ */
+struct FaceKey
 {
-  FaceTypeCellsNodes() : facetype(UNDEFINED_CELL) { }
-
-  FaceTypeCellsNodes(CellType ftype,
-                     std::vector<IndexType>& fcells,
-                     std::vector<IndexType>& fnodes)
-    : facetype(ftype)
-    , facecells(fcells)
-    , facenodes(fnodes)
-  { }
-
-  CellType facetype;
-  std::vector<IndexType> facecells;
-  std::vector<IndexType> facenodes;
+  IndexType nodes[MAX_FACE_NODES];
+
+  bool operator==(const FaceKey& other) const
+  {
+    for(int i = 0; i < MAX_FACE_NODES; ++i)
+    {
+      if(nodes[i] != other.nodes[i])
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool operator<(const FaceKey& other) const
+  {
+    for(int i = 0; i < MAX_FACE_NODES; ++i)
+    {
+      if(nodes[i] != other.nodes[i])
+      {
+        return nodes[i] < other.nodes[i];
+      }
+    }
+    return false;
+  }
 };
 
 //------------------------------------------------------------------------------
@@ -79,174 +112,195 @@ bool initFaces(Mesh* mesh,
                Array<IndexType>& f2noffsets,
                Array<CellType>& f2ntypes)
 {
-  bool success = true;
-
   facecount = 0;
 
-  using IDtoKeyType = std::unordered_map<IndexType, std::vector<IndexType>>;
-  using FaceBuilderType = std::map<std::vector<IndexType>,
-                                   FaceTypeCellsNodes,
-                                   utilities::LexiComparator<IndexType>>;
-  FaceBuilderType workface;
-
-  // Iterate over each cell.
+  // Step 1. Count the faces of every cell.  Each face of each cell is an
+  // "entry", and the entries of cell c are c2foffsets[c], ...,
+  // c2foffsets[c + 1] - 1.
   const IndexType cellcount = mesh->getNumberOfCells();
-  for(int c = 0; c < cellcount; ++c)
+  c2foffsets.resize(cellcount + 1);
+  c2foffsets[0] = 0;
+  for(IndexType c = 0; c < cellcount; ++c)
   {
-    // Step 1. For every cell, get the nodes.
+    c2foffsets[c + 1] =
+      c2foffsets[c] + getCellInfo(mesh->getCellType(c)).num_faces;
+  }
+  const IndexType entrycount = c2foffsets[cellcount];
+
+  // Step 2. For every cell face, record its cell, its index in the cell and
+  // its key.  The cell nodes will be in "VTK Order," as specified by
+  // https://www.vtk.org/wp-content/uploads/2015/04/file-formats.pdf.
+  // The face nodes are later selected as listed in the registered cell info
+  // to make sure that face normals point outward.
+  Array<FaceKey> keys(entrycount, entrycount);
+  Array<IndexType> entrycells(entrycount, entrycount);
+  Array<std::int8_t> entryfaces(entrycount, entrycount);
+
+  const IndexType* c2foffsets_ptr = c2foffsets.data();
+  FaceKey* keys_ptr = keys.data();
+  IndexType* entrycells_ptr = entrycells.data();
+  std::int8_t* entryfaces_ptr = entryfaces.data();
+
+  axom::for_all<FaceExecSpace>(cellcount, [=](IndexType c) {
     IndexType nodes[MAX_CELL_NODES];
     mesh->getCellNodeIDs(c, nodes);
-    const CellType celltype = mesh->getCellType(c);
-    const CellInfo thisCell = getCellInfo(celltype);
+    const CellInfo thisCell = getCellInfo(mesh->getCellType(c));
 
     int base = 0;
     for(int f = 0; f < thisCell.num_faces; ++f)
     {
-      // Step 2. The cell nodes will be in "VTK Order," as specified by
-      // https://www.vtk.org/wp-content/uploads/2015/04/file-formats.pdf.
-      // This routine selects the face nodes as listed in the registered
-      // cell info to make sure that face normals point outward.
-      //
-      // For every face, sort the node IDs and join them together in a
-      // string with '.' delimiters.  This is the key for an associative
-      // array whose value is a list of cell IDs.
-      int num_face_nodes = thisCell.face_nodecount[f];
-      std::vector<IndexType> inorder_facenodes(num_face_nodes);
-      const IndexType* face_node_offsets = thisCell.face_nodes + base;
-      for(int fn = 0; fn < num_face_nodes; ++fn)
+      const IndexType entry = c2foffsets_ptr[c] + f;
+      const int num_face_nodes = thisCell.face_nodecount[f];
+      FaceKey& key = keys_ptr[entry];
+      for(int fn = 0; fn < MAX_FACE_NODES; ++fn)
       {
-        inorder_facenodes[fn] = nodes[face_node_offsets[fn]];
+        key.nodes[fn] = (fn < num_face_nodes)
+          ? nodes[thisCell.face_nodes[base + fn]]
+          : static_cast<IndexType>(-1);
       }
+      std::sort(key.nodes, key.nodes + num_face_nodes);
       base += num_face_nodes;
 
-      std::vector<IndexType> sorted_facenodes(inorder_facenodes);
-      std::sort(sorted_facenodes.begin(), sorted_facenodes.end());
-
-      FaceTypeCellsNodes cells_of_face;
-      if(workface.count(sorted_facenodes) > 0)
-      {
-        cells_of_face = workface[sorted_facenodes];
-      }
-      else
-      {
-        cells_of_face.facetype = thisCell.face_types[f];
-        cells_of_face.facenodes = inorder_facenodes;
-      }
-      cells_of_face.facecells.push_back(c);
-      workface[sorted_facenodes] = cells_of_face;
+      entrycells_ptr[entry] = c;
+      entryfaces_ptr[entry] = static_cast<std::int8_t>(f);
     }
-  }
-
-  // Step 3. For each face, record its incident cells.
-  // Here we use ConnectivityArray::reserve() and then append() each
-  // face.  This means the kth inserted face gets ID k.
-  IndexType faceID = 0;
-  IndexType faceNodeTotal = 0;
-  IDtoKeyType keys;
-  f2c.resize(2 * workface.size());
-  for(FaceBuilderType::value_type v : workface)
+  });
+
+  // Step 3. Sort the entries by key, so the entries of a face are adjacent.
+  // Ties are broken by entry, i.e. by cell, so that the faces are numbered,
+  // and their cells listed, in a deterministic order.
+  Array<IndexType> order(entrycount, entrycount);
+  IndexType* order_ptr = order.data();
+  axom::for_all<FaceExecSpace>(entrycount,
+                               [=](IndexType i) { order_ptr[i] = i; });
+
+  const auto entryLess = [=](IndexType a, IndexType b) {
+    return (keys_ptr[a] < keys_ptr[b]) ||
+      (!(keys_ptr[b] < keys_ptr[a]) && a < b);
+  };
+#ifdef AXOM_USE_RAJA
+  using sort_policy =
+    typename axom::execution_space<FaceExecSpace>::loop_policy;
+  RAJA::sort<sort_policy>(RAJA::make_span(order_ptr, entrycount), entryLess);
+#else
+  std::sort(order.begin(), order.end(), entryLess);
+#endif
+
+  // Step 4. Number the faces, and check that each face has one or two
+  // incident cells.
+  Array<IndexType> facestart(0, entrycount + 1);
+  bool success = true;
+  for(IndexType i = 0; i < entrycount; ++i)
   {
-    FaceTypeCellsNodes theFace = v.second;
-    faceNodeTotal += static_cast<IndexType>(theFace.facenodes.size());
-    int faceCellCount = static_cast<int>(theFace.facecells.size());
-    IndexType* faceCells = theFace.facecells.data();
-
-    if(faceCellCount < 1 || faceCellCount > 2)
+    if(i == 0 || !(keys[order[i]] == keys[order[i - 1]]))
     {
-      success = false;
+      facestart.push_back(i);
     }
-    else
+    else if(i - facestart[facestart.size() - 1] > 1)
     {
-      f2c[2 * faceID] = faceCells[0];
-      f2c[2 * faceID + 1] = (faceCellCount > 1 ? faceCells[1] : -1);
+      success = false;
     }
-
-    keys[faceID] = v.first;
-
-    faceID += 1;
   }
+  facestart.push_back(entrycount);
 
-  // If we have any face with less than one or more than two incident cells,
-  // clean up and return failure.  We won't do any more work here.
+  // If we have any face with more than two incident cells, clean up and
+  // return failure.  We won't do any more work here.
   if(!success)
   {
     f2c.clear();
+    c2foffsets.clear();
     return success;
   }
 
-  // Record how many faces we have in this mesh.
-  facecount = faceID;
+  facecount = facestart.size() - 1;
 
-  // Now that we have a count of all the face-nodes, and we know we have no
-  // faces with more than two nodes, record the face-node relations.
-  f2n.resize(faceNodeTotal);
+  // Step 5. For each face, record its incident cells, and its nodes and
+  // type as seen from its first cell.
+  Array<IndexType> entryfaceids(entrycount, entrycount);
+  f2c.resize(2 * facecount);
   f2noffsets.resize(facecount + 1);
   f2ntypes.resize(facecount);
-  int faceNodeOffset = 0;
-  for(int fidx = 0; fidx < facecount; ++fidx)
-  {
-    FaceTypeCellsNodes theFace = workface[keys[fidx]];
-    std::vector<IndexType>& faceNodes = theFace.facenodes;
-    std::copy(faceNodes.begin(), faceNodes.end(), f2n.begin() + faceNodeOffset);
-    f2noffsets[fidx] = faceNodeOffset;
-    f2ntypes[fidx] = theFace.facetype;
-    faceNodeOffset += static_cast<int>(faceNodes.size());
-  }
-  f2noffsets[facecount] = faceNodeOffset;
 
-  // Step 4. Now that we have face IDs, record cell-to-face relation.
-  using CellFaceBuilderType =
-    std::unordered_map<IndexType, std::vector<IndexType>>;
+  const IndexType* facestart_ptr = facestart.data();
+  IndexType* entryfaceids_ptr = entryfaceids.data();
+  IndexType* f2c_ptr = f2c.data();
+  IndexType* f2noffsets_ptr = f2noffsets.data();
+  CellType* f2ntypes_ptr = f2ntypes.data();
 
-  CellFaceBuilderType cell_to_face;
-  int cellFaceCount = 0;
-  for(int f = 0; f < facecount; ++f)
-  {
-    for(IndexType c : workface[keys[f]].facecells)
+  axom::for_all<FaceExecSpace>(facecount, [=](IndexType f) {
+    const IndexType first = order_ptr[facestart_ptr[f]];
+    const bool shared = facestart_ptr[f + 1] - facestart_ptr[f] > 1;
+
+    f2c_ptr[2 * f] = entrycells_ptr[first];
+    f2c_ptr[2 * f + 1] =
+      shared ? entrycells_ptr[order_ptr[facestart_ptr[f] + 1]] : -1;
+    for(IndexType i = facestart_ptr[f]; i < facestart_ptr[f + 1]; ++i)
     {
-      std::vector<IndexType> cell_faces;
-      if(cell_to_face.count(c) > 0)
-      {
-        cell_faces = cell_to_face[c];
-      }
-      cellFaceCount += 1;
-      cell_faces.push_back(f);
-      cell_to_face[c] = cell_faces;
+      entryfaceids_ptr[order_ptr[i]] = f;
     }
-  }
 
-  // Step 4b. Put cell-to-face relation into output arrays.
-  c2f.resize(cellFaceCount);
-  c2n.resize(cellFaceCount);
-  c2foffsets.resize(cellcount + 1);
-  cellFaceCount = 0;
+    const CellInfo firstCell =
+      getCellInfo(mesh->getCellType(entrycells_ptr[first]));
+    const int local = entryfaces_ptr[first];
+    f2noffsets_ptr[f] = firstCell.face_nodecount[local];
+    f2ntypes_ptr[f] = firstCell.face_types[local];
+  });
 
-  for(IndexType cellID = 0; cellID < cellcount; ++cellID)
+  // Now that we have a count of all the face-nodes, record the face-node
+  // relation.
+  IndexType faceNodeTotal = 0;
+  for(IndexType f = 0; f < facecount; ++f)
   {
-    // For the current cell ID, set its type and value offset
-    //  cellTypes[cellID] = m_cell_connectivity->getIDType(cellID);
-    c2foffsets[cellID] = cellFaceCount;
+    const IndexType num_face_nodes = f2noffsets[f];
+    f2noffsets[f] = faceNodeTotal;
+    faceNodeTotal += num_face_nodes;
+  }
+  f2noffsets[facecount] = faceNodeTotal;
 
-    if(cell_to_face.count(cellID) > 0)
+  f2n.resize(faceNodeTotal);
+  IndexType* f2n_ptr = f2n.data();
+  axom::for_all<FaceExecSpace>(facecount, [=](IndexType f) {
+    const IndexType first = order_ptr[facestart_ptr[f]];
+    const IndexType c = entrycells_ptr[first];
+    const int local = entryfaces_ptr[first];
+
+    IndexType nodes[MAX_CELL_NODES];
+    mesh->getCellNodeIDs(c, nodes);
+    const CellInfo thisCell = getCellInfo(mesh->getCellType(c));
+
+    int base = 0;
+    for(int f2 = 0; f2 < local; ++f2)
     {
-      // If we have faces for the current cell (which we certainly
-      // *SHOULD* have), copy them in.
-      std::vector<IndexType>& theCells = cell_to_face[cellID];
-      IndexType* faceIDs = theCells.data();
-      int thisCellFaceCount = static_cast<int>(theCells.size());
-
-      // Copy in values
-      for(int f = 0; f < thisCellFaceCount; ++f)
-      {
-        c2f[cellFaceCount + f] = faceIDs[f];
-        c2n[cellFaceCount + f] = otherSide(&f2c[2 * faceIDs[f]], cellID);
-      }
+      base += thisCell.face_nodecount[f2];
+    }
+    for(IndexType fn = f2noffsets_ptr[f]; fn < f2noffsets_ptr[f + 1]; ++fn)
+    {
+      f2n_ptr[fn] = nodes[thisCell.face_nodes[base++]];
+    }
+  });
+
+  // Step 6. Now that we have face IDs, record the cell-to-face relation,
+  // listing the faces of each cell by increasing face ID.
+  c2f.resize(entrycount);
+  c2n.resize(entrycount);
+  IndexType* c2f_ptr = c2f.data();
+  IndexType* c2n_ptr = c2n.data();
+  axom::for_all<FaceExecSpace>(cellcount, [=](IndexType c) {
+    IndexType* faceIDs = c2f_ptr + c2foffsets_ptr[c];
+    const IndexType thisCellFaceCount =
+      c2foffsets_ptr[c + 1] - c2foffsets_ptr[c];
+    for(IndexType f = 0; f < thisCellFaceCount; ++f)
+    {
+      faceIDs[f] = entryfaceids_ptr[c2foffsets_ptr[c] + f];
+    }
+    std::sort(faceIDs, faceIDs + thisCellFaceCount);
 
-      // Maintain offset
-      cellFaceCount += thisCellFaceCount;
+    for(IndexType f = 0; f < thisCellFaceCount; ++f)
+    {
+      c2n_ptr[c2foffsets_ptr[c] + f] =
+        otherSide(&f2c_ptr[2 * faceIDs[f]], c);
     }
-  }
-  c2foffsets[cellcount] = cellFaceCount;
+  });
 
   return success;
 }
@@ -56,10 +56,12 @@ std::string make_face_key(int vcount, IndexType* values, char sep);
  * to 0.
  *
  * This routine visits each of the cells of the mesh.  For each cell face, it
- * retrieves the face's nodes and joins the sorted node IDs to make a unique
- * hash key.  The incident cells are recorded in a list for each face's hash
- * key.  The final face-cell and cell-face relations are constructed from this
- * data structure.
+ * retrieves the face's nodes and stores the sorted node IDs in a fixed-size
+ * key.  The cell faces are then sorted by key, which brings together the
+ * cell faces that make up each unique face, and the final face-cell and
+ * cell-face relations are constructed from the sorted keys.  No memory is
+ * allocated per face, and the per-cell and per-face loops and the sort run
+ * in parallel when Axom is built with RAJA and OpenMP.
  *
  * This routine is intended to be used in constructing an UnstructuredMesh's
  * face relations, though it will give correct results for any Mesh.
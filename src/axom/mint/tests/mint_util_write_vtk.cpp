@@ -27,11 +27,18 @@
 
 // C/C++ includes
 #include <cmath>   /* for std::exp */
+#include <cstdint> /* for std::int32_t, std::uint64_t */
+#include <cstring> /* for std::memcpy */
 #include <fstream> /* for std::ifstream */
 #include <iomanip> /* for std::setfill, std::setw */
 #include <string>  /* for std::string */
 #include <sstream> /* for std::stringstream */
 #include <set>     /* for std::set */
+#include <vector>  /* for std::vector */
+
+#ifdef AXOM_USE_ZLIB
+  #include "zlib.h" /* for uncompress */
+#endif
 
 // gtest includes
 #include "gtest/gtest.h"
@@ -824,6 +831,196 @@ void test_mesh(MeshType* mesh, const std::string& path)
 #endif
 }
 
+/*!
+ * \brief Reads count big-endian values of type T from a legacy binary VTK
+ *  file, followed by the newline that ends the data block.
+ * \param [in] file the file to parse.
+ * \param [in] count the number of values to read.
+ */
+template <typename T>
+std::vector<T> read_big_endian(std::ifstream& file, IndexType count)
+{
+  std::vector<T> values(count);
+  file.read(reinterpret_cast<char*>(values.data()), count * sizeof(T));
+  EXPECT_TRUE(file.good());
+  if(utilities::isLittleEndian())
+  {
+    for(T& value : values)
+    {
+      value = utilities::byteswap(value);
+    }
+  }
+  EXPECT_EQ(file.get(), '\n');
+  return values;
+}
+
+/*!
+ * \brief Extracts the data of a named DataArray from the contents of a VTK
+ *  XML file with raw appended data.
+ * \param [in] contents the contents of the file.
+ * \param [in] name the name of the DataArray.
+ * \param [in] compressed true if the file was written with compression.
+ * \return the bytes of the array, decompressed if needed.
+ */
+std::vector<char> read_appended_array(const std::string& contents,
+                                      const std::string& name,
+                                      bool compressed)
+{
+  std::vector<char> bytes;
+
+  const std::size_t tag = contents.find("Name=\"" + name + "\"");
+  EXPECT_NE(tag, std::string::npos);
+  const std::size_t offset_attr = contents.find("offset=\"", tag);
+  EXPECT_NE(offset_attr, std::string::npos);
+  const std::size_t appended = contents.find("<AppendedData encoding=\"raw\">");
+  EXPECT_NE(appended, std::string::npos);
+  if(tag == std::string::npos || offset_attr == std::string::npos ||
+     appended == std::string::npos)
+  {
+    return bytes;
+  }
+
+  const std::uint64_t offset =
+    std::stoull(contents.substr(offset_attr + 8, 20));
+  const char* data =
+    contents.data() + contents.find('_', appended) + 1 + offset;
+
+  auto read_uint64 = [&data]() {
+    std::uint64_t value;
+    std::memcpy(&value, data, sizeof(value));
+    data += sizeof(value);
+    return value;
+  };
+
+  if(!compressed)
+  {
+    const std::uint64_t nbytes = read_uint64();
+    bytes.assign(data, data + nbytes);
+    return bytes;
+  }
+
+#ifdef AXOM_USE_ZLIB
+  const std::uint64_t num_blocks = read_uint64();
+  const std::uint64_t block_size = read_uint64();
+  const std::uint64_t last_block_size = read_uint64();
+  std::vector<std::uint64_t> compressed_sizes(num_blocks);
+  for(auto& size : compressed_sizes)
+  {
+    size = read_uint64();
+  }
+
+  for(std::uint64_t b = 0; b < num_blocks; ++b)
+  {
+    uLongf size = (b + 1 == num_blocks && last_block_size > 0)
+      ? last_block_size
+      : block_size;
+    std::vector<char> block(size);
+    const int rc = uncompress(reinterpret_cast<Bytef*>(block.data()),
+                              &size,
+                              reinterpret_cast<const Bytef*>(data),
+                              compressed_sizes[b]);
+    EXPECT_EQ(rc, Z_OK);
+    bytes.insert(bytes.end(), block.begin(), block.begin() + size);
+    data += compressed_sizes[b];
+  }
+#endif
+
+  return bytes;
+}
+
+/*!
+ * \brief Writes a mesh in the VTK XML format and checks its node coordinates
+ *  and fields against the mesh.
+ * \param [in] mesh the mesh to write out.
+ * \param [in] path the path of the file, without its extension.
+ * \param [in] grid_type the expected VTK XML grid type.
+ * \param [in] compress true to compress the data arrays.
+ * \pre mesh != nullptr
+ */
+void test_xml_mesh(Mesh* mesh,
+                   const std::string& path,
+                   const std::string& grid_type,
+                   bool compress)
+{
+  const std::string file_path = path + vtk_xml_extension(mesh);
+  EXPECT_EQ(write_vtk(mesh, file_path, VTKFormat::XML_APPENDED, compress), 0);
+
+  std::ifstream file(file_path.c_str(), std::ios::binary);
+  ASSERT_TRUE(file);
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  const std::string contents = buffer.str();
+  file.close();
+
+  EXPECT_NE(contents.find("<VTKFile type=\"" + grid_type + "\""),
+            std::string::npos);
+
+  /* Check the node coordinates. */
+  const IndexType num_nodes = mesh->getNumberOfNodes();
+  const int mesh_type = mesh->getMeshType();
+  if(mesh_type == UNSTRUCTURED_MESH || mesh_type == PARTICLE_MESH ||
+     mesh_type == STRUCTURED_CURVILINEAR_MESH)
+  {
+    const std::vector<char> bytes =
+      read_appended_array(contents, "Points", compress);
+    ASSERT_EQ(bytes.size(), 3 * num_nodes * sizeof(double));
+    const double* points = reinterpret_cast<const double*>(bytes.data());
+    for(IndexType idx = 0; idx < num_nodes; ++idx)
+    {
+      double coords[] = {0, 0, 0};
+      mesh->getNode(idx, coords);
+      for(int i = 0; i < 3; ++i)
+      {
+        EXPECT_EQ(points[3 * idx + i], coords[i]);
+      }
+    }
+  }
+
+  /* Check the node and cell fields. */
+  for(int association : {NODE_CENTERED, CELL_CENTERED})
+  {
+    if(association == CELL_CENTERED && mesh_type == PARTICLE_MESH)
+    {
+      continue;
+    }
+
+    const FieldData* field_data = mesh->getFieldData(association);
+    for(int i = 0; i < field_data->getNumFields(); ++i)
+    {
+      const Field* field = field_data->getField(i);
+      const IndexType size = field->getNumTuples() * field->getNumComponents();
+      const std::vector<char> bytes =
+        read_appended_array(contents, field->getName(), compress);
+
+      if(field->getType() == DOUBLE_FIELD_TYPE)
+      {
+        ASSERT_EQ(bytes.size(), size * sizeof(double));
+        const double* expected = Field::getDataPtr<double>(field);
+        const double* actual = reinterpret_cast<const double*>(bytes.data());
+        for(IndexType j = 0; j < size; ++j)
+        {
+          EXPECT_EQ(actual[j], expected[j]);
+        }
+      }
+      else
+      {
+        ASSERT_EQ(field->getType(), INT32_FIELD_TYPE);
+        ASSERT_EQ(bytes.size(), size * sizeof(int));
+        const int* expected = Field::getDataPtr<int>(field);
+        const int* actual = reinterpret_cast<const int*>(bytes.data());
+        for(IndexType j = 0; j < size; ++j)
+        {
+          EXPECT_EQ(actual[j], expected[j]);
+        }
+      }
+    }
+  }
+
+#if DELETE_VTK_FILES
+  axom::utilities::filesystem::removeFile(file_path);
+#endif
+}
+
 } /* end namespace internal */
 
 //------------------------------------------------------------------------------
@@ -931,6 +1128,142 @@ TEST(mint_util_write_vtk, ParticleMesh)
   }
 }
 
+/*!
+ * \brief Creates a mixed UnstructuredMesh and writes it out to disk using
+ *  the legacy binary format and then reads the file back in to check for
+ *  correctness.
+ */
+TEST(mint_util_write_vtk, UnstructuredMeshLegacyBinary)
+{
+  for(int dim = 1; dim <= 3; ++dim)
+  {
+    const std::string path =
+      "unstructuredMeshBinary" + std::to_string(dim) + "D.vtk";
+    Mesh* mesh = internal::build_mesh<UNSTRUCTURED_MESH, MIXED_SHAPE>(dim);
+    internal::create_scalar_data(mesh);
+    EXPECT_EQ(write_vtk(mesh, path, VTKFormat::LEGACY_BINARY), 0);
+
+    std::ifstream file(path.c_str(), std::ios::binary);
+    ASSERT_TRUE(file);
+
+    std::string buffer;
+    std::getline(file, buffer);
+    EXPECT_EQ(buffer, "# vtk DataFile Version 3.0");
+    std::getline(file, buffer);
+    std::getline(file, buffer);
+    EXPECT_EQ(buffer, "BINARY");
+    std::getline(file, buffer);
+    EXPECT_EQ(buffer, "DATASET UNSTRUCTURED_GRID");
+
+    /* Check the node coordinates. */
+    const IndexType num_nodes = mesh->getNumberOfNodes();
+    std::getline(file, buffer);
+    EXPECT_EQ(buffer, "POINTS " + std::to_string(num_nodes) + " double");
+    const std::vector<double> points =
+      internal::read_big_endian<double>(file, 3 * num_nodes);
+    for(IndexType idx = 0; idx < num_nodes; ++idx)
+    {
+      double coords[] = {0, 0, 0};
+      mesh->getNode(idx, coords);
+      for(int i = 0; i < 3; ++i)
+      {
+        EXPECT_EQ(points[3 * idx + i], coords[i]);
+      }
+    }
+
+    /* Check the cell connectivity and types. */
+    const IndexType num_cells = mesh->getNumberOfCells();
+    std::string type;
+    IndexType extracted_cells, extracted_size;
+    file >> type >> extracted_cells >> extracted_size;
+    EXPECT_EQ(type, "CELLS");
+    EXPECT_EQ(extracted_cells, num_cells);
+    EXPECT_EQ(file.get(), '\n');
+
+    const std::vector<std::int32_t> cells =
+      internal::read_big_endian<std::int32_t>(file, extracted_size);
+    IndexType pos = 0;
+    IndexType cell_nodes[MAX_CELL_NODES];
+    for(IndexType cellIdx = 0; cellIdx < num_cells; ++cellIdx)
+    {
+      const IndexType num_cell_nodes =
+        mesh->getCellNodeIDs(cellIdx, cell_nodes);
+      EXPECT_EQ(cells[pos++], num_cell_nodes);
+      for(IndexType i = 0; i < num_cell_nodes; ++i)
+      {
+        EXPECT_EQ(cells[pos++], cell_nodes[i]);
+      }
+    }
+    EXPECT_EQ(pos, extracted_size);
+
+    file >> type >> extracted_cells;
+    EXPECT_EQ(type, "CELL_TYPES");
+    EXPECT_EQ(file.get(), '\n');
+    const std::vector<std::int32_t> types =
+      internal::read_big_endian<std::int32_t>(file, num_cells);
+    for(IndexType cellIdx = 0; cellIdx < num_cells; ++cellIdx)
+    {
+      const CellType cell_type = mesh->getCellType(cellIdx);
+      EXPECT_EQ(types[cellIdx], getCellInfo(cell_type).vtk_type);
+    }
+
+    file.close();
+    delete mesh;
+#if DELETE_VTK_FILES
+    axom::utilities::filesystem::removeFile(path);
+#endif
+  }
+}
+
+/*!
+ * \brief Creates meshes of each type and writes them out to disk using the
+ *  VTK XML format, with and without compression, and then reads the files
+ *  back in to check for correctness.
+ */
+TEST(mint_util_write_vtk, XMLAppended)
+{
+  std::vector<bool> compress_options = {false};
+#ifdef AXOM_USE_ZLIB
+  compress_options.push_back(true);
+#endif
+
+  for(bool compress : compress_options)
+  {
+    const std::string suffix = compress ? "_zlib" : "";
+    for(int dim = 1; dim <= 3; ++dim)
+    {
+      const std::string dim_str = std::to_string(dim) + "D" + suffix;
+      Mesh* meshes[] = {
+        internal::build_mesh<STRUCTURED_UNIFORM_MESH>(dim),
+        internal::build_mesh<STRUCTURED_RECTILINEAR_MESH>(dim),
+        internal::build_mesh<STRUCTURED_CURVILINEAR_MESH>(dim),
+        internal::build_mesh<UNSTRUCTURED_MESH, MIXED_SHAPE>(dim),
+        internal::build_mesh<PARTICLE_MESH>(dim)};
+      const std::string names[] = {"uniformMesh",
+                                   "rectilinearMesh",
+                                   "curvilinearMesh",
+                                   "unstructuredMesh",
+                                   "particleMesh"};
+      const std::string grid_types[] = {"ImageData",
+                                        "RectilinearGrid",
+                                        "StructuredGrid",
+                                        "UnstructuredGrid",
+                                        "UnstructuredGrid"};
+
+      for(int m = 0; m < 5; ++m)
+      {
+        internal::create_scalar_data(meshes[m]);
+        internal::create_vector_data(meshes[m]);
+        internal::test_xml_mesh(meshes[m],
+                                names[m] + dim_str,
+                                grid_types[m],
+                                compress);
+        delete meshes[m];
+      }
+    }
+  }
+}
+
 } /* end namespace mint */
 } /* end namespace axom */
 
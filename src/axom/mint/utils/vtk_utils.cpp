@@ -26,9 +26,18 @@
 
 #include "axom/fmt.hpp"
 
+#ifdef AXOM_USE_ZLIB
+  #include "zlib.h"  // for compress2
+#endif
+
 // C/C++ includes
-#include <fstream>  // for std::ofstream
-#include <string>   // for std::string
+#include <algorithm>   // for std::min
+#include <cstdint>     // for fixed-width types
+#include <fstream>     // for std::ofstream
+#include <functional>  // for std::function
+#include <string>      // for std::string
+#include <type_traits> // for std::remove_pointer
+#include <vector>      // for std::vector
 
 namespace axom
 {
@@ -78,13 +87,383 @@ IndexType get_max_cell_nodes(const Mesh* mesh, IndexType& total_cell_nodes)
   return max_cell_nodes;
 }
 
+/// Size in bytes of the blocks in which binary data is staged and compressed
+constexpr std::size_t VTK_BLOCK_BYTES = 1 << 20;
+
+/// Number of digits of the offsets of the appended arrays in VTK XML files
+constexpr int VTK_XML_OFFSET_DIGITS = 20;
+
+/*!
+ * \brief Traits class holding the names of the VTK binary data types.
+ */
+template <typename T>
+struct vtk_binary_type;
+
+template <>
+struct vtk_binary_type<float>
+{
+  static const char* legacy() { return "float"; }
+  static const char* xml() { return "Float32"; }
+};
+
+template <>
+struct vtk_binary_type<double>
+{
+  static const char* legacy() { return "double"; }
+  static const char* xml() { return "Float64"; }
+};
+
+template <>
+struct vtk_binary_type<std::int32_t>
+{
+  static const char* legacy() { return "int"; }
+  static const char* xml() { return "Int32"; }
+};
+
+template <>
+struct vtk_binary_type<std::int64_t>
+{
+  static const char* legacy() { return "vtktypeint64"; }
+  static const char* xml() { return "Int64"; }
+};
+
+template <>
+struct vtk_binary_type<std::uint8_t>
+{
+  static const char* legacy() { return "unsigned_char"; }
+  static const char* xml() { return "UInt8"; }
+};
+
+/*!
+ * \brief Writes the bytes of one binary data array to a VTK file.
+ *
+ *  In the legacy format, the bytes are written as is. In the XML format,
+ *  the array is preceded by its size in bytes or, when compressed, split into
+ *  blocks that are compressed with zlib as they are filled and preceded by
+ *  the block sizes expected by vtkZLibDataCompressor.
+ */
+class ArraySink
+{
+public:
+  enum class Encoding
+  {
+    LEGACY,
+    XML_RAW,
+    XML_ZLIB
+  };
+
+  /*!
+   * \brief Starts writing an array of nbytes bytes to the given file.
+   */
+  ArraySink(std::ofstream& file, Encoding encoding, std::uint64_t nbytes)
+    : m_file(file)
+    , m_encoding(encoding)
+    , m_nbytes(nbytes)
+  {
+    if(m_encoding == Encoding::XML_RAW)
+    {
+      writeHeader(&nbytes, 1);
+    }
+    else if(m_encoding == Encoding::XML_ZLIB)
+    {
+      // Reserve space for the header, which is filled in by finish()
+      const std::uint64_t num_blocks =
+        (nbytes + VTK_BLOCK_BYTES - 1) / VTK_BLOCK_BYTES;
+      m_header_pos = m_file.tellp();
+      std::vector<std::uint64_t> header(3 + num_blocks, 0);
+      writeHeader(header.data(), header.size());
+      m_block.reserve(VTK_BLOCK_BYTES);
+    }
+  }
+
+  /*!
+   * \brief Appends nbytes bytes to the array.
+   */
+  void write(const void* data, std::size_t nbytes)
+  {
+    const char* bytes = static_cast<const char*>(data);
+    m_written += nbytes;
+    SLIC_ASSERT(m_written <= m_nbytes);
+
+    if(m_encoding != Encoding::XML_ZLIB)
+    {
+      m_file.write(bytes, nbytes);
+      return;
+    }
+
+    while(nbytes > 0)
+    {
+      if(m_block.empty() && nbytes >= VTK_BLOCK_BYTES)
+      {
+        // short-circuit: compress full blocks in place
+        compressBlock(bytes, VTK_BLOCK_BYTES);
+        bytes += VTK_BLOCK_BYTES;
+        nbytes -= VTK_BLOCK_BYTES;
+        continue;
+      }
+
+      const std::size_t n = std::min(nbytes, VTK_BLOCK_BYTES - m_block.size());
+      m_block.insert(m_block.end(), bytes, bytes + n);
+      bytes += n;
+      nbytes -= n;
+
+      if(m_block.size() == VTK_BLOCK_BYTES)
+      {
+        compressBlock(m_block.data(), m_block.size());
+        m_block.clear();
+      }
+    }
+  }
+
+  /*!
+   * \brief Completes the array once all its bytes have been written.
+   */
+  void finish()
+  {
+    SLIC_ASSERT(m_written == m_nbytes);
+    if(m_encoding != Encoding::XML_ZLIB)
+    {
+      return;
+    }
+
+    if(!m_block.empty())
+    {
+      compressBlock(m_block.data(), m_block.size());
+      m_block.clear();
+    }
+
+    std::vector<std::uint64_t> header(3 + m_compressed_sizes.size());
+    header[0] = m_compressed_sizes.size();
+    header[1] = VTK_BLOCK_BYTES;
+    header[2] = m_nbytes % VTK_BLOCK_BYTES;
+    std::copy(m_compressed_sizes.begin(),
+              m_compressed_sizes.end(),
+              header.begin() + 3);
+
+    const std::streampos end = m_file.tellp();
+    m_file.seekp(m_header_pos);
+    writeHeader(header.data(), header.size());
+    m_file.seekp(end);
+  }
+
+private:
+  void writeHeader(const std::uint64_t* values, std::size_t count)
+  {
+    m_file.write(reinterpret_cast<const char*>(values),
+                 count * sizeof(std::uint64_t));
+  }
+
+  void compressBlock(const char* bytes, std::size_t nbytes)
+  {
+#ifdef AXOM_USE_ZLIB
+    // Favor speed over size, since the data is typically written every
+    // few timesteps.
+    uLongf compressed_size = compressBound(static_cast<uLong>(nbytes));
+    m_compressed.resize(compressed_size);
+    const int rc = compress2(reinterpret_cast<Bytef*>(m_compressed.data()),
+                             &compressed_size,
+                             reinterpret_cast<const Bytef*>(bytes),
+                             static_cast<uLong>(nbytes),
+                             Z_BEST_SPEED);
+    SLIC_ERROR_IF(rc != Z_OK, "zlib compression failed with code " << rc);
+
+    m_file.write(m_compressed.data(), compressed_size);
+    m_compressed_sizes.push_back(compressed_size);
+#else
+    AXOM_UNUSED_VAR(bytes);
+    AXOM_UNUSED_VAR(nbytes);
+    SLIC_ERROR("Compressed VTK output requires Axom to be built with zlib");
+#endif
+  }
+
+  std::ofstream& m_file;
+  Encoding m_encoding;
+  std::uint64_t m_nbytes;
+  std::uint64_t m_written {0};
+
+  std::streampos m_header_pos {0};
+  std::vector<char> m_block;
+  std::vector<char> m_compressed;
+  std::vector<std::uint64_t> m_compressed_sizes;
+};
+
+/*!
+ * \brief Writes n values of type T to the given sink through a fixed-size
+ *  staging buffer.
+ *
+ * \param [in] sink the sink to write to.
+ * \param [in] n the number of values to write.
+ * \param [in] swap reverse the bytes of each value, i.e., for the big-endian
+ *  legacy format on a little-endian host.
+ * \param [in] gen a functor returning the i-th value, which is called once
+ *  per value, in order.
+ */
+template <typename T, typename Generator>
+void write_staged(ArraySink& sink, IndexType n, bool swap, Generator&& gen)
+{
+  const IndexType capacity =
+    static_cast<IndexType>(VTK_BLOCK_BYTES / sizeof(T));
+  std::vector<T> stage(std::min(n, capacity));
+
+  for(IndexType start = 0; start < n; start += capacity)
+  {
+    const IndexType count = std::min(capacity, n - start);
+    for(IndexType i = 0; i < count; ++i)
+    {
+      const T value = static_cast<T>(gen(start + i));
+      stage[i] = swap ? utilities::byteswap(value) : value;
+    }
+    sink.write(stage.data(), count * sizeof(T));
+  }
+}
+
+/*!
+ * \brief Writes n contiguous values of type T to the given sink, directly
+ *  from the given buffer unless their bytes need to be swapped.
+ */
+template <typename T>
+void write_contiguous(ArraySink& sink, const T* data, IndexType n, bool swap)
+{
+  if(swap)
+  {
+    write_staged<T>(sink, n, true, [=](IndexType i) { return data[i]; });
+  }
+  else
+  {
+    sink.write(data, n * sizeof(T));
+  }
+}
+
+/*!
+ * \brief Writes the node IDs of the mesh cells, as values of type T, to the
+ *  given sink.
+ *
+ * \param [in] mesh the mesh whose cells will be written.
+ * \param [in] sink the sink to write to.
+ * \param [in] with_counts precede the nodes of each cell by their number,
+ *  as in the legacy format.
+ * \param [in] swap reverse the bytes of each value.
+ * \pre mesh != nullptr
+ */
+template <typename T>
+void write_cell_nodes(const Mesh* mesh,
+                      ArraySink& sink,
+                      bool with_counts,
+                      bool swap)
+{
+  SLIC_ASSERT(mesh != nullptr);
+  const IndexType num_cells = mesh->getNumberOfCells();
+  const std::size_t flush_size = VTK_BLOCK_BYTES / sizeof(T);
+
+  std::vector<T> stage;
+  stage.reserve(flush_size + MAX_CELL_NODES + 1);
+  auto push = [&](IndexType value) {
+    const T t = static_cast<T>(value);
+    stage.push_back(swap ? utilities::byteswap(t) : t);
+  };
+
+  IndexType cell_nodes[MAX_CELL_NODES];
+  for(IndexType cellIdx = 0; cellIdx < num_cells; ++cellIdx)
+  {
+    const IndexType num_cell_nodes = mesh->getCellNodeIDs(cellIdx, cell_nodes);
+    if(with_counts)
+    {
+      push(num_cell_nodes);
+    }
+    for(IndexType i = 0; i < num_cell_nodes; ++i)
+    {
+      push(cell_nodes[i]);
+    }
+
+    if(stage.size() >= flush_size)
+    {
+      sink.write(stage.data(), stage.size() * sizeof(T));
+      stage.clear();
+    }
+  }
+
+  if(!stage.empty())
+  {
+    sink.write(stage.data(), stage.size() * sizeof(T));
+  }
+}
+
 /*!
- * \brief Writes mesh node locations to a VTK file in legacy ASCII format.
+ * \brief Writes the VTK type of each mesh cell, as a value of type T, to the
+ *  given sink.
+ * \pre mesh != nullptr
+ */
+template <typename T>
+void write_cell_types(const Mesh* mesh, ArraySink& sink, bool swap)
+{
+  SLIC_ASSERT(mesh != nullptr);
+  write_staged<T>(sink, mesh->getNumberOfCells(), swap, [=](IndexType i) {
+    return getCellInfo(mesh->getCellType(i)).vtk_type;
+  });
+}
+
+/*!
+ * \brief Writes the node coordinates of the mesh to the given sink, as
+ *  interleaved (x,y,z) triplets padded with zeros in lower dimensions.
+ * \pre mesh != nullptr
+ */
+void write_interleaved_points(const Mesh* mesh, ArraySink& sink, bool swap)
+{
+  SLIC_ASSERT(mesh != nullptr);
+  const int mesh_dim = mesh->getDimension();
+
+  const double* xyz[3] = {
+    mesh->getCoordinateArray(X_COORDINATE),
+    (mesh_dim > 1) ? mesh->getCoordinateArray(Y_COORDINATE) : nullptr,
+    (mesh_dim > 2) ? mesh->getCoordinateArray(Z_COORDINATE) : nullptr};
+  SLIC_ASSERT(xyz[0] != nullptr);
+
+  write_staged<double>(sink,
+                       3 * mesh->getNumberOfNodes(),
+                       swap,
+                       [&](IndexType i) {
+                         const double* coords = xyz[i % 3];
+                         return (coords != nullptr) ? coords[i / 3] : 0.0;
+                       });
+}
+
+/*!
+ * \brief Calls func with the typed data pointer of the given field.
+ * \return true if the field has a supported type, false otherwise.
+ * \pre field != nullptr
+ */
+template <typename Function>
+bool dispatch_field(const Field* field, Function&& func)
+{
+  SLIC_ASSERT(field != nullptr);
+
+  switch(field->getType())
+  {
+  case FLOAT_FIELD_TYPE:
+    func(Field::getDataPtr<float>(field));
+    return true;
+  case DOUBLE_FIELD_TYPE:
+    func(Field::getDataPtr<double>(field));
+    return true;
+  case INT32_FIELD_TYPE:
+    func(Field::getDataPtr<std::int32_t>(field));
+    return true;
+  case INT64_FIELD_TYPE:
+    func(Field::getDataPtr<std::int64_t>(field));
+    return true;
+  default:
+    return false;
+  }
+}
+
+/*!
+ * \brief Writes mesh node locations to a VTK file in legacy format.
  * \param [in] mesh the mesh whose nodes will be written.
  * \param [in] file the stream to write to.
+ * \param [in] binary use the binary rather than the ASCII encoding.
  * \pre mesh != nullptr
  */
-void write_points(const Mesh* mesh, std::ofstream& file)
+void write_points(const Mesh* mesh, std::ofstream& file, bool binary)
 {
   SLIC_ASSERT(mesh != nullptr);
   const IndexType num_nodes = mesh->getNumberOfNodes();
@@ -99,6 +478,17 @@ void write_points(const Mesh* mesh, std::ofstream& file)
     (mesh_dim > 2) ? mesh->getCoordinateArray(Z_COORDINATE) : nullptr;
 
   fmt::print(file, "POINTS {} double\n", num_nodes);
+  if(binary)
+  {
+    ArraySink sink(file,
+                   ArraySink::Encoding::LEGACY,
+                   3 * num_nodes * sizeof(double));
+    write_interleaved_points(mesh, sink, utilities::isLittleEndian());
+    sink.finish();
+    fmt::print(file, "\n");
+    return;
+  }
+
   for(IndexType nodeIdx = 0; nodeIdx < num_nodes; ++nodeIdx)
   {
     double xx = x[nodeIdx];
@@ -110,12 +500,13 @@ void write_points(const Mesh* mesh, std::ofstream& file)
 
 /*!
  * \brief Writes mesh cell connectivity and type to a VTK file
- *  using the legacy ASCII format.
+ *  using the legacy format.
  * \param [in] mesh the mesh whose cells will be written.
  * \param [in] file the stream to write to.
+ * \param [in] binary use the binary rather than the ASCII encoding.
  * \pre mesh != nullptr
  */
-void write_cells(const Mesh* mesh, std::ofstream& file)
+void write_cells(const Mesh* mesh, std::ofstream& file, bool binary)
 {
   SLIC_ASSERT(mesh != nullptr);
   const IndexType num_cells = mesh->getNumberOfCells();
@@ -127,6 +518,26 @@ void write_cells(const Mesh* mesh, std::ofstream& file)
 
   fmt::print(file, "CELLS {} {}\n", num_cells, total_size);
 
+  if(binary)
+  {
+    const bool swap = utilities::isLittleEndian();
+
+    ArraySink cells_sink(file,
+                         ArraySink::Encoding::LEGACY,
+                         total_size * sizeof(std::int32_t));
+    write_cell_nodes<std::int32_t>(mesh, cells_sink, true, swap);
+    cells_sink.finish();
+
+    fmt::print(file, "\nCELL_TYPES {}\n", num_cells);
+    ArraySink types_sink(file,
+                         ArraySink::Encoding::LEGACY,
+                         num_cells * sizeof(std::int32_t));
+    write_cell_types<std::int32_t>(mesh, types_sink, swap);
+    types_sink.finish();
+    fmt::print(file, "\n");
+    return;
+  }
+
   /* Write out the mesh cell connectivity. */
   IndexType* cell_nodes = new IndexType[max_cell_nodes];
   for(IndexType cellIdx = 0; cellIdx < num_cells; ++cellIdx)
@@ -188,13 +599,15 @@ void write_dimensions(const StructuredMesh* mesh, std::ofstream& file)
 }
 
 /*!
- * \brief Writes a rectilinear mesh to a VTK file using the legacy
- *  ASCII format.
+ * \brief Writes a rectilinear mesh to a VTK file using the legacy format.
  * \param [in] mesh the rectilinear mesh to write out.
  * \param [in] file the stream to write to.
+ * \param [in] binary use the binary rather than the ASCII encoding.
  * \pre mesh != nullptr
  */
-void write_rectilinear_mesh(const RectilinearMesh* mesh, std::ofstream& file)
+void write_rectilinear_mesh(const RectilinearMesh* mesh,
+                            std::ofstream& file,
+                            bool binary)
 {
   SLIC_ASSERT(mesh != nullptr);
 
@@ -211,13 +624,38 @@ void write_rectilinear_mesh(const RectilinearMesh* mesh, std::ofstream& file)
                coord_names[dim],
                mesh->getNodeResolution(dim));
     const double* coords = mesh->getCoordinateArray(dim);
-    fmt::print(file,
-               "{}\n",
-               fmt::join(coords, coords + mesh->getNodeResolution(dim), " "));
+    if(binary)
+    {
+      const IndexType num_coords = mesh->getNodeResolution(dim);
+      ArraySink sink(file,
+                     ArraySink::Encoding::LEGACY,
+                     num_coords * sizeof(double));
+      write_contiguous(sink, coords, num_coords, utilities::isLittleEndian());
+      sink.finish();
+      fmt::print(file, "\n");
+    }
+    else
+    {
+      fmt::print(file,
+                 "{}\n",
+                 fmt::join(coords, coords + mesh->getNodeResolution(dim), " "));
+    }
   }
   for(int dim = mesh->getDimension(); dim < 3; ++dim)
   {
-    fmt::print(file, "{} 1 double\n0.0\n", coord_names[dim]);
+    fmt::print(file, "{} 1 double\n", coord_names[dim]);
+    if(binary)
+    {
+      const double zero = 0.0;
+      ArraySink sink(file, ArraySink::Encoding::LEGACY, sizeof(double));
+      write_contiguous(sink, &zero, 1, utilities::isLittleEndian());
+      sink.finish();
+      fmt::print(file, "\n");
+    }
+    else
+    {
+      fmt::print(file, "0.0\n");
+    }
   }
 }
 
@@ -248,7 +686,8 @@ void write_uniform_mesh(const UniformMesh* mesh, std::ofstream& file)
 template <typename T>
 void write_scalar_helper(const std::string& type,
                          const Field* field,
-                         std::ofstream& file)
+                         std::ofstream& file,
+                         bool binary)
 {
   const T* data_ptr = Field::getDataPtr<T>(field);
   SLIC_ASSERT(data_ptr != nullptr);
@@ -257,18 +696,27 @@ void write_scalar_helper(const std::string& type,
   fmt::print(file, fmt::format("{}\n", type));
   fmt::print(file, "LOOKUP_TABLE default\n");
   const IndexType num_values = field->getNumTuples();
+  if(binary)
+  {
+    ArraySink sink(file, ArraySink::Encoding::LEGACY, num_values * sizeof(T));
+    write_contiguous(sink, data_ptr, num_values, utilities::isLittleEndian());
+    sink.finish();
+    fmt::print(file, "\n");
+    return;
+  }
   fmt::print(file, "{}\n", fmt::join(data_ptr, data_ptr + num_values, "\n"));
 }
 
 /*!
- * \brief Writes a scalar field to a VTK file using the legacy ASCII format
+ * \brief Writes a scalar field to a VTK file using the legacy format
  *
  * \param [in] field the scalar field to write out.
  * \param [in] file the stream to write to.
+ * \param [in] binary use the binary rather than the ASCII encoding.
  * \pre field != nullptr
  * \pre field->getNumComponents() == 1
  */
-void write_scalar_data(const Field* field, std::ofstream& file)
+void write_scalar_data(const Field* field, std::ofstream& file, bool binary)
 {
   SLIC_ASSERT(field != nullptr);
   SLIC_ASSERT(field->getNumComponents() == 1);
@@ -276,16 +724,20 @@ void write_scalar_data(const Field* field, std::ofstream& file)
   switch(field->getType())
   {
   case FLOAT_FIELD_TYPE:
-    write_scalar_helper<float>("float", field, file);
+    write_scalar_helper<float>("float", field, file, binary);
     break;
   case DOUBLE_FIELD_TYPE:
-    write_scalar_helper<double>("double", field, file);
+    write_scalar_helper<double>("double", field, file, binary);
     break;
   case INT32_FIELD_TYPE:
-    write_scalar_helper<std::int32_t>("int", field, file);
+    write_scalar_helper<std::int32_t>("int", field, file, binary);
     break;
   case INT64_FIELD_TYPE:
-    write_scalar_helper<std::int64_t>("long", field, file);
+    write_scalar_helper<std::int64_t>(
+      binary ? vtk_binary_type<std::int64_t>::legacy() : "long",
+      field,
+      file,
+      binary);
     break;
   default:
     SLIC_WARNING(
@@ -303,7 +755,8 @@ void write_scalar_data(const Field* field, std::ofstream& file)
 template <typename T>
 void write_vector_helper(const std::string& type,
                          const Field* field,
-                         std::ofstream& file)
+                         std::ofstream& file,
+                         bool binary)
 {
   const T* data_ptr = Field::getDataPtr<T>(field);
   SLIC_ASSERT(data_ptr != nullptr);
@@ -313,6 +766,25 @@ void write_vector_helper(const std::string& type,
 
   const int num_components = field->getNumComponents();
   const IndexType num_values = field->getNumTuples();
+  if(binary)
+  {
+    // VTK vectors always have three components
+    ArraySink sink(file,
+                   ArraySink::Encoding::LEGACY,
+                   3 * num_values * sizeof(T));
+    write_staged<T>(sink,
+                    3 * num_values,
+                    utilities::isLittleEndian(),
+                    [=](IndexType i) {
+                      const int comp = static_cast<int>(i % 3);
+                      return (comp < num_components)
+                        ? data_ptr[num_components * (i / 3) + comp]
+                        : T(0);
+                    });
+    sink.finish();
+    fmt::print(file, "\n");
+    return;
+  }
   for(IndexType i = 0; i < num_values; ++i)
   {
     fmt::print(file,
@@ -324,14 +796,15 @@ void write_vector_helper(const std::string& type,
 }
 
 /*!
- * \brief Writes a vector field to a VTK file using the legacy ASCII format
+ * \brief Writes a vector field to a VTK file using the legacy format
  *
  * \param [in] field the vector field to write out.
  * \param [in] file the stream to write to.
+ * \param [in] binary use the binary rather than the ASCII encoding.
  * \pre field != nullptr
  * \pre field->getNumComponents() == 2 || field->getNumComponents() == 3
  */
-void write_vector_data(const Field* field, std::ofstream& file)
+void write_vector_data(const Field* field, std::ofstream& file, bool binary)
 {
   SLIC_ASSERT(field != nullptr);
   const int num_components = field->getNumComponents();
@@ -341,16 +814,20 @@ void write_vector_data(const Field* field, std::ofstream& file)
   switch(field->getType())
   {
   case FLOAT_FIELD_TYPE:
-    write_vector_helper<float>("float", field, file);
+    write_vector_helper<float>("float", field, file, binary);
     break;
   case DOUBLE_FIELD_TYPE:
-    write_vector_helper<double>("double", field, file);
+    write_vector_helper<double>("double", field, file, binary);
     break;
   case INT32_FIELD_TYPE:
-    write_vector_helper<std::int32_t>("int", field, file);
+    write_vector_helper<std::int32_t>("int", field, file, binary);
     break;
   case INT64_FIELD_TYPE:
-    write_vector_helper<std::int64_t>("long", field, file);
+    write_vector_helper<std::int64_t>(
+      binary ? vtk_binary_type<std::int64_t>::legacy() : "long",
+      field,
+      file,
+      binary);
     break;
   default:
     SLIC_WARNING(
@@ -368,7 +845,8 @@ void write_vector_data(const Field* field, std::ofstream& file)
 template <typename T>
 void write_multidim_helper(const std::string& type,
                            const Field* field,
-                           std::ofstream& file)
+                           std::ofstream& file,
+                           bool binary)
 {
   const T* data_ptr = Field::getDataPtr<T>(field);
   SLIC_ASSERT(data_ptr != nullptr);
@@ -382,6 +860,22 @@ void write_multidim_helper(const std::string& type,
     fmt::print(file, "SCALARS {}_{:0>3} {}\n", field->getName(), cur_comp, type);
     fmt::print(file, "LOOKUP_TABLE default\n");
 
+    if(binary)
+    {
+      ArraySink sink(file,
+                     ArraySink::Encoding::LEGACY,
+                     num_values * sizeof(T));
+      write_staged<T>(sink,
+                      num_values,
+                      utilities::isLittleEndian(),
+                      [=](IndexType i) {
+                        return data_ptr[num_components * i + cur_comp];
+                      });
+      sink.finish();
+      fmt::print(file, "\n");
+      continue;
+    }
+
     for(IndexType i = 0; i < num_values; ++i)
     {
       fmt::print(file, "{}\n", data_ptr[num_components * i + cur_comp]);
@@ -391,29 +885,34 @@ void write_multidim_helper(const std::string& type,
 
 /*!
  * \brief Writes a multidimensional field to a VTK file using the legacy
- *  ASCII format.
+ *  format.
  * \param [in] field the multidimensional field to write out.
  * \param [in] file the stream to write to.
+ * \param [in] binary use the binary rather than the ASCII encoding.
  * \pre field != nullptr
  * \pre field->getNumComponents > 3
  */
-void write_multidim_data(const Field* field, std::ofstream& file)
+void write_multidim_data(const Field* field, std::ofstream& file, bool binary)
 {
   SLIC_ASSERT(field != nullptr);
 
   switch(field->getType())
   {
   case FLOAT_FIELD_TYPE:
-    write_multidim_helper<float>("float", field, file);
+    write_multidim_helper<float>("float", field, file, binary);
     break;
   case DOUBLE_FIELD_TYPE:
-    write_multidim_helper<double>("double", field, file);
+    write_multidim_helper<double>("double", field, file, binary);
     break;
   case INT32_FIELD_TYPE:
-    write_multidim_helper<std::int32_t>("int", field, file);
+    write_multidim_helper<std::int32_t>("int", field, file, binary);
     break;
   case INT64_FIELD_TYPE:
-    write_multidim_helper<std::int64_t>("long", field, file);
+    write_multidim_helper<std::int64_t>(
+      binary ? vtk_binary_type<std::int64_t>::legacy() : "long",
+      field,
+      file,
+      binary);
     break;
   default:
     SLIC_WARNING(
@@ -425,15 +924,17 @@ void write_multidim_data(const Field* field, std::ofstream& file)
 }
 
 /*!
- * \brief Writes mesh FieldData to a VTK file using the legacy ASCII format.
+ * \brief Writes mesh FieldData to a VTK file using the legacy format.
  * \param [in] field_data the data to write out.
  * \param [in] num_values the number of tuples each field is expected to have.
  * \param [in] file the stream to write to.
+ * \param [in] binary use the binary rather than the ASCII encoding.
  * \pre field_data != nullptr
  */
 void write_data(const FieldData* field_data,
                 IndexType AXOM_DEBUG_PARAM(num_values),
-                std::ofstream& file)
+                std::ofstream& file,
+                bool binary)
 {
   const int numFields = field_data->getNumFields();
   for(int i = 0; i < numFields; ++i)
@@ -449,15 +950,15 @@ void write_data(const FieldData* field_data,
 
     if(num_components == 1)
     {
-      write_scalar_data(field, file);
+      write_scalar_data(field, file, binary);
     }
     else if(num_components == 2 || num_components == 3)
     {
-      write_vector_data(field, file);
+      write_vector_data(field, file, binary);
     }
     else if(num_components > 3)
     {
-      write_multidim_data(field, file);
+      write_multidim_data(field, file, binary);
     }
     else
     {
@@ -466,58 +967,56 @@ void write_data(const FieldData* field_data,
   }
 }
 
-} /* namespace internal */
-
-//------------------------------------------------------------------------------
-int write_vtk(const Mesh* mesh, const std::string& file_path)
+/*!
+ * \brief Writes the legacy VTK file of a mesh.
+ *
+ * \param [in] mesh the mesh to write out.
+ * \param [in] file the stream to write to.
+ * \param [in] binary use the binary rather than the ASCII encoding.
+ * \return an error code, zero signifies a successful write.
+ *
+ * \pre mesh != nullptr
+ */
+int write_legacy(const Mesh* mesh, std::ofstream& file, bool binary)
 {
   SLIC_ASSERT(mesh != nullptr);
   int mesh_type = mesh->getMeshType();
 
-  std::ofstream file(file_path.c_str());
-  if(!file.good())
-  {
-    SLIC_WARNING("Could not open file at path " << file_path);
-    return -1;
-  }
-
   /* Write the VTK header */
   file << "# vtk DataFile Version 3.0\n";
   file << "Mesh generated by axom::mint::write_vtk\n";
-  file << "ASCII\n";
+  file << (binary ? "BINARY\n" : "ASCII\n");
 
   /* Write out the mesh node and cell coordinates. */
   if(mesh_type == mint::UNSTRUCTURED_MESH || mesh_type == mint::PARTICLE_MESH)
   {
     file << "DATASET UNSTRUCTURED_GRID\n";
-    internal::write_points(mesh, file);
-    internal::write_cells(mesh, file);
+    write_points(mesh, file, binary);
+    write_cells(mesh, file, binary);
   }
   else if(mesh_type == mint::STRUCTURED_CURVILINEAR_MESH)
   {
     file << "DATASET STRUCTURED_GRID\n";
     const StructuredMesh* struc_mesh = dynamic_cast<const StructuredMesh*>(mesh);
-    internal::write_dimensions(struc_mesh, file);
-    internal::write_points(struc_mesh, file);
+    write_dimensions(struc_mesh, file);
+    write_points(struc_mesh, file, binary);
   }
   else if(mesh_type == mint::STRUCTURED_RECTILINEAR_MESH)
   {
     file << "DATASET RECTILINEAR_GRID\n";
     const RectilinearMesh* rect_mesh = dynamic_cast<const RectilinearMesh*>(mesh);
-    internal::write_rectilinear_mesh(rect_mesh, file);
+    write_rectilinear_mesh(rect_mesh, file, binary);
   }
   else if(mesh_type == mint::STRUCTURED_UNIFORM_MESH)
   {
     file << "DATASET STRUCTURED_POINTS\n";
     const UniformMesh* uniform_mesh = dynamic_cast<const UniformMesh*>(mesh);
-    internal::write_uniform_mesh(uniform_mesh, file);
+    write_uniform_mesh(uniform_mesh, file);
   }
   else
   {
     SLIC_WARNING("Mesh does not have a proper type (" << mesh_type << ") "
                                                       << "write aborted.");
-    file.close();
-    remove(file_path.c_str());
     return -1;
   }
 
@@ -527,7 +1026,7 @@ int write_vtk(const Mesh* mesh, const std::string& file_path)
   if(node_data->getNumFields() > 0)
   {
     fmt::print(file, "POINT_DATA {}\n", num_nodes);
-    internal::write_data(node_data, num_nodes, file);
+    write_data(node_data, num_nodes, file, binary);
   }
 
   /* Write out the cell data if any. */
@@ -538,14 +1037,465 @@ int write_vtk(const Mesh* mesh, const std::string& file_path)
     if(cell_data->getNumFields() > 0)
     {
       fmt::print(file, "CELL_DATA {}\n", num_cells);
-      internal::write_data(cell_data, num_cells, file);
+      write_data(cell_data, num_cells, file, binary);
     }
   }
 
-  file.close();
   return 0;
 }
 
+/*!
+ * \brief Writes the header of the DataArray elements of a VTK XML file and
+ *  appends their data at the end of the file.
+ *
+ *  The offsets of the arrays in the appended data are only known once the
+ *  preceding arrays have been written, possibly compressed. Each DataArray
+ *  element is therefore written with a fixed-width placeholder offset,
+ *  which is filled in by writeAppendedData().
+ */
+class XMLAppendedWriter
+{
+public:
+  /*!
+   * \brief Functor writing the data of an array to a sink.
+   */
+  using ArrayWriter = std::function<void(ArraySink&)>;
+
+  XMLAppendedWriter(std::ofstream& file, bool compress)
+    : m_file(file)
+    , m_compress(compress)
+  { }
+
+  /*!
+   * \brief Writes a DataArray element whose data will be appended.
+   *
+   * \param [in] indent the number of spaces preceding the element.
+   * \param [in] type the VTK XML type of the array, e.g., "Float64".
+   * \param [in] name the name of the array, may be empty.
+   * \param [in] num_components the number of components of each tuple.
+   * \param [in] nbytes the size of the array in bytes.
+   * \param [in] writer functor writing exactly nbytes bytes to a sink.
+   */
+  void addDataArray(int indent,
+                    const char* type,
+                    const std::string& name,
+                    int num_components,
+                    std::uint64_t nbytes,
+                    ArrayWriter writer)
+  {
+    fmt::print(m_file,
+               "{}<DataArray type=\"{}\"",
+               std::string(indent, ' '),
+               type);
+    if(!name.empty())
+    {
+      fmt::print(m_file, " Name=\"{}\"", name);
+    }
+    fmt::print(m_file,
+               " NumberOfComponents=\"{}\" format=\"appended\" offset=\"",
+               num_components);
+
+    m_arrays.push_back({m_file.tellp(), nbytes, std::move(writer)});
+    fmt::print(m_file, "{:0{}}\"/>\n", 0, VTK_XML_OFFSET_DIGITS);
+  }
+
+  /*!
+   * \brief Writes the AppendedData element, closes the VTKFile element and
+   *  fills in the offsets of the data arrays.
+   */
+  void writeAppendedData()
+  {
+    const ArraySink::Encoding encoding = m_compress
+      ? ArraySink::Encoding::XML_ZLIB
+      : ArraySink::Encoding::XML_RAW;
+
+    fmt::print(m_file, "  <AppendedData encoding=\"raw\">\n   _");
+    const std::streampos start = m_file.tellp();
+
+    std::vector<std::streamoff> offsets;
+    offsets.reserve(m_arrays.size());
+    for(auto& array : m_arrays)
+    {
+      offsets.push_back(m_file.tellp() - start);
+      ArraySink sink(m_file, encoding, array.nbytes);
+      array.writer(sink);
+      sink.finish();
+    }
+
+    fmt::print(m_file, "\n  </AppendedData>\n</VTKFile>\n");
+    const std::streampos end = m_file.tellp();
+
+    for(std::size_t i = 0; i < m_arrays.size(); ++i)
+    {
+      m_file.seekp(m_arrays[i].offset_pos);
+      fmt::print(m_file,
+                 "{:0{}}",
+                 static_cast<std::int64_t>(offsets[i]),
+                 VTK_XML_OFFSET_DIGITS);
+    }
+    m_file.seekp(end);
+  }
+
+private:
+  struct AppendedArray
+  {
+    std::streampos offset_pos;
+    std::uint64_t nbytes;
+    ArrayWriter writer;
+  };
+
+  std::ofstream& m_file;
+  bool m_compress;
+  std::vector<AppendedArray> m_arrays;
+};
+
+/*!
+ * \brief Adds a DataArray for each field of the given FieldData, whose data
+ *  is appended directly from the field buffer.
+ *
+ * \param [in] writer the XML writer.
+ * \param [in] field_data the data to write out.
+ * \param [in] num_values the number of tuples each field is expected to have.
+ * \pre field_data != nullptr
+ */
+void write_xml_data(XMLAppendedWriter& writer,
+                    const FieldData* field_data,
+                    IndexType AXOM_DEBUG_PARAM(num_values))
+{
+  SLIC_ASSERT(field_data != nullptr);
+
+  const int numFields = field_data->getNumFields();
+  for(int i = 0; i < numFields; ++i)
+  {
+    const Field* field = field_data->getField(i);
+    SLIC_ASSERT(field != nullptr);
+    SLIC_ASSERT(field->getNumTuples() == num_values);
+
+    const int num_components = field->getNumComponents();
+    const IndexType size = field->getNumTuples() * num_components;
+
+    const bool valid = dispatch_field(field, [&](const auto* data_ptr) {
+      using T = typename std::remove_cv<
+        typename std::remove_pointer<decltype(data_ptr)>::type>::type;
+
+      writer.addDataArray(8,
+                          vtk_binary_type<T>::xml(),
+                          field->getName(),
+                          num_components,
+                          size * sizeof(T),
+                          [=](ArraySink& sink) {
+                            write_contiguous(sink, data_ptr, size, false);
+                          });
+    });
+
+    SLIC_WARNING_IF(!valid,
+                    fmt::format("Unsupported field type ({}) for field '{}'",
+                                field->getType(),
+                                field->getName()));
+  }
+}
+
+/*!
+ * \brief Returns the VTK XML extent of a structured mesh, i.e., the ranges
+ *  of its node indices in each dimension.
+ * \pre mesh != nullptr
+ */
+std::string xml_extent(const StructuredMesh* mesh)
+{
+  SLIC_ASSERT(mesh != nullptr);
+
+  IndexType hi[3] = {0, 0, 0};
+  for(int dim = 0; dim < mesh->getDimension(); ++dim)
+  {
+    hi[dim] = mesh->getNodeResolution(dim) - 1;
+  }
+
+  return fmt::format("0 {} 0 {} 0 {}", hi[0], hi[1], hi[2]);
+}
+
+/*!
+ * \brief Writes the VTK XML file of a mesh, with its arrays appended in raw
+ *  binary form.
+ *
+ * \param [in] mesh the mesh to write out.
+ * \param [in] file the stream to write to.
+ * \param [in] compress compress the appended arrays with zlib.
+ * \return an error code, zero signifies a successful write.
+ *
+ * \pre mesh != nullptr
+ */
+int write_xml(const Mesh* mesh, std::ofstream& file, bool compress)
+{
+  SLIC_ASSERT(mesh != nullptr);
+  const int mesh_type = mesh->getMeshType();
+
+  const char* grid_type = nullptr;
+  switch(mesh_type)
+  {
+  case mint::UNSTRUCTURED_MESH:
+  case mint::PARTICLE_MESH:
+    grid_type = "UnstructuredGrid";
+    break;
+  case mint::STRUCTURED_CURVILINEAR_MESH:
+    grid_type = "StructuredGrid";
+    break;
+  case mint::STRUCTURED_RECTILINEAR_MESH:
+    grid_type = "RectilinearGrid";
+    break;
+  case mint::STRUCTURED_UNIFORM_MESH:
+    grid_type = "ImageData";
+    break;
+  default:
+    SLIC_WARNING("Mesh does not have a proper type (" << mesh_type << ") "
+                                                      << "write aborted.");
+    return -1;
+  }
+
+  const IndexType num_nodes = mesh->getNumberOfNodes();
+  const IndexType num_cells = mesh->getNumberOfCells();
+
+  /* Write the VTK header */
+  fmt::print(file, "<?xml version=\"1.0\"?>\n");
+  fmt::print(file,
+             "<VTKFile type=\"{}\" version=\"1.0\" byte_order=\"{}\" "
+             "header_type=\"UInt64\"{}>\n",
+             grid_type,
+             utilities::isLittleEndian() ? "LittleEndian" : "BigEndian",
+             compress ? " compressor=\"vtkZLibDataCompressor\"" : "");
+
+  /* Write the grid and piece headers. */
+  const bool unstructured =
+    (mesh_type == mint::UNSTRUCTURED_MESH || mesh_type == mint::PARTICLE_MESH);
+  if(unstructured)
+  {
+    fmt::print(file, "  <{}>\n", grid_type);
+    fmt::print(file,
+               "    <Piece NumberOfPoints=\"{}\" NumberOfCells=\"{}\">\n",
+               num_nodes,
+               num_cells);
+  }
+  else
+  {
+    const StructuredMesh* struc_mesh = dynamic_cast<const StructuredMesh*>(mesh);
+    const std::string extent = xml_extent(struc_mesh);
+
+    fmt::print(file, "  <{} WholeExtent=\"{}\"", grid_type, extent);
+    if(mesh_type == mint::STRUCTURED_UNIFORM_MESH)
+    {
+      const UniformMesh* uniform_mesh = dynamic_cast<const UniformMesh*>(mesh);
+      const double* origin = uniform_mesh->getOrigin();
+      const double* spacing = uniform_mesh->getSpacing();
+      fmt::print(file,
+                 " Origin=\"{} {} {}\" Spacing=\"{} {} {}\"",
+                 origin[0],
+                 origin[1],
+                 origin[2],
+                 spacing[0],
+                 spacing[1],
+                 spacing[2]);
+    }
+    fmt::print(file, ">\n    <Piece Extent=\"{}\">\n", extent);
+  }
+
+  XMLAppendedWriter writer(file, compress);
+
+  /* Write out the node data if any. */
+  const FieldData* node_data = mesh->getFieldData(mint::NODE_CENTERED);
+  if(node_data->getNumFields() > 0)
+  {
+    fmt::print(file, "      <PointData>\n");
+    write_xml_data(writer, node_data, num_nodes);
+    fmt::print(file, "      </PointData>\n");
+  }
+
+  /* Write out the cell data if any. */
+  if(mesh_type != mint::PARTICLE_MESH)
+  {
+    const FieldData* cell_data = mesh->getFieldData(mint::CELL_CENTERED);
+    if(cell_data->getNumFields() > 0)
+    {
+      fmt::print(file, "      <CellData>\n");
+      write_xml_data(writer, cell_data, num_cells);
+      fmt::print(file, "      </CellData>\n");
+    }
+  }
+
+  /* Write out the mesh node coordinates. */
+  if(unstructured || mesh_type == mint::STRUCTURED_CURVILINEAR_MESH)
+  {
+    fmt::print(file, "      <Points>\n");
+    writer.addDataArray(8,
+                        vtk_binary_type<double>::xml(),
+                        "Points",
+                        3,
+                        3 * num_nodes * sizeof(double),
+                        [=](ArraySink& sink) {
+                          write_interleaved_points(mesh, sink, false);
+                        });
+    fmt::print(file, "      </Points>\n");
+  }
+  else if(mesh_type == mint::STRUCTURED_RECTILINEAR_MESH)
+  {
+    static const double zero = 0.0;
+    const std::string coord_names[3] = {"x_coordinates",
+                                        "y_coordinates",
+                                        "z_coordinates"};
+
+    fmt::print(file, "      <Coordinates>\n");
+    for(int dim = 0; dim < 3; ++dim)
+    {
+      const bool has_dim = dim < mesh->getDimension();
+      const double* coords = has_dim ? mesh->getCoordinateArray(dim) : &zero;
+      const IndexType num_coords = has_dim
+        ? dynamic_cast<const RectilinearMesh*>(mesh)->getNodeResolution(dim)
+        : 1;
+
+      writer.addDataArray(8,
+                          vtk_binary_type<double>::xml(),
+                          coord_names[dim],
+                          1,
+                          num_coords * sizeof(double),
+                          [=](ArraySink& sink) {
+                            write_contiguous(sink, coords, num_coords, false);
+                          });
+    }
+    fmt::print(file, "      </Coordinates>\n");
+  }
+
+  /* Write out the mesh cells. */
+  if(unstructured)
+  {
+    using ConnType = IndexType;
+
+    IndexType total_cell_nodes = 0;
+    get_max_cell_nodes(mesh, total_cell_nodes);
+
+    fmt::print(file, "      <Cells>\n");
+    writer.addDataArray(8,
+                        vtk_binary_type<ConnType>::xml(),
+                        "connectivity",
+                        1,
+                        total_cell_nodes * sizeof(ConnType),
+                        [=](ArraySink& sink) {
+                          write_cell_nodes<ConnType>(mesh, sink, false, false);
+                        });
+    writer.addDataArray(8,
+                        vtk_binary_type<ConnType>::xml(),
+                        "offsets",
+                        1,
+                        num_cells * sizeof(ConnType),
+                        [=](ArraySink& sink) {
+                          // VTK offsets point to the end of each cell
+                          IndexType offset = 0;
+                          auto next_offset = [&](IndexType i) {
+                            offset += mesh->getNumberOfCellNodes(i);
+                            return offset;
+                          };
+                          write_staged<ConnType>(sink,
+                                                 num_cells,
+                                                 false,
+                                                 next_offset);
+                        });
+    writer.addDataArray(8,
+                        vtk_binary_type<std::uint8_t>::xml(),
+                        "types",
+                        1,
+                        num_cells * sizeof(std::uint8_t),
+                        [=](ArraySink& sink) {
+                          write_cell_types<std::uint8_t>(mesh, sink, false);
+                        });
+    fmt::print(file, "      </Cells>\n");
+  }
+
+  fmt::print(file, "    </Piece>\n");
+  fmt::print(file, "  </{}>\n", grid_type);
+
+  /* Write out the data of the arrays. */
+  writer.writeAppendedData();
+
+  return 0;
+}
+
+} /* namespace internal */
+
+//------------------------------------------------------------------------------
+int write_vtk(const Mesh* mesh,
+              const std::string& file_path,
+              VTKFormat format,
+              bool compress)
+{
+  SLIC_ASSERT(mesh != nullptr);
+
+  if(compress && format != VTKFormat::XML_APPENDED)
+  {
+    SLIC_WARNING("Compression only applies to the VTK XML format, "
+                 << "writing uncompressed data to " << file_path);
+    compress = false;
+  }
+#ifndef AXOM_USE_ZLIB
+  if(compress)
+  {
+    SLIC_WARNING("Axom was built without zlib, "
+                 << "writing uncompressed data to " << file_path);
+    compress = false;
+  }
+#endif
+
+  const std::ios_base::openmode mode = (format == VTKFormat::LEGACY_ASCII)
+    ? std::ios_base::out
+    : std::ios_base::out | std::ios_base::binary;
+
+  std::ofstream file(file_path.c_str(), mode);
+  if(!file.good())
+  {
+    SLIC_WARNING("Could not open file at path " << file_path);
+    return -1;
+  }
+
+  int rc = 0;
+  switch(format)
+  {
+  case VTKFormat::LEGACY_ASCII:
+    rc = internal::write_legacy(mesh, file, false);
+    break;
+  case VTKFormat::LEGACY_BINARY:
+    rc = internal::write_legacy(mesh, file, true);
+    break;
+  case VTKFormat::XML_APPENDED:
+    rc = internal::write_xml(mesh, file, compress);
+    break;
+  }
+
+  file.close();
+  if(rc != 0)
+  {
+    remove(file_path.c_str());
+  }
+
+  return rc;
+}
+
+//------------------------------------------------------------------------------
+std::string vtk_xml_extension(const Mesh* mesh)
+{
+  SLIC_ASSERT(mesh != nullptr);
+
+  switch(mesh->getMeshType())
+  {
+  case mint::UNSTRUCTURED_MESH:
+  case mint::PARTICLE_MESH:
+    return ".vtu";
+  case mint::STRUCTURED_CURVILINEAR_MESH:
+    return ".vts";
+  case mint::STRUCTURED_RECTILINEAR_MESH:
+    return ".vtr";
+  case mint::STRUCTURED_UNIFORM_MESH:
+    return ".vti";
+  default:
+    return "";
+  }
+}
+
 //------------------------------------------------------------------------------
 int write_vtk(mint::FiniteElement& fe, const std::string& file_path)
 {
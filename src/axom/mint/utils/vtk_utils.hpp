@@ -17,15 +17,59 @@ class Mesh;
 class FiniteElement;
 
 /*!
- * \brief Writes a mesh to a VTK file using the legacy ASCII format.
- *  that can be visualized with VisIt or ParaView.
+ * \brief Enumerates the file formats supported by write_vtk().
+ */
+enum class VTKFormat
+{
+  LEGACY_ASCII,   /*!< legacy VTK format, ASCII encoded (.vtk) */
+  LEGACY_BINARY,  /*!< legacy VTK format, big-endian binary encoded (.vtk) */
+  XML_APPENDED    /*!< VTK XML format with raw appended data, i.e.,
+                       .vtu, .vts, .vtr or .vti depending on the mesh type */
+};
+
+/*!
+ * \brief Writes a mesh to a VTK file that can be visualized with VisIt or
+ *  ParaView.
+ *
  * \param [in] mesh the mesh to write out.
  * \param [in] file_path the path of the file to write to.
+ * \param [in] format the file format, legacy ASCII by default.
+ * \param [in] compress compress the data arrays with zlib (optional).
  * \return an error code, zero signifies a successful write.
+ *
+ * \pre mesh != nullptr
+ *
+ * \note The binary and XML formats write the coordinate and field arrays in
+ *  large blocks, directly from the mesh buffers where possible, and are
+ *  intended for large meshes. The ASCII format is primarily intended for
+ *  debugging.
+ *
+ * \note The XML format writes an UnstructuredGrid (.vtu) for unstructured
+ *  and particle meshes, a StructuredGrid (.vts) for curvilinear meshes, a
+ *  RectilinearGrid (.vtr) for rectilinear meshes and an ImageData (.vti)
+ *  for uniform meshes. The file is written to file_path as given, so it
+ *  should have the matching extension.
+ *
+ * \note Compression only applies to the XML format and requires Axom to be
+ *  built with zlib. Otherwise, the data is written uncompressed.
+ *
+ * \see vtk_xml_extension()
+ */
+int write_vtk(const Mesh* mesh,
+              const std::string& file_path,
+              VTKFormat format = VTKFormat::LEGACY_ASCII,
+              bool compress = false);
+
+/*!
+ * \brief Returns the extension, including the dot, of the VTK XML file
+ *  written by write_vtk() for the given mesh, e.g., ".vtu".
+ *
+ * \param [in] mesh the mesh to write out.
+ * \return the file extension, or an empty string for an unsupported mesh.
+ *
  * \pre mesh != nullptr
- * \note This method is primarily intended for debugging.
  */
-int write_vtk(const Mesh* mesh, const std::string& file_path);
+std::string vtk_xml_extension(const Mesh* mesh);
 
 /*!
  * \brief Writes a FiniteElement to a VTK file in the legacy ASCII format.
@@ -23,6 +23,7 @@
 #include "axom/primal/geometry/OrientedBoundingBox.hpp"
 
 #include "axom/primal/operators/squared_distance.hpp"
+#include "axom/primal/operators/detail/bezier_eval_impl.hpp"
 
 #include <vector>
 #include <ostream>
@@ -334,64 +335,46 @@ public:
    */
   PointType evaluate(T t) const
   {
-    using axom::utilities::lerp;
-
     PointType ptval;
-
     const int ord = getOrder();
-    axom::Array<T> dCarray(ord + 1);
-
-    // If not rational, we can do standard de Casteljau
-    if(!isRational())
-    {
-      // Run de Casteljau algorithm on each dimension
-      for(int i = 0; i < NDIMS; ++i)
-      {
-        for(int p = 0; p <= ord; ++p)
-        {
-          dCarray[p] = m_controlPoints[p][i];
-        }
+    detail::BezierWorkspace<T> work(detail::bezier_curve_work_size<NDIMS>(ord));
+    detail::bezier_curve_evaluate(m_controlPoints.data(),
+                                  isRational() ? m_weights.data() : nullptr,
+                                  ord,
+                                  t,
+                                  work.data(),
+                                  ptval,
+                                  static_cast<VectorType*>(nullptr));
+    return ptval;
+  }
 
-        for(int p = 1; p <= ord; ++p)
-        {
-          const int end = ord - p;
-          for(int k = 0; k <= end; ++k)
-          {
-            dCarray[k] = lerp(dCarray[k], dCarray[k + 1], t);
-          }
-        }
-        ptval[i] = dCarray[0];
-      }
+  /*!
+   * \brief Evaluates a Bezier curve at a batch of parameter values
+   *
+   * \param [in] params the parameter values at which to evaluate
+   * \param [out] out the value of the Bezier curve at each parameter value
+   *
+   * \pre out.size() >= params.size()
+   * \note The evaluations share a single scratch buffer, which is on the
+   *  stack for curves of moderate order, so no memory is allocated
+   */
+  void evaluate(axom::ArrayView<const T> params,
+                axom::ArrayView<PointType> out) const
+  {
+    SLIC_ASSERT(out.size() >= params.size());
 
-      return ptval;
-    }
-    // If rational, construct 4D homogeneous curve to evaluate
-    else
+    const int ord = getOrder();
+    const T* weights = isRational() ? m_weights.data() : nullptr;
+    detail::BezierWorkspace<T> work(detail::bezier_curve_work_size<NDIMS>(ord));
+    for(IndexType i = 0; i < params.size(); ++i)
     {
-      // Store BezierCurve of projective weights, (wx, wy, wz)
-      //  and BezierCurve of weights (w)
-      BezierCurve<T, NDIMS> projective(ord);
-      BezierCurve<T, 1> weights(ord);
-
-      for(int p = 0; p <= ord; ++p)
-      {
-        weights[p][0] = m_weights[p];
-
-        for(int i = 0; i < NDIMS; ++i)
-        {
-          projective[p][i] = m_controlPoints[p][i] * m_weights[p];
-        }
-      }
-
-      Point<T, NDIMS> P = projective.evaluate(t);
-      Point<T, 1> W = weights.evaluate(t);
-
-      for(int i = 0; i < NDIMS; ++i)
-      {
-        ptval[i] = P[i] / W[0];
-      }
-
-      return ptval;
+      detail::bezier_curve_evaluate(m_controlPoints.data(),
+                                    weights,
+                                    ord,
+                                    params[i],
+                                    work.data(),
+                                    out[i],
+                                    static_cast<VectorType*>(nullptr));
     }
   }
 
@@ -404,79 +387,15 @@ public:
    */
   void evaluate_first_derivative(T t, PointType& eval, VectorType& Dt) const
   {
-    using axom::utilities::lerp;
-    VectorType val;
-
     const int ord = getOrder();
-    std::vector<T> dCarray(ord + 1);
-
-    // If the curve is nonrational, we can use standard de Casteljau
-    if(!isRational())
-    {
-      // Run de Casteljau algorithm on each dimension
-      for(int i = 0; i < NDIMS; ++i)
-      {
-        for(int p = 0; p <= ord; ++p)
-        {
-          dCarray[p] = m_controlPoints[p][i];
-        }
-
-        // stop one step early and take difference of last two values
-        for(int p = 1; p <= ord - 1; ++p)
-        {
-          const int end = ord - p;
-          for(int k = 0; k <= end; ++k)
-          {
-            dCarray[k] = lerp(dCarray[k], dCarray[k + 1], t);
-          }
-        }
-
-        if(ord == 0)
-        {
-          eval[i] = dCarray[0];
-          Dt[i] = 0.0;
-        }
-        else
-        {
-          eval[i] = (1 - t) * dCarray[0] + t * dCarray[1];
-          Dt[i] = ord * (dCarray[1] - dCarray[0]);
-        }
-      }
-    }
-    // If rational, construct the 4D homogeneous surface,
-    //  which requires all first derivatives
-    else
-    {
-      // Store BezierPatch of projective weights, (wx, wy, wz)
-      //  and BezierPatch of weights (w)
-      BezierCurve<T, NDIMS> projective(ord);
-      BezierCurve<T, 1> weights(ord);
-
-      for(int p = 0; p <= ord; ++p)
-      {
-        weights[p][0] = m_weights[p];
-
-        for(int i = 0; i < NDIMS; ++i)
-        {
-          projective[p][i] = m_controlPoints[p][i] * m_weights[p];
-        }
-      }
-
-      Point<T, NDIMS> P;
-      Vector<T, NDIMS> P_t;
-
-      Point<T, 1> W;
-      Vector<T, 1> W_t;
-
-      projective.evaluate_first_derivative(t, P, P_t);
-      weights.evaluate_first_derivative(t, W, W_t);
-
-      for(int i = 0; i < NDIMS; ++i)
-      {
-        eval[i] = P[i] / W[0];
-        Dt[i] = (P_t[i] - eval[i] * W_t[0]) / W[0];
-      }
-    }
+    detail::BezierWorkspace<T> work(detail::bezier_curve_work_size<NDIMS>(ord));
+    detail::bezier_curve_evaluate(m_controlPoints.data(),
+                                  isRational() ? m_weights.data() : nullptr,
+                                  ord,
+                                  t,
+                                  work.data(),
+                                  eval,
+                                  &Dt);
   }
 
   /*!
@@ -489,80 +408,10 @@ public:
    */
   VectorType dt(T t) const
   {
-    using axom::utilities::lerp;
+    PointType eval;
     VectorType val;
-
-    const int ord = getOrder();
-    axom::Array<T> dCarray(ord + 1);
-
-    // If the curve is nonrational, we can use standard de Casteljau
-    if(!isRational())
-    {
-      // Run de Casteljau algorithm on each dimension
-      for(int i = 0; i < NDIMS; ++i)
-      {
-        for(int p = 0; p <= ord; ++p)
-        {
-          dCarray[p] = m_controlPoints[p][i];
-        }
-
-        // stop one step early and take difference of last two values
-        for(int p = 1; p <= ord - 1; ++p)
-        {
-          const int end = ord - p;
-          for(int k = 0; k <= end; ++k)
-          {
-            dCarray[k] = lerp(dCarray[k], dCarray[k + 1], t);
-          }
-        }
-
-        if(ord == 0)
-        {
-          val[i] = 0.0;
-        }
-        else
-        {
-          val[i] = ord * (dCarray[1] - dCarray[0]);
-        }
-      }
-
-      return val;
-    }
-    // If rational, construct the 4D homogeneous surface,
-    //  which requires all first derivatives
-    else
-    {
-      // Store BezierPatch of projective weights, (wx, wy, wz)
-      //  and BezierPatch of weights (w)
-      BezierCurve<T, NDIMS> projective(ord);
-      BezierCurve<T, 1> weights(ord);
-
-      for(int p = 0; p <= ord; ++p)
-      {
-        weights[p][0] = m_weights[p];
-
-        for(int i = 0; i < NDIMS; ++i)
-        {
-          projective[p][i] = m_controlPoints[p][i] * m_weights[p];
-        }
-      }
-
-      Point<T, NDIMS> P;
-      Vector<T, NDIMS> P_t;
-
-      Point<T, 1> W;
-      Vector<T, 1> W_t;
-
-      projective.evaluate_first_derivative(t, P, P_t);
-      weights.evaluate_first_derivative(t, W, W_t);
-
-      for(int i = 0; i < NDIMS; ++i)
-      {
-        val[i] = (W[0] * P_t[i] - P[i] * W_t[0]) / (W[0] * W[0]);
-      }
-
-      return val;
-    }
+    evaluate_first_derivative(t, eval, val);
+    return val;
   }
 
   /*!
@@ -24,6 +24,7 @@
 #include "axom/primal/geometry/OrientedBoundingBox.hpp"
 
 #include "axom/primal/operators/squared_distance.hpp"
+#include "axom/primal/operators/detail/bezier_eval_impl.hpp"
 
 #include <ostream>
 
@@ -799,13 +800,59 @@ public:
    */
   PointType evaluate(T u, T v) const
   {
-    if(getOrder_u() >= getOrder_v())
-    {
-      return isocurve_u(u).evaluate(v);
-    }
-    else
+    PointType eval;
+    const int ord_u = getOrder_u();
+    const int ord_v = getOrder_v();
+    detail::BezierWorkspace<T> work(
+      detail::bezier_patch_work_size<NDIMS>(ord_u, ord_v));
+    detail::bezier_patch_evaluate(m_controlPoints.data(),
+                                  isRational() ? m_weights.data() : nullptr,
+                                  ord_u,
+                                  ord_v,
+                                  u,
+                                  v,
+                                  work.data(),
+                                  eval,
+                                  static_cast<VectorType*>(nullptr),
+                                  static_cast<VectorType*>(nullptr));
+    return eval;
+  }
+
+  /*!
+   * \brief Evaluates a Bezier patch at a batch of parameter values
+   *
+   * \param [in] u parameter values at which to evaluate on the first axis
+   * \param [in] v parameter values at which to evaluate on the second axis
+   * \param [out] out the value of the Bezier patch at each (u[i], v[i])
+   *
+   * \pre u.size() == v.size() and out.size() >= u.size()
+   * \note The evaluations share a single scratch buffer, which is on the
+   *  stack for patches of moderate order, so no memory is allocated
+   */
+  void evaluate(axom::ArrayView<const T> u,
+                axom::ArrayView<const T> v,
+                axom::ArrayView<PointType> out) const
+  {
+    SLIC_ASSERT(u.size() == v.size());
+    SLIC_ASSERT(out.size() >= u.size());
+
+    const int ord_u = getOrder_u();
+    const int ord_v = getOrder_v();
+    const T* weights = isRational() ? m_weights.data() : nullptr;
+    detail::BezierWorkspace<T> work(
+      detail::bezier_patch_work_size<NDIMS>(ord_u, ord_v));
+    for(IndexType i = 0; i < u.size(); ++i)
     {
-      return isocurve_v(v).evaluate(u);
+      detail::bezier_patch_evaluate(m_controlPoints.data(),
+                                    weights,
+                                    ord_u,
+                                    ord_v,
+                                    u[i],
+                                    v[i],
+                                    work.data(),
+                                    out[i],
+                                    static_cast<VectorType*>(nullptr),
+                                    static_cast<VectorType*>(nullptr));
     }
   }
 
@@ -826,157 +873,20 @@ public:
                                   Vector<T, NDIMS>& Du,
                                   Vector<T, NDIMS>& Dv) const
   {
-    using axom::utilities::lerp;
     const int ord_u = getOrder_u();
     const int ord_v = getOrder_v();
-
-    axom::Array<T, 2> dCmat(ord_u + 1, ord_v + 1);
-
-    if(!isRational())
-    {
-      // Do de Casteljau until we get a 2x2
-      for(int i = 0; i < NDIMS; ++i)
-      {
-        for(int p = 0; p <= ord_u; ++p)
-        {
-          for(int q = 0; q <= ord_v; ++q)
-          {
-            dCmat(p, q) = m_controlPoints(p, q)[i];
-          }
-        }
-
-        // Store the size after each de Casteljau reduction is made
-        int end_u = ord_u;
-        int end_v = ord_v;
-
-        // Do de Casteljau over the longer direction first
-        if(ord_u >= ord_v)
-        {
-          // Stop 1 steps early in u
-          while(end_u > 1)
-          {
-            end_u -= 1;
-            for(int k = 0; k <= end_u; ++k)
-            {
-              for(int q = 0; q <= end_v; ++q)
-              {
-                dCmat(k, q) = lerp(dCmat(k, q), dCmat(k + 1, q), u);
-              }
-            }
-          }
-
-          // Stop 1 steps early in v
-          while(end_v > 1)
-          {
-            end_v -= 1;
-            for(int k = 0; k <= end_v; ++k)
-            {
-              for(int p = 0; p <= end_u; ++p)
-              {
-                dCmat(p, k) = lerp(dCmat(p, k), dCmat(p, k + 1), v);
-              }
-            }
-          }
-        }
-        else
-        {
-          // Stop 1 steps early in v
-          while(end_v > 1)
-          {
-            end_v -= 1;
-            for(int k = 0; k <= end_v; ++k)
-            {
-              for(int p = 0; p <= end_u; ++p)
-              {
-                dCmat(p, k) = lerp(dCmat(p, k), dCmat(p, k + 1), v);
-              }
-            }
-          }
-
-          // Stop 2 steps early in v over the three columns
-          while(end_u > 1)
-          {
-            end_u -= 1;
-            for(int k = 0; k <= end_u; ++k)
-            {
-              for(int q = 0; q <= end_v; ++q)
-              {
-                dCmat(k, q) = lerp(dCmat(k, q), dCmat(k + 1, q), u);
-              }
-            }
-          }
-        }
-
-        // By now, the first 2x2 submatrix of dCmat should have
-        //  all the intermediate values needed
-
-        // Compute first order derivatives
-        // clang-format off
-        if( end_u == 1 && end_v == 1 )
-        {
-          Du[i] = ord_u * ( (1 - v) * (dCmat(1, 0) - dCmat(0, 0)) + 
-                                  v * (dCmat(1, 1) - dCmat(0, 1)) );
-          Dv[i] = ord_v * ( (1 - u) * (dCmat(0, 1) - dCmat(0, 0)) + 
-                                  u * (dCmat(1, 1) - dCmat(1, 0)) );
-          eval[i] = (1 - u) * (1 - v) * dCmat(0, 0) + u * (1 - v) * dCmat(1, 0) + (1 - u) * v * dCmat(0, 1) + u * v * dCmat(1, 1);
-        }
-        else if (end_u == 1 && end_v == 0)
-        {
-          Du[i] = ord_u * (dCmat(1, 0) - dCmat(0, 0));
-          Dv[i] = 0.0;
-          eval[i] = (1 - u) * dCmat(0, 0) + u * dCmat(1, 0);
-        }
-        else if (end_u == 0 && end_v == 1)
-        {
-          Du[i] = 0.0;
-          Dv[i] = ord_v * (dCmat(0, 1) - dCmat(0, 0));
-          eval[i] = (1 - v) * dCmat(0, 0) + v * dCmat(0, 1);
-        }
-        else
-        {
-          Du[i] = 0.0;
-          Dv[i] = 0.0;
-          eval[i] = dCmat(0, 0);
-        }
-        // clang-format on
-      }
-    }
-    else
-    {
-      // Store BezierPatch of projective weights, (wx, wy, wz)
-      //  and BezierPatch of weights (w)
-      BezierPatch<T, NDIMS> projective(ord_u, ord_v);
-      BezierPatch<T, 1> weights(ord_u, ord_v);
-
-      for(int p = 0; p <= ord_u; ++p)
-      {
-        for(int q = 0; q <= ord_v; ++q)
-        {
-          weights(p, q)[0] = m_weights(p, q);
-
-          for(int i = 0; i < NDIMS; ++i)
-          {
-            projective(p, q)[i] = m_controlPoints(p, q)[i] * m_weights(p, q);
-          }
-        }
-      }
-
-      Point<T, NDIMS> P;
-      Vector<T, NDIMS> P_u, P_v, P_uu, P_vv, P_uv;
-
-      Point<T, 1> W;
-      Vector<T, 1> W_u, W_v, W_uu, W_vv, W_uv;
-
-      projective.evaluate_second_derivatives(u, v, P, P_u, P_v, P_uu, P_vv, P_uv);
-      weights.evaluate_second_derivatives(u, v, W, W_u, W_v, W_uu, W_vv, W_uv);
-
-      for(int i = 0; i < NDIMS; ++i)
-      {
-        eval[i] = P[i] / W[0];
-        Du[i] = (P_u[i] - eval[i] * W_u[0]) / W[0];
-        Dv[i] = (P_v[i] - eval[i] * W_v[0]) / W[0];
-      }
-    }
+    detail::BezierWorkspace<T> work(
+      detail::bezier_patch_work_size<NDIMS>(ord_u, ord_v));
+    detail::bezier_patch_evaluate(m_controlPoints.data(),
+                                  isRational() ? m_weights.data() : nullptr,
+                                  ord_u,
+                                  ord_v,
+                                  u,
+                                  v,
+                                  work.data(),
+                                  eval,
+                                  &Du,
+                                  &Dv);
   }
 
   /*!
@@ -1430,7 +1340,13 @@ public:
    *
    * \note We typically find the tangent of the patch at \a u and \a v between 0 and 1
    */
-  VectorType du(T u, T v) const { return isocurve_v(v).dt(u); }
+  VectorType du(T u, T v) const
+  {
+    PointType eval;
+    VectorType Du, Dv;
+    evaluate_first_derivatives(u, v, eval, Du, Dv);
+    return Du;
+  }
 
   /*!
    * \brief Computes the second derivative of a Bezier patch at (\a u, \a v) along the u axis
@@ -1452,7 +1368,13 @@ public:
    *
    * \note We typically find the tangent of the patch at \a u and \a v between 0 and 1
    */
-  VectorType dv(T u, T v) const { return isocurve_u(u).dt(v); }
+  VectorType dv(T u, T v) const
+  {
+    PointType eval;
+    VectorType Du, Dv;
+    evaluate_first_derivatives(u, v, eval, Du, Dv);
+    return Dv;
+  }
 
   /*!
    * \brief Computes the second derivative of a Bezier patch at (\a u, \a v) along the v axis
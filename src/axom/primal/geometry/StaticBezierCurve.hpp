@@ -0,0 +1,361 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ * \file StaticBezierCurve.hpp
+ *
+ * \brief A Bezier curve primitive with a fixed maximum order
+ */
+
+#ifndef AXOM_PRIMAL_STATICBEZIERCURVE_HPP_
+#define AXOM_PRIMAL_STATICBEZIERCURVE_HPP_
+
+#include "axom/core/Macros.hpp"
+#include "axom/core/StackArray.hpp"
+#include "axom/core/ArrayView.hpp"
+#include "axom/core/utilities/Utilities.hpp"
+#include "axom/slic.hpp"
+
+#include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/geometry/Vector.hpp"
+#include "axom/primal/geometry/BoundingBox.hpp"
+#include "axom/primal/geometry/BezierCurve.hpp"
+
+#include "axom/primal/operators/detail/bezier_eval_impl.hpp"
+
+#include <ostream>
+
+namespace axom
+{
+namespace primal
+{
+/*!
+ * \class StaticBezierCurve
+ *
+ * \brief Represents a (rational) Bezier curve whose control points and
+ *  weights are stored inline, in arrays sized for the maximum order.
+ *
+ * \tparam T the coordinate type, e.g., double, float, etc.
+ * \tparam NDIMS the number of dimensions
+ * \tparam MAX_ORDER the largest order of the curve
+ *
+ *  Unlike BezierCurve, a StaticBezierCurve never allocates memory, so it can
+ *  be copied into device kernels and evaluated in hot loops. Its evaluation
+ *  runs the de Casteljau algorithm in place, on a scratch buffer on the stack.
+ *
+ * \sa BezierCurve
+ */
+template <typename T, int NDIMS, int MAX_ORDER = 3>
+class StaticBezierCurve
+{
+public:
+  using PointType = Point<T, NDIMS>;
+  using VectorType = Vector<T, NDIMS>;
+  using BoundingBoxType = BoundingBox<T, NDIMS>;
+  using BezierCurveType = BezierCurve<T, NDIMS>;
+
+  AXOM_STATIC_ASSERT_MSG((NDIMS == 1) || (NDIMS == 2) || (NDIMS == 3),
+                         "A Bezier Curve object may be defined in 1-, 2-, "
+                         "or 3-D");
+  AXOM_STATIC_ASSERT_MSG(MAX_ORDER >= 0,
+                         "The maximum order of a Bezier Curve must be "
+                         "nonnegative");
+
+public:
+  /*!
+   * \brief Constructor for a nonrational Bezier curve of the given order,
+   *  whose control points are at the origin
+   *
+   * \param [in] ord the order of the curve
+   * \pre -1 <= ord <= MAX_ORDER
+   */
+  AXOM_HOST_DEVICE explicit StaticBezierCurve(int ord = -1) : m_order(ord)
+  {
+    SLIC_ASSERT(ord >= -1 && ord <= MAX_ORDER);
+  }
+
+  /*!
+   * \brief Constructor for a Bezier curve from an array of control points
+   *  and, optionally, an array of weights
+   *
+   * \param [in] pts the ord + 1 control points
+   * \param [in] weights the ord + 1 weights, or null for a nonrational curve
+   * \param [in] ord the order of the curve
+   *
+   * \pre 0 <= ord <= MAX_ORDER
+   */
+  AXOM_HOST_DEVICE StaticBezierCurve(const PointType* pts,
+                                     const T* weights,
+                                     int ord)
+    : m_order(ord)
+    , m_rational(weights != nullptr)
+  {
+    SLIC_ASSERT(ord >= 0 && ord <= MAX_ORDER);
+    SLIC_ASSERT(pts != nullptr);
+
+    for(int p = 0; p <= ord; ++p)
+    {
+      m_controlPoints[p] = pts[p];
+      m_weights[p] = m_rational ? weights[p] : T(1);
+    }
+  }
+
+  /*!
+   * \brief Constructor from a BezierCurve
+   *
+   * \pre curve.getOrder() <= MAX_ORDER
+   */
+  explicit StaticBezierCurve(const BezierCurveType& curve)
+    : m_order(curve.getOrder())
+    , m_rational(curve.isRational())
+  {
+    SLIC_ASSERT(m_order <= MAX_ORDER);
+
+    for(int p = 0; p <= m_order; ++p)
+    {
+      m_controlPoints[p] = curve[p];
+      m_weights[p] = m_rational ? curve.getWeight(p) : T(1);
+    }
+  }
+
+  /// Returns a BezierCurve with the same control points and weights
+  BezierCurveType toBezierCurve() const
+  {
+    BezierCurveType curve(m_order);
+    for(int p = 0; p <= m_order; ++p)
+    {
+      curve[p] = m_controlPoints[p];
+    }
+    if(m_rational)
+    {
+      curve.makeRational();
+      for(int p = 0; p <= m_order; ++p)
+      {
+        curve.setWeight(p, m_weights[p]);
+      }
+    }
+    return curve;
+  }
+
+  /// Returns the order of the Bezier curve
+  AXOM_HOST_DEVICE int getOrder() const { return m_order; }
+
+  /// Returns true if the Bezier curve is rational
+  AXOM_HOST_DEVICE bool isRational() const { return m_rational; }
+
+  /// Makes the curve rational, with unit weights
+  AXOM_HOST_DEVICE void makeRational()
+  {
+    if(!m_rational)
+    {
+      for(int p = 0; p <= m_order; ++p)
+      {
+        m_weights[p] = T(1);
+      }
+      m_rational = true;
+    }
+  }
+
+  /// Makes the curve nonrational, by discarding its weights
+  AXOM_HOST_DEVICE void makeNonrational() { m_rational = false; }
+
+  /// Retrieves the control point at index \a idx
+  AXOM_HOST_DEVICE PointType& operator[](int idx)
+  {
+    SLIC_ASSERT(idx >= 0 && idx <= m_order);
+    return m_controlPoints[idx];
+  }
+
+  /// Retrieves the control point at index \a idx
+  AXOM_HOST_DEVICE const PointType& operator[](int idx) const
+  {
+    SLIC_ASSERT(idx >= 0 && idx <= m_order);
+    return m_controlPoints[idx];
+  }
+
+  /// Returns the weight of the control point at index \a idx
+  AXOM_HOST_DEVICE T getWeight(int idx) const
+  {
+    SLIC_ASSERT(idx >= 0 && idx <= m_order);
+    return m_rational ? m_weights[idx] : T(1);
+  }
+
+  /*!
+   * \brief Sets the weight of the control point at index \a idx
+   *
+   * \pre the curve is rational and \a weight is positive
+   */
+  AXOM_HOST_DEVICE void setWeight(int idx, T weight)
+  {
+    SLIC_ASSERT(m_rational);
+    SLIC_ASSERT(idx >= 0 && idx <= m_order);
+    SLIC_ASSERT(weight > 0);
+    m_weights[idx] = weight;
+  }
+
+  /// Returns an axis-aligned bounding box containing the Bezier curve
+  AXOM_HOST_DEVICE BoundingBoxType boundingBox() const
+  {
+    return BoundingBoxType(&m_controlPoints[0], m_order + 1);
+  }
+
+  /*!
+   * \brief Evaluates the Bezier curve at a particular parameter value \a t
+   *
+   * \param [in] t parameter value at which to evaluate
+   * \return p the value of the Bezier curve at t
+   */
+  AXOM_HOST_DEVICE PointType evaluate(T t) const
+  {
+    PointType eval;
+    T work[detail::bezier_curve_work_size<NDIMS>(MAX_ORDER)];
+    detail::bezier_curve_evaluate(&m_controlPoints[0],
+                                  weights(),
+                                  m_order,
+                                  t,
+                                  work,
+                                  eval,
+                                  static_cast<VectorType*>(nullptr));
+    return eval;
+  }
+
+  /*!
+   * \brief Evaluates the Bezier curve at a batch of parameter values
+   *
+   * \param [in] params the parameter values at which to evaluate
+   * \param [out] out the value of the Bezier curve at each parameter value
+   *
+   * \pre out.size() >= params.size()
+   */
+  AXOM_HOST_DEVICE void evaluate(axom::ArrayView<const T> params,
+                                 axom::ArrayView<PointType> out) const
+  {
+    SLIC_ASSERT(out.size() >= params.size());
+
+    T work[detail::bezier_curve_work_size<NDIMS>(MAX_ORDER)];
+    for(IndexType i = 0; i < params.size(); ++i)
+    {
+      detail::bezier_curve_evaluate(&m_controlPoints[0],
+                                    weights(),
+                                    m_order,
+                                    params[i],
+                                    work,
+                                    out[i],
+                                    static_cast<VectorType*>(nullptr));
+    }
+  }
+
+  /*!
+   * \brief Computes the 0th and 1st derivative of the Bezier curve
+   *
+   * \param [in] t Parameter value at which to compute tangent
+   * \param [out] eval The value of the curve at \a t
+   * \param [out] Dt The tangent vector of the curve at \a t
+   */
+  AXOM_HOST_DEVICE void evaluate_first_derivative(T t,
+                                                  PointType& eval,
+                                                  VectorType& Dt) const
+  {
+    T work[detail::bezier_curve_work_size<NDIMS>(MAX_ORDER)];
+    detail::bezier_curve_evaluate(&m_controlPoints[0],
+                                  weights(),
+                                  m_order,
+                                  t,
+                                  work,
+                                  eval,
+                                  &Dt);
+  }
+
+  /*!
+   * \brief Computes the tangent of the Bezier curve at a parameter value \a t
+   *
+   * \param [in] t parameter value at which to compute tangent
+   * \return p the tangent vector of the Bezier curve at t
+   */
+  AXOM_HOST_DEVICE VectorType dt(T t) const
+  {
+    PointType eval;
+    VectorType Dt;
+    evaluate_first_derivative(t, eval, Dt);
+    return Dt;
+  }
+
+  /*!
+   * \brief Splits the Bezier curve into two Bezier curves at \a t
+   *
+   * \param [in] t parameter value between 0 and 1 at which to split the curve
+   * \param [out] c1 First output Bezier curve, on [0, t]
+   * \param [out] c2 Second output Bezier curve, on [t, 1]
+   */
+  AXOM_HOST_DEVICE void split(T t,
+                              StaticBezierCurve& c1,
+                              StaticBezierCurve& c2) const
+  {
+    using axom::utilities::lerp;
+    constexpr int H = NDIMS + 1;
+
+    c1 = *this;
+    c2 = *this;
+
+    // run de Casteljau on the homogeneous control points, storing the first
+    // and last points of each level in the left and right curves
+    T work[detail::bezier_curve_work_size<NDIMS>(MAX_ORDER)];
+    for(int p = 0; p <= m_order; ++p)
+    {
+      detail::bezier_load(m_controlPoints[p], weights(), p, work + p * H);
+    }
+
+    for(int k = 1; k <= m_order; ++k)
+    {
+      for(int p = 0; p <= m_order - k; ++p)
+      {
+        for(int i = 0; i < H; ++i)
+        {
+          work[p * H + i] = lerp(work[p * H + i], work[(p + 1) * H + i], t);
+        }
+      }
+      c1.setHomogeneous(k, work);
+      c2.setHomogeneous(m_order - k, work + (m_order - k) * H);
+    }
+  }
+
+private:
+  /// Returns the weights for the evaluation routines, null if not rational
+  AXOM_HOST_DEVICE const T* weights() const
+  {
+    return m_rational ? &m_weights[0] : nullptr;
+  }
+
+  /// Sets the control point \a idx from its homogeneous coordinates
+  AXOM_HOST_DEVICE void setHomogeneous(int idx, const T* hom)
+  {
+    for(int i = 0; i < NDIMS; ++i)
+    {
+      m_controlPoints[idx][i] = m_rational ? hom[i] / hom[NDIMS] : hom[i];
+    }
+    m_weights[idx] = m_rational ? hom[NDIMS] : T(1);
+  }
+
+private:
+  axom::StackArray<PointType, MAX_ORDER + 1> m_controlPoints;
+  axom::StackArray<T, MAX_ORDER + 1> m_weights;
+  int m_order {-1};
+  bool m_rational {false};
+};
+
+//------------------------------------------------------------------------------
+/// Free functions related to StaticBezierCurve
+//------------------------------------------------------------------------------
+template <typename T, int NDIMS, int MAX_ORDER>
+std::ostream& operator<<(std::ostream& os,
+                         const StaticBezierCurve<T, NDIMS, MAX_ORDER>& bCurve)
+{
+  return os << bCurve.toBezierCurve();
+}
+
+}  // namespace primal
+}  // namespace axom
+
+#endif  // AXOM_PRIMAL_STATICBEZIERCURVE_HPP_
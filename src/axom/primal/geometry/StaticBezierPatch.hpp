@@ -0,0 +1,374 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ * \file StaticBezierPatch.hpp
+ *
+ * \brief A Bezier patch primitive with a fixed maximum order
+ */
+
+#ifndef AXOM_PRIMAL_STATICBEZIERPATCH_HPP_
+#define AXOM_PRIMAL_STATICBEZIERPATCH_HPP_
+
+#include "axom/core/Macros.hpp"
+#include "axom/core/StackArray.hpp"
+#include "axom/core/ArrayView.hpp"
+#include "axom/slic.hpp"
+
+#include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/geometry/Vector.hpp"
+#include "axom/primal/geometry/BoundingBox.hpp"
+#include "axom/primal/geometry/BezierPatch.hpp"
+
+#include "axom/primal/operators/detail/bezier_eval_impl.hpp"
+
+#include <ostream>
+
+namespace axom
+{
+namespace primal
+{
+/*!
+ * \class StaticBezierPatch
+ *
+ * \brief Represents a (rational) Bezier patch whose control points and
+ *  weights are stored inline, in arrays sized for the maximum order.
+ *
+ * \tparam T the coordinate type, e.g., double, float, etc.
+ * \tparam NDIMS the number of dimensions
+ * \tparam MAX_ORDER the largest order of the patch along each axis
+ *
+ *  Unlike BezierPatch, a StaticBezierPatch never allocates memory, so it can
+ *  be copied into device kernels and evaluated in hot loops. Its evaluation
+ *  runs the de Casteljau algorithm in place, on a scratch buffer on the stack,
+ *  without building the intermediate isocurves.
+ *
+ * \sa BezierPatch
+ */
+template <typename T, int NDIMS, int MAX_ORDER = 3>
+class StaticBezierPatch
+{
+public:
+  using PointType = Point<T, NDIMS>;
+  using VectorType = Vector<T, NDIMS>;
+  using BoundingBoxType = BoundingBox<T, NDIMS>;
+  using BezierPatchType = BezierPatch<T, NDIMS>;
+
+  AXOM_STATIC_ASSERT_MSG((NDIMS == 1) || (NDIMS == 2) || (NDIMS == 3),
+                         "A Bezier Patch object may be defined in 1-, 2-, "
+                         "or 3-D");
+  AXOM_STATIC_ASSERT_MSG(MAX_ORDER >= 0,
+                         "The maximum order of a Bezier Patch must be "
+                         "nonnegative");
+
+public:
+  /*!
+   * \brief Constructor for a nonrational Bezier patch of the given orders,
+   *  whose control points are at the origin
+   *
+   * \param [in] ord_u the order of the patch along u
+   * \param [in] ord_v the order of the patch along v
+   * \pre -1 <= ord_u, ord_v <= MAX_ORDER
+   */
+  AXOM_HOST_DEVICE explicit StaticBezierPatch(int ord_u = -1, int ord_v = -1)
+    : m_ord_u(ord_u)
+    , m_ord_v(ord_v)
+  {
+    SLIC_ASSERT(ord_u >= -1 && ord_u <= MAX_ORDER);
+    SLIC_ASSERT(ord_v >= -1 && ord_v <= MAX_ORDER);
+  }
+
+  /*!
+   * \brief Constructor for a Bezier patch from an array of control points
+   *  and, optionally, an array of weights
+   *
+   * \param [in] pts the (ord_u + 1) x (ord_v + 1) control points, row-major
+   * \param [in] weights the weights, or null for a nonrational patch
+   * \param [in] ord_u the order of the patch along u
+   * \param [in] ord_v the order of the patch along v
+   *
+   * \pre 0 <= ord_u, ord_v <= MAX_ORDER
+   */
+  AXOM_HOST_DEVICE StaticBezierPatch(const PointType* pts,
+                                     const T* weights,
+                                     int ord_u,
+                                     int ord_v)
+    : m_ord_u(ord_u)
+    , m_ord_v(ord_v)
+    , m_rational(weights != nullptr)
+  {
+    SLIC_ASSERT(ord_u >= 0 && ord_u <= MAX_ORDER);
+    SLIC_ASSERT(ord_v >= 0 && ord_v <= MAX_ORDER);
+    SLIC_ASSERT(pts != nullptr);
+
+    const int npts = (ord_u + 1) * (ord_v + 1);
+    for(int p = 0; p < npts; ++p)
+    {
+      m_controlPoints[p] = pts[p];
+      m_weights[p] = m_rational ? weights[p] : T(1);
+    }
+  }
+
+  /*!
+   * \brief Constructor from a BezierPatch
+   *
+   * \pre the orders of \a patch are at most MAX_ORDER
+   */
+  explicit StaticBezierPatch(const BezierPatchType& patch)
+    : m_ord_u(patch.getOrder_u())
+    , m_ord_v(patch.getOrder_v())
+    , m_rational(patch.isRational())
+  {
+    SLIC_ASSERT(m_ord_u <= MAX_ORDER && m_ord_v <= MAX_ORDER);
+
+    for(int p = 0; p <= m_ord_u; ++p)
+    {
+      for(int q = 0; q <= m_ord_v; ++q)
+      {
+        m_controlPoints[index(p, q)] = patch(p, q);
+        m_weights[index(p, q)] = m_rational ? patch.getWeight(p, q) : T(1);
+      }
+    }
+  }
+
+  /// Returns a BezierPatch with the same control points and weights
+  BezierPatchType toBezierPatch() const
+  {
+    BezierPatchType patch(m_ord_u, m_ord_v);
+    if(m_rational)
+    {
+      patch.makeRational();
+    }
+    for(int p = 0; p <= m_ord_u; ++p)
+    {
+      for(int q = 0; q <= m_ord_v; ++q)
+      {
+        patch(p, q) = m_controlPoints[index(p, q)];
+        if(m_rational)
+        {
+          patch.setWeight(p, q, m_weights[index(p, q)]);
+        }
+      }
+    }
+    return patch;
+  }
+
+  /// Returns the order of the Bezier patch on the first axis
+  AXOM_HOST_DEVICE int getOrder_u() const { return m_ord_u; }
+
+  /// Returns the order of the Bezier patch on the second axis
+  AXOM_HOST_DEVICE int getOrder_v() const { return m_ord_v; }
+
+  /// Returns true if the Bezier patch is rational
+  AXOM_HOST_DEVICE bool isRational() const { return m_rational; }
+
+  /// Makes the patch rational, with unit weights
+  AXOM_HOST_DEVICE void makeRational()
+  {
+    if(!m_rational)
+    {
+      const int npts = (m_ord_u + 1) * (m_ord_v + 1);
+      for(int p = 0; p < npts; ++p)
+      {
+        m_weights[p] = T(1);
+      }
+      m_rational = true;
+    }
+  }
+
+  /// Makes the patch nonrational, by discarding its weights
+  AXOM_HOST_DEVICE void makeNonrational() { m_rational = false; }
+
+  /// Retrieves the control point at index \a (ui, vi)
+  AXOM_HOST_DEVICE PointType& operator()(int ui, int vi)
+  {
+    return m_controlPoints[index(ui, vi)];
+  }
+
+  /// Retrieves the control point at index \a (ui, vi)
+  AXOM_HOST_DEVICE const PointType& operator()(int ui, int vi) const
+  {
+    return m_controlPoints[index(ui, vi)];
+  }
+
+  /// Returns the weight of the control point at index \a (ui, vi)
+  AXOM_HOST_DEVICE T getWeight(int ui, int vi) const
+  {
+    return m_rational ? m_weights[index(ui, vi)] : T(1);
+  }
+
+  /*!
+   * \brief Sets the weight of the control point at index \a (ui, vi)
+   *
+   * \pre the patch is rational and \a weight is positive
+   */
+  AXOM_HOST_DEVICE void setWeight(int ui, int vi, T weight)
+  {
+    SLIC_ASSERT(m_rational);
+    SLIC_ASSERT(weight > 0);
+    m_weights[index(ui, vi)] = weight;
+  }
+
+  /// Returns an axis-aligned bounding box containing the Bezier patch
+  AXOM_HOST_DEVICE BoundingBoxType boundingBox() const
+  {
+    return BoundingBoxType(&m_controlPoints[0],
+                           (m_ord_u + 1) * (m_ord_v + 1));
+  }
+
+  /*!
+   * \brief Evaluates the Bezier patch at a parameter value (\a u, \a v)
+   *
+   * \param [in] u parameter value at which to evaluate on the first axis
+   * \param [in] v parameter value at which to evaluate on the second axis
+   * \return p the value of the Bezier patch at (u, v)
+   */
+  AXOM_HOST_DEVICE PointType evaluate(T u, T v) const
+  {
+    PointType eval;
+    T work[detail::bezier_patch_work_size<NDIMS>(MAX_ORDER, MAX_ORDER)];
+    detail::bezier_patch_evaluate(&m_controlPoints[0],
+                                  weights(),
+                                  m_ord_u,
+                                  m_ord_v,
+                                  u,
+                                  v,
+                                  work,
+                                  eval,
+                                  static_cast<VectorType*>(nullptr),
+                                  static_cast<VectorType*>(nullptr));
+    return eval;
+  }
+
+  /*!
+   * \brief Evaluates the Bezier patch at a batch of parameter values
+   *
+   * \param [in] u parameter values at which to evaluate on the first axis
+   * \param [in] v parameter values at which to evaluate on the second axis
+   * \param [out] out the value of the Bezier patch at each (u[i], v[i])
+   *
+   * \pre u.size() == v.size() and out.size() >= u.size()
+   */
+  AXOM_HOST_DEVICE void evaluate(axom::ArrayView<const T> u,
+                                 axom::ArrayView<const T> v,
+                                 axom::ArrayView<PointType> out) const
+  {
+    SLIC_ASSERT(u.size() == v.size());
+    SLIC_ASSERT(out.size() >= u.size());
+
+    T work[detail::bezier_patch_work_size<NDIMS>(MAX_ORDER, MAX_ORDER)];
+    for(IndexType i = 0; i < u.size(); ++i)
+    {
+      detail::bezier_patch_evaluate(&m_controlPoints[0],
+                                    weights(),
+                                    m_ord_u,
+                                    m_ord_v,
+                                    u[i],
+                                    v[i],
+                                    work,
+                                    out[i],
+                                    static_cast<VectorType*>(nullptr),
+                                    static_cast<VectorType*>(nullptr));
+    }
+  }
+
+  /*!
+   * \brief Evaluates the Bezier patch and its first derivatives at (\a u, \a v)
+   *
+   * \param [in] u Parameter value at which to evaluate on the first axis
+   * \param [in] v Parameter value at which to evaluate on the second axis
+   * \param [out] eval The point value of the Bezier patch at (u, v)
+   * \param [out] Du The vector value of S_u(u, v)
+   * \param [out] Dv The vector value of S_v(u, v)
+   */
+  AXOM_HOST_DEVICE void evaluate_first_derivatives(T u,
+                                                   T v,
+                                                   PointType& eval,
+                                                   VectorType& Du,
+                                                   VectorType& Dv) const
+  {
+    T work[detail::bezier_patch_work_size<NDIMS>(MAX_ORDER, MAX_ORDER)];
+    detail::bezier_patch_evaluate(&m_controlPoints[0],
+                                  weights(),
+                                  m_ord_u,
+                                  m_ord_v,
+                                  u,
+                                  v,
+                                  work,
+                                  eval,
+                                  &Du,
+                                  &Dv);
+  }
+
+  /// Computes a tangent of the Bezier patch at (\a u, \a v) along the u axis
+  AXOM_HOST_DEVICE VectorType du(T u, T v) const
+  {
+    PointType eval;
+    VectorType Du, Dv;
+    evaluate_first_derivatives(u, v, eval, Du, Dv);
+    return Du;
+  }
+
+  /// Computes a tangent of the Bezier patch at (\a u, \a v) along the v axis
+  AXOM_HOST_DEVICE VectorType dv(T u, T v) const
+  {
+    PointType eval;
+    VectorType Du, Dv;
+    evaluate_first_derivatives(u, v, eval, Du, Dv);
+    return Dv;
+  }
+
+  /*!
+   * \brief Computes the normal vector of the Bezier patch at (\a u, \a v)
+   *
+   * \note Only available in 3D
+   */
+  AXOM_HOST_DEVICE VectorType normal(T u, T v) const
+  {
+    PointType eval;
+    VectorType Du, Dv;
+    evaluate_first_derivatives(u, v, eval, Du, Dv);
+    return VectorType::cross_product(Du, Dv);
+  }
+
+private:
+  /// Returns the index of the control point (ui, vi) in the row-major arrays
+  AXOM_HOST_DEVICE int index(int ui, int vi) const
+  {
+    SLIC_ASSERT(ui >= 0 && ui <= m_ord_u);
+    SLIC_ASSERT(vi >= 0 && vi <= m_ord_v);
+    return ui * (m_ord_v + 1) + vi;
+  }
+
+  /// Returns the weights for the evaluation routines, null if not rational
+  AXOM_HOST_DEVICE const T* weights() const
+  {
+    return m_rational ? &m_weights[0] : nullptr;
+  }
+
+private:
+  static constexpr int MAX_POINTS = (MAX_ORDER + 1) * (MAX_ORDER + 1);
+
+  axom::StackArray<PointType, MAX_POINTS> m_controlPoints;
+  axom::StackArray<T, MAX_POINTS> m_weights;
+  int m_ord_u {-1};
+  int m_ord_v {-1};
+  bool m_rational {false};
+};
+
+//------------------------------------------------------------------------------
+/// Free functions related to StaticBezierPatch
+//------------------------------------------------------------------------------
+template <typename T, int NDIMS, int MAX_ORDER>
+std::ostream& operator<<(std::ostream& os,
+                         const StaticBezierPatch<T, NDIMS, MAX_ORDER>& bPatch)
+{
+  return os << bPatch.toBezierPatch();
+}
+
+}  // namespace primal
+}  // namespace axom
+
+#endif  // AXOM_PRIMAL_STATICBEZIERPATCH_HPP_
@@ -0,0 +1,272 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_PRIMAL_BEZIER_EVAL_IMPL_HPP_
+#define AXOM_PRIMAL_BEZIER_EVAL_IMPL_HPP_
+
+#include "axom/core/Macros.hpp"
+#include "axom/core/utilities/Utilities.hpp"
+
+#include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/geometry/Vector.hpp"
+
+#include <vector>
+
+namespace axom
+{
+namespace primal
+{
+namespace detail
+{
+/*!
+ * \brief Runs the de Casteljau algorithm in place on the \a ord + 1
+ *  homogeneous points of \a buf, each with \a H components.
+ *
+ *  The reduction stops one level early, so that the derivative is obtained
+ *  from the difference of the last two points.
+ *
+ * \param [in,out] buf the control points, overwritten by the reduction
+ * \param [in] ord the order of the curve
+ * \param [in] t the parameter value
+ * \param [out] val the \a H components of the curve at \a t
+ * \param [out] der the \a H components of the derivative at \a t, if not null
+ */
+template <int H, typename T>
+AXOM_HOST_DEVICE inline void bezier_reduce(T* buf, int ord, T t, T* val, T* der)
+{
+  using axom::utilities::lerp;
+
+  for(int p = 1; p <= ord - 1; ++p)
+  {
+    const int end = ord - p;
+    for(int k = 0; k <= end; ++k)
+    {
+      for(int i = 0; i < H; ++i)
+      {
+        buf[k * H + i] = lerp(buf[k * H + i], buf[(k + 1) * H + i], t);
+      }
+    }
+  }
+
+  for(int i = 0; i < H; ++i)
+  {
+    if(ord == 0)
+    {
+      val[i] = buf[i];
+      if(der != nullptr)
+      {
+        der[i] = 0.0;
+      }
+    }
+    else
+    {
+      val[i] = lerp(buf[i], buf[H + i], t);
+      if(der != nullptr)
+      {
+        der[i] = ord * (buf[H + i] - buf[i]);
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Copies a control point to \a H = NDIMS + 1 homogeneous components,
+ *  i.e. (w x, w y, w z, w), with w = 1 when \a weights is null.
+ */
+template <typename T, int NDIMS>
+AXOM_HOST_DEVICE inline void bezier_load(const Point<T, NDIMS>& pt,
+                                         const T* weights,
+                                         int idx,
+                                         T* dst)
+{
+  const T w = (weights != nullptr) ? weights[idx] : T(1);
+  for(int i = 0; i < NDIMS; ++i)
+  {
+    dst[i] = (weights != nullptr) ? pt[i] * w : pt[i];
+  }
+  dst[NDIMS] = w;
+}
+
+/*!
+ * \brief Projects homogeneous values and derivatives back to NDIMS
+ *
+ *  For a rational curve, the derivative of P / W is (P' - S W') / W.
+ */
+template <typename T, int NDIMS>
+AXOM_HOST_DEVICE inline void bezier_project(const T* val,
+                                            const T* der,
+                                            bool rational,
+                                            Point<T, NDIMS>& eval,
+                                            Vector<T, NDIMS>* D)
+{
+  for(int i = 0; i < NDIMS; ++i)
+  {
+    eval[i] = rational ? val[i] / val[NDIMS] : val[i];
+    if(D != nullptr)
+    {
+      (*D)[i] =
+        rational ? (der[i] - eval[i] * der[NDIMS]) / val[NDIMS] : der[i];
+    }
+  }
+}
+
+/// \brief Returns the size of the work array of bezier_curve_evaluate()
+template <int NDIMS>
+AXOM_HOST_DEVICE constexpr int bezier_curve_work_size(int ord)
+{
+  return (ord + 1) * (NDIMS + 1);
+}
+
+/// \brief Returns the size of the work array of bezier_patch_evaluate()
+template <int NDIMS>
+AXOM_HOST_DEVICE constexpr int bezier_patch_work_size(int ord_u, int ord_v)
+{
+  return (ord_u >= ord_v) ? (ord_u + 1 + 2 * (ord_v + 1)) * (NDIMS + 1)
+                          : (ord_v + 1 + 2 * (ord_u + 1)) * (NDIMS + 1);
+}
+
+/*!
+ * \brief Evaluates a (rational) Bezier curve and, optionally, its derivative
+ *  with the de Casteljau algorithm, without allocating memory.
+ *
+ * \param [in] pts the \a ord + 1 control points
+ * \param [in] weights the weights of the control points, or null when the
+ *  curve is not rational
+ * \param [in] ord the order of the curve
+ * \param [in] t the parameter value
+ * \param [in] work scratch space of bezier_curve_work_size(ord) values
+ * \param [out] eval the point of the curve at \a t
+ * \param [out] Dt the tangent of the curve at \a t, if not null
+ */
+template <typename T, int NDIMS>
+AXOM_HOST_DEVICE inline void bezier_curve_evaluate(const Point<T, NDIMS>* pts,
+                                                   const T* weights,
+                                                   int ord,
+                                                   T t,
+                                                   T* work,
+                                                   Point<T, NDIMS>& eval,
+                                                   Vector<T, NDIMS>* Dt)
+{
+  constexpr int H = NDIMS + 1;
+  for(int p = 0; p <= ord; ++p)
+  {
+    bezier_load(pts[p], weights, p, work + p * H);
+  }
+
+  T val[H];
+  T der[H];
+  bezier_reduce<H>(work, ord, t, val, Dt != nullptr ? der : nullptr);
+  bezier_project(val, der, weights != nullptr, eval, Dt);
+}
+
+/*!
+ * \brief Evaluates a (rational) Bezier patch and, optionally, its first
+ *  derivatives with the de Casteljau algorithm, without allocating memory.
+ *
+ *  The patch is first reduced along its axis of highest order, for each of
+ *  the rows of control points of the other axis, which leaves a curve (and
+ *  the curve of its derivatives) along the other axis.
+ *
+ * \param [in] pts the (ord_u + 1) x (ord_v + 1) control points, row-major
+ * \param [in] weights the weights of the control points, or null when the
+ *  patch is not rational
+ * \param [in] ord_u the order of the patch along u
+ * \param [in] ord_v the order of the patch along v
+ * \param [in] u the parameter value along u
+ * \param [in] v the parameter value along v
+ * \param [in] work scratch space of bezier_patch_work_size(ord_u, ord_v) values
+ * \param [out] eval the point of the patch at (u, v)
+ * \param [out] Du the derivative of the patch along u, if not null
+ * \param [out] Dv the derivative of the patch along v, if not null
+ */
+template <typename T, int NDIMS>
+AXOM_HOST_DEVICE inline void bezier_patch_evaluate(const Point<T, NDIMS>* pts,
+                                                   const T* weights,
+                                                   int ord_u,
+                                                   int ord_v,
+                                                   T u,
+                                                   T v,
+                                                   T* work,
+                                                   Point<T, NDIMS>& eval,
+                                                   Vector<T, NDIMS>* Du,
+                                                   Vector<T, NDIMS>* Dv)
+{
+  constexpr int H = NDIMS + 1;
+
+  // axis a is reduced first, then axis b
+  const bool u_first = ord_u >= ord_v;
+  const int ord_a = u_first ? ord_u : ord_v;
+  const int ord_b = u_first ? ord_v : ord_u;
+  const T ta = u_first ? u : v;
+  const T tb = u_first ? v : u;
+  const int stride_a = u_first ? ord_v + 1 : 1;
+  const int stride_b = u_first ? 1 : ord_v + 1;
+  const bool derivs = (Du != nullptr) || (Dv != nullptr);
+
+  T* line = work;
+  T* curve = line + (ord_a + 1) * H;
+  T* dcurve = curve + (ord_b + 1) * H;
+
+  for(int j = 0; j <= ord_b; ++j)
+  {
+    for(int i = 0; i <= ord_a; ++i)
+    {
+      const int idx = i * stride_a + j * stride_b;
+      bezier_load(pts[idx], weights, idx, line + i * H);
+    }
+    bezier_reduce<H>(line,
+                     ord_a,
+                     ta,
+                     curve + j * H,
+                     derivs ? dcurve + j * H : nullptr);
+  }
+
+  T val[H];
+  T der_a[H];
+  T der_b[H];
+  bezier_reduce<H>(curve, ord_b, tb, val, derivs ? der_b : nullptr);
+  if(derivs)
+  {
+    bezier_reduce<H>(dcurve, ord_b, tb, der_a, static_cast<T*>(nullptr));
+  }
+
+  const bool rational = weights != nullptr;
+  bezier_project(val, der_a, rational, eval, u_first ? Du : Dv);
+  bezier_project(val, der_b, rational, eval, u_first ? Dv : Du);
+}
+
+/*!
+ * \brief Scratch space for the Bezier evaluation routines, on the stack when
+ *  it has at most \a N values and on the heap otherwise.
+ */
+template <typename T, int N = 256>
+class BezierWorkspace
+{
+public:
+  explicit BezierWorkspace(int size) : m_data(m_stack)
+  {
+    if(size > N)
+    {
+      m_heap.resize(size);
+      m_data = m_heap.data();
+    }
+  }
+
+  BezierWorkspace(const BezierWorkspace&) = delete;
+  BezierWorkspace& operator=(const BezierWorkspace&) = delete;
+
+  T* data() { return m_data; }
+
+private:
+  T m_stack[N];
+  std::vector<T> m_heap;
+  T* m_data;
+};
+
+}  // namespace detail
+}  // namespace primal
+}  // namespace axom
+
+#endif  // AXOM_PRIMAL_BEZIER_EVAL_IMPL_HPP_
@@ -0,0 +1,429 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_PRIMAL_INTERSECTION_VOLUME_IMPL_HPP_
+#define AXOM_PRIMAL_INTERSECTION_VOLUME_IMPL_HPP_
+
+#include "axom/core/Macros.hpp"
+#include "axom/core/utilities/Utilities.hpp"
+#include "axom/slic.hpp"
+
+#include "axom/primal/constants.hpp"
+#include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/geometry/Vector.hpp"
+#include "axom/primal/geometry/Plane.hpp"
+#include "axom/primal/geometry/Hexahedron.hpp"
+#include "axom/primal/geometry/Octahedron.hpp"
+#include "axom/primal/geometry/Tetrahedron.hpp"
+
+#include <cstdint>
+
+namespace axom
+{
+namespace primal
+{
+namespace detail
+{
+/*!
+ * \class CompactPolyhedron
+ *
+ * \brief A convex polyhedron whose vertices all have three neighbors, which
+ *  is clipped against planes and reduced to its moments without ever being
+ *  turned into a Polyhedron.
+ *
+ *  This follows r3d (Powell and Abel, "An exact general remeshing scheme
+ *  applied to physically conservative voxelization", J. Comput. Phys. 2015):
+ *  since every vertex has exactly three neighbors, and every vertex created
+ *  by a clipping plane also has three neighbors, the connectivity is a fixed
+ *  size table that is patched in place, instead of the general neighbor lists
+ *  of Polyhedron. The vertices of degree four of an octahedron are split in
+ *  two vertices of degree three, joined by an edge of zero length.
+ *
+ *  The neighbors of a vertex are ordered such that a face is traversed by
+ *  going from neighbor i of a vertex to the vertex, then to its neighbor
+ *  i - 1, as in Polyhedron, so both classes compute the same signed volumes.
+ *
+ * \sa Polyhedron, clipPolyhedron()
+ */
+template <typename T>
+class CompactPolyhedron
+{
+public:
+  static constexpr int MAX_VERTS = 32;
+
+  using PointType = Point<T, 3>;
+  using VectorType = Vector<T, 3>;
+  using PlaneType = Plane<T, 3>;
+
+public:
+  /*!
+   * \brief Creates the polyhedron of a hexahedron, whose vertices 1, 3 and
+   *  5, 7 are swapped when \a tryFixOrientation is true and its signed
+   *  volume is negative, as in Polyhedron::from_primitive()
+   */
+  AXOM_HOST_DEVICE CompactPolyhedron(const Hexahedron<T, 3>& hex,
+                                     bool tryFixOrientation)
+  {
+    constexpr std::int8_t nbrs[8][3] = {{1, 4, 3},
+                                        {0, 2, 5},
+                                        {1, 3, 6},
+                                        {2, 0, 7},
+                                        {0, 5, 7},
+                                        {1, 6, 4},
+                                        {2, 7, 5},
+                                        {3, 4, 6}};
+    m_num_verts = 8;
+    for(int v = 0; v < 8; ++v)
+    {
+      setVertex(v, hex[v], nbrs[v]);
+    }
+
+    if(tryFixOrientation && signedVolume() < 0)
+    {
+      axom::utilities::swap(m_pos[1], m_pos[3]);
+      axom::utilities::swap(m_pos[5], m_pos[7]);
+    }
+  }
+
+  /*!
+   * \brief Creates the polyhedron of a tetrahedron, whose vertices 1 and 2
+   *  are swapped when \a tryFixOrientation is true and its signed volume is
+   *  negative, as in Polyhedron::from_primitive()
+   */
+  AXOM_HOST_DEVICE CompactPolyhedron(const Tetrahedron<T, 3>& tet,
+                                     bool tryFixOrientation)
+  {
+    constexpr std::int8_t nbrs[4][3] = {{1, 3, 2},
+                                        {0, 2, 3},
+                                        {0, 3, 1},
+                                        {0, 1, 2}};
+    m_num_verts = 4;
+    for(int v = 0; v < 4; ++v)
+    {
+      setVertex(v, tet[v], nbrs[v]);
+    }
+
+    if(tryFixOrientation && tet.signedVolume() < 0)
+    {
+      axom::utilities::swap(m_pos[1], m_pos[2]);
+    }
+  }
+
+  /*!
+   * \brief Creates the polyhedron of an octahedron, whose vertices 1, 2 and
+   *  4, 5 are swapped when \a tryFixOrientation is true and its signed
+   *  volume is negative, as in Polyhedron::from_primitive()
+   *
+   *  Vertex v of the octahedron is split in vertices 2v and 2v + 1, which
+   *  hold its first two and last two neighbors, respectively.
+   */
+  AXOM_HOST_DEVICE CompactPolyhedron(const Octahedron<T, 3>& oct,
+                                     bool tryFixOrientation)
+  {
+    constexpr std::int8_t nbrs[12][3] = {{2, 10, 1},
+                                         {8, 4, 0},
+                                         {0, 5, 3},
+                                         {6, 10, 2},
+                                         {1, 9, 5},
+                                         {6, 2, 4},
+                                         {3, 5, 7},
+                                         {9, 11, 6},
+                                         {1, 11, 9},
+                                         {7, 4, 8},
+                                         {0, 3, 11},
+                                         {7, 8, 10}};
+    m_num_verts = 12;
+    for(int v = 0; v < 12; ++v)
+    {
+      setVertex(v, oct[v / 2], nbrs[v]);
+    }
+
+    if(tryFixOrientation && signedVolume() < 0)
+    {
+      for(int i = 0; i < 2; ++i)
+      {
+        axom::utilities::swap(m_pos[2 + i], m_pos[4 + i]);
+        axom::utilities::swap(m_pos[8 + i], m_pos[10 + i]);
+      }
+    }
+  }
+
+  /// Returns the number of vertices of the polyhedron
+  AXOM_HOST_DEVICE int numVertices() const { return m_num_verts; }
+
+  /// Returns the position of vertex \a v
+  AXOM_HOST_DEVICE const PointType& operator[](int v) const
+  {
+    return m_pos[v];
+  }
+
+  /*!
+   * \brief Clips the polyhedron against the half-space above a plane
+   *
+   * \param [in] plane The plane defining the half-space
+   * \param [in] eps The tolerance for plane point orientation
+   *
+   * \return false if there was not enough room for the new vertices, in
+   *  which case the polyhedron is left in an invalid state
+   *
+   * \note The polyhedron becomes empty when none of its vertices is above the
+   *  plane, and is unchanged when none is below it, as in clipPolyhedron().
+   *  Otherwise, vertices are split by the sign of their distance to the
+   *  plane, so each new vertex lies on the edge it replaces and vertices
+   *  within \a eps below the plane are moved onto it.
+   */
+  AXOM_HOST_DEVICE bool clip(const PlaneType& plane, double eps)
+  {
+    if(m_num_verts == 0)
+    {
+      return true;
+    }
+
+    T sdist[MAX_VERTS];
+    bool anyAbove = false;
+    bool anyBelow = false;
+    for(int v = 0; v < m_num_verts; ++v)
+    {
+      sdist[v] = plane.signedDistance(m_pos[v]);
+      anyAbove = anyAbove || sdist[v] > eps;
+      anyBelow = anyBelow || sdist[v] < -eps;
+    }
+
+    if(!anyAbove)
+    {
+      m_num_verts = 0;
+      return true;
+    }
+    if(!anyBelow)
+    {
+      return true;
+    }
+
+    // insert a vertex on each edge from a kept vertex to a clipped one
+    const int oldVerts = m_num_verts;
+    int numVerts = oldVerts;
+    for(int v = 0; v < oldVerts; ++v)
+    {
+      if(sdist[v] < 0)
+      {
+        continue;
+      }
+
+      for(int j = 0; j < 3; ++j)
+      {
+        const int n = m_nbrs[v][j];
+        if(sdist[n] >= 0)
+        {
+          continue;
+        }
+
+        if(numVerts == MAX_VERTS)
+        {
+          return false;
+        }
+
+        // sdist[v] >= 0 > sdist[n], so t is in [0, 1]
+        const T t = sdist[v] / (sdist[v] - sdist[n]);
+        for(int d = 0; d < 3; ++d)
+        {
+          m_pos[numVerts][d] =
+            axom::utilities::lerp(m_pos[v][d], m_pos[n][d], t);
+        }
+        m_nbrs[numVerts][0] = v;
+        m_nbrs[v][j] = numVerts;
+        ++numVerts;
+      }
+    }
+
+    // link the new vertices around the new face, by walking along the old
+    // face from each new vertex through the kept vertices to the next one
+    for(int vstart = oldVerts; vstart < numVerts; ++vstart)
+    {
+      int prev = vstart;
+      int cur = m_nbrs[vstart][0];
+      do
+      {
+        const int next = m_nbrs[cur][(slot(cur, prev) + 2) % 3];
+        prev = cur;
+        cur = next;
+      } while(cur < oldVerts);
+
+      m_nbrs[vstart][1] = cur;
+      m_nbrs[cur][2] = vstart;
+    }
+
+    // remove the clipped vertices
+    std::int8_t newIndices[MAX_VERTS];
+    int count = 0;
+    for(int v = 0; v < numVerts; ++v)
+    {
+      const bool clipped = v < oldVerts && sdist[v] < 0;
+      newIndices[v] = clipped ? -1 : count++;
+    }
+    for(int v = 0; v < numVerts; ++v)
+    {
+      const int nv = newIndices[v];
+      if(nv >= 0)
+      {
+        m_pos[nv] = m_pos[v];
+        for(int j = 0; j < 3; ++j)
+        {
+          m_nbrs[nv][j] = newIndices[m_nbrs[v][j]];
+        }
+      }
+    }
+    m_num_verts = count;
+
+    return true;
+  }
+
+  /*!
+   * \brief Computes the volume (0th moment) and the centroid (1st moment
+   *  over volume) of the polyhedron
+   *
+   * \sa Polyhedron::moments()
+   */
+  AXOM_HOST_DEVICE void moments(T& volume,
+                                PointType& centroid,
+                                bool should_compute_centroid = true) const
+  {
+    volume = 0;
+    if(m_num_verts < 4)
+    {
+      return;
+    }
+
+    // fan triangulation of each face, walked once through its first edge
+    bool visited[MAX_VERTS][3] = {};
+    const PointType& origin = m_pos[0];
+    VectorType centroid_vector;
+    for(int vstart = 0; vstart < m_num_verts; ++vstart)
+    {
+      for(int jstart = 0; jstart < 3; ++jstart)
+      {
+        if(visited[vstart][jstart])
+        {
+          continue;
+        }
+        visited[vstart][jstart] = true;
+
+        const VectorType v0(origin, m_pos[vstart]);
+        int prev = vstart;
+        int cur = m_nbrs[vstart][jstart];
+        int j = (slot(cur, prev) + 2) % 3;
+        visited[cur][j] = true;
+        int next = m_nbrs[cur][j];
+
+        while(next != vstart)
+        {
+          const VectorType v1(origin, m_pos[cur]);
+          const VectorType v2(origin, m_pos[next]);
+          const T curVol = VectorType::scalar_triple_product(v0, v1, v2);
+          volume += curVol;
+          if(should_compute_centroid)
+          {
+            centroid_vector += (v0 + v1 + v2) * curVol;
+          }
+
+          prev = cur;
+          cur = next;
+          j = (slot(cur, prev) + 2) % 3;
+          visited[cur][j] = true;
+          next = m_nbrs[cur][j];
+        }
+      }
+    }
+
+    volume /= 6.;
+
+    if(should_compute_centroid)
+    {
+      centroid_vector /=
+        (volume != 0.0) ? (24.0 * volume) : axom::primal::PRIMAL_TINY;
+      centroid = centroid_vector + origin;
+    }
+  }
+
+  /// Returns the signed volume of the polyhedron
+  AXOM_HOST_DEVICE T signedVolume() const
+  {
+    T volume;
+    PointType centroid;
+    moments(volume, centroid, false);
+    return volume;
+  }
+
+private:
+  AXOM_HOST_DEVICE void setVertex(int v,
+                                  const PointType& pos,
+                                  const std::int8_t* nbrs)
+  {
+    m_pos[v] = pos;
+    for(int j = 0; j < 3; ++j)
+    {
+      m_nbrs[v][j] = nbrs[j];
+    }
+  }
+
+  /// Returns the slot of neighbor \a nbr in the neighbors of vertex \a v
+  AXOM_HOST_DEVICE int slot(int v, int nbr) const
+  {
+    return (m_nbrs[v][0] == nbr) ? 0 : ((m_nbrs[v][1] == nbr) ? 1 : 2);
+  }
+
+private:
+  PointType m_pos[MAX_VERTS];
+  std::int8_t m_nbrs[MAX_VERTS][3];
+  int m_num_verts {0};
+};
+
+/*!
+ * \brief Computes the volume of the part of \a poly inside a tetrahedron,
+ *  by clipping it against the planes of the faces of the tetrahedron.
+ *
+ * \param [in] poly The polyhedron to clip, which is modified
+ * \param [in] tet The tetrahedron
+ * \param [in] eps The tolerance for plane point orientation
+ * \param [in] tryFixOrientation If true, swaps vertices 1 and 2 of \a tet
+ *  when its signed volume is negative
+ * \param [out] volume The unsigned volume of the intersection
+ *
+ * \return false if \a poly ran out of room for its vertices, in which case
+ *  \a volume is not set
+ */
+template <typename T>
+AXOM_HOST_DEVICE bool clipped_volume(CompactPolyhedron<T>& poly,
+                                     const Tetrahedron<T, 3>& tet,
+                                     double eps,
+                                     bool tryFixOrientation,
+                                     T& volume)
+{
+  const bool flip = tryFixOrientation && tet.signedVolume() < 0;
+  const int i1 = flip ? 2 : 1;
+  const int i2 = flip ? 1 : 2;
+
+  // (Ordering here matters to get the correct winding)
+  const Plane<T, 3> planes[4] = {make_plane(tet[i1], tet[3], tet[i2]),
+                                 make_plane(tet[0], tet[i2], tet[3]),
+                                 make_plane(tet[0], tet[3], tet[i1]),
+                                 make_plane(tet[0], tet[i1], tet[i2])};
+
+  for(int i = 0; i < 4 && poly.numVertices() > 0; ++i)
+  {
+    if(!poly.clip(planes[i], eps))
+    {
+      return false;
+    }
+  }
+
+  volume = axom::utilities::abs(poly.signedVolume());
+  return true;
+}
+
+}  // namespace detail
+}  // namespace primal
+}  // namespace axom
+
+#endif  // AXOM_PRIMAL_INTERSECTION_VOLUME_IMPL_HPP_
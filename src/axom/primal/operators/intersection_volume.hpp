@@ -14,12 +14,16 @@
 #ifndef AXOM_PRIMAL_INTERSECTION_VOLUME_HPP_
 #define AXOM_PRIMAL_INTERSECTION_VOLUME_HPP_
 
-#include "axom/primal/geometry/Tetrahedron.hpp"
+#include "axom/core/ArrayView.hpp"
+#include "axom/slic.hpp"
+
+#include "axom/primal/geometry/Hexahedron.hpp"
 #include "axom/primal/geometry/Octahedron.hpp"
 #include "axom/primal/geometry/Polyhedron.hpp"
 #include "axom/primal/geometry/Tetrahedron.hpp"
 
 #include "axom/primal/operators/clip.hpp"
+#include "axom/primal/operators/detail/intersection_volume_impl.hpp"
 
 namespace axom
 {
@@ -49,6 +53,10 @@ namespace primal
  *          a negative signed volume, the returned volume of intersection
  *          may be zero and/or unexpected.
  *
+ * \note The volume is accumulated while clipping the hexahedron against the
+ *       planes of the tetrahedron, without building the Polyhedron returned
+ *       by clip(), which is only used if the clipped hexahedron has too many
+ *       vertices.
  */
 template <typename T>
 AXOM_HOST_DEVICE T intersection_volume(const Hexahedron<T, 3>& hex,
@@ -56,6 +64,12 @@ AXOM_HOST_DEVICE T intersection_volume(const Hexahedron<T, 3>& hex,
                                        double eps = 1.e-10,
                                        bool tryFixOrientation = false)
 {
+  T volume;
+  detail::CompactPolyhedron<T> poly(hex, tryFixOrientation);
+  if(detail::clipped_volume(poly, tet, eps, tryFixOrientation, volume))
+  {
+    return volume;
+  }
   return clip(hex, tet, eps, tryFixOrientation).volume();
 }
 
@@ -117,6 +131,10 @@ AXOM_HOST_DEVICE T intersection_volume(const Tetrahedron<T, 3>& tet,
  *          a negative signed volume, the returned volume of intersection
  *          may be zero and/or unexpected.
  *
+ * \note The volume is accumulated while clipping the octahedron against the
+ *       planes of the tetrahedron, without building the Polyhedron returned
+ *       by clip(), which is only used if the clipped octahedron has too many
+ *       vertices.
  */
 template <typename T>
 AXOM_HOST_DEVICE T intersection_volume(const Octahedron<T, 3>& oct,
@@ -124,6 +142,12 @@ AXOM_HOST_DEVICE T intersection_volume(const Octahedron<T, 3>& oct,
                                        double eps = 1.e-10,
                                        bool tryFixOrientation = false)
 {
+  T volume;
+  detail::CompactPolyhedron<T> poly(oct, tryFixOrientation);
+  if(detail::clipped_volume(poly, tet, eps, tryFixOrientation, volume))
+  {
+    return volume;
+  }
   return clip(oct, tet, eps, tryFixOrientation).volume();
 }
 
@@ -185,6 +209,9 @@ AXOM_HOST_DEVICE T intersection_volume(const Tetrahedron<T, 3>& tet,
  *          a negative signed volume, the returned volume of intersection
  *          may be zero and/or unexpected.
  *
+ * \note The volume is accumulated while clipping the first tetrahedron
+ *       against the planes of the second one, without building the
+ *       Polyhedron returned by clip().
  */
 template <typename T>
 AXOM_HOST_DEVICE T intersection_volume(const Tetrahedron<T, 3>& tet1,
@@ -192,9 +219,55 @@ AXOM_HOST_DEVICE T intersection_volume(const Tetrahedron<T, 3>& tet1,
                                        double eps = 1.e-10,
                                        bool tryFixOrientation = false)
 {
+  T volume;
+  detail::CompactPolyhedron<T> poly(tet1, tryFixOrientation);
+  if(detail::clipped_volume(poly, tet2, eps, tryFixOrientation, volume))
+  {
+    return volume;
+  }
   return clip(tet1, tet2, eps, tryFixOrientation).volume();
 }
 
+/*!
+ * \brief Finds the absolute (unsigned) intersection volumes between pairs
+ *        of shapes, e.g. hexahedra, octahedra or tetrahedra, and tetrahedra
+ *
+ * \param [in] shapes The first shape of each pair
+ * \param [in] tets The tetrahedron of each pair
+ * \param [out] volumes The intersection volume of each pair
+ * \param [in] eps The tolerance for determining the intersection
+ * \param [in] tryFixOrientation If true, takes each shape with a negative
+ *             signed volume and swaps the order of some vertices in that
+ *             shape to try to obtain a nonnegative signed volume.
+ *             Defaults to false.
+ *
+ * \pre shapes.size() == tets.size() and volumes.size() >= shapes.size()
+ *
+ * \note The pairs are processed in a plain loop over the arrays, which can
+ *       be called from a device kernel on a batch of pairs, and the inputs
+ *       are only read once, in order.
+ *
+ * \sa intersection_volume()
+ */
+template <typename ShapeType, typename TetrahedronType, typename T>
+AXOM_HOST_DEVICE void intersection_volume(
+  axom::ArrayView<ShapeType> shapes,
+  axom::ArrayView<TetrahedronType> tets,
+  axom::ArrayView<T> volumes,
+  double eps = 1.e-10,
+  bool tryFixOrientation = false)
+{
+  SLIC_ASSERT(shapes.size() == tets.size());
+  SLIC_ASSERT(volumes.size() >= shapes.size());
+
+  const IndexType n = shapes.size();
+  for(IndexType i = 0; i < n; ++i)
+  {
+    volumes[i] =
+      intersection_volume(shapes[i], tets[i], eps, tryFixOrientation);
+  }
+}
+
 }  // namespace primal
 }  // namespace axom
 
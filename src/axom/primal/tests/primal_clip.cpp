@@ -1954,6 +1954,280 @@ TEST(primal_clip, polygon_intersects_polygon)
   }
 }
 
+//------------------------------------------------------------------------------
+namespace
+{
+/// Returns a random affine map of the unit cube, with planar faces
+Primal3D::HexahedronType random_hexahedron()
+{
+  using namespace Primal3D;
+  using axom::utilities::random_real;
+
+  double A[3][3];
+  for(int r = 0; r < 3; ++r)
+  {
+    for(int c = 0; c < 3; ++c)
+    {
+      A[r][c] = (r == c ? 1. : 0.) + random_real(-0.2, 0.2);
+    }
+  }
+
+  const double cube[8][3] = {{0, 0, 0},
+                             {1, 0, 0},
+                             {1, 1, 0},
+                             {0, 1, 0},
+                             {0, 0, 1},
+                             {1, 0, 1},
+                             {1, 1, 1},
+                             {0, 1, 1}};
+  HexahedronType hex;
+  for(int v = 0; v < 8; ++v)
+  {
+    for(int r = 0; r < 3; ++r)
+    {
+      hex[v][r] =
+        A[r][0] * cube[v][0] + A[r][1] * cube[v][1] + A[r][2] * cube[v][2];
+    }
+  }
+  return hex;
+}
+
+/// Returns a random tetrahedron near the unit cube, of either orientation
+Primal3D::TetrahedronType random_tetrahedron()
+{
+  using namespace Primal3D;
+  using axom::utilities::random_real;
+
+  TetrahedronType tet;
+  for(int v = 0; v < 4; ++v)
+  {
+    for(int d = 0; d < 3; ++d)
+    {
+      tet[v][d] = random_real(0.05, 0.95);
+    }
+  }
+  return tet;
+}
+
+/// Returns a random octahedron near the unit cube
+Primal3D::OctahedronType random_octahedron()
+{
+  using namespace Primal3D;
+  using axom::utilities::random_real;
+
+  return OctahedronType(PointType {1.2, 0.5, 0.5},
+                        PointType {0.5, 1.2, 0.5},
+                        PointType {random_real(0.2, 0.8), 0.5, 1.2},
+                        PointType {-0.2, 0.5, 0.5},
+                        PointType {0.5, -0.2, 0.5},
+                        PointType {0.5, random_real(0.2, 0.8), -0.2});
+}
+
+}  // namespace
+
+TEST(primal_clip, intersection_volume_matches_clip)
+{
+  using namespace Primal3D;
+  namespace primal = axom::primal;
+
+  constexpr double EPS = 1e-10;
+  constexpr double TOL = 1e-12;
+
+  for(int i = 0; i < 200; ++i)
+  {
+    const TetrahedronType tet = random_tetrahedron();
+    const TetrahedronType tet2 = random_tetrahedron();
+    HexahedronType hex = random_hexahedron();
+    OctahedronType oct = random_octahedron();
+
+    EXPECT_NEAR(primal::clip(hex, tet, EPS, true).volume(),
+                primal::intersection_volume(hex, tet, EPS, true),
+                TOL);
+    EXPECT_NEAR(primal::clip(oct, tet, EPS, true).volume(),
+                primal::intersection_volume(oct, tet, EPS, true),
+                TOL);
+    EXPECT_NEAR(primal::clip(tet2, tet, EPS, true).volume(),
+                primal::intersection_volume(tet2, tet, EPS, true),
+                TOL);
+
+    // inverted hexahedra, with and without fixing their orientation
+    axom::utilities::swap(hex[1], hex[3]);
+    axom::utilities::swap(hex[5], hex[7]);
+    EXPECT_NEAR(primal::clip(hex, tet, EPS, true).volume(),
+                primal::intersection_volume(hex, tet, EPS, true),
+                TOL);
+    EXPECT_NEAR(primal::clip(hex, tet).volume(),
+                primal::intersection_volume(hex, tet),
+                TOL);
+  }
+}
+
+TEST(primal_clip, intersection_volume_batched)
+{
+  using namespace Primal3D;
+  namespace primal = axom::primal;
+
+  constexpr int N = 50;
+  axom::Array<HexahedronType> hexes(N, N);
+  axom::Array<TetrahedronType> tets(N, N);
+  axom::Array<double> volumes(N, N);
+  for(int i = 0; i < N; ++i)
+  {
+    hexes[i] = random_hexahedron();
+    tets[i] = random_tetrahedron();
+  }
+
+  primal::intersection_volume(hexes.view(),
+                              tets.view(),
+                              volumes.view(),
+                              1e-10,
+                              true);
+
+  for(int i = 0; i < N; ++i)
+  {
+    EXPECT_DOUBLE_EQ(
+      primal::intersection_volume(hexes[i], tets[i], 1e-10, true),
+      volumes[i]);
+  }
+}
+
+TEST(primal_clip, compact_polyhedron_moments)
+{
+  using namespace Primal3D;
+  using CompactPolyhedronType =
+    axom::primal::detail::CompactPolyhedron<double>;
+
+  for(int i = 0; i < 50; ++i)
+  {
+    const HexahedronType hex = random_hexahedron();
+    const TetrahedronType tet = random_tetrahedron();
+
+    CompactPolyhedronType poly(hex, true);
+    double volume = 0.;
+    ASSERT_TRUE(
+      axom::primal::detail::clipped_volume(poly, tet, 1e-10, true, volume));
+
+    double cvolume = 0.;
+    PointType ccentroid;
+    poly.moments(cvolume, ccentroid);
+
+    const PolyhedronType expected = axom::primal::clip(hex, tet, 1e-10, true);
+    EXPECT_NEAR(expected.volume(), volume, 1e-12);
+    EXPECT_NEAR(expected.signedVolume(), cvolume, 1e-12);
+    if(expected.volume() > 1e-8)
+    {
+      const PointType centroid = expected.centroid();
+      for(int d = 0; d < 3; ++d)
+      {
+        EXPECT_NEAR(centroid[d], ccentroid[d], 1e-8);
+      }
+    }
+  }
+}
+
+// Tetrahedra with faces coplanar with the faces of the hexahedron, and with
+// vertices on the planes of its faces
+TEST(primal_clip, intersection_volume_coplanar)
+{
+  using namespace Primal3D;
+  namespace primal = axom::primal;
+
+  constexpr double EPS = 1e-10;
+  constexpr double TOL = 1e-12;
+
+  const HexahedronType hex(PointType {0, 0, 0},
+                           PointType {1, 0, 0},
+                           PointType {1, 1, 0},
+                           PointType {0, 1, 0},
+                           PointType {0, 0, 1},
+                           PointType {1, 0, 1},
+                           PointType {1, 1, 1},
+                           PointType {0, 1, 1});
+
+  // corner tet with three faces on the faces of the hex
+  const TetrahedronType corner(PointType {0, 0, 0},
+                               PointType {1, 0, 0},
+                               PointType {0, 1, 0},
+                               PointType {0, 0, 1});
+  EXPECT_NEAR(1. / 6.,
+              primal::intersection_volume(hex, corner, EPS, true),
+              TOL);
+
+  // tet with a face on the top face of the hex, poking out of its sides
+  const TetrahedronType top(PointType {0, 0, 1},
+                            PointType {2, 0, 1},
+                            PointType {0, 2, 1},
+                            PointType {0, 0, -1});
+  EXPECT_NEAR(primal::clip(hex, top, EPS, true).volume(),
+              primal::intersection_volume(hex, top, EPS, true),
+              TOL);
+
+  // tet with its vertices on the faces of the hex
+  const TetrahedronType inscribed(PointType {0.5, 0.5, 0},
+                                  PointType {1, 0.25, 1},
+                                  PointType {0, 1, 0.5},
+                                  PointType {0.25, 0, 1});
+  EXPECT_NEAR(inscribed.volume(),
+              primal::intersection_volume(hex, inscribed, EPS, true),
+              TOL);
+
+  // tet with its vertices on the planes of the hex faces, outside the hex
+  const TetrahedronType outside(PointType {-1, 0.5, 0},
+                                PointType {2, 0.5, 0},
+                                PointType {0.5, -1, 1},
+                                PointType {0.5, 2, 1});
+  EXPECT_NEAR(primal::clip(hex, outside, EPS, true).volume(),
+              primal::intersection_volume(hex, outside, EPS, true),
+              TOL);
+}
+
+// Hexahedron vertices within the tolerance below a tet face
+TEST(primal_clip, intersection_volume_vertices_near_plane)
+{
+  using namespace Primal3D;
+  namespace primal = axom::primal;
+
+  constexpr double EPS = 1e-3;
+
+  // a tet whose base lies on z = 0 and that contains the rest of the hex
+  const TetrahedronType tet(PointType {-10, -10, 0},
+                            PointType {30, -10, 0},
+                            PointType {-10, 30, 0},
+                            PointType {-10, -10, 100});
+
+  // the bottom vertices of the hex are slightly below z = 0, two of them
+  // within the tolerance and two beyond it
+  const HexahedronType hex(PointType {0, 0, -0.5 * EPS},
+                           PointType {1, 0, -1.1 * EPS},
+                           PointType {1, 1, -0.5 * EPS},
+                           PointType {0, 1, -1.1 * EPS},
+                           PointType {0, 0, 1},
+                           PointType {1, 0, 1},
+                           PointType {1, 1, 1},
+                           PointType {0, 1, 1});
+
+  // the part of the hex above z = 0 has unit volume, up to the tolerance
+  EXPECT_NEAR(1., primal::intersection_volume(hex, tet, EPS, true), EPS);
+  EXPECT_NEAR(primal::clip(hex, tet, EPS, true).volume(),
+              primal::intersection_volume(hex, tet, EPS, true),
+              EPS);
+
+  // the new vertices lie on the edges of the hex
+  primal::detail::CompactPolyhedron<double> poly(hex, true);
+  const PlaneType plane(VectorType {0, 0, 1}, PointType {0, 0, 0});
+  ASSERT_TRUE(poly.clip(plane, EPS));
+  EXPECT_EQ(8, poly.numVertices());
+  for(int v = 0; v < poly.numVertices(); ++v)
+  {
+    for(int d = 0; d < 2; ++d)
+    {
+      EXPECT_GE(poly[v][d], 0.);
+      EXPECT_LE(poly[v][d], 1.);
+    }
+    EXPECT_GE(poly[v][2], -1e-12);
+  }
+}
+
 //------------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
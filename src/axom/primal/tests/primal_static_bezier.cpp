@@ -0,0 +1,391 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ * \file primal_static_bezier.cpp
+ * \brief This file tests primal's fixed-capacity Bezier curves and patches,
+ *  and the allocation-free evaluation of the Bezier curves and patches
+ */
+
+#include "gtest/gtest.h"
+
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+
+#include "axom/primal/geometry/BezierCurve.hpp"
+#include "axom/primal/geometry/BezierPatch.hpp"
+#include "axom/primal/geometry/StaticBezierCurve.hpp"
+#include "axom/primal/geometry/StaticBezierPatch.hpp"
+
+namespace primal = axom::primal;
+
+namespace
+{
+constexpr double EPS = 1e-12;
+
+using PointType = primal::Point<double, 3>;
+using VectorType = primal::Vector<double, 3>;
+
+/// Returns the Bernstein polynomial B_{i,n}(t), zero when i is out of range
+double bernstein(int n, int i, double t)
+{
+  if(i < 0 || i > n)
+  {
+    return 0.;
+  }
+  return axom::utilities::binomialCoefficient(n, i) * std::pow(t, i) *
+    std::pow(1. - t, n - i);
+}
+
+/// Returns the derivative of the Bernstein polynomial B_{i,n}(t)
+double bernstein_dt(int n, int i, double t)
+{
+  return n == 0 ? 0.
+                : n * (bernstein(n - 1, i - 1, t) - bernstein(n - 1, i, t));
+}
+
+/*!
+ * \brief Evaluates a rational Bezier patch and its derivatives with the
+ *  Bernstein basis, with unit weights when \a weights is null
+ */
+void bernstein_patch(const PointType* pts,
+                     const double* weights,
+                     int ord_u,
+                     int ord_v,
+                     double u,
+                     double v,
+                     PointType& eval,
+                     VectorType& Du,
+                     VectorType& Dv)
+{
+  double N[3] = {0., 0., 0.}, Nu[3] = {0., 0., 0.}, Nv[3] = {0., 0., 0.};
+  double W = 0., Wu = 0., Wv = 0.;
+  for(int p = 0; p <= ord_u; ++p)
+  {
+    for(int q = 0; q <= ord_v; ++q)
+    {
+      const int idx = p * (ord_v + 1) + q;
+      const double w = weights != nullptr ? weights[idx] : 1.;
+      const double b = bernstein(ord_u, p, u) * bernstein(ord_v, q, v);
+      const double bu = bernstein_dt(ord_u, p, u) * bernstein(ord_v, q, v);
+      const double bv = bernstein(ord_u, p, u) * bernstein_dt(ord_v, q, v);
+      W += w * b;
+      Wu += w * bu;
+      Wv += w * bv;
+      for(int i = 0; i < 3; ++i)
+      {
+        N[i] += w * b * pts[idx][i];
+        Nu[i] += w * bu * pts[idx][i];
+        Nv[i] += w * bv * pts[idx][i];
+      }
+    }
+  }
+
+  for(int i = 0; i < 3; ++i)
+  {
+    eval[i] = N[i] / W;
+    Du[i] = (Nu[i] - eval[i] * Wu) / W;
+    Dv[i] = (Nv[i] - eval[i] * Wv) / W;
+  }
+}
+
+/// Returns control points of a curve (ord_v == 0) or a patch
+axom::Array<PointType> make_points(int ord_u, int ord_v)
+{
+  axom::Array<PointType> pts;
+  for(int p = 0; p <= ord_u; ++p)
+  {
+    for(int q = 0; q <= ord_v; ++q)
+    {
+      pts.push_back(PointType {1. * p + 0.3 * q * q,
+                               1. * q - 0.2 * p * p,
+                               std::sin(1. * p + 2. * q)});
+    }
+  }
+  return pts;
+}
+
+/// Returns positive weights for a curve (ord_v == 0) or a patch
+axom::Array<double> make_weights(int ord_u, int ord_v)
+{
+  axom::Array<double> weights;
+  for(int p = 0; p <= ord_u; ++p)
+  {
+    for(int q = 0; q <= ord_v; ++q)
+    {
+      weights.push_back(1. + 0.5 * ((p + 2 * q) % 3));
+    }
+  }
+  return weights;
+}
+
+void expect_near(const PointType& a, const PointType& b, double tol)
+{
+  for(int i = 0; i < 3; ++i)
+  {
+    EXPECT_NEAR(a[i], b[i], tol);
+  }
+}
+
+void expect_near(const VectorType& a, const VectorType& b, double tol)
+{
+  for(int i = 0; i < 3; ++i)
+  {
+    EXPECT_NEAR(a[i], b[i], tol);
+  }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+TEST(primal_static_bezier, curve_matches_bernstein)
+{
+  constexpr int ORDER = 4;
+  using StaticCurveType = primal::StaticBezierCurve<double, 3, ORDER>;
+  using CurveType = primal::BezierCurve<double, 3>;
+
+  for(int ord = 0; ord <= ORDER; ++ord)
+  {
+    auto pts = make_points(ord, 0);
+    auto weights = make_weights(ord, 0);
+
+    for(bool rational : {false, true})
+    {
+      SCOPED_TRACE(axom::fmt::format("order {} rational {}", ord, rational));
+
+      const double* w = rational ? weights.data() : nullptr;
+      const StaticCurveType scurve(pts.data(), w, ord);
+      const CurveType curve = rational
+        ? CurveType(pts.data(), weights.data(), ord)
+        : CurveType(pts.data(), ord);
+      EXPECT_EQ(ord, scurve.getOrder());
+      EXPECT_EQ(rational, scurve.isRational());
+
+      for(double t : {0., 0.1, 0.35, 0.5, 0.8, 1.})
+      {
+        PointType expEval;
+        VectorType expDt, unused;
+        bernstein_patch(pts.data(), w, ord, 0, t, 0., expEval, expDt, unused);
+
+        expect_near(expEval, scurve.evaluate(t), EPS);
+        expect_near(expDt, scurve.dt(t), 1e-10);
+        expect_near(expEval, curve.evaluate(t), EPS);
+        expect_near(expDt, curve.dt(t), 1e-10);
+
+        PointType eval;
+        VectorType Dt;
+        scurve.evaluate_first_derivative(t, eval, Dt);
+        expect_near(expEval, eval, EPS);
+        expect_near(expDt, Dt, 1e-10);
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(primal_static_bezier, curve_conversions_and_split)
+{
+  using StaticCurveType = primal::StaticBezierCurve<double, 3>;
+  using CurveType = primal::BezierCurve<double, 3>;
+
+  const int ord = 3;
+  auto pts = make_points(ord, 0);
+  auto weights = make_weights(ord, 0);
+
+  for(bool rational : {false, true})
+  {
+    const CurveType curve = rational
+      ? CurveType(pts.data(), weights.data(), ord)
+      : CurveType(pts.data(), ord);
+
+    const StaticCurveType scurve(curve);
+    EXPECT_EQ(curve, scurve.toBezierCurve());
+    EXPECT_EQ(curve.boundingBox(), scurve.boundingBox());
+
+    CurveType c1, c2;
+    curve.split(0.3, c1, c2);
+
+    StaticCurveType s1, s2;
+    scurve.split(0.3, s1, s2);
+    ASSERT_EQ(rational, s1.isRational());
+    ASSERT_EQ(rational, s2.isRational());
+
+    for(int p = 0; p <= ord; ++p)
+    {
+      expect_near(c1[p], s1[p], EPS);
+      expect_near(c2[p], s2[p], EPS);
+      EXPECT_NEAR(rational ? c1.getWeight(p) : 1., s1.getWeight(p), EPS);
+      EXPECT_NEAR(rational ? c2.getWeight(p) : 1., s2.getWeight(p), EPS);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(primal_static_bezier, patch_matches_bernstein)
+{
+  using StaticPatchType = primal::StaticBezierPatch<double, 3>;
+  using PatchType = primal::BezierPatch<double, 3>;
+
+  // exercise both reduction orders, and the degenerate directions
+  const int orders[][2] = {{3, 2}, {2, 3}, {3, 3}, {1, 0}, {0, 2}, {0, 0}};
+  for(const auto& ord : orders)
+  {
+    const int ord_u = ord[0];
+    const int ord_v = ord[1];
+    auto pts = make_points(ord_u, ord_v);
+    auto weights = make_weights(ord_u, ord_v);
+
+    for(bool rational : {false, true})
+    {
+      SCOPED_TRACE(
+        axom::fmt::format("orders {} {} rational {}", ord_u, ord_v, rational));
+
+      const double* w = rational ? weights.data() : nullptr;
+      const StaticPatchType spatch(pts.data(), w, ord_u, ord_v);
+      const PatchType patch = rational
+        ? PatchType(pts.data(), weights.data(), ord_u, ord_v)
+        : PatchType(pts.data(), ord_u, ord_v);
+      EXPECT_EQ(patch, spatch.toBezierPatch());
+
+      for(double u : {0., 0.25, 0.6, 1.})
+      {
+        for(double v : {0., 0.4, 0.9, 1.})
+        {
+          PointType expEval;
+          VectorType expDu, expDv;
+          bernstein_patch(pts.data(),
+                          w,
+                          ord_u,
+                          ord_v,
+                          u,
+                          v,
+                          expEval,
+                          expDu,
+                          expDv);
+
+          expect_near(expEval, spatch.evaluate(u, v), EPS);
+          expect_near(expDu, spatch.du(u, v), 1e-10);
+          expect_near(expDv, spatch.dv(u, v), 1e-10);
+          expect_near(VectorType::cross_product(expDu, expDv),
+                      spatch.normal(u, v),
+                      1e-9);
+
+          expect_near(expEval, patch.evaluate(u, v), EPS);
+          expect_near(expDu, patch.du(u, v), 1e-10);
+          expect_near(expDv, patch.dv(u, v), 1e-10);
+
+          PointType eval;
+          VectorType Du, Dv;
+          patch.evaluate_first_derivatives(u, v, eval, Du, Dv);
+          expect_near(expEval, eval, EPS);
+          expect_near(expDu, Du, 1e-10);
+          expect_near(expDv, Dv, 1e-10);
+        }
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(primal_static_bezier, batched_evaluation)
+{
+  using StaticCurveType = primal::StaticBezierCurve<double, 3>;
+  using StaticPatchType = primal::StaticBezierPatch<double, 3>;
+  using CurveType = primal::BezierCurve<double, 3>;
+  using PatchType = primal::BezierPatch<double, 3>;
+
+  const int N = 100;
+  axom::Array<double> u(N, N), v(N, N);
+  for(int i = 0; i < N; ++i)
+  {
+    u[i] = static_cast<double>(i) / (N - 1);
+    v[i] = 1. - 0.5 * u[i] * u[i];
+  }
+
+  auto curvePts = make_points(3, 0);
+  auto curveWeights = make_weights(3, 0);
+  const CurveType curve(curvePts.data(), curveWeights.data(), 3);
+  const StaticCurveType scurve(curve);
+
+  auto patchPts = make_points(3, 2);
+  auto patchWeights = make_weights(3, 2);
+  const PatchType patch(patchPts.data(), patchWeights.data(), 3, 2);
+  const StaticPatchType spatch(patch);
+
+  axom::Array<PointType> out(N, N), sout(N, N), kout(N, N);
+
+  // curves
+  curve.evaluate(u.view(), out.view());
+  scurve.evaluate(u.view(), sout.view());
+  for(int i = 0; i < N; ++i)
+  {
+    EXPECT_EQ(curve.evaluate(u[i]), out[i]);
+    EXPECT_EQ(scurve.evaluate(u[i]), sout[i]);
+  }
+
+  // patches
+  patch.evaluate(u.view(), v.view(), out.view());
+  spatch.evaluate(u.view(), v.view(), sout.view());
+
+  // static patches are captured by copy in the kernels
+  const auto u_view = u.view();
+  const auto v_view = v.view();
+  const auto kout_view = kout.view();
+  axom::for_all<axom::SEQ_EXEC>(
+    N,
+    AXOM_LAMBDA(axom::IndexType i) {
+      kout_view[i] = spatch.evaluate(u_view[i], v_view[i]);
+    });
+
+  for(int i = 0; i < N; ++i)
+  {
+    EXPECT_EQ(patch.evaluate(u[i], v[i]), out[i]);
+    EXPECT_EQ(spatch.evaluate(u[i], v[i]), sout[i]);
+    EXPECT_EQ(sout[i], kout[i]);
+    expect_near(out[i], sout[i], EPS);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(primal_static_bezier, high_order_uses_heap_workspace)
+{
+  // large enough orders that the evaluation scratch space is on the heap
+  using PatchType = primal::BezierPatch<double, 3>;
+
+  const int ord_u = 30;
+  const int ord_v = 25;
+  auto pts = make_points(ord_u, ord_v);
+  const PatchType patch(pts.data(), ord_u, ord_v);
+
+  for(double u : {0.1, 0.7})
+  {
+    for(double v : {0.2, 0.5})
+    {
+      // the first two coordinates are quadratic polynomials, whose control
+      // points are the moments of binomial distributions
+      const double Eq2 = ord_v * v * (1. - v) + ord_v * ord_v * v * v;
+      const double Ep2 = ord_u * u * (1. - u) + ord_u * ord_u * u * u;
+
+      const PointType eval = patch.evaluate(u, v);
+      EXPECT_NEAR(ord_u * u + 0.3 * Eq2, eval[0], 1e-10);
+      EXPECT_NEAR(ord_v * v - 0.2 * Ep2, eval[1], 1e-10);
+
+      // the isocurves are evaluated with scratch space on the stack
+      expect_near(patch.isocurve_u(u).evaluate(v), eval, 1e-10);
+      expect_near(patch.isocurve_v(v).dt(u), patch.du(u, v), 1e-8);
+      expect_near(patch.isocurve_u(u).dt(v), patch.dv(u, v), 1e-8);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+
+  axom::slic::SimpleLogger logger;
+
+  return RUN_ALL_TESTS();
+}
@@ -127,6 +127,57 @@ void check_zip_points_2d_from_3d()
   axom::setDefaultAllocator(current_allocator);
 }
 
+template <typename ExecSpace>
+void check_zip_points_3d_strided()
+{
+  using PointType = primal::Point<double, 3>;
+  using ZipType = primal::ZipIndexable<PointType>;
+
+  const int current_allocator = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  // create an array of interleaved coordinates, padded with an extra value
+  constexpr int N = 4;
+  constexpr int STRIDE = 4;
+  double* xyz = axom::allocate<double>(N * STRIDE);
+
+  bool* valid = axom::allocate<bool>(N);
+  bool valid_host[N];
+
+  axom::for_all<ExecSpace>(
+    0,
+    N,
+    AXOM_LAMBDA(int idx) {
+      xyz[idx * STRIDE + 0] = (idx % 2) + 1;
+      xyz[idx * STRIDE + 1] = (idx / 2) + 1;
+      xyz[idx * STRIDE + 2] = idx + 1;
+      xyz[idx * STRIDE + 3] = -1.;
+    });
+
+  ZipType it({xyz, xyz + 1, xyz + 2}, STRIDE);
+
+  axom::for_all<ExecSpace>(
+    0,
+    N,
+    AXOM_LAMBDA(int idx) {
+      valid[idx] = (it[idx] ==
+                    PointType {xyz[idx * STRIDE + 0],
+                               xyz[idx * STRIDE + 1],
+                               xyz[idx * STRIDE + 2]});
+    });
+
+  axom::copy(&valid_host, valid, N * sizeof(bool));
+
+  for(int i = 0; i < N; i++)
+  {
+    EXPECT_TRUE(valid_host[i]);
+  }
+
+  axom::deallocate(xyz);
+  axom::deallocate(valid);
+  axom::setDefaultAllocator(current_allocator);
+}
+
 template <typename ExecSpace>
 void check_zip_vectors_2d_from_3d()
 {
@@ -495,6 +546,13 @@ TEST(primal_zip, zip_points_2d_from_3d)
   check_zip_points_2d_from_3d<ExecSpace>();
 }
 
+TEST(primal_zip, zip_points_3d_strided)
+{
+  using ExecSpace = axom::SEQ_EXEC;
+
+  check_zip_points_3d_strided<ExecSpace>();
+}
+
 TEST(primal_zip, zip_vectors_3d)
 {
   using PointType = primal::Vector<double, 3>;
@@ -8,6 +8,7 @@
 
 #include "axom/config.hpp"
 #include "axom/core/StackArray.hpp"
+#include "axom/core/Types.hpp"
 #include "axom/slic/interface/slic.hpp"
 
 #include "axom/primal/geometry/Point.hpp"
@@ -41,13 +42,22 @@ struct ZipBase<Point<T, NDIMS>>
   /*!
    * \brief Creates a ZipIndexable over a set of arrays.
    * \param [in] arrays the arrays storing coordinate data for each dimension
+   * \param [in] stride the distance, in elements, between the coordinates of
+   *  consecutive points in each array (optional, defaults to 1)
+   *
+   * \note A stride larger than 1 allows iterating over interleaved coordinate
+   *  data in place, e.g., the arrays {xyz, xyz + 1, xyz + 2} with a stride of
+   *  3 iterate over an array of points stored as x0, y0, z0, x1, y1, z1, ...
    *
    * \pre Size >= NDIMS
+   * \pre stride >= 1
    */
   template <size_t Size>
-  ZipBase(const T* const (&arrays)[Size])
+  ZipBase(const T* const (&arrays)[Size], IndexType stride = 1)
+    : pts_stride(stride)
   {
     AXOM_STATIC_ASSERT_MSG(Size >= NDIMS, "Must provide at least NDIMS arrays");
+    SLIC_ASSERT(stride >= 1);
     for(int d = 0; d < NDIMS; ++d)
     {
       pts_arrays[d] = arrays[d];
@@ -63,13 +73,14 @@ struct ZipBase<Point<T, NDIMS>>
     StackArray<T, NDIMS> pt_data;
     for(int d = 0; d < NDIMS; ++d)
     {
-      pt_data[d] = pts_arrays[d][i];
+      pt_data[d] = pts_arrays[d][i * pts_stride];
     }
     return GeomType(pt_data);
   }
 
 private:
   const T* pts_arrays[NDIMS];
+  IndexType pts_stride {1};
 };
 
 }  // namespace detail
@@ -0,0 +1,373 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_QUEST_FAST_WINDING_NUMBER_HPP_
+#define AXOM_QUEST_FAST_WINDING_NUMBER_HPP_
+
+// axom includes
+#include "axom/config.hpp"
+#include "axom/core/AnnotationMacros.hpp"
+#include "axom/core/Array.hpp"
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/execution/for_all.hpp"
+#include "axom/slic.hpp"
+
+// primal includes
+#include "axom/primal/geometry/BoundingBox.hpp"
+#include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/geometry/Polyhedron.hpp"
+#include "axom/primal/operators/squared_distance.hpp"
+#include "axom/primal/operators/winding_number.hpp"
+
+// spin includes
+#include "axom/spin/BVH.hpp"
+
+#include "axom/quest/detail/FastWindingNumber_detail.hpp"
+
+// C/C++ includes
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace axom
+{
+namespace quest
+{
+/*!
+ * \class FastWindingNumber
+ *
+ * \brief Computes the generalized winding number of query points with respect
+ *  to a triangle soup or the surface of a polyhedron in 3D, or a collection
+ *  of Bezier curves in 2D, in time that is logarithmic in the number of
+ *  elements per query point.
+ *
+ *  The elements are organized in a BVH, and each node of the BVH holds a
+ *  second-order far-field expansion of the winding number of the elements
+ *  below it. A query point is evaluated with the expansion of a node when it
+ *  is farther than \a beta times the radius of the node from its center, and
+ *  with the exact winding numbers of the elements otherwise (Barnes-Hut).
+ *  The error of the expansions decays like 1 / beta^3, so larger values of
+ *  \a beta are more accurate and slower; every element is evaluated exactly
+ *  when \a beta is infinite.
+ *
+ * \tparam NDIMS the dimension, 2 for curves and 3 for triangles
+ * \tparam ExecSpace the execution space of the batched queries
+ *
+ * \note The exact winding numbers of the elements are computed with
+ *  primal::winding_number(), which is only available on the host, so
+ *  \a ExecSpace must be a host execution space.
+ *
+ * \see detail::WindingNumberExpansion
+ */
+template <int NDIMS, typename ExecSpace = axom::SEQ_EXEC>
+class FastWindingNumber
+{
+  static_assert(NDIMS == 2 || NDIMS == 3,
+                "FastWindingNumber is only defined in 2D and 3D");
+  static_assert(!axom::execution_space<ExecSpace>::onDevice(),
+                "FastWindingNumber requires a host execution space");
+
+public:
+  /// Triangles in 3D, Bezier curves in 2D
+  using ElementType = typename detail::WindingNumberElement<NDIMS>::Type;
+  using PointType = primal::Point<double, NDIMS>;
+  using BoxType = primal::BoundingBox<double, NDIMS>;
+  using BVHTreeType = spin::BVH<NDIMS, ExecSpace>;
+  using ExpansionType = detail::WindingNumberExpansion<NDIMS>;
+
+public:
+  /*!
+   * \brief Creates a FastWindingNumber instance for the given elements.
+   *
+   * \param [in] elements the triangles (3D) or curves (2D), which are copied
+   * \param [in] beta the ratio of the distance to a cluster of elements over
+   *  its radius beyond which the cluster is evaluated with its expansion
+   *  (optional, defaults to 2)
+   *
+   * \pre beta > 1
+   */
+  FastWindingNumber(axom::ArrayView<const ElementType> elements,
+                    double beta = 2.0);
+
+  /*!
+   * \brief Creates a FastWindingNumber instance for the surface of a
+   *  polyhedron in 3D, whose faces are triangulated.
+   *
+   * \param [in] poly the polyhedron, with its vertex neighbors
+   * \param [in] beta the ratio of the distance to a cluster of elements over
+   *  its radius beyond which the cluster is evaluated with its expansion
+   *  (optional, defaults to 2)
+   *
+   * \note The winding numbers are not rounded, unlike the ones of
+   *  primal::winding_number() for a polyhedron.
+   *
+   * \pre poly.hasNeighbors()
+   * \pre beta > 1
+   */
+  template <int DIM = NDIMS, typename std::enable_if<DIM == 3, int>::type = 0>
+  explicit FastWindingNumber(const primal::Polyhedron<double, 3>& poly,
+                             double beta = 2.0)
+    : FastWindingNumber(
+        detail::WindingNumberElement<3>::triangulate(poly).view(),
+        beta)
+  { }
+
+  /// \brief Returns the number of elements
+  IndexType getNumElements() const { return m_elements.size(); }
+
+  /*!
+   * \brief Sets the accuracy of the queries.
+   *
+   * \param [in] beta the ratio of the distance to a cluster of elements over
+   *  its radius beyond which the cluster is evaluated with its expansion
+   *
+   * \pre beta > 1
+   */
+  void setBeta(double beta)
+  {
+    SLIC_ASSERT(beta > 1.);
+    m_beta = beta;
+  }
+
+  /// \brief Returns the accuracy parameter of the queries
+  double getBeta() const { return m_beta; }
+
+  /*!
+   * \brief Sets the tolerances passed to primal::winding_number() for the
+   *  elements that are evaluated exactly.
+   *
+   * \param [in] edge_tol the physical distance level at which objects are
+   *  considered indistinguishable
+   * \param [in] EPS miscellaneous numerical tolerance for nonphysical distances
+   */
+  void setTolerances(double edge_tol, double EPS)
+  {
+    m_edge_tol = edge_tol;
+    m_EPS = EPS;
+  }
+
+  /*!
+   * \brief Computes the generalized winding number of a query point.
+   *
+   * \param [in] queryPnt the query point
+   * \return the approximate generalized winding number of the point
+   */
+  double computeWindingNumber(const PointType& queryPnt) const;
+
+  /*!
+   * \brief Computes the generalized winding numbers of a set of query points
+   *  in the execution space.
+   *
+   * \param [in] npts the number of query points
+   * \param [in] queryPts an indexable collection of query points
+   * \param [out] outWN the winding number of each query point
+   *
+   * \pre outWN != nullptr and has room for \a npts values
+   */
+  template <typename PointIndexable>
+  void computeWindingNumbers(IndexType npts,
+                             PointIndexable queryPts,
+                             double* outWN) const;
+
+  /// \brief Returns a const reference to the underlying BVH
+  const BVHTreeType& getBVHTree() const { return m_bvh; }
+
+private:
+  /// \brief Computes the expansions of the nodes of the BVH, bottom-up
+  void computeExpansions();
+
+  /*!
+   * \brief Computes the winding number of a query point by traversing the
+   *  BVH, evaluating the expansions of the nodes that are far enough.
+   */
+  static double evaluate(
+    const PointType& q,
+    const typename BVHTreeType::TraverserType& traverser,
+    axom::ArrayView<const ElementType> elements,
+    axom::ArrayView<const ExpansionType> expansions,
+    double sqBeta,
+    double edge_tol,
+    double EPS);
+
+private:
+  axom::Array<ElementType> m_elements;
+  axom::Array<ExpansionType> m_expansions;  // one per node of the BVH
+  BVHTreeType m_bvh;
+  double m_beta;
+  double m_edge_tol {1e-8};
+  double m_EPS {1e-8};
+};
+
+//------------------------------------------------------------------------------
+//  FastWindingNumber implementation
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+FastWindingNumber<NDIMS, ExecSpace>::FastWindingNumber(
+  axom::ArrayView<const ElementType> elements,
+  double beta)
+  : m_elements(elements)
+  , m_beta(beta)
+{
+  AXOM_ANNOTATE_SCOPE("FastWindingNumber::build");
+  SLIC_ASSERT(beta > 1.);
+
+  const IndexType numElements = m_elements.size();
+  axom::Array<BoxType> boxes(numElements, numElements);
+  for(IndexType i = 0; i < numElements; ++i)
+  {
+    boxes[i] = detail::WindingNumberElement<NDIMS>::boundingBox(m_elements[i]);
+  }
+
+  m_bvh.initialize(boxes.view(), numElements);
+  computeExpansions();
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+void FastWindingNumber<NDIMS, ExecSpace>::computeExpansions()
+{
+  const auto traverser = m_bvh.getTraverser();
+  const auto nodes = traverser.getInnerNodes();
+  const auto children = traverser.getInnerNodeChildren();
+  const auto leafs = traverser.getLeafNodes();
+
+  const IndexType numNodes = nodes.size();
+  m_expansions = axom::Array<ExpansionType>(numNodes, numNodes);
+
+  // list the nodes in pre-order, so that the children of a node are
+  // listed after it
+  std::vector<std::int32_t> order;
+  order.reserve(numNodes);
+  std::vector<std::int32_t> todo {1, 0};
+  while(!todo.empty())
+  {
+    const std::int32_t node = todo.back();
+    todo.pop_back();
+    order.push_back(node);
+
+    const std::int32_t child = children[node];
+    if(nodes[node].isValid() && !spin::internal::linear_bvh::leaf_node(child))
+    {
+      todo.push_back(child + 1);
+      todo.push_back(child);
+    }
+  }
+
+  // accumulate the expansions in reverse order, from the leaves up
+  for(auto it = order.rbegin(); it != order.rend(); ++it)
+  {
+    const std::int32_t node = *it;
+    if(!nodes[node].isValid())
+    {
+      continue;
+    }
+
+    const std::int32_t child = children[node];
+    if(spin::internal::linear_bvh::leaf_node(child))
+    {
+      const IndexType elementIdx = leafs[-child - 1];
+      m_expansions[node] =
+        detail::WindingNumberElement<NDIMS>::expansion(m_elements[elementIdx]);
+    }
+    else
+    {
+      m_expansions[node].combine(m_expansions[child],
+                                 m_expansions[child + 1],
+                                 nodes[node]);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+double FastWindingNumber<NDIMS, ExecSpace>::evaluate(
+  const PointType& q,
+  const typename BVHTreeType::TraverserType& traverser,
+  axom::ArrayView<const ElementType> elements,
+  axom::ArrayView<const ExpansionType> expansions,
+  double sqBeta,
+  double edge_tol,
+  double EPS)
+{
+  double wn = 0.;
+
+  auto nearElement = [&](std::int32_t currentNode, const std::int32_t* leafs) {
+    const ElementType& element = elements[leafs[currentNode]];
+    wn += primal::winding_number(q, element, edge_tol, EPS);
+  };
+
+  auto isNear = [&](const PointType& p, const BoxType&, std::int32_t node) {
+    const ExpansionType& expansion = expansions[node];
+    const double sqRadius = expansion.radius * expansion.radius;
+    if(primal::squared_distance(p, expansion.center) > sqBeta * sqRadius)
+    {
+      wn += expansion.evaluate(p);
+      return false;
+    }
+    return true;
+  };
+
+  traverser.traverse_nodes(q, nearElement, isNear);
+  return wn;
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+double FastWindingNumber<NDIMS, ExecSpace>::computeWindingNumber(
+  const PointType& queryPnt) const
+{
+  if(m_elements.empty())
+  {
+    return 0.;
+  }
+
+  return evaluate(queryPnt,
+                  m_bvh.getTraverser(),
+                  m_elements.view(),
+                  m_expansions.view(),
+                  m_beta * m_beta,
+                  m_edge_tol,
+                  m_EPS);
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+template <typename PointIndexable>
+void FastWindingNumber<NDIMS, ExecSpace>::computeWindingNumbers(
+  IndexType npts,
+  PointIndexable queryPts,
+  double* outWN) const
+{
+  AXOM_ANNOTATE_SCOPE("FastWindingNumber::computeWindingNumbers");
+  SLIC_ASSERT(npts == 0 || outWN != nullptr);
+
+  if(m_elements.empty())
+  {
+    for_all<ExecSpace>(
+      npts,
+      AXOM_LAMBDA(IndexType i) { outWN[i] = 0.; });
+    return;
+  }
+
+  const auto traverser = m_bvh.getTraverser();
+  const auto elements = m_elements.view();
+  const auto expansions = m_expansions.view();
+  const double sqBeta = m_beta * m_beta;
+  const double edge_tol = m_edge_tol;
+  const double EPS = m_EPS;
+
+  for_all<ExecSpace>(
+    npts,
+    AXOM_LAMBDA(IndexType i) {
+      const PointType q = queryPts[i];
+      outWN[i] =
+        evaluate(q, traverser, elements, expansions, sqBeta, edge_tol, EPS);
+    });
+}
+
+}  // end namespace quest
+}  // end namespace axom
+
+#endif  // AXOM_QUEST_FAST_WINDING_NUMBER_HPP_
@@ -24,12 +24,14 @@
 #include "detail/inout/MeshWrapper.hpp"
 #include "detail/inout/InOutOctreeValidator.hpp"
 #include "detail/inout/InOutOctreeStats.hpp"
+#include "detail/inout/FrozenInOutOctree.hpp"
 
 #include "axom/fmt.hpp"
 
 #include <vector>
 #include <iterator>
 #include <sstream>
+#include <numeric>
 #include <unordered_map>
 
 #ifndef DUMP_VTK_MESH
@@ -92,6 +94,7 @@ private:
   friend class detail::InOutOctreeStats<DIM>;
   friend class detail::InOutOctreeValidator<DIM>;
   friend class detail::InOutOctreeMeshDumper<DIM>;
+  friend class detail::FrozenInOutOctree<DIM>;
   friend class detail::InOutOctreeMeshDumperBase<DIM, detail::InOutOctreeMeshDumper<DIM>>;
 
 public:
@@ -104,6 +107,7 @@ public:
   using BlockIndex = typename SpatialOctreeType::BlockIndex;
   using GridPt = typename OctreeBaseType::GridPt;
   using SpaceRay = primal::Ray<double, DIM>;
+  using FrozenOctreeType = detail::FrozenInOutOctree<DIM>;
 
 private:
   enum GenerationState
@@ -192,7 +196,17 @@ public:
 
   /**
    * \brief Generate the spatial index over the surface mesh
+   *
+   * The octree is built one level at a time. The work on the blocks of a
+   * level, e.g. distributing the mesh vertices and cells among the children
+   * of the blocks and coloring the leaf blocks, is performed in parallel in
+   * the execution space \a ExecSpace, while the octree itself is updated
+   * sequentially in between. The resulting index does not depend on the
+   * execution space.
+   *
+   * \tparam ExecSpace A host execution space (default: axom::SEQ_EXEC)
    */
+  template <typename ExecSpace = axom::SEQ_EXEC>
   void generateIndex();
 
   /**
@@ -204,6 +218,52 @@ public:
    */
   bool within(const SpacePt& pt) const;
 
+  /**
+   * \brief Batched point containment query
+   *
+   * \param [in] pts The points at which we are checking for containment
+   * \param [out] results Entry \a i is set to true if pts[i] is within (or on)
+   * the surface and to false otherwise
+   *
+   * \tparam ExecSpace A host execution space for the queries
+   * (default: axom::SEQ_EXEC)
+   * \pre results.size() >= pts.size()
+   * \sa within(const SpacePt&)
+   */
+  template <typename ExecSpace = axom::SEQ_EXEC>
+  void within(axom::ArrayView<const SpacePt> pts,
+              axom::ArrayView<bool> results) const;
+
+  /**
+   * \brief Builds a linearized, query-only representation of the octree
+   *
+   * The leaves of the octree are sorted by their Morton index into contiguous
+   * arrays, along with their colors and the cell lists of the gray leaves.
+   * Once frozen, within() locates the leaf covering a query point with a
+   * binary search over these arrays instead of with hash map lookups on the
+   * levels of the octree.
+   *
+   * \return True if the octree was frozen, false otherwise, e.g. when its
+   * leaves are finer than FrozenOctreeType::maxRepresentableLevel()
+   * \pre generateIndex() has been called
+   * \sa detail::FrozenInOutOctree
+   */
+  bool freeze();
+
+  /// \brief Predicate to check if the octree has been frozen
+  bool isFrozen() const { return !m_frozenOctree.empty(); }
+
+  /**
+   * \brief Returns the frozen representation of the octree
+   *
+   * \note The returned instance is empty unless the octree has been frozen.
+   * It can be copied to another allocator, e.g.
+   * \code{.cpp}
+   *   FrozenOctreeType frozenCopy(octree.getFrozenOctree(), allocatorID);
+   * \endcode
+   */
+  const FrozenOctreeType& getFrozenOctree() const { return m_frozenOctree; }
+
   /**
    * \brief Sets the threshold for welding vertices during octree construction
    *
@@ -243,9 +303,20 @@ private:
    */
   void insertVertex(VertexIndex idx, int startingLevel = 0);
 
+  /**
+   * \brief Insert all mesh vertices into the octree, generating a PR octree
+   *
+   * The vertices are distributed level by level among the blocks of the
+   * octree. A block is refined when one of its vertices is farther than the
+   * welding threshold from its first vertex.
+   */
+  template <typename ExecSpace>
+  void insertVertices();
+
   /**
    * \brief Insert all mesh cells into the octree, generating a PM octree
    */
+  template <typename ExecSpace>
   void insertMeshCells();
 
   /**
@@ -254,6 +325,7 @@ private:
    * Black blocks are entirely within the surface, white blocks are entirely
    * outside the surface and Gray blocks intersect the surface.
    */
+  template <typename ExecSpace>
   void colorOctreeLeaves();
 
   /**
@@ -279,14 +351,26 @@ private:
                                       DynamicGrayBlockData& leafData) const;
 
   /**
-   * \brief Finds a color for the given block \a blk and propagates to neighbors
+   * \brief Finds the color that a colored block imparts across one of its faces
    *
-   * \note Propagates color to same-level and coarser level neighbors
-   * \param blk The block to color
-   * \param blkData The data associated with this block
-   * \return True if we were able to find a color for \a blk, false otherwise
+   * \param srcBlk The colored block
+   * \param srcData The data associated with \a srcBlk
+   * \param adjBlk A same-level face neighbor of \a srcBlk, which determines
+   * the face. The color is that of the center of this face.
+   * \return The color imparted by \a srcBlk, Undetermined if it is uncolored
    */
-  bool colorLeafAndNeighbors(const BlockIndex& blk, InOutBlockData& blkData);
+  InOutBlockData::LeafColor colorAcrossFace(const BlockIndex& srcBlk,
+                                            const InOutBlockData& srcData,
+                                            const BlockIndex& adjBlk) const;
+
+  /**
+   * \brief Finds a color for the given leaf block \a blk from its colored
+   * same-level face neighbors
+   *
+   * \return The color of the first colored neighbor, Undetermined if none of
+   * the same-level face neighbors of \a blk has a color
+   */
+  InOutBlockData::LeafColor findColorFromNeighbors(const BlockIndex& blk) const;
 
   /**
    * \brief Predicate to determine if the vertex is indexed by the blk
@@ -333,30 +417,30 @@ private:
    *
    * \param queryPt The point we are querying
    * \param leafBlk The block of the gray leaf
-   * \param data The data associated with the leaf block
+   * \param cells The indices of the mesh cells associated with the leaf block
    * \return True, if the point is inside the local surface associated with this
    * block, false otherwise
    */
-  template <int TDIM>
+  template <int TDIM, typename CellSet>
   typename std::enable_if<TDIM == 3, bool>::type withinGrayBlock(
     const SpacePt& queryPt,
     const BlockIndex& leafBlk,
-    const InOutBlockData& data) const;
+    const CellSet& cells) const;
 
   /**
    * \brief Determines whether the specified 2D point is within the gray leaf
    *
    * \param queryPt The point we are querying
    * \param leafBlk The block of the gray leaf
-   * \param data The data associated with the leaf block
+   * \param cells The indices of the mesh cells associated with the leaf block
    * \return True, if the point is inside the local surface associated with this
    * block, false otherwise
    */
-  template <int TDIM = DIM>
+  template <int TDIM = DIM, typename CellSet>
   typename std::enable_if<TDIM == 2, bool>::type withinGrayBlock(
     const SpacePt& queryPt,
     const BlockIndex& leafBlk,
-    const InOutBlockData& data) const;
+    const CellSet& cells) const;
 
   /**
    * \brief Returns the index of the mesh vertex associated with the given leaf block
@@ -419,6 +503,9 @@ protected:
 
   double m_vertexWeldThresholdSquared;
 
+  /// Linearized representation of the leaves for queries (once frozen)
+  FrozenOctreeType m_frozenOctree;
+
   /// Bounding box scaling factor for dealing with grazing triangles
   double m_boundingBoxScaleFactor {DEFAULT_BOUNDING_BOX_SCALE_FACTOR};
 };
@@ -451,8 +538,12 @@ inline std::ostream& operator<<(std::ostream& os,
 }  // namespace
 
 template <int DIM>
+template <typename ExecSpace>
 void InOutOctree<DIM>::generateIndex()
 {
+  AXOM_STATIC_ASSERT_MSG(!axom::execution_space<ExecSpace>::onDevice(),
+                         "InOutOctree only supports host execution spaces");
+
   using Timer = axom::utilities::Timer;
 
   // Loop through mesh vertices
@@ -469,11 +560,7 @@ void InOutOctree<DIM>::generateIndex()
   {
     AXOM_ANNOTATE_SCOPE("insert vertices");
     timer.start();
-    int numMeshVerts = m_meshWrapper.numMeshVertices();
-    for(int idx = 0; idx < numMeshVerts; ++idx)
-    {
-      insertVertex(idx);
-    }
+    insertVertices<ExecSpace>();
     timer.stop();
     m_generationState = INOUTOCTREE_VERTICES_INSERTED;
   }
@@ -518,7 +605,7 @@ void InOutOctree<DIM>::generateIndex()
   {
     AXOM_ANNOTATE_SCOPE("insert mesh cells");
     timer.start();
-    insertMeshCells();
+    insertMeshCells<ExecSpace>();
     timer.stop();
     m_generationState = INOUTOCTREE_ELEMENTS_INSERTED;
   }
@@ -531,7 +618,7 @@ void InOutOctree<DIM>::generateIndex()
   {
     AXOM_ANNOTATE_SCOPE("color octree leaves");
     timer.start();
-    colorOctreeLeaves();
+    colorOctreeLeaves<ExecSpace>();
 
     timer.stop();
     m_generationState = INOUTOCTREE_LEAVES_COLORED;
@@ -622,10 +709,156 @@ void InOutOctree<DIM>::insertVertex(VertexIndex idx, int startingLevel)
 }
 
 template <int DIM>
+template <typename ExecSpace>
+void InOutOctree<DIM>::insertVertices()
+{
+  using Timer = axom::utilities::Timer;
+
+  const int numMeshVerts = m_meshWrapper.numMeshVertices();
+  if(numMeshVerts == 0)
+  {
+    return;
+  }
+
+  // The vertices that still need to be placed, grouped by the block of the
+  // current level that covers them. Each group is stored contiguously,
+  // in order of increasing vertex index.
+  std::vector<VertexIndex> verts(numMeshVerts);
+  std::iota(verts.begin(), verts.end(), VertexIndex {0});
+  std::vector<GridPt> groupBlocks {this->root().pt()};
+  std::vector<IndexType> groupOffsets {0, numMeshVerts};
+
+  std::vector<VertexIndex> nextVerts;
+  std::vector<GridPt> nextGroupBlocks;
+  std::vector<IndexType> nextGroupOffsets;
+  std::vector<char> groupRefines;
+  std::vector<IndexType> groupForcedWelds;
+  std::vector<int> childIndices(numMeshVerts);
+
+  IndexType numForcedWelds = 0;
+  for(int lev = 0; !groupBlocks.empty(); ++lev)
+  {
+    Timer levelTimer(true);
+
+    const IndexType numGroups = static_cast<IndexType>(groupBlocks.size());
+    const bool canRefine = lev + 1 < this->maxLeafLevel();
+
+    // A block must be refined when one of its vertices cannot be welded
+    // to its first vertex. Blocks of the finest level cannot be refined,
+    // so their vertices are welded regardless, and counted
+    groupRefines.assign(numGroups, 0);
+    groupForcedWelds.assign(numGroups, 0);
+    axom::for_all<ExecSpace>(numGroups, [&](IndexType g) {
+      const SpacePt firstPt =
+        m_meshWrapper.getMeshVertexPosition(verts[groupOffsets[g]]);
+      for(IndexType i = groupOffsets[g] + 1; i < groupOffsets[g + 1]; ++i)
+      {
+        const SpacePt pt = m_meshWrapper.getMeshVertexPosition(verts[i]);
+        if(squared_distance(firstPt, pt) >= m_vertexWeldThresholdSquared)
+        {
+          if(canRefine)
+          {
+            groupRefines[g] = 1;
+            break;
+          }
+          ++groupForcedWelds[g];
+        }
+      }
+    });
+
+    // Update the octree: blocks that don't refine index their first vertex
+    for(IndexType g = 0; g < numGroups; ++g)
+    {
+      const BlockIndex block(groupBlocks[g], lev);
+      numForcedWelds += groupForcedWelds[g];
+      if(groupRefines[g])
+      {
+        this->refineLeaf(block);
+      }
+      else
+      {
+        (*this)[block].setData(verts[groupOffsets[g]]);
+      }
+    }
+
+    // Find the child block covering each vertex of the refined blocks
+    axom::for_all<ExecSpace>(numGroups, [&](IndexType g) {
+      if(!groupRefines[g])
+      {
+        return;
+      }
+      const GridPt& parentPt = groupBlocks[g];
+      for(IndexType i = groupOffsets[g]; i < groupOffsets[g + 1]; ++i)
+      {
+        const GridPt childPt = this->findGridCellAtLevel(
+          m_meshWrapper.getMeshVertexPosition(verts[i]),
+          lev + 1);
+
+        int childIdx = 0;
+        for(int d = 0; d < DIM; ++d)
+        {
+          const int offset = childPt[d] - 2 * parentPt[d];
+          SLIC_ASSERT(offset == 0 || offset == 1);
+          childIdx |= (offset << d);
+        }
+        childIndices[verts[i]] = childIdx;
+      }
+    });
+
+    // Group the vertices of the refined blocks by child block
+    nextVerts.clear();
+    nextGroupBlocks.clear();
+    nextGroupOffsets.assign(1, 0);
+    for(IndexType g = 0; g < numGroups; ++g)
+    {
+      if(!groupRefines[g])
+      {
+        continue;
+      }
+
+      const BlockIndex block(groupBlocks[g], lev);
+      for(int j = 0; j < BlockIndex::numChildren(); ++j)
+      {
+        for(IndexType i = groupOffsets[g]; i < groupOffsets[g + 1]; ++i)
+        {
+          if(childIndices[verts[i]] == j)
+          {
+            nextVerts.push_back(verts[i]);
+          }
+        }
+
+        const IndexType numChildVerts =
+          static_cast<IndexType>(nextVerts.size()) - nextGroupOffsets.back();
+        if(numChildVerts > 0)
+        {
+          nextGroupBlocks.push_back(block.childPt(j));
+          nextGroupOffsets.push_back(static_cast<IndexType>(nextVerts.size()));
+        }
+      }
+    }
+
+    verts.swap(nextVerts);
+    groupBlocks.swap(nextGroupBlocks);
+    groupOffsets.swap(nextGroupOffsets);
+
+    SLIC_DEBUG("\tInserting vertices into level "
+               << lev << " took " << levelTimer.elapsed() << " seconds.");
+  }
+
+  SLIC_WARNING_IF(
+    numForcedWelds > 0,
+    axom::fmt::format("InOutOctree: {} vertices are farther than the vertex "
+                      "weld threshold from another vertex in the same block "
+                      "of the finest level of the octree, and were welded "
+                      "to it. Consider using a larger vertex weld threshold.",
+                      numForcedWelds));
+}
+
+template <int DIM>
+template <typename ExecSpace>
 void InOutOctree<DIM>::insertMeshCells()
 {
   using Timer = axom::utilities::Timer;
-  using LeavesLevelMap = typename OctreeBaseType::OctreeLevelType;
 
   SLIC_ASSERT(m_meshWrapper.meshWasReindexed());
 
@@ -637,6 +870,14 @@ void InOutOctree<DIM>::insertMeshCells()
   currentLevelData.reserve(NUM_INIT_DATA_ENTRIES);
   nextLevelData.reserve(NUM_INIT_DATA_ENTRIES);
 
+  // Per-level work arrays: the blocks holding cells and their data indices,
+  // the blocks that distribute their cells and the data of their children
+  std::vector<GridPt> levelBlocks;
+  std::vector<int> levelBlockData;
+  std::vector<char> leafMustRefine;
+  std::vector<IndexType> refinedBlocks;
+  DynamicLevelData childLevelData;
+
   /// --- Initialize root level data
   BlockIndex rootBlock = this->root();
   InOutBlockData& rootData = (*this)[rootBlock];
@@ -671,26 +912,47 @@ void InOutOctree<DIM>::insertMeshCells()
     auto& geSizeRelData = m_indexRegistry.addNamelessBuffer();
     geSizeRelData.push_back(0);
 
-    int nextLevelDataBlockCounter = 0;
-
     auto& levelLeafMap = this->getOctreeLevel(lev);
+
+    // Collect the blocks of this level that hold cells
+    levelBlocks.clear();
+    levelBlockData.clear();
     auto itEnd = levelLeafMap.end();
     for(auto it = levelLeafMap.begin(); it != itEnd; ++it)
     {
-      InOutBlockData& blkData = *it;
+      if(it->hasData())
+      {
+        levelBlocks.push_back(it.pt());
+        levelBlockData.push_back(it->dataIndex());
+      }
+    }
+    const IndexType numLevelBlocks = static_cast<IndexType>(levelBlocks.size());
 
-      if(!blkData.hasData())
+    // Check which leaf blocks must be refined
+    leafMustRefine.assign(numLevelBlocks, 0);
+    axom::for_all<ExecSpace>(numLevelBlocks, [&](IndexType i) {
+      DynamicGrayBlockData& dynamicLeafData =
+        currentLevelData[levelBlockData[i]];
+      if(dynamicLeafData.isLeaf())
       {
-        continue;
+        const BlockIndex blk(levelBlocks[i], lev);
+        leafMustRefine[i] =
+          allCellsIncidentInCommonVertex(blk, dynamicLeafData) ? 0 : 1;
       }
+    });
 
-      BlockIndex blk(it.pt(), lev);
+    // Update the octree: finalize the leaf blocks that don't refine
+    // and refine the others
+    refinedBlocks.clear();
+    for(IndexType i = 0; i < numLevelBlocks; ++i)
+    {
+      const BlockIndex blk(levelBlocks[i], lev);
+      InOutBlockData& blkData = (*this)[blk];
       DynamicGrayBlockData& dynamicLeafData =
-        currentLevelData[blkData.dataIndex()];
+        currentLevelData[levelBlockData[i]];
 
-      bool isInternal = !dynamicLeafData.isLeaf();
-      bool isLeafThatMustRefine =
-        !isInternal && !allCellsIncidentInCommonVertex(blk, dynamicLeafData);
+      const bool isInternal = !dynamicLeafData.isLeaf();
+      const bool isLeafThatMustRefine = leafMustRefine[i] != 0;
 
       QUEST_OCTREE_DEBUG_LOG_IF(
         DEBUG_BLOCK_1 == blk || DEBUG_BLOCK_2 == blk,
@@ -730,138 +992,146 @@ void InOutOctree<DIM>::insertMeshCells()
                               dynamicLeafData,
                               blkData));
         }
+        continue;
       }
-      else
-      {
-        /// Otherwise, we must distribute the block data among the children
 
-        // Refine the leaf if necessary
-        if(isLeafThatMustRefine)
-        {
-          const VertexIndex vIdx = dynamicLeafData.vertexIndex();
+      /// Otherwise, we must distribute the block data among the children
 
-          this->refineLeaf(blk);
-          dynamicLeafData.setLeafFlag(false);
+      // Refine the leaf if necessary
+      if(isLeafThatMustRefine)
+      {
+        const VertexIndex vIdx = dynamicLeafData.vertexIndex();
 
-          // Reinsert the vertex into the tree, if vIdx was indexed by blk
-          if(blockIndexesVertex(vIdx, blk))
-          {
-            insertVertex(vIdx, blk.childLevel());
-          }
-        }
-        else if(isInternal)
+        this->refineLeaf(blk);
+        dynamicLeafData.setLeafFlag(false);
+
+        // Reinsert the vertex into the tree, if vIdx was indexed by blk
+        if(blockIndexesVertex(vIdx, blk))
         {
-          // Need to mark the leaf as internal since we were using its data
-          // as an index into the DynamicGrayBlockData array
-          blkData.setInternal();
+          insertVertex(vIdx, blk.childLevel());
         }
+      }
+      else if(isInternal)
+      {
+        // Need to mark the leaf as internal since we were using its data
+        // as an index into the DynamicGrayBlockData array
+        blkData.setInternal();
+      }
 
-        SLIC_ASSERT_MSG(
-          this->isInternal(blk),
-          axom::fmt::format(
-            "Block {} was refined, so it should be marked as internal.",
-            fmt::streamed(blk)));
+      SLIC_ASSERT_MSG(
+        this->isInternal(blk),
+        axom::fmt::format(
+          "Block {} was refined, so it should be marked as internal.",
+          fmt::streamed(blk)));
 
-        /// Setup caches for data associated with children
-        BlockIndex childBlk[BlockIndex::NUM_CHILDREN];
-        GeometricBoundingBox childBB[BlockIndex::NUM_CHILDREN];
-        DynamicGrayBlockData childData[BlockIndex::NUM_CHILDREN];
-        DynamicGrayBlockData* childDataPtr[BlockIndex::NUM_CHILDREN];
+      refinedBlocks.push_back(i);
+    }
 
-        const typename LeavesLevelMap::BroodData& broodData =
-          this->getOctreeLevel(lev + 1).getBroodData(blk.pt());
+    // Add the cells of the refined blocks to their intersecting children
+    const IndexType numRefinedBlocks =
+      static_cast<IndexType>(refinedBlocks.size());
+    childLevelData.clear();
+    childLevelData.resize(numRefinedBlocks * BlockIndex::NUM_CHILDREN);
+
+    const InOutOctree& constThis = *this;
+    axom::for_all<ExecSpace>(numRefinedBlocks, [&](IndexType r) {
+      const IndexType i = refinedBlocks[r];
+      const BlockIndex blk(levelBlocks[i], lev);
+      const DynamicGrayBlockData& dynamicLeafData =
+        currentLevelData[levelBlockData[i]];
+
+      /// Setup caches for data associated with children
+      BlockIndex childBlk[BlockIndex::NUM_CHILDREN];
+      GeometricBoundingBox childBB[BlockIndex::NUM_CHILDREN];
+      DynamicGrayBlockData* childData =
+        &childLevelData[r * BlockIndex::NUM_CHILDREN];
+
+      for(int j = 0; j < BlockIndex::NUM_CHILDREN; ++j)
+      {
+        childBlk[j] = blk.child(j);
+        childBB[j] = this->blockBoundingBox(childBlk[j]);
+
+        // expand bounding box slightly to deal with grazing cells
+        childBB[j].scale(m_boundingBoxScaleFactor);
 
-        for(int j = 0; j < BlockIndex::NUM_CHILDREN; ++j)
+        const InOutBlockData& childBlockData = constThis[childBlk[j]];
+        if(!childBlockData.hasData())
+        {
+          childData[j] = DynamicGrayBlockData();
+          childData[j].setLeafFlag(childBlockData.isLeaf());
+        }
+        else
         {
-          childBlk[j] = blk.child(j);
-          childBB[j] = this->blockBoundingBox(childBlk[j]);
+          childData[j] = DynamicGrayBlockData(childBlockData.dataIndex(),
+                                              childBlockData.isLeaf());
+        }
+      }
 
-          // expand bounding box slightly to deal with grazing cells
-          childBB[j].scale(m_boundingBoxScaleFactor);
+      // Add all cells to intersecting children blocks
+      const DynamicGrayBlockData::CellList& parentCells =
+        dynamicLeafData.cells();
+      int numCells = static_cast<int>(parentCells.size());
+      for(int k = 0; k < numCells; ++k)
+      {
+        CellIndex tIdx = parentCells[k];
+        SpaceCell spaceTri = m_meshWrapper.cellPositions(tIdx);
+        GeometricBoundingBox tBB = m_meshWrapper.cellBoundingBox(tIdx);
 
-          const InOutBlockData& childBlockData = broodData[j];
-          if(!childBlockData.hasData())
-          {
-            childData[j] = DynamicGrayBlockData();
-            childData[j].setLeafFlag(childBlockData.isLeaf());
-          }
-          else
+        for(int j = 0; j < BlockIndex::numChildren(); ++j)
+        {
+          bool shouldAddCell = blockIndexesElementVertex(tIdx, childBlk[j]) ||
+            (childData[j].isLeaf() ? intersect(spaceTri, childBB[j])
+                                   : intersect(tBB, childBB[j]));
+
+          QUEST_OCTREE_DEBUG_LOG_IF(
+            DEBUG_BLOCK_1 == childBlk[j] || DEBUG_BLOCK_2 == childBlk[j],
+            //&& tIdx == DEBUG_TRI_IDX
+            axom::fmt::format("Attempting to insert cell {} @ {} w/ BB {}"
+                              "\n\t into block {} w/ BB {} and data {} "
+                              "\n\tShould add? {}",
+                              tIdx,
+                              spaceTri,
+                              tBB,
+                              axom::fmt::streamed(childBlk[j]),
+                              childBB[j],
+                              childData[j],
+                              (shouldAddCell ? " yes" : "no")));
+
+          if(shouldAddCell)
           {
-            childData[j] = DynamicGrayBlockData(childBlockData.dataIndex(),
-                                                childBlockData.isLeaf());
+            childData[j].addCell(tIdx);
           }
-
-          childDataPtr[j] = &childData[j];
         }
+      }
+    });
 
-        // Check that the vector has enough capacity for all children
-        // This ensures that our child data pointers will not be invalidated
-        if(nextLevelData.capacity() <
-           (nextLevelData.size() + BlockIndex::NUM_CHILDREN))
+    // Set the data of the children with cells in the octree
+    // to their index in the next level's array of DynamicGrayBlockData
+    for(IndexType r = 0; r < numRefinedBlocks; ++r)
+    {
+      const BlockIndex blk(levelBlocks[refinedBlocks[r]], lev);
+      for(int j = 0; j < BlockIndex::NUM_CHILDREN; ++j)
+      {
+        DynamicGrayBlockData& childData =
+          childLevelData[r * BlockIndex::NUM_CHILDREN + j];
+        if(!childData.hasCells())
         {
-          nextLevelData.reserve(nextLevelData.size() * 4);
+          continue;
         }
 
-        // Add all cells to intersecting children blocks
-        DynamicGrayBlockData::CellList& parentCells = dynamicLeafData.cells();
-        int numCells = static_cast<int>(parentCells.size());
-        for(int i = 0; i < numCells; ++i)
-        {
-          CellIndex tIdx = parentCells[i];
-          SpaceCell spaceTri = m_meshWrapper.cellPositions(tIdx);
-          GeometricBoundingBox tBB = m_meshWrapper.cellBoundingBox(tIdx);
+        const BlockIndex childBlk = blk.child(j);
+        (*this)[childBlk].setData(static_cast<int>(nextLevelData.size()));
 
-          for(int j = 0; j < BlockIndex::numChildren(); ++j)
-          {
-            bool shouldAddCell = blockIndexesElementVertex(tIdx, childBlk[j]) ||
-              (childDataPtr[j]->isLeaf() ? intersect(spaceTri, childBB[j])
-                                         : intersect(tBB, childBB[j]));
-
-            QUEST_OCTREE_DEBUG_LOG_IF(
-              DEBUG_BLOCK_1 == childBlk[j] || DEBUG_BLOCK_2 == childBlk[j],
-              //&& tIdx == DEBUG_TRI_IDX
-              axom::fmt::format("Attempting to insert cell {} @ {} w/ BB {}"
-                                "\n\t into block {} w/ BB {} and data {} "
-                                "\n\tShould add? {}",
-                                tIdx,
-                                spaceTri,
-                                tBB,
-                                axom::fmt::streamed(childBlk[j]),
-                                childBB[j],
-                                *childDataPtr[j],
-                                (shouldAddCell ? " yes" : "no")));
-
-            if(shouldAddCell)
-            {
-              // Place the DynamicGrayBlockData in the array before adding its data
-              if(!childDataPtr[j]->hasCells())
-              {
-                // Copy the DynamicGrayBlockData into the array
-                nextLevelData.push_back(childData[j]);
-
-                // Update the child data pointer
-                childDataPtr[j] = &nextLevelData[nextLevelDataBlockCounter];
-
-                // Set the data in the octree to this index and update the index
-                (*this)[childBlk[j]].setData(nextLevelDataBlockCounter++);
-              }
-
-              childDataPtr[j]->addCell(tIdx);
-
-              QUEST_OCTREE_DEBUG_LOG_IF(
-                DEBUG_BLOCK_1 == childBlk[j] || DEBUG_BLOCK_2 == childBlk[j],
-                //&& tIdx == DEBUG_TRI_IDX
-                axom::fmt::format(
-                  "Added cell {} @ {} with verts [{}]"
-                  "\n\tinto block {} with data {}.",
-                  tIdx,
-                  spaceTri,
-                  fmt::join(m_meshWrapper.cellVertexIndices(tIdx), ", "),
-                  axom::fmt::streamed(childBlk[j]),
-                  *(childDataPtr[j])));
-            }
-          }
-        }
+        nextLevelData.push_back(
+          DynamicGrayBlockData(childData.vertexIndex(), childData.isLeaf()));
+        nextLevelData.back().cells().swap(childData.cells());
+
+        QUEST_OCTREE_DEBUG_LOG_IF(
+          DEBUG_BLOCK_1 == childBlk || DEBUG_BLOCK_2 == childBlk,
+          axom::fmt::format("Added cells [{}] into block {} with data {}.",
+                            fmt::join(nextLevelData.back().cells(), ", "),
+                            axom::fmt::streamed(childBlk),
+                            nextLevelData.back()));
       }
     }
 
@@ -899,6 +1169,7 @@ void InOutOctree<DIM>::insertMeshCells()
 }
 
 template <int DIM>
+template <typename ExecSpace>
 void InOutOctree<DIM>::colorOctreeLeaves()
 {
   // Note (KW): Existence of leaf implies that either
@@ -907,15 +1178,25 @@ void InOutOctree<DIM>::colorOctreeLeaves()
   // * one of its siblings has a gray descendant
 
   using Timer = axom::utilities::Timer;
+  using LeafColor = InOutBlockData::LeafColor;
   using GridPtVec = std::vector<GridPt>;
+
+  const int numFaces = BlockIndex::numFaceNeighbors();
+
+  GridPtVec levelLeaves;
   GridPtVec uncoloredBlocks;
+  GridPtVec newlyColoredBlocks;
+  std::vector<LeafColor> colors;
+  std::vector<BlockIndex> coarserBlocks;
 
   // Bottom-up traversal of octree
   for(int lev = this->maxLeafLevel() - 1; lev >= 0; --lev)
   {
-    uncoloredBlocks.clear();
     Timer levelTimer(true);
 
+    levelLeaves.clear();
+    uncoloredBlocks.clear();
+
     auto& levelLeafMap = this->getOctreeLevel(lev);
     auto itEnd = levelLeafMap.end();
     for(auto it = levelLeafMap.begin(); it != itEnd; ++it)
@@ -925,42 +1206,125 @@ void InOutOctree<DIM>::colorOctreeLeaves()
         continue;
       }
 
-      BlockIndex leafBlk(it.pt(), lev);
-      InOutBlockData& blockData = *it;
-      if(!colorLeafAndNeighbors(leafBlk, blockData))
+      levelLeaves.push_back(it.pt());
+      if(!it->isColored())
       {
-        uncoloredBlocks.push_back(leafBlk.pt());
+        uncoloredBlocks.push_back(it.pt());
       }
     }
 
-    // Iterate through the uncolored blocks until all have a color
-    // This terminates since we know that one of its siblings
-    // (or their descendants) is gray
+    // Spread the colors among the leaves of this level in rounds. In each
+    // round, the candidate blocks find a color from their colored same-level
+    // neighbors. The candidates of the next round are the uncolored
+    // neighbors of the blocks colored in this round, so all leaves get a
+    // color since we know that one of its siblings (or their descendants)
+    // is gray
     while(!uncoloredBlocks.empty())
     {
-      int prevCount = static_cast<int>(uncoloredBlocks.size());
-      AXOM_UNUSED_VAR(prevCount);
+      const IndexType numCandidates =
+        static_cast<IndexType>(uncoloredBlocks.size());
+      colors.resize(numCandidates);
+      axom::for_all<ExecSpace>(numCandidates, [&](IndexType i) {
+        colors[i] = findColorFromNeighbors(BlockIndex(uncoloredBlocks[i], lev));
+      });
+
+      newlyColoredBlocks.clear();
+      for(IndexType i = 0; i < numCandidates; ++i)
+      {
+        InOutBlockData& blkData = (*this)[BlockIndex(uncoloredBlocks[i], lev)];
+        if(colors[i] == InOutBlockData::Undetermined || blkData.isColored())
+        {
+          continue;
+        }
 
-      GridPtVec prevVec;
-      prevVec.swap(uncoloredBlocks);
-      auto end = prevVec.end();
-      for(auto it = prevVec.begin(); it < end; ++it)
+        if(colors[i] == InOutBlockData::Black)
+        {
+          blkData.setBlack();
+        }
+        else
+        {
+          blkData.setWhite();
+        }
+        newlyColoredBlocks.push_back(uncoloredBlocks[i]);
+      }
+
+      uncoloredBlocks.clear();
+      for(const GridPt& pt : newlyColoredBlocks)
       {
-        BlockIndex leafBlk(*it, lev);
-        if(!colorLeafAndNeighbors(leafBlk, (*this)[leafBlk]))
+        const BlockIndex blk(pt, lev);
+        for(int f = 0; f < numFaces; ++f)
         {
-          uncoloredBlocks.push_back(*it);
+          const BlockIndex neighborBlk = blk.faceNeighbor(f);
+          if(this->isLeaf(neighborBlk) && !(*this)[neighborBlk].isColored())
+          {
+            uncoloredBlocks.push_back(neighborBlk.pt());
+          }
         }
       }
+    }
 
-      SLIC_ASSERT_MSG(
-        static_cast<int>(uncoloredBlocks.size()) < prevCount,
-        axom::fmt::format("Problem coloring leaf blocks at level {}. "
-                          "There are {} blocks that are still not colored. "
-                          "First problem block is: {}",
-                          lev,
-                          uncoloredBlocks.size(),
-                          fmt::streamed(BlockIndex(uncoloredBlocks[0], lev))));
+#ifdef AXOM_DEBUG
+    // The rounds above only reach the leaves that are connected to a colored
+    // leaf, so check that they colored all the leaves of this level
+    for(const GridPt& pt : levelLeaves)
+    {
+      if(!(*this)[BlockIndex(pt, lev)].isColored())
+      {
+        uncoloredBlocks.push_back(pt);
+      }
+    }
+    SLIC_ASSERT_MSG(
+      uncoloredBlocks.empty(),
+      axom::fmt::format("Problem coloring leaf blocks at level {}. "
+                        "There are {} blocks that are still not colored. "
+                        "First problem block is: {}",
+                        lev,
+                        uncoloredBlocks.size(),
+                        fmt::streamed(BlockIndex(uncoloredBlocks[0], lev))));
+#endif
+
+    // Propagate the colors to uncolored face neighbors at coarser levels
+    const IndexType numLeaves = static_cast<IndexType>(levelLeaves.size());
+    colors.resize(numLeaves * numFaces);
+    coarserBlocks.resize(numLeaves * numFaces);
+    axom::for_all<ExecSpace>(numLeaves, [&](IndexType i) {
+      const InOutOctree& constThis = *this;
+      const BlockIndex leafBlk(levelLeaves[i], lev);
+      const InOutBlockData& leafData = constThis[leafBlk];
+      for(int f = 0; f < numFaces; ++f)
+      {
+        const IndexType idx = i * numFaces + f;
+        const BlockIndex faceBlk = leafBlk.faceNeighbor(f);
+        coarserBlocks[idx] = this->coveringLeafBlock(faceBlk);
+        colors[idx] = InOutBlockData::Undetermined;
+        if(coarserBlocks[idx] != BlockIndex::invalid_index() &&
+           coarserBlocks[idx].level() < lev &&
+           !constThis[coarserBlocks[idx]].isColored())
+        {
+          colors[idx] = colorAcrossFace(leafBlk, leafData, faceBlk);
+        }
+      }
+    });
+
+    for(IndexType idx = 0; idx < numLeaves * numFaces; ++idx)
+    {
+      if(colors[idx] == InOutBlockData::Undetermined)
+      {
+        continue;
+      }
+
+      InOutBlockData& neighborData = (*this)[coarserBlocks[idx]];
+      if(!neighborData.isColored())
+      {
+        if(colors[idx] == InOutBlockData::Black)
+        {
+          neighborData.setBlack();
+        }
+        else
+        {
+          neighborData.setWhite();
+        }
+      }
     }
 
     if(!levelLeafMap.empty())
@@ -975,151 +1339,72 @@ void InOutOctree<DIM>::colorOctreeLeaves()
 }
 
 template <int DIM>
-bool InOutOctree<DIM>::colorLeafAndNeighbors(const BlockIndex& leafBlk,
-                                             InOutBlockData& leafData)
+InOutBlockData::LeafColor InOutOctree<DIM>::findColorFromNeighbors(
+  const BlockIndex& leafBlk) const
 {
-  bool isColored = leafData.isColored();
-
-  QUEST_OCTREE_DEBUG_LOG_IF(
-    leafBlk == DEBUG_BLOCK_1 || leafBlk == DEBUG_BLOCK_2,
-    axom::fmt::format("Trying to color {} with data: {}",
-                      axom::fmt::streamed(leafBlk),
-                      leafData));
-
-  if(!isColored)
+  for(int i = 0; i < leafBlk.numFaceNeighbors(); ++i)
   {
-    // Leaf does not yet have a color... try to find its color from same-level face neighbors
-    for(int i = 0; !isColored && i < leafBlk.numFaceNeighbors(); ++i)
+    const BlockIndex neighborBlk = leafBlk.faceNeighbor(i);
+    if(this->isLeaf(neighborBlk))
     {
-      BlockIndex neighborBlk = leafBlk.faceNeighbor(i);
-      if(this->isLeaf(neighborBlk))
+      const InOutBlockData::LeafColor color =
+        colorAcrossFace(neighborBlk, (*this)[neighborBlk], leafBlk);
+      if(color != InOutBlockData::Undetermined)
       {
-        const InOutBlockData& neighborData = (*this)[neighborBlk];
-
-        QUEST_OCTREE_DEBUG_LOG_IF(
-          DEBUG_BLOCK_1 == neighborBlk || DEBUG_BLOCK_2 == neighborBlk ||
-            DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
-          axom::fmt::format("Spreading color to block {} with data {}, "
-                            "bounding box {} w/ midpoint {}"
-                            "\n\t\t from block {} with data {}, "
-                            "bounding box {} w/ midpoint {}.",
-                            axom::fmt::streamed(leafBlk),
-                            leafData,
-                            this->blockBoundingBox(leafBlk),
-                            this->blockBoundingBox(leafBlk).getCentroid(),
-                            axom::fmt::streamed(neighborBlk),
-                            neighborData,
-                            this->blockBoundingBox(neighborBlk),
-                            this->blockBoundingBox(neighborBlk).getCentroid()));
-
-        switch(neighborData.color())
-        {
-        case InOutBlockData::Black:
-          leafData.setBlack();
-          break;
-        case InOutBlockData::White:
-          leafData.setWhite();
-          break;
-        case InOutBlockData::Gray:
-        {
-          SpacePt faceCenter =
-            SpacePt::midpoint(this->blockBoundingBox(leafBlk).getCentroid(),
-                              this->blockBoundingBox(neighborBlk).getCentroid());
-          if(withinGrayBlock<DIM>(faceCenter, neighborBlk, neighborData))
-          {
-            leafData.setBlack();
-          }
-          else
-          {
-            leafData.setWhite();
-          }
-        }
-        break;
-        case InOutBlockData::Undetermined:
-          break;
-        }
-
-        isColored = leafData.isColored();
-
-        QUEST_OCTREE_DEBUG_LOG_IF(
-          isColored &&
-            (DEBUG_BLOCK_1 == neighborBlk || DEBUG_BLOCK_2 == neighborBlk),
-          axom::fmt::format("Leaf block was colored -- {} now has data {}",
-                            axom::fmt::streamed(leafBlk),
-                            leafData));
+        return color;
       }
     }
   }
 
-  // If the block has a color, try to color its face neighbors at the same or coarser resolution
-  if(isColored)
-  {
-    for(int i = 0; i < leafBlk.numFaceNeighbors(); ++i)
-    {
-      BlockIndex neighborBlk = this->coveringLeafBlock(leafBlk.faceNeighbor(i));
-      if(neighborBlk != BlockIndex::invalid_index())
-      {
-        InOutBlockData& neighborData = (*this)[neighborBlk];
-        if(!neighborData.isColored())
-        {
-          QUEST_OCTREE_DEBUG_LOG_IF(
-            DEBUG_BLOCK_1 == neighborBlk || DEBUG_BLOCK_2 == neighborBlk ||
-              DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
-            axom::fmt::format("Spreading color from block {} with data {}, "
-                              "bounding box {} w/ midpoint {}"
-                              "\n\t\t to block {} with data {}, "
-                              "bounding box {} w/ midpoint {}.",
-                              axom::fmt::streamed(leafBlk),
-                              leafData,
-                              this->blockBoundingBox(leafBlk),
-                              this->blockBoundingBox(leafBlk).getCentroid(),
-                              axom::fmt::streamed(neighborBlk),
-                              neighborData,
-                              this->blockBoundingBox(neighborBlk),
-                              this->blockBoundingBox(neighborBlk).getCentroid()));
-
-          switch(leafData.color())
-          {
-          case InOutBlockData::Black:
-            neighborData.setBlack();
-            break;
-          case InOutBlockData::White:
-            neighborData.setWhite();
-            break;
-          case InOutBlockData::Gray:
-          {
-            // Check the center of the shared face between the same-level neighbor of the gray block
-            SpacePt faceCenter = SpacePt::midpoint(
-              this->blockBoundingBox(leafBlk).getCentroid(),
-              this->blockBoundingBox(leafBlk.faceNeighbor(i)).getCentroid());
-
-            if(withinGrayBlock<DIM>(faceCenter, leafBlk, leafData))
-            {
-              neighborData.setBlack();
-            }
-            else
-            {
-              neighborData.setWhite();
-            }
-          }
-          break;
-          case InOutBlockData::Undetermined:
-            break;
-          }
+  return InOutBlockData::Undetermined;
+}
 
-          QUEST_OCTREE_DEBUG_LOG_IF(
-            neighborData.isColored() &&
-              (DEBUG_BLOCK_1 == neighborBlk || DEBUG_BLOCK_2 == neighborBlk),
-            axom::fmt::format(
-              "Neighbor block was colored -- {} now has data {}",
-              axom::fmt::streamed(neighborBlk),
-              neighborData));
-        }
-      }
-    }
+template <int DIM>
+InOutBlockData::LeafColor InOutOctree<DIM>::colorAcrossFace(
+  const BlockIndex& srcBlk,
+  const InOutBlockData& srcData,
+  const BlockIndex& adjBlk) const
+{
+  QUEST_OCTREE_DEBUG_LOG_IF(
+    DEBUG_BLOCK_1 == srcBlk || DEBUG_BLOCK_2 == srcBlk ||
+      DEBUG_BLOCK_1 == adjBlk || DEBUG_BLOCK_2 == adjBlk,
+    axom::fmt::format("Spreading color from block {} with data {}, "
+                      "bounding box {} w/ midpoint {}"
+                      "\n\t\t across face with block {}, "
+                      "bounding box {} w/ midpoint {}.",
+                      axom::fmt::streamed(srcBlk),
+                      srcData,
+                      this->blockBoundingBox(srcBlk),
+                      this->blockBoundingBox(srcBlk).getCentroid(),
+                      axom::fmt::streamed(adjBlk),
+                      this->blockBoundingBox(adjBlk),
+                      this->blockBoundingBox(adjBlk).getCentroid()));
+
+  switch(srcData.color())
+  {
+  case InOutBlockData::Black:
+    return InOutBlockData::Black;
+  case InOutBlockData::White:
+    return InOutBlockData::White;
+  case InOutBlockData::Gray:
+  {
+    // Check the center of the face shared by the gray block
+    // and its same-level neighbor
+    const SpacePt faceCenter =
+      SpacePt::midpoint(this->blockBoundingBox(srcBlk).getCentroid(),
+                        this->blockBoundingBox(adjBlk).getCentroid());
+
+    return withinGrayBlock<DIM>(faceCenter,
+                                srcBlk,
+                                leafCells(srcBlk, srcData))
+      ? InOutBlockData::Black
+      : InOutBlockData::White;
+  }
+  case InOutBlockData::Undetermined:
+    break;
   }
 
-  return isColored;
+  return InOutBlockData::Undetermined;
 }
 
 template <int DIM>
@@ -1151,26 +1436,25 @@ typename InOutOctree<DIM>::CellIndexSet InOutOctree<DIM>::leafCells(
 }
 
 template <int DIM>
-template <int TDIM>
+template <int TDIM, typename CellSet>
 typename std::enable_if<TDIM == 3, bool>::type InOutOctree<DIM>::withinGrayBlock(
   const SpacePt& queryPt,
   const BlockIndex& leafBlk,
-  const InOutBlockData& leafData) const
+  const CellSet& cells) const
 {
   /// Finds a ray from queryPt to a point of a triangle within leafBlk.
   /// Then find the first triangle along this ray. The orientation of the ray
   /// against this triangle's normal indicates queryPt's containment.
   /// It is inside when the dot product is positive.
 
-  SLIC_ASSERT(leafData.color() == InOutBlockData::Gray);
-  SLIC_ASSERT(leafData.hasData());
+  SLIC_ASSERT(cells.size() > 0);
 
   GeometricBoundingBox blockBB = this->blockBoundingBox(leafBlk);
 
   SpacePt triPt;
 
-  CellIndexSet triSet = leafCells(leafBlk, leafData);
-  const int numTris = triSet.size();
+  const CellSet& triSet = cells;
+  const int numTris = static_cast<int>(triSet.size());
   for(int i = 0; i < numTris; ++i)
   {
     /// Get the triangle
@@ -1209,11 +1493,11 @@ typename std::enable_if<TDIM == 3, bool>::type InOutOctree<DIM>::withinGrayBlock
     QUEST_OCTREE_DEBUG_LOG_IF(
       DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
       axom::fmt::format(
-        "Checking if pt {} is within block {} with data {}, "
+        "Checking if pt {} is within block {} with cells [{}], "
         "ray is {}, triangle point is {} on triangle with index {}.",
         queryPt,
         axom::fmt::streamed(leafBlk),
-        leafData,
+        fmt::join(cells, ","),
         ray,
         triPt,
         idx));
@@ -1279,19 +1563,18 @@ typename std::enable_if<TDIM == 3, bool>::type InOutOctree<DIM>::withinGrayBlock
 }
 
 template <int DIM>
-template <int TDIM>
+template <int TDIM, typename CellSet>
 typename std::enable_if<TDIM == 2, bool>::type InOutOctree<DIM>::withinGrayBlock(
   const SpacePt& queryPt,
   const BlockIndex& leafBlk,
-  const InOutBlockData& leafData) const
+  const CellSet& cells) const
 {
   /// Finds a ray from queryPt to a point of a segment within leafBlk.
   /// Then finds the first segment along this ray. The orientation of the ray
   /// against this segment's normal indicates queryPt's containment.
   /// It is inside when the dot product is positive.
 
-  SLIC_ASSERT(leafData.color() == InOutBlockData::Gray);
-  SLIC_ASSERT(leafData.hasData());
+  SLIC_ASSERT(cells.size() > 0);
 
   GeometricBoundingBox blockBB = this->blockBoundingBox(leafBlk);
   GeometricBoundingBox expandedBB = blockBB;
@@ -1299,8 +1582,8 @@ typename std::enable_if<TDIM == 2, bool>::type InOutOctree<DIM>::withinGrayBlock
 
   SpacePt segmentPt;
 
-  CellIndexSet segmentSet = leafCells(leafBlk, leafData);
-  const int numSegments = segmentSet.size();
+  const CellSet& segmentSet = cells;
+  const int numSegments = static_cast<int>(segmentSet.size());
   for(int i = 0; i < numSegments; ++i)
   {
     /// Get the segment
@@ -1327,11 +1610,11 @@ typename std::enable_if<TDIM == 2, bool>::type InOutOctree<DIM>::withinGrayBlock
     QUEST_OCTREE_DEBUG_LOG_IF(
       DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
       axom::fmt::format(
-        "Checking if pt {} is within block {} with data {}, "
+        "Checking if pt {} is within block {} with cells [{}], "
         "ray is {}, segment point is {} on segment with index {}.",
         queryPt,
         axom::fmt::streamed(leafBlk),
-        leafData,
+        fmt::join(cells, ","),
         ray,
         segmentPt,
         idx));
@@ -1531,10 +1814,47 @@ bool InOutOctree<DIM>::allCellsIncidentInCommonVertex(
   return shareCommonVert;
 }
 
+template <int DIM>
+bool InOutOctree<DIM>::freeze()
+{
+  SLIC_ASSERT(m_generationState == INOUTOCTREE_LEAVES_COLORED);
+
+  m_frozenOctree = FrozenOctreeType(*this);
+
+  SLIC_INFO_IF(isFrozen(),
+               axom::fmt::format(axom::utilities::locale(),
+                                 "  Froze InOutOctree with {:L} leaves and "
+                                 "{:L} gray leaves in {:L} bytes.",
+                                 m_frozenOctree.numLeaves(),
+                                 m_frozenOctree.numGrayLeaves(),
+                                 m_frozenOctree.memoryFootprint()));
+
+  return isFrozen();
+}
+
 template <int DIM>
 bool InOutOctree<DIM>::within(const SpacePt& pt) const
 {
-  if(this->boundingBox().contains(pt))
+  if(this->boundingBox().contains(pt) && isFrozen())
+  {
+    // Find the leaf in the sorted arrays of the frozen octree
+    const int maxLevel = m_frozenOctree.maxLevel();
+    const IndexType leaf =
+      m_frozenOctree.findLeaf(this->findGridCellAtLevel(pt, maxLevel));
+
+    switch(m_frozenOctree.leafColor(leaf))
+    {
+    case InOutBlockData::Black:
+      return true;
+    case InOutBlockData::Gray:
+      return withinGrayBlock<DIM>(pt,
+                                  m_frozenOctree.leafBlock(leaf),
+                                  m_frozenOctree.leafCells(leaf));
+    default:
+      return false;
+    }
+  }
+  else if(this->boundingBox().contains(pt))
   {
     const BlockIndex block = this->findLeafBlock(pt);
     const InOutBlockData& data = (*this)[block];
@@ -1546,7 +1866,7 @@ bool InOutOctree<DIM>::within(const SpacePt& pt) const
     case InOutBlockData::White:
       return false;
     case InOutBlockData::Gray:
-      return withinGrayBlock<DIM>(pt, block, data);
+      return withinGrayBlock<DIM>(pt, block, leafCells(block, data));
     case InOutBlockData::Undetermined:
       SLIC_ASSERT_MSG(
         false,
@@ -1562,6 +1882,19 @@ bool InOutOctree<DIM>::within(const SpacePt& pt) const
   return false;
 }
 
+template <int DIM>
+template <typename ExecSpace>
+void InOutOctree<DIM>::within(axom::ArrayView<const SpacePt> pts,
+                              axom::ArrayView<bool> results) const
+{
+  AXOM_STATIC_ASSERT_MSG(!axom::execution_space<ExecSpace>::onDevice(),
+                         "InOutOctree only supports host execution spaces");
+  SLIC_ASSERT(results.size() >= pts.size());
+
+  axom::for_all<ExecSpace>(pts.size(),
+                           [=](IndexType i) { results[i] = within(pts[i]); });
+}
+
 template <int DIM>
 void InOutOctree<DIM>::printOctreeStats() const
 {
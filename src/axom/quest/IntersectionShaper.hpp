@@ -962,18 +962,15 @@ public:
           const int shapeIndex = shape_candidates_device_view[i];
           const int tetIndex = tet_indices_device_view[i];
 
-          const PolyhedronType poly =
-            primal::clip(shapes_device_view[shapeIndex],
-                         tets_from_hexes_device_view[tetIndex],
-                         EPS,
-                         tryFixOrientation);
-
-          // Poly is valid
-          if(poly.numVertices() >= 4)
+          // Workaround - intermediate volume variable needed for
+          // CUDA Pro/E test case correctness
+          double volume =
+            primal::intersection_volume(shapes_device_view[shapeIndex],
+                                        tets_from_hexes_device_view[tetIndex],
+                                        EPS,
+                                        tryFixOrientation);
+          if(volume > 0.)
           {
-            // Workaround - intermediate volume variable needed for
-            // CUDA Pro/E test case correctness
-            double volume = poly.volume();
             RAJA::atomicAdd<ATOMIC_POL>(overlap_volumes_device_view.data() + index,
                                         volume);
           }
@@ -145,7 +145,21 @@ AXOM_HOST_DEVICE inline bool isClosestPointTypeShared(ClosestPointLocType cpt)
 
 }  // end namespace detail
 
-template <int NDIMS, typename ExecSpace = axom::SEQ_EXEC>
+/*!
+ * \brief Computes the signed distance to a surface mesh.
+ *
+ * \tparam NDIMS the dimension of the surface mesh, 2 or 3.
+ * \tparam ExecSpace the execution space of the queries. Optional.
+ * \tparam BVHImpl the BVH used to find the closest cells, e.g.,
+ *  spin::BVHType::LinearBVH or spin::BVHType::WideBVH4. Optional.
+ *
+ * \note The wide BVHs visit the closest child first, which tightens the
+ *  search radius sooner for closest point queries. Only the binary
+ *  spin::BVHType::LinearBVH can be shared in serialized form.
+ */
+template <int NDIMS,
+          typename ExecSpace = axom::SEQ_EXEC,
+          spin::BVHType BVHImpl = spin::BVHType::LinearBVH>
 class SignedDistance
 {
 public:
@@ -154,7 +168,7 @@ public:
   using TriangleType = axom::primal::Triangle<double, NDIMS>;
   using BoxType = axom::primal::BoundingBox<double, NDIMS>;
   using ZipPoint = axom::primal::ZipIndexable<PointType>;
-  using BVHTreeType = axom::spin::BVH<NDIMS, ExecSpace>;
+  using BVHTreeType = axom::spin::BVH<NDIMS, ExecSpace, double, BVHImpl>;
 
 private:
   struct MinCandidate
@@ -201,6 +215,35 @@ public:
                  bool computeSign = true,
                  int allocatorID = axom::execution_space<ExecSpace>::allocatorID());
 
+  /*!
+   * \brief Creates a SignedDistance instance for queries on the given mesh,
+   *  which uses a BVH that was built and serialized by another instance.
+   *
+   * \param [in] surfaceMesh user-supplied surface mesh.
+   * \param [in] bvhBuffer buffer holding the BVH of an instance over the same
+   *  surface mesh, written by BVHTreeType::serialize().
+   * \param [in] bvhBufferSize the size of the buffer in bytes.
+   * \param [in] isWatertight indicates if the surface mesh is closed.
+   * \param [in] computeSign indicates if distance queries should compute signs (optional).
+   * \param [in] allocatorID the allocator for the BVH, if it is copied (optional).
+   *
+   * \note The BVH is accessed in place in the buffer, e.g., a segment of
+   *  MPI-3 shared memory, so that several processes can query the same BVH
+   *  without building it. The buffer must outlive the instance. The BVH is
+   *  copied on devices.
+   *
+   * \note Only supported for spin::BVHType::LinearBVH.
+   *
+   * \pre surfaceMesh != nullptr
+   * \pre bvhBuffer != nullptr
+   */
+  SignedDistance(const mint::Mesh* surfaceMesh,
+                 const void* bvhBuffer,
+                 std::size_t bvhBufferSize,
+                 bool isWatertight,
+                 bool computeSign = true,
+                 int allocatorID = axom::execution_space<ExecSpace>::allocatorID());
+
   /*!
    * \brief Reinitializes a SignedDistance instance with a new surface mesh.
    *
@@ -215,6 +258,10 @@ public:
    *  specified in the SignedDistance instantiation. By default, a compatible
    *  allocator ID used if allocatorID is not specified.
    *
+   * \note If the surface mesh is the same as the current one, e.g., a moving
+   *  interface whose nodes have been updated in place, the hierarchy of the
+   *  underlying BVH is kept and only its bounding boxes are updated.
+   *
    * \return status true if reinitialization was successful.
    * \pre surfaceMesh != nullptr
    */
@@ -308,6 +355,8 @@ public:
    *  Optional.
    * \param [out] outNormals array to fill with surface normals associated with
    * closest points on the mesh. Optional.
+   * \param [out] outCellIds array to fill with the index of the surface mesh
+   *  cell containing the closest point to each query point. Optional.
    *
    * \note When the input is not a closed surface mesh, the assumption is that
    *  the surface mesh divides the computational mesh domain into two regions.
@@ -321,16 +370,66 @@ public:
    *  everywhere. Specifically, the sign is ambiguous for all points for which
    *  a normal projection onto the surface does not exist.
    *
+   * \note The query points are read in place, so strided or interleaved
+   *  coordinate data can be queried without a copy through a ZipPoint built
+   *  with a stride. All the requested outputs are computed in a single
+   *  traversal of the BVH per query point.
+   *
+   * \note When a narrow band is set, query points that are farther than the
+   *  band width from the surface get a distance of +/-width, a closest cell
+   *  index of -1, and an unset closest point and normal. The sign of these
+   *  points is only computed for a watertight surface mesh, and is positive
+   *  otherwise.
+   *
    * \return the signed minimum distance to the surface mesh.
    *
    * \pre outSgnDist != nullptr
+   *
+   * \see setNarrowBand()
    */
   template <typename PointIndexable>
   void computeDistances(int npts,
                         PointIndexable queryPts,
                         double* outSgnDist,
                         PointType* outClosestPts = nullptr,
-                        VectorType* outNormals = nullptr) const;
+                        VectorType* outNormals = nullptr,
+                        IndexType* outCellIds = nullptr) const;
+
+  /*!
+   * \brief Restricts the distance queries to a narrow band around the surface.
+   *
+   * \param [in] width the width of the band around the surface mesh
+   *
+   * \note The traversal of the BVH for a query point stops as soon as all the
+   *  remaining bins are farther than \a width from the point, so that points
+   *  far from the surface are cheap to query. Their distance is clamped to
+   *  \a width. When signs are computed for a watertight surface mesh, the
+   *  points in the bounding box of the mesh are traversed again without the
+   *  band to find their sign, so that points deep inside the surface get a
+   *  distance of -width.
+   *
+   * \pre width > 0
+   */
+  void setNarrowBand(double width)
+  {
+    SLIC_ASSERT(width > 0.);
+    m_narrowBand = width;
+  }
+
+  /// \brief Removes the narrow band set with setNarrowBand()
+  void clearNarrowBand()
+  {
+    m_narrowBand = numerics::floating_point_limits<double>::max();
+  }
+
+  /// \brief Returns the width of the narrow band of the distance queries
+  double getNarrowBand() const { return m_narrowBand; }
+
+  /// \brief Checks if the distance queries are restricted to a narrow band
+  bool hasNarrowBand() const
+  {
+    return m_narrowBand < numerics::floating_point_limits<double>::max();
+  }
 
   /*!
    * \brief Returns a const reference to the underlying bucket tree.
@@ -339,6 +438,12 @@ public:
   const BVHTreeType& getBVHTree() const { return m_bvh; }
 
 private:
+  /*!
+   * \brief Computes the bounding box of the nodes of the surface mesh.
+   * \pre m_surfaceMesh != nullptr
+   */
+  void computeMeshBounds();
+
   /*!
    * \brief Computes the bounding box of the given cell on the surface mesh.
    * \param [in] icell the index of the cell on the surface mesh.
@@ -395,6 +500,7 @@ private:
   const mint::Mesh* m_surfaceMesh; /*!< User-supplied surface mesh.          */
   BoxType m_boxDomain;             /*!< bounding box containing surface mesh */
   BVHTreeType m_bvh;               /*!< Spatial acceleration data-structure. */
+  double m_narrowBand {numerics::floating_point_limits<double>::max()};
 
   DISABLE_COPY_AND_ASSIGNMENT(SignedDistance);
 };
@@ -410,11 +516,12 @@ namespace axom
 namespace quest
 {
 //------------------------------------------------------------------------------
-template <int NDIMS, typename ExecSpace>
-SignedDistance<NDIMS, ExecSpace>::SignedDistance(const mint::Mesh* surfaceMesh,
-                                                 bool isWatertight,
-                                                 bool computeSign,
-                                                 int allocatorID)
+template <int NDIMS, typename ExecSpace, spin::BVHType BVHImpl>
+SignedDistance<NDIMS, ExecSpace, BVHImpl>::SignedDistance(
+  const mint::Mesh* surfaceMesh,
+  bool isWatertight,
+  bool computeSign,
+  int allocatorID)
   : m_isInputWatertight(isWatertight)
   , m_computeSign(computeSign)
 {
@@ -427,15 +534,39 @@ SignedDistance<NDIMS, ExecSpace>::SignedDistance(const mint::Mesh* surfaceMesh,
 }
 
 //------------------------------------------------------------------------------
-template <int NDIMS, typename ExecSpace>
-bool SignedDistance<NDIMS, ExecSpace>::setMesh(const mint::Mesh* surfaceMesh,
-                                               int allocatorID)
+template <int NDIMS, typename ExecSpace, spin::BVHType BVHImpl>
+SignedDistance<NDIMS, ExecSpace, BVHImpl>::SignedDistance(
+  const mint::Mesh* surfaceMesh,
+  const void* bvhBuffer,
+  std::size_t bvhBufferSize,
+  bool isWatertight,
+  bool computeSign,
+  int allocatorID)
+  : m_isInputWatertight(isWatertight)
+  , m_computeSign(computeSign)
+  , m_surfaceMesh(surfaceMesh)
 {
-  AXOM_ANNOTATE_SCOPE("SignedDistance::setMesh");
+  static_assert(BVHImpl == spin::BVHType::LinearBVH,
+                "Serialized BVHs are only supported for BVHType::LinearBVH");
+
+  // Sanity checks
   SLIC_ASSERT(surfaceMesh != nullptr);
+  SLIC_ASSERT(bvhBuffer != nullptr);
+
+  computeMeshBounds();
+
+  m_bvh.setAllocatorID(allocatorID);
+  const int result = m_bvh.attach(bvhBuffer, bvhBufferSize);
+  SLIC_ERROR_IF(result != spin::BVH_BUILD_OK,
+                "Supplied buffer does not hold a valid BVH");
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, spin::BVHType BVHImpl>
+void SignedDistance<NDIMS, ExecSpace, BVHImpl>::computeMeshBounds()
+{
+  SLIC_ASSERT(m_surfaceMesh != nullptr);
 
-  m_surfaceMesh = surfaceMesh;
-  const axom::IndexType ncells = m_surfaceMesh->getNumberOfCells();
   const axom::IndexType nnodes = m_surfaceMesh->getNumberOfNodes();
 
   // Get device-usable mesh data
@@ -447,13 +578,6 @@ bool SignedDistance<NDIMS, ExecSpace>::setMesh(const mint::Mesh* surfaceMesh,
     zs = m_surfaceMesh->getCoordinateArray(2);
   }
 
-  ZipPoint surfPts {{xs, ys, zs}};
-
-  detail::UcdMeshData surfaceData;
-  bool mesh_valid = detail::SD_GetUcdMeshData(m_surfaceMesh, surfaceData);
-  AXOM_UNUSED_VAR(mesh_valid);
-  SLIC_CHECK_MSG(mesh_valid, "Input mesh is not an unstructured surface mesh");
-
   // compute bounding box of surface mesh
   // NOTE: this should be changed to an oriented bounding box in the future.
 #ifdef AXOM_USE_RAJA
@@ -486,11 +610,50 @@ bool SignedDistance<NDIMS, ExecSpace>::setMesh(const mint::Mesh* surfaceMesh,
   PointType boxMax {xmax.get(), ymax.get(), zmax.get()};
   m_boxDomain = BoxType {boxMin, boxMax};
 #else
+  ZipPoint surfPts {{xs, ys, zs}};
+
+  m_boxDomain.clear();
   for(axom::IndexType inode = 0; inode < nnodes; ++inode)
   {
     m_boxDomain.addPoint(surfPts[inode]);
   }
 #endif
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, spin::BVHType BVHImpl>
+bool SignedDistance<NDIMS, ExecSpace, BVHImpl>::setMesh(
+  const mint::Mesh* surfaceMesh,
+  int allocatorID)
+{
+  AXOM_ANNOTATE_SCOPE("SignedDistance::setMesh");
+  SLIC_ASSERT(surfaceMesh != nullptr);
+
+  // The BVH can be refitted when the same mesh is supplied again, e.g., after
+  // its nodes have moved, as long as the number of cells has not changed.
+  const bool canRefit = m_bvh.isInitialized() &&
+    (surfaceMesh == m_surfaceMesh) && (m_bvh.getAllocatorID() == allocatorID);
+
+  m_surfaceMesh = surfaceMesh;
+  const axom::IndexType ncells = m_surfaceMesh->getNumberOfCells();
+
+  // Get device-usable mesh data
+  const double* xs = m_surfaceMesh->getCoordinateArray(0);
+  const double* ys = m_surfaceMesh->getCoordinateArray(1);
+  const double* zs = nullptr;
+  if(NDIMS == 3)
+  {
+    zs = m_surfaceMesh->getCoordinateArray(2);
+  }
+
+  ZipPoint surfPts {{xs, ys, zs}};
+
+  detail::UcdMeshData surfaceData;
+  bool mesh_valid = detail::SD_GetUcdMeshData(m_surfaceMesh, surfaceData);
+  AXOM_UNUSED_VAR(mesh_valid);
+  SLIC_CHECK_MSG(mesh_valid, "Input mesh is not an unstructured surface mesh");
+
+  computeMeshBounds();
 
   // Initialize BVH with the surface elements.
 
@@ -501,17 +664,29 @@ bool SignedDistance<NDIMS, ExecSpace>::setMesh(const mint::Mesh* surfaceMesh,
       boxes[icell] = getCellBoundingBox(icell, surfaceData, surfPts);
     });
 
-  // Build bounding volume hierarchy
-  m_bvh.setAllocatorID(allocatorID);
-  int result = m_bvh.initialize(boxes, ncells);
+  // Build bounding volume hierarchy, or refit the existing one. The latter
+  // falls back to a full build if the number of cells has changed or the
+  // quality of the refitted hierarchy has degraded too much. The hierarchy
+  // is only kept once the same mesh has been supplied again.
+  int result;
+  if(canRefit && m_bvh.isRefittable())
+  {
+    result = m_bvh.refit(boxes, ncells);
+  }
+  else
+  {
+    m_bvh.setAllocatorID(allocatorID);
+    m_bvh.setRefittable(canRefit);
+    result = m_bvh.initialize(boxes, ncells);
+  }
 
   axom::deallocate(boxes);
   return (result == spin::BVH_BUILD_OK);
 }
 
 //------------------------------------------------------------------------------
-template <int NDIMS, typename ExecSpace>
-inline double SignedDistance<NDIMS, ExecSpace>::computeDistance(
+template <int NDIMS, typename ExecSpace, spin::BVHType BVHImpl>
+inline double SignedDistance<NDIMS, ExecSpace, BVHImpl>::computeDistance(
   const PointType& pt) const
 {
   double dist;
@@ -520,8 +695,8 @@ inline double SignedDistance<NDIMS, ExecSpace>::computeDistance(
 }
 
 //------------------------------------------------------------------------------
-template <int NDIMS, typename ExecSpace>
-inline double SignedDistance<NDIMS, ExecSpace>::computeDistance(
+template <int NDIMS, typename ExecSpace, spin::BVHType BVHImpl>
+inline double SignedDistance<NDIMS, ExecSpace, BVHImpl>::computeDistance(
   const PointType& queryPnt,
   PointType& closestPnt,
   VectorType& surfaceNormal) const
@@ -532,14 +707,15 @@ inline double SignedDistance<NDIMS, ExecSpace>::computeDistance(
 }
 
 //------------------------------------------------------------------------------
-template <int NDIMS, typename ExecSpace>
+template <int NDIMS, typename ExecSpace, spin::BVHType BVHImpl>
 template <typename PointIndexable>
-inline void SignedDistance<NDIMS, ExecSpace>::computeDistances(
+inline void SignedDistance<NDIMS, ExecSpace, BVHImpl>::computeDistances(
   int npts,
   PointIndexable queryPts,
   double* outSgnDist,
   PointType* outClosestPts,
-  VectorType* outNormals) const
+  VectorType* outNormals,
+  IndexType* outCellIds) const
 {
   SLIC_ASSERT(npts > 0);
   SLIC_ASSERT(m_surfaceMesh != nullptr);
@@ -563,6 +739,13 @@ inline void SignedDistance<NDIMS, ExecSpace>::computeDistances(
   const BoxType boxDomain = m_boxDomain;
   const bool computeSigns = m_computeSign;
 
+  // Candidates farther than the narrow band are never accepted, which prunes
+  // the traversal for points far from the surface
+  const double bandWidth = m_narrowBand;
+  const double bandSqDist = hasNarrowBand()
+    ? bandWidth * bandWidth
+    : numerics::floating_point_limits<double>::max();
+
   detail::UcdMeshData surfaceData;
   bool result = detail::SD_GetUcdMeshData(m_surfaceMesh, surfaceData);
   AXOM_UNUSED_VAR(result);
@@ -575,6 +758,7 @@ inline void SignedDistance<NDIMS, ExecSpace>::computeDistances(
       PointType qpt = queryPts[idx];
 
       MinCandidate curr_min {};
+      curr_min.minSqDist = bandSqDist;
 
       auto searchMinDist = [&](std::int32_t current_node,
                                const std::int32_t* leaf_nodes) {
@@ -595,6 +779,35 @@ inline void SignedDistance<NDIMS, ExecSpace>::computeDistances(
       // Traverse the tree, searching for the point with minimum distance.
       it.traverse_tree(qpt, searchMinDist, traversePredicate);
 
+      // No candidate was found in the narrow band around the surface
+      if(curr_min.minType == detail::ClosestPointLocType::uninitialized)
+      {
+        // A closed surface can enclose points far from it, whose sign is
+        // found from the closest point of a full traversal
+        double bandSgn = 1.0;
+        if(computeSigns && watertightInput && boxDomain.contains(qpt))
+        {
+          curr_min.minSqDist = numerics::floating_point_limits<double>::max();
+          it.traverse_tree(qpt, searchMinDist, traversePredicate);
+          bandSgn = computeSign(qpt, curr_min);
+        }
+
+        outSgnDist[idx] = bandWidth * bandSgn;
+        if(outClosestPts)
+        {
+          outClosestPts[idx] = PointType {};
+        }
+        if(outNormals)
+        {
+          outNormals[idx] = VectorType {};
+        }
+        if(outCellIds)
+        {
+          outCellIds[idx] = -1;
+        }
+        return;
+      }
+
       double sgn = 1.0;
       if(computeSigns)
       {
@@ -616,15 +829,21 @@ inline void SignedDistance<NDIMS, ExecSpace>::computeDistances(
       {
         outNormals[idx] = getSurfaceNormal(curr_min).unitVector();
       }
+
+      if(outCellIds)
+      {
+        outCellIds[idx] = curr_min.minElem;
+      }
     });
 }
 
 //------------------------------------------------------------------------------
-template <int NDIMS, typename ExecSpace>
+template <int NDIMS, typename ExecSpace, spin::BVHType BVHImpl>
 AXOM_HOST_DEVICE inline axom::primal::BoundingBox<double, NDIMS>
-SignedDistance<NDIMS, ExecSpace>::getCellBoundingBox(axom::IndexType icell,
-                                                     const detail::UcdMeshData& mesh,
-                                                     ZipPoint meshPts)
+SignedDistance<NDIMS, ExecSpace, BVHImpl>::getCellBoundingBox(
+  axom::IndexType icell,
+  const detail::UcdMeshData& mesh,
+  ZipPoint meshPts)
 {
   // Get the cell type, for now we support linear triangle,quad in 3-D and
   // line segments in 2-D.
@@ -649,8 +868,8 @@ SignedDistance<NDIMS, ExecSpace>::getCellBoundingBox(axom::IndexType icell,
 }
 
 //------------------------------------------------------------------------------
-template <int NDIMS, typename ExecSpace>
-AXOM_HOST_DEVICE inline void SignedDistance<NDIMS, ExecSpace>::checkCandidate(
+template <int NDIMS, typename ExecSpace, spin::BVHType BVHImpl>
+AXOM_HOST_DEVICE inline void SignedDistance<NDIMS, ExecSpace, BVHImpl>::checkCandidate(
   const PointType& qpt,
   MinCandidate& currMin,
   IndexType cellId,
@@ -757,9 +976,10 @@ AXOM_HOST_DEVICE inline void SignedDistance<NDIMS, ExecSpace>::checkCandidate(
 }
 
 //------------------------------------------------------------------------------
-template <int NDIMS, typename ExecSpace>
-AXOM_HOST_DEVICE inline typename SignedDistance<NDIMS, ExecSpace>::VectorType
-SignedDistance<NDIMS, ExecSpace>::getSurfaceNormal(const MinCandidate& currMin)
+template <int NDIMS, typename ExecSpace, spin::BVHType BVHImpl>
+AXOM_HOST_DEVICE inline typename SignedDistance<NDIMS, ExecSpace, BVHImpl>::VectorType
+SignedDistance<NDIMS, ExecSpace, BVHImpl>::getSurfaceNormal(
+  const MinCandidate& currMin)
 {
   // Closest point is either internal to a face of the surface or, for points on
   // a boundary edge or vertex, we already computed the (pseudo)-normal during the traversal
@@ -769,8 +989,8 @@ SignedDistance<NDIMS, ExecSpace>::getSurfaceNormal(const MinCandidate& currMin)
 }
 
 //------------------------------------------------------------------------------
-template <int NDIMS, typename ExecSpace>
-AXOM_HOST_DEVICE inline double SignedDistance<NDIMS, ExecSpace>::computeSign(
+template <int NDIMS, typename ExecSpace, spin::BVHType BVHImpl>
+AXOM_HOST_DEVICE inline double SignedDistance<NDIMS, ExecSpace, BVHImpl>::computeSign(
   const PointType& qpt,
   const MinCandidate& currMin)
 {
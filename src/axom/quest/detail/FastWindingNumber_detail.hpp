@@ -0,0 +1,246 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_QUEST_FAST_WINDING_NUMBER_DETAIL_HPP_
+#define AXOM_QUEST_FAST_WINDING_NUMBER_DETAIL_HPP_
+
+#include "axom/config.hpp"
+#include "axom/core/Array.hpp"
+#include "axom/core/Macros.hpp"
+#include "axom/core/utilities/Utilities.hpp"
+
+#include "axom/primal/geometry/BezierCurve.hpp"
+#include "axom/primal/geometry/BoundingBox.hpp"
+#include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/geometry/Polyhedron.hpp"
+#include "axom/primal/geometry/Triangle.hpp"
+#include "axom/primal/geometry/Vector.hpp"
+#include "axom/primal/operators/compute_bounding_box.hpp"
+
+#include <cmath>
+
+namespace axom
+{
+namespace quest
+{
+namespace detail
+{
+/*!
+ * \brief Second-order far-field expansion of the generalized winding number
+ *  of a cluster of elements.
+ *
+ *  The winding number of a surface (or curve) is the potential of a dipole
+ *  layer, i.e., the integral of n(x) . grad G(x - q) over the elements, where
+ *  G is the free-space Green's function. Far from a cluster, the gradient of
+ *  G is expanded about the center of the cluster, which only involves the
+ *  sum of the area-weighted normals of the elements (the dipole) and their
+ *  first moments about the center, as in
+ *
+ *   Gavin Barill, Neil G. Dickson, Ryan Schmidt, David I.W. Levin, and
+ *   Alec Jacobson. 2018. Fast Winding Numbers for Soups and Clouds.
+ *   ACM Trans. Graph. 37, 4, Article 43 (July 2018)
+ */
+template <int NDIMS>
+struct WindingNumberExpansion
+{
+  using PointType = primal::Point<double, NDIMS>;
+  using VectorType = primal::Vector<double, NDIMS>;
+  using BoxType = primal::BoundingBox<double, NDIMS>;
+
+  PointType center;   // center of the expansion
+  double radius {0.};  // radius of the ball about center holding the cluster
+  double weight {0.};  // total unsigned area (or length) of the elements
+  VectorType dipole;   // sum of the area-weighted normals of the elements
+  double moment[NDIMS][NDIMS] {};  // sum of outer(n_i * a_i, c_i - center)
+
+  /// \brief Sets the radius to the one of the ball about center holding \a box
+  AXOM_HOST_DEVICE void setRadius(const BoxType& box)
+  {
+    double sq_radius = 0.;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const double lo = center[d] - box.getMin()[d];
+      const double hi = box.getMax()[d] - center[d];
+      const double extent = axom::utilities::max(lo, hi);
+      sq_radius += extent * extent;
+    }
+    radius = std::sqrt(sq_radius);
+  }
+
+  /*!
+   * \brief Sets this expansion to the one of the union of two clusters.
+   *
+   * \param [in] box bounding box of the union of the clusters
+   */
+  AXOM_HOST_DEVICE void combine(const WindingNumberExpansion& a,
+                                const WindingNumberExpansion& b,
+                                const BoxType& box)
+  {
+    weight = a.weight + b.weight;
+    if(weight > 0.)
+    {
+      for(int d = 0; d < NDIMS; ++d)
+      {
+        center[d] = (a.weight * a.center[d] + b.weight * b.center[d]) / weight;
+      }
+    }
+    else
+    {
+      center = box.getCentroid();
+    }
+    dipole = a.dipole + b.dipole;
+
+    // shift the moments of the children to the new center
+    const VectorType da(center, a.center);
+    const VectorType db(center, b.center);
+    for(int i = 0; i < NDIMS; ++i)
+    {
+      for(int j = 0; j < NDIMS; ++j)
+      {
+        moment[i][j] = a.moment[i][j] + a.dipole[i] * da[j] + b.moment[i][j] +
+          b.dipole[i] * db[j];
+      }
+    }
+
+    setRadius(box);
+  }
+
+  /// \brief Evaluates the expansion at a query point
+  AXOM_HOST_DEVICE double evaluate(const PointType& q) const
+  {
+    // kernel is r / |r|^NDIMS, with derivative
+    //   I / |r|^NDIMS - NDIMS * r r^T / |r|^(NDIMS+2)
+    const VectorType r(q, center);
+    const double sq_dist = r.squared_norm();
+    const double scale = (NDIMS == 3) ? 0.25 * M_1_PI : 0.5 * M_1_PI;
+    const double inv_pow = (NDIMS == 3) ? 1. / (sq_dist * std::sqrt(sq_dist))
+                                        : 1. / sq_dist;
+
+    double trace = 0.;
+    double quad = 0.;
+    for(int i = 0; i < NDIMS; ++i)
+    {
+      trace += moment[i][i];
+      for(int j = 0; j < NDIMS; ++j)
+      {
+        quad += r[i] * moment[i][j] * r[j];
+      }
+    }
+
+    return scale * inv_pow *
+      (dipole.dot(r) + trace - NDIMS * quad / sq_dist);
+  }
+};
+
+/// \brief Elements whose winding numbers are computed in \a NDIMS dimensions
+template <int NDIMS>
+struct WindingNumberElement;
+
+/*!
+ * \brief In 2D, the elements are Bezier curves.
+ *
+ *  Outside of the bounding box of its control points, the winding number of a
+ *  curve is the one of the segment joining its endpoints, so the expansion of
+ *  a curve is the one of this segment, whose normal is constant and whose
+ *  first moment about its midpoint vanishes.
+ */
+template <>
+struct WindingNumberElement<2>
+{
+  using Type = primal::BezierCurve<double, 2>;
+
+  static primal::BoundingBox<double, 2> boundingBox(const Type& curve)
+  {
+    return curve.boundingBox();
+  }
+
+  static WindingNumberExpansion<2> expansion(const Type& curve)
+  {
+    WindingNumberExpansion<2> exp;
+    const int ord = curve.getOrder();
+    if(ord <= 0)
+    {
+      if(ord == 0)
+      {
+        exp.center = curve[0];
+      }
+      return exp;
+    }
+
+    const primal::Vector<double, 2> chord(curve[0], curve[ord]);
+    exp.center = primal::Point<double, 2>::midpoint(curve[0], curve[ord]);
+    exp.weight = chord.norm();
+    exp.dipole = primal::Vector<double, 2> {chord[1], -chord[0]};
+    exp.setRadius(curve.boundingBox());
+    return exp;
+  }
+};
+
+/*!
+ * \brief In 3D, the elements are triangles, whose normal is constant and
+ *  whose first moment about their centroid vanishes.
+ */
+template <>
+struct WindingNumberElement<3>
+{
+  using Type = primal::Triangle<double, 3>;
+
+  static primal::BoundingBox<double, 3> boundingBox(const Type& tri)
+  {
+    return primal::compute_bounding_box(tri);
+  }
+
+  static WindingNumberExpansion<3> expansion(const Type& tri)
+  {
+    WindingNumberExpansion<3> exp;
+    for(int d = 0; d < 3; ++d)
+    {
+      exp.center[d] = (tri[0][d] + tri[1][d] + tri[2][d]) / 3.;
+    }
+    exp.dipole = 0.5 * tri.normal();
+    exp.weight = exp.dipole.norm();
+    exp.setRadius(primal::compute_bounding_box(tri));
+    return exp;
+  }
+
+  /*!
+   * \brief Returns the triangles of the faces of a polyhedron, which are
+   *  split in fans about their first vertex, so that the triangles of a face
+   *  have the same orientation as the face.
+   *
+   * \pre poly.hasNeighbors()
+   */
+  static axom::Array<Type> triangulate(
+    const primal::Polyhedron<double, 3>& poly)
+  {
+    SLIC_ASSERT(poly.hasNeighbors());
+    const int num_verts = poly.numVertices();
+
+    axom::Array<int> faces(num_verts * num_verts), face_size(2 * num_verts),
+      face_offset(2 * num_verts);
+    int face_count = 0;
+    poly.getFaces(faces.data(),
+                  face_size.data(),
+                  face_offset.data(),
+                  face_count);
+
+    axom::Array<Type> tris;
+    for(int i = 0; i < face_count; ++i)
+    {
+      const int* face = faces.data() + face_offset[i];
+      for(int j = 2; j < face_size[i]; ++j)
+      {
+        tris.push_back(Type(poly[face[0]], poly[face[j - 1]], poly[face[j]]));
+      }
+    }
+    return tris;
+  }
+};
+
+}  // end namespace detail
+}  // end namespace quest
+}  // end namespace axom
+
+#endif  // AXOM_QUEST_FAST_WINDING_NUMBER_DETAIL_HPP_
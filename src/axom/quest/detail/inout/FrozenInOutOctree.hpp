@@ -0,0 +1,351 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * \file FrozenInOutOctree.hpp
+ *
+ * \brief Defines a linearized, query-only representation of an InOutOctree.
+ */
+
+#ifndef AXOM_QUEST_FROZEN_INOUT_OCTREE__HPP_
+#define AXOM_QUEST_FROZEN_INOUT_OCTREE__HPP_
+
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+#include "axom/spin.hpp"
+
+#include "BlockData.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace axom
+{
+namespace quest
+{
+// Predeclare InOutOctree class
+template <int DIM>
+class InOutOctree;
+
+namespace detail
+{
+/**
+ * \class FrozenInOutOctree
+ * \brief A linearized, query-only representation of the leaves of an
+ * InOutOctree
+ *
+ * The leaves are stored in contiguous arrays, sorted by the Morton index of
+ * their first grid cell at the finest leaf level of the octree. Since the
+ * leaves of an InOutOctree cover its bounding box without overlapping, the
+ * leaf covering a grid cell of the finest level is the last leaf whose Morton
+ * index does not exceed that of the cell. It is found with a binary search
+ * instead of the hash map lookups on the levels of the octree.
+ *
+ * Each leaf holds its level and either its color or, for gray leaves, the
+ * index of its list of mesh cells. The cell lists of the gray leaves are
+ * stored in compressed (offsets and indices) arrays.
+ *
+ * \note The Morton indices are 64-bit integers, so the finest leaf level is
+ * limited to maxRepresentableLevel(), i.e. 21 in 3D and 32 in 2D.
+ */
+template <int DIM>
+class FrozenInOutOctree
+{
+public:
+  using OctreeBaseType = spin::OctreeBase<DIM, InOutBlockData>;
+  using BlockIndex = typename OctreeBaseType::BlockIndex;
+  using GridPt = typename OctreeBaseType::GridPt;
+  using CoordType = typename OctreeBaseType::CoordType;
+
+  using MortonIndex = std::uint64_t;
+  using MortonizerType = spin::Mortonizer<CoordType, MortonIndex, DIM>;
+
+  using CellIndex = axom::IndexType;
+  using CellIndexView = axom::ArrayView<const CellIndex>;
+
+  /// Values of the leaf data for white and black leaves.
+  /// Gray leaves hold the (nonnegative) index of their list of cells.
+  enum
+  {
+    WHITE_LEAF = -1,
+    BLACK_LEAF = -2
+  };
+
+public:
+  /// \brief Constructs an empty instance
+  FrozenInOutOctree() = default;
+
+  /**
+   * \brief Constructs the linearized representation of the leaves of \a octree
+   *
+   * \param [in] octree An InOutOctree whose leaves have been colored
+   * \param [in] allocatorID The allocator for the arrays of this instance
+   *
+   * \note The instance is empty if the finest leaf level of the octree
+   * exceeds maxRepresentableLevel()
+   */
+  explicit FrozenInOutOctree(const InOutOctree<DIM>& octree,
+                             int allocatorID = axom::getDefaultAllocatorID());
+
+  /**
+   * \brief Copies \a other into arrays allocated with the allocator
+   * \a allocatorID
+   */
+  FrozenInOutOctree(const FrozenInOutOctree& other, int allocatorID)
+    : m_maxLevel(other.m_maxLevel)
+    , m_mortonIndices(other.m_mortonIndices, allocatorID)
+    , m_leafLevels(other.m_leafLevels, allocatorID)
+    , m_leafData(other.m_leafData, allocatorID)
+    , m_grayCellOffsets(other.m_grayCellOffsets, allocatorID)
+    , m_grayCells(other.m_grayCells, allocatorID)
+  { }
+
+  /// \brief Returns the finest leaf level that can be represented
+  static int maxRepresentableLevel()
+  {
+    return MortonizerType::maxBitsPerCoord();
+  }
+
+  /// \brief Predicate to check if the instance holds any leaves
+  bool empty() const { return m_mortonIndices.empty(); }
+
+  /// \brief Returns the finest level of the leaves
+  int maxLevel() const { return m_maxLevel; }
+
+  /// \brief Returns the number of leaves
+  axom::IndexType numLeaves() const { return m_mortonIndices.size(); }
+
+  /// \brief Returns the number of gray leaves
+  axom::IndexType numGrayLeaves() const
+  {
+    return m_grayCellOffsets.empty() ? 0 : m_grayCellOffsets.size() - 1;
+  }
+
+  /// \brief Returns the number of bytes used by the arrays of this instance
+  std::size_t memoryFootprint() const
+  {
+    return m_mortonIndices.size() * sizeof(MortonIndex) +
+      m_leafLevels.size() * sizeof(std::int8_t) +
+      m_leafData.size() * sizeof(int) +
+      m_grayCellOffsets.size() * sizeof(axom::IndexType) +
+      m_grayCells.size() * sizeof(CellIndex);
+  }
+
+  /**
+   * \brief Finds the leaf covering a grid cell of the finest leaf level
+   *
+   * \param [in] cell The grid point of a cell at level maxLevel()
+   * \return The index of the leaf covering \a cell
+   * \pre The instance is not empty and its arrays are accessible on the host
+   */
+  axom::IndexType findLeaf(const GridPt& cell) const
+  {
+    SLIC_ASSERT(!empty());
+
+    const MortonIndex key = MortonizerType::mortonize(cell);
+
+    // Binary search for the last leaf whose Morton index is at most key
+    axom::IndexType lo = 0;
+    axom::IndexType hi = numLeaves();
+    while(hi - lo > 1)
+    {
+      const axom::IndexType mid = lo + (hi - lo) / 2;
+      if(m_mortonIndices[mid] <= key)
+      {
+        lo = mid;
+      }
+      else
+      {
+        hi = mid;
+      }
+    }
+    return lo;
+  }
+
+  /// \brief Returns the block index of the leaf with index \a leaf
+  BlockIndex leafBlock(axom::IndexType leaf) const
+  {
+    const int lev = m_leafLevels[leaf];
+    GridPt pt = MortonizerType::demortonize(m_mortonIndices[leaf]);
+    for(int d = 0; d < DIM; ++d)
+    {
+      pt[d] >>= (m_maxLevel - lev);
+    }
+    return BlockIndex(pt, lev);
+  }
+
+  /// \brief Returns the color of the leaf with index \a leaf
+  InOutBlockData::LeafColor leafColor(axom::IndexType leaf) const
+  {
+    const int data = m_leafData[leaf];
+    if(data >= 0)
+    {
+      return InOutBlockData::Gray;
+    }
+    return data == BLACK_LEAF ? InOutBlockData::Black : InOutBlockData::White;
+  }
+
+  /**
+   * \brief Returns the indices of the mesh cells of the leaf with index
+   * \a leaf
+   *
+   * \pre The leaf is gray
+   */
+  CellIndexView leafCells(axom::IndexType leaf) const
+  {
+    SLIC_ASSERT(leafColor(leaf) == InOutBlockData::Gray);
+
+    const int gray = m_leafData[leaf];
+    const axom::IndexType offset = m_grayCellOffsets[gray];
+    return CellIndexView(m_grayCells.data() + offset,
+                         m_grayCellOffsets[gray + 1] - offset);
+  }
+
+  /// \name Accessors for the arrays of the linearized octree
+  /// @{
+
+  /// \brief The Morton index of the first grid cell (at level maxLevel())
+  /// of each leaf, sorted in increasing order
+  axom::ArrayView<const MortonIndex> mortonIndices() const
+  {
+    return m_mortonIndices.view();
+  }
+
+  /// \brief The level of each leaf
+  axom::ArrayView<const std::int8_t> leafLevels() const
+  {
+    return m_leafLevels.view();
+  }
+
+  /// \brief The data of each leaf: WHITE_LEAF, BLACK_LEAF or, for gray leaves,
+  /// the index of its list of cells
+  axom::ArrayView<const int> leafData() const { return m_leafData.view(); }
+
+  /// \brief The offsets of the lists of cells of the gray leaves
+  axom::ArrayView<const axom::IndexType> grayCellOffsets() const
+  {
+    return m_grayCellOffsets.view();
+  }
+
+  /// \brief The concatenated lists of cells of the gray leaves
+  CellIndexView grayCells() const { return m_grayCells.view(); }
+
+  /// @}
+
+private:
+  int m_maxLevel {-1};
+  axom::Array<MortonIndex> m_mortonIndices;
+  axom::Array<std::int8_t> m_leafLevels;
+  axom::Array<int> m_leafData;
+  axom::Array<axom::IndexType> m_grayCellOffsets;
+  axom::Array<CellIndex> m_grayCells;
+};
+
+template <int DIM>
+FrozenInOutOctree<DIM>::FrozenInOutOctree(const InOutOctree<DIM>& octree,
+                                          int allocatorID)
+{
+  SLIC_ASSERT(octree.m_generationState >=
+              InOutOctree<DIM>::INOUTOCTREE_LEAVES_COLORED);
+
+  // Collect the leaves of the octree and find the finest leaf level
+  std::vector<BlockIndex> leaves;
+  for(int lev = 0; lev < octree.maxLeafLevel(); ++lev)
+  {
+    const auto& levelLeafMap = octree.getOctreeLevel(lev);
+    auto itEnd = levelLeafMap.end();
+    for(auto it = levelLeafMap.begin(); it != itEnd; ++it)
+    {
+      if(it->isLeaf())
+      {
+        leaves.push_back(BlockIndex(it.pt(), lev));
+        m_maxLevel = lev;
+      }
+    }
+  }
+
+  if(m_maxLevel > maxRepresentableLevel())
+  {
+    SLIC_WARNING("Cannot freeze InOutOctree: its finest leaf level "
+                 << m_maxLevel << " exceeds the maximum level "
+                 << maxRepresentableLevel()
+                 << " representable with 64-bit Morton indices");
+    m_maxLevel = -1;
+    return;
+  }
+
+  // Sort the leaves by the Morton index of their first cell at the finest level
+  const axom::IndexType numLeaves = static_cast<axom::IndexType>(leaves.size());
+  std::vector<std::pair<MortonIndex, axom::IndexType>> keys(numLeaves);
+  for(axom::IndexType i = 0; i < numLeaves; ++i)
+  {
+    const BlockIndex& blk = leaves[i];
+    GridPt anchor = blk.pt();
+    for(int d = 0; d < DIM; ++d)
+    {
+      anchor[d] <<= (m_maxLevel - blk.level());
+    }
+    keys[i] = std::make_pair(MortonizerType::mortonize(anchor), i);
+  }
+  std::sort(keys.begin(), keys.end());
+
+  const int hostAllocatorID =
+    axom::execution_space<axom::SEQ_EXEC>::allocatorID();
+  axom::Array<MortonIndex> mortonIndices(numLeaves, numLeaves, hostAllocatorID);
+  axom::Array<std::int8_t> leafLevels(numLeaves, numLeaves, hostAllocatorID);
+  axom::Array<int> leafData(numLeaves, numLeaves, hostAllocatorID);
+  axom::Array<axom::IndexType> grayCellOffsets(0,
+                                               numLeaves + 1,
+                                               hostAllocatorID);
+  axom::Array<CellIndex> grayCells(0, 0, hostAllocatorID);
+  grayCellOffsets.push_back(0);
+
+  for(axom::IndexType i = 0; i < numLeaves; ++i)
+  {
+    const BlockIndex& blk = leaves[keys[i].second];
+    const InOutBlockData& blkData = octree[blk];
+
+    mortonIndices[i] = keys[i].first;
+    leafLevels[i] = static_cast<std::int8_t>(blk.level());
+
+    switch(blkData.color())
+    {
+    case InOutBlockData::Black:
+      leafData[i] = BLACK_LEAF;
+      break;
+    case InOutBlockData::Gray:
+    {
+      leafData[i] = static_cast<int>(grayCellOffsets.size() - 1);
+      const auto cells = octree.leafCells(blk, blkData);
+      for(int j = 0; j < cells.size(); ++j)
+      {
+        grayCells.push_back(cells[j]);
+      }
+      grayCellOffsets.push_back(grayCells.size());
+    }
+    break;
+    case InOutBlockData::White:
+    case InOutBlockData::Undetermined:
+      SLIC_ASSERT_MSG(blkData.color() == InOutBlockData::White,
+                      "All leaf blocks must have a color");
+      leafData[i] = WHITE_LEAF;
+      break;
+    }
+  }
+
+  m_mortonIndices = axom::Array<MortonIndex>(mortonIndices, allocatorID);
+  m_leafLevels = axom::Array<std::int8_t>(leafLevels, allocatorID);
+  m_leafData = axom::Array<int>(leafData, allocatorID);
+  m_grayCellOffsets =
+    axom::Array<axom::IndexType>(grayCellOffsets, allocatorID);
+  m_grayCells = axom::Array<CellIndex>(grayCells, allocatorID);
+}
+
+}  // namespace detail
+}  // namespace quest
+}  // namespace axom
+
+#endif  // AXOM_QUEST_FROZEN_INOUT_OCTREE__HPP_
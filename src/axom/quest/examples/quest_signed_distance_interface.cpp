@@ -81,6 +81,7 @@ struct Arguments
   bool is_water_tight {true};
   bool dump_vtk {true};
   bool use_shared {false};
+  bool use_wide_bvh {false};
   bool use_batched_query {false};
   bool ignore_signs {false};
   quest::SignedDistExec exec_space {quest::SignedDistExec::CPU};
@@ -123,6 +124,12 @@ struct Arguments
                 "stores the surface using MPI-3 shared memory")
       ->capture_default_str();
 
+    app
+      .add_flag("--wide-bvh",
+                this->use_wide_bvh,
+                "finds the closest cells with a 4-wide BVH (CPU only)")
+      ->capture_default_str();
+
     app
       .add_flag("--batched",
                 this->use_batched_query,
@@ -228,6 +235,7 @@ int main(int argc, char** argv)
 
   timer.start();
   quest::signed_distance_use_shared_memory(args.use_shared);
+  quest::signed_distance_use_wide_bvh(args.use_wide_bvh);
   quest::signed_distance_set_closed_surface(args.is_water_tight);
   quest::signed_distance_set_compute_signs(!args.ignore_signs);
   quest::signed_distance_set_execution_space(args.exec_space);
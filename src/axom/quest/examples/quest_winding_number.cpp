@@ -176,6 +176,7 @@ int main(int argc, char** argv)
   std::vector<double> boxMaxs;
   std::vector<int> boxResolution;
   int queryOrder {1};
+  double beta {2.};
 
   app.add_option("-i,--input", inputFile)
     ->description("MFEM mesh containing contours (1D segments)")
@@ -209,6 +210,12 @@ int main(int argc, char** argv)
   query_mesh_subcommand->add_option("--order", queryOrder)
     ->description("polynomial order of the query mesh")
     ->check(axom::CLI::PositiveNumber);
+  query_mesh_subcommand->add_option("--beta", beta)
+    ->description(
+      "Accuracy of the hierarchical winding number queries. Clusters of "
+      "curves farther than beta times their radius are approximated")
+    ->capture_default_str()
+    ->check(axom::CLI::Range(1.0, axom::numeric_limits<double>::max()));
 
   CLI11_PARSE(app, argc, argv);
 
@@ -274,22 +281,24 @@ int main(int argc, char** argv)
   auto nodes_fes = query_mesh->GetNodalFESpace();
 
   // Query the winding numbers at each degree of freedom (DoF) of the query mesh.
-  // The loop below independently checks (and adaptively refines) every curve for each query points.
-  // A more efficient algorithm can de defined that caches the refined curves to avoid
-  // extra refinements. We will add this in a follow-up PR.
-  for(int nidx = 0; nidx < nodes_fes->GetNDofs(); ++nidx)
+  // The curves are organized in a BVH, whose far away clusters of curves are
+  // approximated, so that each query only evaluates the nearby curves exactly.
+  axom::quest::FastWindingNumber<2> fwn(curves.view(), beta);
+
+  const int ndofs = nodes_fes->GetNDofs();
+  axom::Array<Point2D> query_points(ndofs, ndofs);
+  for(int nidx = 0; nidx < ndofs; ++nidx)
   {
-    Point2D q;
-    query_mesh->GetNode(nidx, q.data());
+    query_mesh->GetNode(nidx, query_points[nidx].data());
+  }
 
-    double wn {};
-    for(const auto& c : curves)
-    {
-      wn += axom::primal::winding_number(q, c);
-    }
+  axom::Array<double> wn(ndofs, ndofs);
+  fwn.computeWindingNumbers(ndofs, query_points.view(), wn.data());
 
-    winding[nidx] = wn;
-    inout[nidx] = std::round(wn);
+  for(int nidx = 0; nidx < ndofs; ++nidx)
+  {
+    winding[nidx] = wn[nidx];
+    inout[nidx] = std::round(wn[nidx]);
   }
 
   // Save the query mesh and fields to disk using a format that can be viewed in VisIt
@@ -193,7 +193,12 @@ struct InOutHelper
     m_inoutTree->setVertexWeldThreshold(m_params.m_vertexWeldThreshold);
 
     // initialize the spatial index
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+    m_inoutTree->template generateIndex<axom::OMP_EXEC>();
+#else
     m_inoutTree->generateIndex();
+#endif
+    m_inoutTree->freeze();
 
     // Update the mesh parameter since the InOutOctree modifies the mesh
     mesh = m_surfaceMesh;
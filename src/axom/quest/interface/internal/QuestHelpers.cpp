@@ -149,6 +149,36 @@ void create_communicators(MPI_Comm global_comm,
 #endif
 
 #if defined(AXOM_USE_MPI) && defined(AXOM_USE_MPI3)
+/*
+ * Allocates a buffer of the given size that is shared among all the ranks
+ * within the same compute node.
+ */
+MPI_Aint allocate_shared_window(MPI_Aint bytesize,
+                                MPI_Comm intra_node_comm,
+                                unsigned char*& buffer,
+                                MPI_Win& shared_window)
+{
+  constexpr int ROOT_RANK = 0;
+  SLIC_ASSERT(intra_node_comm != MPI_COMM_NULL);
+  SLIC_ASSERT(shared_window == MPI_WIN_NULL);
+
+  int local_rank_id = -1;
+  MPI_Comm_rank(intra_node_comm, &local_rank_id);
+
+  int disp = sizeof(unsigned char);
+  MPI_Aint window_size = (local_rank_id != ROOT_RANK) ? 0 : bytesize;
+
+  MPI_Win_allocate_shared(window_size,
+                          disp,
+                          MPI_INFO_NULL,
+                          intra_node_comm,
+                          &buffer,
+                          &shared_window);
+  MPI_Win_shared_query(shared_window, ROOT_RANK, &bytesize, &disp, &buffer);
+
+  return (bytesize);
+}
+
 /*
  * Allocates a shared memory buffer for the mesh that is shared among
  * all the ranks within the same compute node.
@@ -163,23 +193,17 @@ MPI_Aint allocate_shared_buffer(int local_rank_id,
                                 unsigned char*& mesh_buffer,
                                 MPI_Win& shared_window)
 {
-  constexpr int ROOT_RANK = 0;
+  AXOM_UNUSED_VAR(local_rank_id);
 
   const int nnodes = mesh_metadata[0];
   const int nfaces = mesh_metadata[1];
 
-  int disp = sizeof(unsigned char);
   MPI_Aint bytesize =
     nnodes * 3 * sizeof(double) + nfaces * 3 * sizeof(axom::IndexType);
-  MPI_Aint window_size = (local_rank_id != ROOT_RANK) ? 0 : bytesize;
-
-  MPI_Win_allocate_shared(window_size,
-                          disp,
-                          MPI_INFO_NULL,
-                          intra_node_comm,
-                          &mesh_buffer,
-                          &shared_window);
-  MPI_Win_shared_query(shared_window, ROOT_RANK, &bytesize, &disp, &mesh_buffer);
+  bytesize = allocate_shared_window(bytesize,
+                                    intra_node_comm,
+                                    mesh_buffer,
+                                    shared_window);
 
   // calculate offset to the coordinates & cell connectivity in the buffer
   int baseOffset = nnodes * sizeof(double);
@@ -250,6 +274,7 @@ int read_stl_mesh_shared(const std::string& file,
 
   quest::STLReader reader;
   reader.setFileName(file);
+  reader.setWeldVertices(true);
   int rc = read_and_exchange_mesh_metadata(global_rank_id,
                                            global_comm,
                                            reader,
@@ -334,8 +359,9 @@ int read_stl_mesh(const std::string& file, mint::Mesh*& m, MPI_Comm comm)
   quest::STLReader reader;
 #endif
 
-  // STEP 3: read the mesh from the STL file
+  // STEP 3: read the mesh from the STL file, welding its coincident vertices
   reader.setFileName(file);
+  reader.setWeldVertices(true);
   int rc = reader.read();
   if(rc == READ_SUCCESS)
   {
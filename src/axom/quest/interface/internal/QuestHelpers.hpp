@@ -143,6 +143,29 @@ void create_communicators(MPI_Comm global_comm,
 #endif
 
 #if defined(AXOM_USE_MPI) && defined(AXOM_USE_MPI3)
+/*!
+ * \brief Allocates a buffer of the given size that is shared among all the
+ *  ranks within the same compute node.
+ *
+ * \param [in] bytesize the size of the buffer, specified on the root rank
+ *  of the intra-node communicator and ignored on the other ranks.
+ * \param [in] intra_node_comm intra-node communicator within a node.
+ * \param [out] buffer pointer to the shared buffer, on all the ranks.
+ * \param [out] shared_window MPI window to which the shared buffer is attached.
+ *
+ * \return bytesize the number of bytes in the shared buffer.
+ *
+ * \note This is a collective call over the intra-node communicator. The
+ *  buffer is deallocated when the window is freed.
+ *
+ * \pre intra_node_comm != MPI_COMM_NULL
+ * \pre shared_window == MPI_WIN_NULL
+ */
+MPI_Aint allocate_shared_window(MPI_Aint bytesize,
+                                MPI_Comm intra_node_comm,
+                                unsigned char*& buffer,
+                                MPI_Win& shared_window);
+
 /*!
  * \brief Allocates a shared memory buffer for the mesh that is shared among
  *  all the ranks within the same compute node.
@@ -239,6 +262,8 @@ int read_stl_mesh_shared(const std::string& file,
  *
  * \note This method currently expects the surface mesh to be given in STL format.
  *
+ * \note The coincident vertices of the triangles are welded while reading.
+ *
  * \note The caller is responsible for properly de-allocating the mesh object
  *  that is returned by this function.
  *
@@ -13,6 +13,9 @@
 
 #include "axom/slic/interface/slic.hpp"
 
+// C/C++ includes
+#include <cstdint>
+
 #ifdef AXOM_USE_MPI
   #include <mpi.h>
 #endif
@@ -32,6 +35,8 @@ constexpr int INIT_SUCCESS = 0;
 using ExecSeq = axom::SEQ_EXEC;
 using SignedDistance3D = SignedDistance<3>;
 using SignedDistance2D = SignedDistance<2>;
+using SignedDistance3DWide =
+  SignedDistance<3, ExecSeq, spin::BVHType::WideBVH4>;
 
 #if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
 using ExecOMP = axom::OMP_EXEC;
@@ -61,8 +66,10 @@ static struct parameters_t
   bool verbose;           /*!< logger verbosity */
   bool is_closed_surface; /*!< indicates if the input is a closed surface */
   bool use_shared_memory; /*!< use MPI-3 shared memory for the surface mesh */
+  bool use_wide_bvh;      /*!< use a 4-wide BVH for the CPU queries */
   bool compute_sign;      /*!< indicates if sign should be computed */
   int allocator_id; /*!< the allocator ID to create BVH with (-1 for default) */
+  double narrow_band;     /*!< width of the narrow band (-1 for none) */
   SignedDistExec exec_space; /*!< indicates the execution space to run in */
 
   /*!
@@ -73,8 +80,10 @@ static struct parameters_t
     , verbose(false)
     , is_closed_surface(true)
     , use_shared_memory(false)
+    , use_wide_bvh(false)
     , compute_sign(true)
     , allocator_id(-1)
+    , narrow_band(-1.)
     , exec_space(SignedDistExec::CPU)
   { }
 
@@ -82,6 +91,7 @@ static struct parameters_t
 
 // TODO: note the SignedDistance query is currently only supported in 3-D
 static SignedDistance3D* s_query = nullptr;
+static SignedDistance3DWide* s_query_wide = nullptr;
 #if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
 static SignedDistance3DOMP* s_query_omp = nullptr;
 #endif
@@ -97,8 +107,115 @@ static bool s_logger_is_initialized = false;
 static unsigned char* s_shared_mesh_buffer = nullptr;
 MPI_Comm s_intra_node_comm = MPI_COMM_NULL;
 MPI_Win s_window = MPI_WIN_NULL;
+MPI_Win s_bvh_window = MPI_WIN_NULL;
 #endif
 
+/*!
+ * \brief Creates the query over the surface mesh.
+ *
+ * \note When the surface mesh is stored in MPI-3 shared memory, only the
+ *  first rank of each node builds the BVH of the query, which it serializes
+ *  into another shared memory buffer. The queries of all the ranks of the
+ *  node then access this single copy of the BVH in place.
+ */
+template <typename SignedDistanceType>
+SignedDistanceType* create_query(int allocatorID)
+{
+#if defined(AXOM_USE_MPI) && defined(AXOM_USE_MPI3)
+  if(s_intra_node_comm != MPI_COMM_NULL)
+  {
+    int local_rank_id = -1;
+    MPI_Comm_rank(s_intra_node_comm, &local_rank_id);
+
+    // STEP 0: build the BVH on the first rank of the node
+    SignedDistanceType* builder = nullptr;
+    std::uint64_t bvh_size = 0;
+    if(local_rank_id == 0)
+    {
+      builder = new SignedDistanceType(s_surface_mesh,
+                                       Parameters.is_closed_surface,
+                                       Parameters.compute_sign,
+                                       allocatorID);
+      bvh_size = builder->getBVHTree().getSerializedSize();
+    }
+
+    // STEP 1: serialize it into a buffer shared by all the ranks of the node
+    unsigned char* bvh_buffer = nullptr;
+    internal::allocate_shared_window(static_cast<MPI_Aint>(bvh_size),
+                                     s_intra_node_comm,
+                                     bvh_buffer,
+                                     s_bvh_window);
+    if(local_rank_id == 0)
+    {
+      builder->getBVHTree().serialize(bvh_buffer);
+      delete builder;
+    }
+
+    MPI_Bcast(&bvh_size, 1, MPI_UINT64_T, 0, s_intra_node_comm);
+    MPI_Barrier(s_intra_node_comm);
+
+    // STEP 2: create the queries over the shared BVH
+    return new SignedDistanceType(s_surface_mesh,
+                                  bvh_buffer,
+                                  bvh_size,
+                                  Parameters.is_closed_surface,
+                                  Parameters.compute_sign,
+                                  allocatorID);
+  }
+#endif
+
+  return new SignedDistanceType(s_surface_mesh,
+                                Parameters.is_closed_surface,
+                                Parameters.compute_sign,
+                                allocatorID);
+}
+
+/*!
+ * \brief Applies the options that are not constructor arguments to the query.
+ */
+template <typename SignedDistanceType>
+void set_query_options(SignedDistanceType* query)
+{
+  SLIC_ASSERT(query != nullptr);
+  if(Parameters.narrow_band > 0.)
+  {
+    query->setNarrowBand(Parameters.narrow_band);
+  }
+}
+
+/*!
+ * \brief Evaluates the query at a set of points, writing the closest points
+ *  and normals in place into arrays of interleaved coordinates.
+ */
+template <typename SignedDistanceType>
+void compute_distances(const SignedDistanceType* query,
+                       const double* x,
+                       const double* y,
+                       const double* z,
+                       int npoints,
+                       int stride,
+                       double* phi,
+                       double* closest_pts,
+                       double* normals,
+                       axom::IndexType* cells)
+{
+  using PointType = typename SignedDistanceType::PointType;
+  using VectorType = typename SignedDistanceType::VectorType;
+  using ZipPoint = typename SignedDistanceType::ZipPoint;
+
+  AXOM_STATIC_ASSERT_MSG(sizeof(PointType) == 3 * sizeof(double) &&
+                           sizeof(VectorType) == 3 * sizeof(double),
+                         "Points and vectors must be laid out as 3 doubles");
+
+  ZipPoint it({x, y, z}, stride);
+  query->computeDistances(npoints,
+                          it,
+                          phi,
+                          reinterpret_cast<PointType*>(closest_pts),
+                          reinterpret_cast<VectorType*>(normals),
+                          cells);
+}
+
 }  // end anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -114,7 +231,7 @@ int signed_distance_init(const std::string& file, MPI_Comm comm)
                         Parameters.verbose,
                         comm);
 
-  SLIC_ASSERT(s_query == nullptr);
+  SLIC_ASSERT(s_query == nullptr && s_query_wide == nullptr);
 
   if(Parameters.dimension != 3)
   {
@@ -191,6 +308,11 @@ int signed_distance_init(const mint::Mesh* m, MPI_Comm comm)
     s_must_delete_mesh = false;
   }
 
+  SLIC_WARNING_IF(
+    Parameters.use_wide_bvh && Parameters.exec_space != SignedDistExec::CPU,
+    "The wide BVH is only supported in the CPU execution space. "
+    "Option is ignored!");
+
   int allocatorID = Parameters.allocator_id;
   switch(Parameters.exec_space)
   {
@@ -199,10 +321,20 @@ int signed_distance_init(const mint::Mesh* m, MPI_Comm comm)
     {
       allocatorID = axom::execution_space<ExecSeq>::allocatorID();
     }
-    s_query = new SignedDistance3D(s_surface_mesh,
-                                   Parameters.is_closed_surface,
-                                   Parameters.compute_sign,
-                                   allocatorID);
+    if(Parameters.use_wide_bvh)
+    {
+      // the wide BVH can not be serialized, so each rank builds its own
+      s_query_wide = new SignedDistance3DWide(s_surface_mesh,
+                                              Parameters.is_closed_surface,
+                                              Parameters.compute_sign,
+                                              allocatorID);
+      set_query_options(s_query_wide);
+    }
+    else
+    {
+      s_query = create_query<SignedDistance3D>(allocatorID);
+      set_query_options(s_query);
+    }
     break;
 #if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
   case SignedDistExec::OpenMP:
@@ -210,10 +342,8 @@ int signed_distance_init(const mint::Mesh* m, MPI_Comm comm)
     {
       allocatorID = axom::execution_space<ExecOMP>::allocatorID();
     }
-    s_query_omp = new SignedDistance3DOMP(s_surface_mesh,
-                                          Parameters.is_closed_surface,
-                                          Parameters.compute_sign,
-                                          allocatorID);
+    s_query_omp = create_query<SignedDistance3DOMP>(allocatorID);
+    set_query_options(s_query_omp);
     break;
 #endif
 #if defined(AXOM_USE_GPU) && defined(AXOM_USE_RAJA)
@@ -222,10 +352,8 @@ int signed_distance_init(const mint::Mesh* m, MPI_Comm comm)
     {
       allocatorID = axom::execution_space<ExecGPU>::allocatorID();
     }
-    s_query_gpu = new SignedDistance3DGPU(s_surface_mesh,
-                                          Parameters.is_closed_surface,
-                                          Parameters.compute_sign,
-                                          allocatorID);
+    s_query_gpu = create_query<SignedDistance3DGPU>(allocatorID);
+    set_query_options(s_query_gpu);
     break;
 #endif
   default:
@@ -242,7 +370,7 @@ bool signed_distance_initialized()
   switch(Parameters.exec_space)
   {
   case SignedDistExec::CPU:
-    return (s_query != nullptr);
+    return (s_query != nullptr) || (s_query_wide != nullptr);
 #if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
   case SignedDistExec::OpenMP:
     return (s_query_omp != nullptr);
@@ -300,6 +428,16 @@ void signed_distance_set_compute_signs(bool computeSign)
   Parameters.compute_sign = computeSign;
 }
 
+//------------------------------------------------------------------------------
+void signed_distance_set_narrow_band(double width)
+{
+  SLIC_ERROR_IF(
+    signed_distance_initialized(),
+    "signed distance query already initialized; setting option has no effect!");
+
+  Parameters.narrow_band = (width > 0.) ? width : -1.;
+}
+
 //------------------------------------------------------------------------------
 void signed_distance_set_allocator(int allocatorID)
 {
@@ -335,6 +473,16 @@ void signed_distance_use_shared_memory(bool status)
 #endif
 }
 
+//------------------------------------------------------------------------------
+void signed_distance_use_wide_bvh(bool status)
+{
+  SLIC_ERROR_IF(
+    signed_distance_initialized(),
+    "signed distance query already initialized; setting option has no effect!");
+
+  Parameters.use_wide_bvh = status;
+}
+
 //------------------------------------------------------------------------------
 void signed_distance_set_execution_space(SignedDistExec exec_space)
 {
@@ -342,14 +490,14 @@ void signed_distance_set_execution_space(SignedDistExec exec_space)
     signed_distance_initialized(),
     "signed distance query already initialized; setting option has no effect!");
 
-#if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
+#if !defined(AXOM_USE_OPENMP) || !defined(AXOM_USE_RAJA)
   if(exec_space == SignedDistExec::OpenMP)
   {
     SLIC_ERROR("Signed distance query not compiled with OpenMP support");
   }
 #endif
 
-#if defined(AXOM_USE_GPU) && defined(AXOM_USE_RAJA)
+#if !defined(AXOM_USE_GPU) || !defined(AXOM_USE_RAJA)
   if(exec_space == SignedDistExec::GPU)
   {
     SLIC_ERROR("Signed distance query not compiled with GPU support");
@@ -370,7 +518,8 @@ double signed_distance_evaluate(double x, double y, double z)
   switch(Parameters.exec_space)
   {
   case SignedDistExec::CPU:
-    phi = s_query->computeDistance(x, y, z);
+    phi = (s_query_wide != nullptr) ? s_query_wide->computeDistance(x, y, z)
+                                    : s_query->computeDistance(x, y, z);
     break;
 #if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
   case SignedDistExec::OpenMP:
@@ -419,7 +568,9 @@ double signed_distance_evaluate(double x,
   switch(Parameters.exec_space)
   {
   case SignedDistExec::CPU:
-    phi = s_query->computeDistance(query, closest_pt, normal);
+    phi = (s_query_wide != nullptr)
+      ? s_query_wide->computeDistance(query, closest_pt, normal)
+      : s_query->computeDistance(query, closest_pt, normal);
     break;
 #if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
   case SignedDistExec::OpenMP:
@@ -470,7 +621,14 @@ void signed_distance_evaluate(const double* x,
   switch(Parameters.exec_space)
   {
   case SignedDistExec::CPU:
-    s_query->computeDistances(npoints, it, phi);
+    if(s_query_wide != nullptr)
+    {
+      s_query_wide->computeDistances(npoints, it, phi);
+    }
+    else
+    {
+      s_query->computeDistances(npoints, it, phi);
+    }
     break;
 #if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
   case SignedDistExec::OpenMP:
@@ -488,6 +646,90 @@ void signed_distance_evaluate(const double* x,
   }
 }
 
+//------------------------------------------------------------------------------
+void signed_distance_evaluate(const double* x,
+                              const double* y,
+                              const double* z,
+                              int npoints,
+                              int stride,
+                              double* phi,
+                              double* closest_pts,
+                              double* normals,
+                              axom::IndexType* cells)
+{
+  SLIC_ERROR_IF(
+    !signed_distance_initialized(),
+    "signed distance query must be initialized prior to calling evaluate()!");
+  SLIC_ERROR_IF(x == nullptr, "x-coords array is null");
+  SLIC_ERROR_IF(y == nullptr, "y-coords array is null");
+  SLIC_ERROR_IF(z == nullptr, "z-coords array is null");
+  SLIC_ERROR_IF(stride < 1, "stride of the coordinates must be positive");
+  SLIC_ERROR_IF(phi == nullptr, "output phi array is null");
+
+  switch(Parameters.exec_space)
+  {
+  case SignedDistExec::CPU:
+    if(s_query_wide != nullptr)
+    {
+      compute_distances(s_query_wide,
+                        x,
+                        y,
+                        z,
+                        npoints,
+                        stride,
+                        phi,
+                        closest_pts,
+                        normals,
+                        cells);
+    }
+    else
+    {
+      compute_distances(s_query,
+                        x,
+                        y,
+                        z,
+                        npoints,
+                        stride,
+                        phi,
+                        closest_pts,
+                        normals,
+                        cells);
+    }
+    break;
+#if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
+  case SignedDistExec::OpenMP:
+    compute_distances(s_query_omp,
+                      x,
+                      y,
+                      z,
+                      npoints,
+                      stride,
+                      phi,
+                      closest_pts,
+                      normals,
+                      cells);
+    break;
+#endif
+#if defined(AXOM_USE_GPU) && defined(AXOM_USE_RAJA)
+  case SignedDistExec::GPU:
+    compute_distances(s_query_gpu,
+                      x,
+                      y,
+                      z,
+                      npoints,
+                      stride,
+                      phi,
+                      closest_pts,
+                      normals,
+                      cells);
+    break;
+#endif
+  default:
+    SLIC_ERROR("Unsupported execution space");
+    break;
+  }
+}
+
 //------------------------------------------------------------------------------
 void signed_distance_finalize()
 {
@@ -497,6 +739,12 @@ void signed_distance_finalize()
     s_query = nullptr;
   }
 
+  if(s_query_wide != nullptr)
+  {
+    delete s_query_wide;
+    s_query_wide = nullptr;
+  }
+
 #if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
   if(s_query_omp != nullptr)
   {
@@ -525,6 +773,7 @@ void signed_distance_finalize()
 
 #if defined(AXOM_USE_MPI) && defined(AXOM_USE_MPI3)
   internal::mpi_comm_free(&s_intra_node_comm);
+  internal::mpi_win_free(&s_bvh_window);
   internal::mpi_win_free(&s_window);
   s_shared_mesh_buffer = nullptr;
 #endif
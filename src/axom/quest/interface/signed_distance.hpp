@@ -7,7 +7,8 @@
 #define QUEST_SIGNED_DISTANCE_INTERFACE_HPP_
 
 // Axom includes
-#include "axom/config.hpp"  // for compile-time definitions
+#include "axom/config.hpp"      // for compile-time definitions
+#include "axom/core/Types.hpp"  // for axom::IndexType
 
 // Quest includes
 #include "axom/quest/interface/internal/mpicomm_wrapper.hpp"  // MPI_COMM_SELF
@@ -188,6 +189,23 @@ void signed_distance_set_closed_surface(bool status);
  */
 void signed_distance_set_compute_signs(bool computeSign);
 
+/*!
+ * \brief Restricts the signed distance queries to a narrow band around the
+ *  surface mesh.
+ *
+ * \param [in] width the width of the band around the surface mesh, or a
+ *  non-positive value to remove the narrow band
+ *
+ * \note Query points that are farther than \a width from the surface are
+ *  not resolved. Their signed distance is set to +/-width. Such points are
+ *  much cheaper to query than points in the narrow band, except for points
+ *  in the bounding box of a watertight surface mesh when signs are computed,
+ *  which are traversed again to find their sign.
+ * \note By default, the queries are not restricted to a narrow band.
+ * \note Options must be set before initializing the Signed Distance Query.
+ */
+void signed_distance_set_narrow_band(double width);
+
 /*!
  * \brief Sets the allocator to use for creating internal signed distance query
  *  data structures.
@@ -214,10 +232,31 @@ void signed_distance_set_verbose(bool status);
  *
  * \param [in] status flag indicating whether to enable/disable shared memory.
  *
+ * \note When enabled, the surface mesh read by signed_distance_init() and
+ *  the BVH built over it are stored once per compute node. The BVH is built
+ *  by the first rank of each node and queried in place by all the ranks of
+ *  the node.
+ *
  * \note This option utilities MPI-3 features
  */
 void signed_distance_use_shared_memory(bool status);
 
+/*!
+ * \brief Enable/Disable the use of a 4-wide BVH to find the closest cells
+ *  of the surface mesh. By default this option is disabled.
+ *
+ * \param [in] status flag indicating whether to enable/disable the wide BVH.
+ *
+ * \note The wide BVH visits the closest children of a node first, which
+ *  speeds up queries over large surface meshes, but it can be slower for
+ *  small surface meshes or narrow bands.
+ *
+ * \note This option is only supported in the CPU execution space. The wide
+ *  BVH is not shared by the ranks of a node, even if the surface mesh is
+ *  stored in shared memory.
+ */
+void signed_distance_use_wide_bvh(bool status);
+
 /*!
  * \brief Set the execution space in which to run signed distance queries. By
  *  default this option is set to SIGNED_DIST_EVAL_CPU.
@@ -293,6 +332,50 @@ void signed_distance_evaluate(const double* x,
                               int npoints,
                               double* phi);
 
+/*!
+ * \brief Evaluates the signed distance function at the given set of points
+ *  and, optionally, the closest points, surface normals and closest cells,
+ *  in a single pass over the points.
+ *
+ * \param [in] x pointer to the x-coordinate of the first query point
+ * \param [in] y pointer to the y-coordinate of the first query point
+ * \param [in] z pointer to the z-coordinate of the first query point
+ * \param [in] npoints the number of query point
+ * \param [in] stride the distance, in number of values, between the
+ *  coordinates of consecutive query points
+ * \param [out] phi output array storing the signed distance of each point
+ * \param [out] closest_pts output array storing the interleaved coordinates
+ *  of the closest point on the surface to each query point (optional)
+ * \param [out] normals output array storing the interleaved components of the
+ *  surface normal at each closest point (optional)
+ * \param [out] cells output array storing the index of the surface mesh cell
+ *  containing each closest point (optional)
+ *
+ * \note The coordinates are read in place, e.g., separate coordinate arrays
+ *  are given with a stride of 1, and an array of interleaved coordinates,
+ *  xyz, is given as x = xyz, y = xyz + 1, z = xyz + 2, with a stride of 3.
+ * \note The optional outputs are skipped when null. Otherwise, closest_pts
+ *  and normals hold 3 * npoints values and cells holds npoints values.
+ * \note All the arrays must be accessible in the execution space of the query.
+ *
+ * \pre x != nullptr
+ * \pre y != nullptr
+ * \pre z != nullptr
+ * \pre stride >= 1
+ * \pre phi != nullptr
+ *
+ * \see signed_distance_set_narrow_band()
+ */
+void signed_distance_evaluate(const double* x,
+                              const double* y,
+                              const double* z,
+                              int npoints,
+                              int stride,
+                              double* phi,
+                              double* closest_pts = nullptr,
+                              double* normals = nullptr,
+                              axom::IndexType* cells = nullptr);
+
 /*!
  * \brief Computes the bounds of the specified input mesh supplied to the
  *  Signed Distance Query.
@@ -5,6 +5,17 @@
 
 #include "axom/quest/readers/PSTLReader.hpp"
 
+#include "axom/core/utilities/Utilities.hpp"
+#include "axom/slic/interface/slic.hpp"
+#include "axom/spin/MortonIndex.hpp"
+
+// C/C++ includes
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
 namespace axom
 {
 namespace quest
@@ -13,12 +24,41 @@ namespace
 {
 constexpr int READER_SUCCESS = 0;
 constexpr int READER_FAILED = -1;
+
+constexpr int ASCII_FORMAT = 1;
+constexpr int BINARY_FORMAT = 2;
+
+// Bounds on the number of keys sampled to find the splitters between ranks
+constexpr std::int64_t SAMPLE_BUDGET = 1 << 20;
+constexpr std::int64_t MIN_SAMPLES_PER_RANK = 16;
+
+/// A triangle exchanged during the redistribution of the triangles
+struct TriangleRecord
+{
+  std::uint64_t key;
+  std::int64_t faceId;
+  double coords[9];
+};
+
+inline bool operator<(const TriangleRecord& a, const TriangleRecord& b)
+{
+  return (a.key < b.key) || (a.key == b.key && a.faceId < b.faceId);
+}
+
+/// Returns the index of the first triangle of the given rank
+inline axom::IndexType rangeBegin(axom::IndexType numTris, int rank, int nranks)
+{
+  return static_cast<axom::IndexType>(static_cast<std::int64_t>(numTris) *
+                                      rank / nranks);
+}
+
 }  // namespace
 
 //------------------------------------------------------------------------------
 PSTLReader::PSTLReader(MPI_Comm comm) : m_comm(comm)
 {
   MPI_Comm_rank(m_comm, &m_my_rank);
+  MPI_Comm_size(m_comm, &m_num_ranks);
 }
 
 //------------------------------------------------------------------------------
@@ -34,43 +74,438 @@ int PSTLReader::read()
 
   // Clear internal data-structures
   this->clear();
+  m_globalFaceIds.clear();
 
-  int rc = -1;  // return code
+  return (m_mode == ReadMode::PARTITIONED) ? readPartitioned()
+                                           : readBroadcast();
+}
 
-  switch(m_my_rank)
+//------------------------------------------------------------------------------
+int PSTLReader::readBroadcast()
+{
+  // Rank 0 broadcasts the number of nodes and faces and whether the vertices
+  // were welded, if the STL file is read successfully, or sends a
+  // READER_FAILED flag, indicating that the read was not successful.
+  constexpr int NUM_NODES = 0;
+  constexpr int NUM_FACES = 1;
+  constexpr int IS_WELDED = 2;
+  axom::IndexType metadata[3] = {READER_FAILED, 0, 0};
+
+  if(m_my_rank == 0)
   {
-  case 0:
+    if(STLReader::read() == READER_SUCCESS)
+    {
+      metadata[NUM_NODES] = m_num_nodes;
+      metadata[NUM_FACES] = m_num_faces;
+      metadata[IS_WELDED] = m_connectivity.empty() ? 0 : 1;
+    }
+  }
 
-    rc = STLReader::read();
-    if(rc == READER_SUCCESS)
+  MPI_Bcast(metadata, 3, axom::mpi_traits<axom::IndexType>::type, 0, m_comm);
+  if(metadata[NUM_NODES] == READER_FAILED)
+  {
+    return READER_FAILED;
+  }
+
+  if(m_my_rank != 0)
+  {
+    m_num_nodes = metadata[NUM_NODES];
+    m_num_faces = metadata[NUM_FACES];
+    m_nodes.resize(m_num_nodes * 3);
+    if(metadata[IS_WELDED] != 0)
     {
-      MPI_Bcast(&m_num_nodes, 1, axom::mpi_traits<axom::IndexType>::type, 0, m_comm);
-      MPI_Bcast(&m_nodes[0], m_num_nodes * 3, MPI_DOUBLE, 0, m_comm);
-    }  // END if
+      m_connectivity.resize(m_num_faces * 3);
+    }
+  }
+
+  MPI_Bcast(m_nodes.data(), m_num_nodes * 3, MPI_DOUBLE, 0, m_comm);
+  if(metadata[IS_WELDED] != 0)
+  {
+    MPI_Bcast(m_connectivity.data(),
+              m_num_faces * 3,
+              axom::mpi_traits<axom::IndexType>::type,
+              0,
+              m_comm);
+  }
+
+  return READER_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+int PSTLReader::readPartitioned()
+{
+  // STEP 1: rank 0 checks the format of the file and broadcasts the format
+  // and, for binary files, the number of triangles
+  constexpr int FORMAT = 0;
+  constexpr int NUM_TRIS = 1;
+  std::int64_t metadata[2] = {READER_FAILED, 0};
+
+  if(m_my_rank == 0)
+  {
+    std::ifstream ifs(m_fileName, std::ios::in | std::ios::binary);
+    if(m_fileName.empty() || !ifs.is_open())
+    {
+      SLIC_WARNING("Cannot open the provided STL file [" << m_fileName << "]");
+    }
     else
     {
-      MPI_Bcast(&rc, 1, MPI_INT, 0, m_comm);
-    }  // END else
-    break;
+      ifs.seekg(0, std::ios::end);
+      const std::size_t fileSize = static_cast<std::size_t>(ifs.tellg());
+      ifs.seekg(0, std::ios::beg);
+
+      char header[BINARY_HEADER_SIZE + sizeof(std::uint32_t)] = {};
+      ifs.read(header, std::min(sizeof(header), fileSize));
+
+      if(isAsciiFormat(header, fileSize))
+      {
+        metadata[FORMAT] = ASCII_FORMAT;
+      }
+      else
+      {
+        std::uint32_t numTris = 0;
+        std::memcpy(&numTris, header + BINARY_HEADER_SIZE, sizeof(numTris));
+        if(!axom::utilities::isLittleEndian())
+        {
+          numTris = axom::utilities::byteswap(numTris);
+        }
+
+        const std::uint64_t maxTris = static_cast<std::uint64_t>(
+          std::numeric_limits<axom::IndexType>::max() / 3);
+        if(numTris > maxTris)
+        {
+          SLIC_WARNING("STL file [" << m_fileName << "] has " << numTris
+                                    << " triangles, which exceeds the maximum "
+                                    << "of " << maxTris << " triangles");
+        }
+        else
+        {
+          metadata[FORMAT] = BINARY_FORMAT;
+          metadata[NUM_TRIS] = numTris;
+        }
+      }
+    }
+  }
+
+  MPI_Bcast(metadata, 2, MPI_INT64_T, 0, m_comm);
+  if(metadata[FORMAT] == READER_FAILED)
+  {
+    return READER_FAILED;
+  }
+
+  // STEP 2: read the triangles, such that each rank holds a contiguous range
+  std::vector<double> coords;
+  int rc = READER_FAILED;
+  axom::IndexType numTris = 0;
+  if(metadata[FORMAT] == BINARY_FORMAT)
+  {
+    numTris = static_cast<axom::IndexType>(metadata[NUM_TRIS]);
+    rc = readBinaryRange(numTris, coords);
+  }
+  else
+  {
+    rc = scatterAsciiTriangles(coords, numTris);
+  }
+
+  if(rc != READER_SUCCESS)
+  {
+    return READER_FAILED;
+  }
+
+  // STEP 3: redistribute the triangles by the Morton index of their centroid
+  redistributeTriangles(coords, rangeBegin(numTris, m_my_rank, m_num_ranks));
+
+  // STEP 4: weld the vertices of the local triangles
+  if(m_weldVertices)
+  {
+    weldVertices();
+  }
+
+  return READER_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+int PSTLReader::readBinaryRange(axom::IndexType numTris,
+                                std::vector<double>& coords)
+{
+  const axom::IndexType begin = rangeBegin(numTris, m_my_rank, m_num_ranks);
+  const axom::IndexType end = rangeBegin(numTris, m_my_rank + 1, m_num_ranks);
+  const axom::IndexType count = end - begin;
+
+  MPI_File fh;
+  int rc = MPI_File_open(m_comm,
+                         const_cast<char*>(m_fileName.c_str()),
+                         MPI_MODE_RDONLY,
+                         MPI_INFO_NULL,
+                         &fh);
+  if(rc != MPI_SUCCESS)
+  {
+    SLIC_WARNING("Cannot open the provided STL file [" << m_fileName << "]");
+    return READER_FAILED;
+  }
+
+  // Read the raw triangles of this rank, as records of BINARY_TRI_SIZE bytes
+  MPI_Datatype triType;
+  MPI_Type_contiguous(BINARY_TRI_SIZE, MPI_BYTE, &triType);
+  MPI_Type_commit(&triType);
+
+  std::vector<char> buffer(static_cast<std::size_t>(count) * BINARY_TRI_SIZE);
+  const MPI_Offset offset = BINARY_HEADER_SIZE + sizeof(std::uint32_t) +
+    static_cast<MPI_Offset>(begin) * BINARY_TRI_SIZE;
+  rc = MPI_File_read_at_all(fh,
+                            offset,
+                            buffer.data(),
+                            count,
+                            triType,
+                            MPI_STATUS_IGNORE);
+
+  MPI_Type_free(&triType);
+  MPI_File_close(&fh);
+
+  int failed = (rc != MPI_SUCCESS) ? 1 : 0;
+  MPI_Allreduce(MPI_IN_PLACE, &failed, 1, MPI_INT, MPI_MAX, m_comm);
+  if(failed != 0)
+  {
+    SLIC_WARNING("Failed to read the triangles of STL file [" << m_fileName
+                                                               << "]");
+    return READER_FAILED;
+  }
+
+  coords.resize(static_cast<std::size_t>(count) * 9);
+  decodeBinaryTriangles(buffer.data(), count, coords.data());
 
-  default:
+  return READER_SUCCESS;
+}
 
-    // Rank 0 broadcasts the number of nodes, a positive integer, if the
-    // STL file is read successfully, or send a READER_FAILED flag, indicating
-    // that the read was not successful.
-    MPI_Bcast(&m_num_nodes, 1, axom::mpi_traits<axom::IndexType>::type, 0, m_comm);
+//------------------------------------------------------------------------------
+int PSTLReader::scatterAsciiTriangles(std::vector<double>& coords,
+                                      axom::IndexType& numTris)
+{
+  // Rank 0 reads in the soup of triangles, vertices are welded after the
+  // triangles are redistributed
+  int rc = READER_SUCCESS;
+  if(m_my_rank == 0)
+  {
+    const bool weld = m_weldVertices;
+    m_weldVertices = false;
+    rc = STLReader::read();
+    m_weldVertices = weld;
+  }
 
-    if(m_num_nodes != READER_FAILED)
+  MPI_Bcast(&rc, 1, MPI_INT, 0, m_comm);
+  if(rc != READER_SUCCESS)
+  {
+    return READER_FAILED;
+  }
+
+  numTris = m_num_faces;
+  MPI_Bcast(&numTris, 1, axom::mpi_traits<axom::IndexType>::type, 0, m_comm);
+
+  std::vector<int> counts(m_num_ranks);
+  std::vector<int> displs(m_num_ranks);
+  for(int r = 0; r < m_num_ranks; ++r)
+  {
+    displs[r] = rangeBegin(numTris, r, m_num_ranks);
+    counts[r] = rangeBegin(numTris, r + 1, m_num_ranks) - displs[r];
+  }
+
+  MPI_Datatype triType;
+  MPI_Type_contiguous(9, MPI_DOUBLE, &triType);
+  MPI_Type_commit(&triType);
+
+  coords.resize(static_cast<std::size_t>(counts[m_my_rank]) * 9);
+  MPI_Scatterv(m_nodes.data(),
+               counts.data(),
+               displs.data(),
+               triType,
+               coords.data(),
+               counts[m_my_rank],
+               triType,
+               0,
+               m_comm);
+
+  MPI_Type_free(&triType);
+  this->clear();
+
+  return READER_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+void PSTLReader::redistributeTriangles(const std::vector<double>& coords,
+                                       axom::IndexType firstFaceId)
+{
+  using MortonizerType = spin::Mortonizer<std::uint32_t, std::uint64_t, 3>;
+  constexpr int BITS_PER_DIM = MortonizerType::MAX_UNIQUE_BITS;
+  constexpr double MAX_COORD = (1u << BITS_PER_DIM) - 1;
+
+  const std::int64_t numLocal = static_cast<std::int64_t>(coords.size() / 9);
+
+  // STEP 1: compute the bounding box of the centroids of all the triangles
+  double lo[3] = {std::numeric_limits<double>::max(),
+                  std::numeric_limits<double>::max(),
+                  std::numeric_limits<double>::max()};
+  double hi[3] = {std::numeric_limits<double>::lowest(),
+                  std::numeric_limits<double>::lowest(),
+                  std::numeric_limits<double>::lowest()};
+
+  std::vector<TriangleRecord> records(numLocal);
+  for(std::int64_t i = 0; i < numLocal; ++i)
+  {
+    for(int d = 0; d < 3; ++d)
     {
-      rc = READER_SUCCESS;
-      m_num_faces = m_num_nodes / 3;
-      m_nodes.resize(m_num_nodes * 3);
-      MPI_Bcast(&m_nodes[0], m_num_nodes * 3, MPI_DOUBLE, 0, m_comm);
+      const double c =
+        (coords[9 * i + d] + coords[9 * i + 3 + d] + coords[9 * i + 6 + d]) /
+        3.;
+      lo[d] = axom::utilities::min(lo[d], c);
+      hi[d] = axom::utilities::max(hi[d], c);
     }
+  }
+  MPI_Allreduce(MPI_IN_PLACE, lo, 3, MPI_DOUBLE, MPI_MIN, m_comm);
+  MPI_Allreduce(MPI_IN_PLACE, hi, 3, MPI_DOUBLE, MPI_MAX, m_comm);
+
+  // STEP 2: sort the local triangles by the Morton index of their centroid,
+  // quantized within the bounding box
+  double scale[3];
+  for(int d = 0; d < 3; ++d)
+  {
+    scale[d] = (hi[d] > lo[d]) ? MAX_COORD / (hi[d] - lo[d]) : 0.;
+  }
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(std::int64_t i = 0; i < numLocal; ++i)
+  {
+    TriangleRecord& rec = records[i];
+    std::uint32_t q[3];
+    for(int d = 0; d < 3; ++d)
+    {
+      const double c =
+        (coords[9 * i + d] + coords[9 * i + 3 + d] + coords[9 * i + 6 + d]) /
+        3.;
+      const double t = axom::utilities::clampVal((c - lo[d]) * scale[d],
+                                                 0.,
+                                                 MAX_COORD);
+      q[d] = static_cast<std::uint32_t>(t);
+    }
+    rec.key = MortonizerType::mortonize(q[0], q[1], q[2]);
+    rec.faceId = firstFaceId + i;
+    std::memcpy(rec.coords, &coords[9 * i], sizeof(rec.coords));
+  }
+  std::sort(records.begin(), records.end());
+
+  // STEP 3: pick the splitters between the ranks from a regular sample of
+  // the keys of each rank. The total number of samples is bounded, so that
+  // the size of the gathered sample does not grow with the square of the
+  // number of ranks
+  const std::int64_t samplesPerRank = axom::utilities::max<std::int64_t>(
+    MIN_SAMPLES_PER_RANK,
+    SAMPLE_BUDGET / m_num_ranks);
+  const int numSamples =
+    static_cast<int>(axom::utilities::min(numLocal, samplesPerRank));
+  std::vector<std::uint64_t> samples(numSamples);
+  for(int s = 0; s < numSamples; ++s)
+  {
+    samples[s] = records[(2 * s + 1) * numLocal / (2 * numSamples)].key;
+  }
+
+  std::vector<int> sampleCounts(m_num_ranks);
+  std::vector<int> sampleDispls(m_num_ranks + 1, 0);
+  MPI_Allgather(&numSamples,
+                1,
+                MPI_INT,
+                sampleCounts.data(),
+                1,
+                MPI_INT,
+                m_comm);
+  for(int r = 0; r < m_num_ranks; ++r)
+  {
+    sampleDispls[r + 1] = sampleDispls[r] + sampleCounts[r];
+  }
+
+  std::vector<std::uint64_t> allSamples(sampleDispls[m_num_ranks]);
+  MPI_Allgatherv(samples.data(),
+                 numSamples,
+                 MPI_UINT64_T,
+                 allSamples.data(),
+                 sampleCounts.data(),
+                 sampleDispls.data(),
+                 MPI_UINT64_T,
+                 m_comm);
+  std::sort(allSamples.begin(), allSamples.end());
+
+  const std::int64_t totalSamples = allSamples.size();
+  std::vector<std::uint64_t> splitters(m_num_ranks - 1);
+  for(int r = 1; r < m_num_ranks; ++r)
+  {
+    splitters[r - 1] = (totalSamples > 0)
+      ? allSamples[r * totalSamples / m_num_ranks]
+      : std::numeric_limits<std::uint64_t>::max();
+  }
 
-  }  // END switch
+  // STEP 4: send each triangle to the rank whose key range holds its key.
+  // Since the triangles are sorted, the triangles of each rank are contiguous
+  std::vector<int> sendCounts(m_num_ranks, 0);
+  std::vector<int> sendDispls(m_num_ranks + 1, 0);
+  for(std::int64_t i = 0; i < numLocal; ++i)
+  {
+    const int dest = static_cast<int>(
+      std::upper_bound(splitters.begin(), splitters.end(), records[i].key) -
+      splitters.begin());
+    ++sendCounts[dest];
+  }
+
+  std::vector<int> recvCounts(m_num_ranks);
+  std::vector<int> recvDispls(m_num_ranks + 1, 0);
+  MPI_Alltoall(sendCounts.data(),
+               1,
+               MPI_INT,
+               recvCounts.data(),
+               1,
+               MPI_INT,
+               m_comm);
+  for(int r = 0; r < m_num_ranks; ++r)
+  {
+    sendDispls[r + 1] = sendDispls[r] + sendCounts[r];
+    recvDispls[r + 1] = recvDispls[r] + recvCounts[r];
+  }
 
-  return (rc);
+  MPI_Datatype recordType;
+  MPI_Type_contiguous(sizeof(TriangleRecord), MPI_BYTE, &recordType);
+  MPI_Type_commit(&recordType);
+
+  std::vector<TriangleRecord> received(recvDispls[m_num_ranks]);
+  MPI_Alltoallv(records.data(),
+                sendCounts.data(),
+                sendDispls.data(),
+                recordType,
+                received.data(),
+                recvCounts.data(),
+                recvDispls.data(),
+                recordType,
+                m_comm);
+
+  MPI_Type_free(&recordType);
+  records.clear();
+  records.shrink_to_fit();
+
+  // STEP 5: store the received triangles in the order of their Morton index
+  std::sort(received.begin(), received.end());
+
+  m_num_faces = static_cast<axom::IndexType>(received.size());
+  m_num_nodes = 3 * m_num_faces;
+  m_nodes.resize(static_cast<std::size_t>(m_num_faces) * 9);
+  m_globalFaceIds.resize(m_num_faces);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(axom::IndexType i = 0; i < m_num_faces; ++i)
+  {
+    std::memcpy(&m_nodes[9 * static_cast<std::size_t>(i)],
+                received[i].coords,
+                sizeof(received[i].coords));
+    m_globalFaceIds[i] = static_cast<axom::IndexType>(received[i].faceId);
+  }
 }
 
 }  // end namespace quest
@@ -12,29 +12,134 @@
 
 #include "mpi.h"
 
+// C/C++ includes
+#include <vector>  // for std::vector
+
 namespace axom
 {
 namespace quest
 {
+/*!
+ * \class PSTLReader
+ *
+ * \brief A parallel reader for STL files, which distributes the surface mesh
+ *  among the ranks of an MPI communicator.
+ *
+ * The reader supports two modes:
+ *
+ * * ReadMode::BROADCAST (default): rank 0 reads in the STL file and
+ *   broadcasts the surface mesh, so that every rank holds the whole mesh.
+ *
+ * * ReadMode::PARTITIONED: each rank reads in its own range of triangles
+ *   of a binary STL file with MPI-IO. The triangles are then redistributed
+ *   among the ranks by the Morton index of their centroid, so that every
+ *   rank holds a spatially coherent subset of the triangles of roughly
+ *   the same size. Ascii STL files, which cannot be split by byte ranges,
+ *   are read in by rank 0 and scattered among the ranks before being
+ *   redistributed.
+ *
+ * In both modes, vertex welding, if enabled, is applied to the triangles
+ * held by each rank.
+ *
+ * \see STLReader::setWeldVertices()
+ */
 class PSTLReader : public STLReader
 {
+public:
+  /// \brief Modes for distributing the surface mesh among the ranks
+  enum class ReadMode
+  {
+    BROADCAST,
+    PARTITIONED
+  };
+
 public:
   PSTLReader() = delete;
   PSTLReader(MPI_Comm comm);
 
   virtual ~PSTLReader();
 
+  /*!
+   * \brief Sets the mode used to distribute the mesh among the ranks.
+   * \param [in] mode the read mode
+   */
+  void setReadMode(ReadMode mode) { m_mode = mode; }
+
+  /*!
+   * \brief Returns the mode used to distribute the mesh among the ranks.
+   */
+  ReadMode getReadMode() const { return m_mode; }
+
+  /*!
+   * \brief Returns the index in the STL file of each triangle of this rank.
+   *
+   * \note Only populated in the PARTITIONED mode. In the BROADCAST mode,
+   *  every rank holds the triangles in the order of the file.
+   */
+  const std::vector<axom::IndexType>& getGlobalFaceIds() const
+  {
+    return m_globalFaceIds;
+  }
+
   /*!
    * \brief Reads in an STL file to all ranks in the associated communicator.
-   * 
-   * \note Rank 0 reads in the STL mesh file and broadcasts to the other ranks.
+   *
+   * \note In the BROADCAST mode, rank 0 reads in the STL mesh file and
+   *  broadcasts to the other ranks. In the PARTITIONED mode, each rank holds
+   *  a spatially coherent subset of the triangles.
+   *
    * \return status set to zero on success; set to a non-zero value otherwise.
+   *
+   * \see ReadMode
    */
   int read() final override;
 
+private:
+  /// Rank 0 reads in the whole mesh and broadcasts it to the other ranks
+  int readBroadcast();
+
+  /// Each rank reads a range of triangles, which are then redistributed
+  int readPartitioned();
+
+  /*!
+   * \brief Reads the contiguous range of triangles of this rank from a
+   *  binary STL file with collective MPI-IO calls.
+   *
+   * \param [in] numTris the number of triangles in the file
+   * \param [out] coords the coordinates of the triangles of this rank
+   *
+   * \return status set to zero on success on all ranks
+   */
+  int readBinaryRange(axom::IndexType numTris, std::vector<double>& coords);
+
+  /*!
+   * \brief Rank 0 reads in an ascii STL file and scatters contiguous ranges
+   *  of its triangles to the ranks.
+   *
+   * \param [out] coords the coordinates of the triangles of this rank
+   * \param [out] numTris the number of triangles in the file
+   *
+   * \return status set to zero on success on all ranks
+   */
+  int scatterAsciiTriangles(std::vector<double>& coords,
+                            axom::IndexType& numTris);
+
+  /*!
+   * \brief Redistributes the triangles among the ranks by the Morton index
+   *  of their centroid, and stores the triangles of this rank.
+   *
+   * \param [in] coords the coordinates of the triangles read by this rank
+   * \param [in] firstFaceId the index in the file of the first triangle
+   */
+  void redistributeTriangles(const std::vector<double>& coords,
+                             axom::IndexType firstFaceId);
+
 private:
   MPI_Comm m_comm {MPI_COMM_NULL};
   int m_my_rank {0};
+  int m_num_ranks {1};
+  ReadMode m_mode {ReadMode::BROADCAST};
+  std::vector<axom::IndexType> m_globalFaceIds;
 
   DISABLE_COPY_AND_ASSIGNMENT(PSTLReader);
   DISABLE_MOVE_AND_ASSIGNMENT(PSTLReader);
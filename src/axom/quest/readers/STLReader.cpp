@@ -6,17 +6,141 @@
 #include "axom/quest/readers/STLReader.hpp"
 
 // Axom includes
+#include "axom/core/utilities/FileUtilities.hpp"
 #include "axom/core/utilities/Utilities.hpp"
 #include "axom/mint/mesh/CellTypes.hpp"
 #include "axom/slic/interface/slic.hpp"
 
 // C/C++ includes
-#include <fstream>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
 
 namespace
 {
-const std::size_t BINARY_HEADER_SIZE = 80;  // bytes
-const std::size_t BINARY_TRI_SIZE = 50;     // bytes
+const std::size_t ASCII_CHUNK_SIZE = 1 << 20;  // bytes
+
+inline bool isSpace(char c)
+{
+  return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\v' ||
+    c == '\f';
+}
+
+/// Returns the position of the first whitespace character at or after pos
+inline std::size_t tokenEnd(const char* data, std::size_t size, std::size_t pos)
+{
+  while(pos < size && !isSpace(data[pos]))
+  {
+    ++pos;
+  }
+  return pos;
+}
+
+/// Returns the position of the first non-whitespace character at or after pos
+inline std::size_t skipSpaces(const char* data,
+                              std::size_t size,
+                              std::size_t pos)
+{
+  while(pos < size && isSpace(data[pos]))
+  {
+    ++pos;
+  }
+  return pos;
+}
+
+/*!
+ * \brief Parses the floating point number in the token starting at or after
+ *  \a pos, and advances \a pos past the token.
+ *
+ * \return true if the whole token is a valid floating point number
+ */
+bool parseDouble(const char* data,
+                 std::size_t size,
+                 std::size_t& pos,
+                 double& value)
+{
+  pos = skipSpaces(data, size, pos);
+  const std::size_t end = tokenEnd(data, size, pos);
+
+  // The file contents are not null-terminated, so copy the token for strtod
+  char buf[64];
+  const std::size_t len = end - pos;
+  if(len == 0 || len >= sizeof(buf))
+  {
+    return false;
+  }
+  std::memcpy(buf, data + pos, len);
+  buf[len] = '\0';
+  pos = end;
+
+  char* parseEnd = nullptr;
+  value = std::strtod(buf, &parseEnd);
+  return parseEnd == buf + len;
+}
+
+/*!
+ * \brief Parses the vertices of an ascii STL file whose "vertex" keyword
+ *  starts in the range [begin, end) of the file contents.
+ *
+ * In an STL file, we only care about the vertex positions.
+ * Vertices are strings of the form: "vertex v_x v_y v_z"
+ *
+ * \note The coordinates of the last vertex may extend past \a end.
+ * \return true if all the vertices were parsed successfully
+ */
+bool parseAsciiVertices(const char* data,
+                        std::size_t size,
+                        std::size_t begin,
+                        std::size_t end,
+                        std::vector<double>& coords)
+{
+  std::size_t pos = skipSpaces(data, size, begin);
+  while(pos < end)
+  {
+    const std::size_t next = tokenEnd(data, size, pos);
+    const bool isVertex =
+      (next - pos == 6) && std::strncmp(data + pos, "vertex", 6) == 0;
+    pos = next;
+
+    if(isVertex)
+    {
+      for(int d = 0; d < 3; ++d)
+      {
+        double coord;
+        if(!parseDouble(data, size, pos, coord))
+        {
+          return false;
+        }
+        coords.push_back(coord);
+      }
+    }
+
+    pos = skipSpaces(data, size, pos);
+  }
+  return true;
+}
+
+/// Returns the bits of a coordinate, with -0.0 and +0.0 treated as equal
+inline std::uint64_t coordBits(double coord)
+{
+  const double normalized = coord + 0.0;
+  std::uint64_t bits;
+  std::memcpy(&bits, &normalized, sizeof(bits));
+  return bits;
+}
+
+/// Mixes the bits of a 64-bit value (the splitmix64 finalizer)
+inline std::uint64_t mixBits(std::uint64_t h)
+{
+  h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+  return h ^ (h >> 31);
+}
+
 }  // namespace
 
 //------------------------------------------------------------------------------
@@ -26,6 +150,10 @@ namespace axom
 {
 namespace quest
 {
+constexpr std::size_t STLReader::BINARY_HEADER_SIZE;
+constexpr std::size_t STLReader::BINARY_TRI_SIZE;
+
+//------------------------------------------------------------------------------
 STLReader::STLReader() : m_fileName(""), m_num_nodes(0), m_num_faces(0) { }
 
 //------------------------------------------------------------------------------
@@ -37,40 +165,29 @@ void STLReader::clear()
   m_num_nodes = 0;
   m_num_faces = 0;
   m_nodes.clear();
+  m_connectivity.clear();
 }
 
 //------------------------------------------------------------------------------
-bool STLReader::isAsciiFormat() const
+bool STLReader::isAsciiFormat(const char* data, std::size_t size) const
 {
   // The binary format consists of
   //    a header of size BINARY_HEADER_SIZE==80 bytes
   //    followed by a four byte int encoding the number of triangles
   //    followed by the triangle data (BINARY_TRI_SIZE == 50 bytes per triangle)
 
-  // Open the file
-  std::ifstream ifs(m_fileName.c_str(), std::ios::in | std::ios::binary);
-
-  if(!ifs.is_open())
-  {
-    /* short-circuit */
-    SLIC_WARNING("Cannot open the provided STL file [" << m_fileName << "]");
-    return false;
-  }
-
-  // Find out the file size
-  ifs.seekg(0, ifs.end);
-  std::int32_t fileSize = static_cast<std::int32_t>(ifs.tellg());
-
-  const int totalHeaderSize = (BINARY_HEADER_SIZE + sizeof(std::int32_t));
+  // Note: file sizes are 64-bit, since STL files can be larger than 2GB
+  const std::uint64_t fileSize = size;
+  const std::uint64_t totalHeaderSize =
+    BINARY_HEADER_SIZE + sizeof(std::uint32_t);
   if(fileSize < totalHeaderSize)
   {
     return true;
   }
 
   // Find the number of triangles (if the file were binary)
-  int numTris = 0;
-  ifs.seekg(BINARY_HEADER_SIZE, ifs.beg);
-  ifs.read((char*)&numTris, sizeof(std::int32_t));
+  std::uint32_t numTris = 0;
+  std::memcpy(&numTris, data + BINARY_HEADER_SIZE, sizeof(std::uint32_t));
 
   if(!utilities::isLittleEndian())
   {
@@ -78,117 +195,291 @@ bool STLReader::isAsciiFormat() const
   }
 
   // Check if the size matches our expectation
-  int expectedBinarySize = totalHeaderSize + (numTris * BINARY_TRI_SIZE);
-
-  ifs.close();
+  const std::uint64_t expectedBinarySize =
+    totalHeaderSize + static_cast<std::uint64_t>(numTris) * BINARY_TRI_SIZE;
 
   return (fileSize != expectedBinarySize);
 }
 
 //------------------------------------------------------------------------------
-int STLReader::readAsciiSTL()
+int STLReader::readAsciiSTL(const char* data, std::size_t size)
 {
-  std::ifstream ifs(m_fileName.c_str());
-
-  if(!ifs.is_open())
+  // Split the file into chunks that are parsed in parallel. Each chunk
+  // parses the vertices whose keyword starts in the chunk, so the chunk
+  // boundaries are moved past the token they fall in.
+  const std::int64_t numChunks =
+    static_cast<std::int64_t>(size / ASCII_CHUNK_SIZE) + 1;
+  std::vector<std::size_t> bounds(numChunks + 1, size);
+  bounds[0] = 0;
+  for(std::int64_t c = 1; c < numChunks; ++c)
   {
-    SLIC_WARNING("Cannot open the provided STL file [" << m_fileName << "]");
-    return (-1);
+    bounds[c] = tokenEnd(data, size, c * ASCII_CHUNK_SIZE);
   }
 
-  std::string junk;
-  double x, y, z;
+  std::vector<std::vector<double>> chunkCoords(numChunks);
+  int numFailed = 0;
 
-  // In an STL  file, we only care about the vertex positions
-  // Vertices are strings of the form: "vertex v_x v_y v_z"
-  while(true)
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(dynamic) reduction(+ : numFailed)
+#endif
+  for(std::int64_t c = 0; c < numChunks; ++c)
   {
-    do
-    {
-      ifs >> junk;
-    } while(ifs.good() && junk != "vertex");
-
-    if(ifs.fail())
+    if(!parseAsciiVertices(data,
+                           size,
+                           bounds[c],
+                           bounds[c + 1],
+                           chunkCoords[c]))
     {
-      break;
+      ++numFailed;
     }
+  }
 
-    ifs >> x >> y >> z;
-    m_nodes.push_back(x);
-    m_nodes.push_back(y);
-    m_nodes.push_back(z);
+  if(numFailed > 0)
+  {
+    SLIC_WARNING("Invalid vertex in ascii STL file [" << m_fileName << "]");
+    return (-1);
+  }
+
+  // Concatenate the vertices of the chunks
+  std::vector<std::size_t> offsets(numChunks + 1, 0);
+  for(std::int64_t c = 0; c < numChunks; ++c)
+  {
+    offsets[c + 1] = offsets[c] + chunkCoords[c].size();
+  }
+
+  // The vertices are indexed with axom::IndexType
+  const std::uint64_t maxVerts =
+    static_cast<std::uint64_t>(std::numeric_limits<axom::IndexType>::max());
+  if(offsets[numChunks] / 3 > maxVerts)
+  {
+    SLIC_WARNING("STL file [" << m_fileName << "] has "
+                              << offsets[numChunks] / 3
+                              << " vertices, which exceeds the maximum of "
+                              << maxVerts << " vertices");
+    return (-1);
+  }
+  m_nodes.resize(offsets[numChunks]);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(dynamic)
+#endif
+  for(std::int64_t c = 0; c < numChunks; ++c)
+  {
+    std::copy(chunkCoords[c].begin(),
+              chunkCoords[c].end(),
+              m_nodes.begin() + offsets[c]);
   }
 
   // Set the number of nodes and faces
   m_num_nodes = static_cast<axom::IndexType>(m_nodes.size()) / 3;
   m_num_faces = m_num_nodes / 3;
 
-  ifs.close();
   return (0);
 }
 
 //------------------------------------------------------------------------------
-int STLReader::readBinarySTL()
+int STLReader::readBinarySTL(const char* data, std::size_t size)
 {
   // Binary STL format consists of
   //    an 80 byte header (BINARY_HEADER_SIZE)
   //    followed by a 32 bit int encoding the number of faces
   //    followed by the triangles, each of which is 50 bytes (BINARY_TRI_SIZE)
 
-  // A local union data structure for triangles in a binary STL
-  union BinarySTLTri
-  {
-    std::int8_t raw[BINARY_TRI_SIZE];
-
-    struct
-    {
-      float normal[3];
-      float vert[9];
-      std::uint16_t attr;
-    } data;
-
-  } tri;
+  // read the num faces
+  std::uint32_t numTris = 0;
+  std::memcpy(&numTris, data + BINARY_HEADER_SIZE, sizeof(std::uint32_t));
 
-  bool const isLittleEndian = axom::utilities::isLittleEndian();
+  if(!axom::utilities::isLittleEndian())
+  {
+    numTris = utilities::byteswap(numTris);
+  }
 
-  // Open binary file, skip the header
-  std::ifstream ifs(m_fileName.c_str(), std::ios::in | std::ios::binary);
-  if(!ifs.is_open())
+  // The vertices of the soup of triangles are indexed with axom::IndexType.
+  // Offsets into the coordinates are computed with std::size_t.
+  const std::uint64_t maxTris =
+    static_cast<std::uint64_t>(std::numeric_limits<axom::IndexType>::max()) / 3;
+  if(numTris > maxTris)
   {
-    SLIC_WARNING("Cannot open the provided STL file [" << m_fileName << "]");
+    SLIC_WARNING("STL file [" << m_fileName << "] has " << numTris
+                              << " triangles, which exceeds the maximum of "
+                              << maxTris << " triangles");
     return (-1);
   }
+  SLIC_ASSERT(BINARY_HEADER_SIZE + sizeof(std::uint32_t) +
+                static_cast<std::uint64_t>(numTris) * BINARY_TRI_SIZE ==
+              size);
+  AXOM_UNUSED_VAR(size);
 
-  ifs.seekg(BINARY_HEADER_SIZE);
+  m_num_faces = static_cast<axom::IndexType>(numTris);
+  m_num_nodes = m_num_faces * 3;
+  m_nodes.resize(static_cast<std::size_t>(m_num_nodes) * 3);
 
-  // read the num faces and reserve room for the vertex positions
-  ifs.read((char*)&m_num_faces, sizeof(std::int32_t));
+  decodeBinaryTriangles(data + BINARY_HEADER_SIZE + sizeof(std::uint32_t),
+                        m_num_faces,
+                        m_nodes.data());
 
-  if(!isLittleEndian)
-  {
-    m_num_faces = utilities::byteswap(m_num_faces);
-  }
+  return (0);
+}
 
-  m_num_nodes = m_num_faces * 3;
-  m_nodes.reserve(m_num_nodes * 3);
+//------------------------------------------------------------------------------
+void STLReader::decodeBinaryTriangles(const char* tris,
+                                      axom::IndexType numTris,
+                                      double* coords)
+{
+  // Each triangle holds a normal, the three vertices, as 32-bit floats, and
+  // a 16-bit attribute.
+  const std::size_t VERTEX_OFFSET = 3 * sizeof(float);
+
+  bool const isLittleEndian = axom::utilities::isLittleEndian();
 
   // Read the triangles. Cast to doubles and ignore normals and attributes
-  for(axom::IndexType i = 0; i < m_num_faces; ++i)
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(axom::IndexType i = 0; i < numTris; ++i)
   {
-    ifs.read((char*)tri.raw, BINARY_TRI_SIZE);
+    float vert[9];
+    std::memcpy(vert,
+                tris + static_cast<std::size_t>(i) * BINARY_TRI_SIZE +
+                  VERTEX_OFFSET,
+                sizeof(vert));
 
     for(int j = 0; j < 9; ++j)
     {
-      float coord = isLittleEndian ? tri.data.vert[j]
-                                   : utilities::byteswap(tri.data.vert[j]);
+      float coord = isLittleEndian ? vert[j] : utilities::byteswap(vert[j]);
 
-      m_nodes.push_back(static_cast<double>(coord));
+      coords[static_cast<std::size_t>(i) * 9 + j] = static_cast<double>(coord);
     }
   }
+}
 
-  ifs.close();
+//------------------------------------------------------------------------------
+void STLReader::weldVertices()
+{
+  // The soup of triangles has three vertices per triangle
+  const axom::IndexType numVerts = m_num_nodes;
+  const double* coords = m_nodes.data();
+
+  // Note: the offsets into coords can exceed the range of a 32-bit IndexType
+  auto vertexCoords = [=](axom::IndexType i) {
+    return coords + 3 * static_cast<std::size_t>(i);
+  };
+
+  auto sameVertex = [=](axom::IndexType a, axom::IndexType b) {
+    const double* pa = vertexCoords(a);
+    const double* pb = vertexCoords(b);
+    return coordBits(pa[0]) == coordBits(pb[0]) &&
+      coordBits(pa[1]) == coordBits(pb[1]) &&
+      coordBits(pa[2]) == coordBits(pb[2]);
+  };
+
+  auto hashVertex = [=](axom::IndexType i) {
+    const double* p = vertexCoords(i);
+    std::uint64_t h = mixBits(coordBits(p[0]));
+    h = mixBits(h ^ coordBits(p[1]));
+    return mixBits(h ^ coordBits(p[2]));
+  };
+
+  // STEP 1: insert the vertices into an open-addressing hash table, whose
+  // slots hold the smallest index of the vertices with the same coordinates
+  constexpr axom::IndexType EMPTY_SLOT = -1;
+  std::size_t numSlots = 1;
+  while(numSlots < 2 * static_cast<std::size_t>(numVerts))
+  {
+    numSlots <<= 1;
+  }
+  const std::size_t slotMask = numSlots - 1;
+  std::unique_ptr<std::atomic<axom::IndexType>[]> slots(
+    new std::atomic<axom::IndexType>[numSlots]);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(std::int64_t s = 0; s < static_cast<std::int64_t>(numSlots); ++s)
+  {
+    slots[s].store(EMPTY_SLOT, std::memory_order_relaxed);
+  }
 
-  return (0);
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(axom::IndexType i = 0; i < numVerts; ++i)
+  {
+    std::size_t s = hashVertex(i) & slotMask;
+    axom::IndexType cur = slots[s].load();
+    while(true)
+    {
+      if(cur == EMPTY_SLOT)
+      {
+        // on failure, cur is updated with the index stored by another thread
+        if(slots[s].compare_exchange_weak(cur, i))
+        {
+          break;
+        }
+      }
+      else if(sameVertex(cur, i))
+      {
+        if(cur <= i || slots[s].compare_exchange_weak(cur, i))
+        {
+          break;
+        }
+      }
+      else
+      {
+        s = (s + 1) & slotMask;
+        cur = slots[s].load();
+      }
+    }
+  }
+
+  // STEP 2: find the first occurrence of each vertex
+  std::vector<axom::IndexType> firstVert(numVerts);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(axom::IndexType i = 0; i < numVerts; ++i)
+  {
+    std::size_t s = hashVertex(i) & slotMask;
+    while(!sameVertex(slots[s].load(std::memory_order_relaxed), i))
+    {
+      s = (s + 1) & slotMask;
+    }
+    firstVert[i] = slots[s].load(std::memory_order_relaxed);
+  }
+  slots.reset();
+
+  // STEP 3: number the unique vertices in the order of their first occurrence
+  std::vector<axom::IndexType> nodeIds(numVerts);
+  axom::IndexType numUnique = 0;
+  for(axom::IndexType i = 0; i < numVerts; ++i)
+  {
+    nodeIds[i] = (firstVert[i] == i) ? numUnique++ : -1;
+  }
+
+  // STEP 4: gather the unique vertices and build the connectivity
+  std::vector<double> nodes(static_cast<std::size_t>(numUnique) * 3);
+  m_connectivity.resize(numVerts);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(axom::IndexType i = 0; i < numVerts; ++i)
+  {
+    const axom::IndexType nodeId = nodeIds[firstVert[i]];
+    m_connectivity[i] = nodeId;
+    if(firstVert[i] == i)
+    {
+      const double* p = vertexCoords(i);
+      for(int d = 0; d < 3; ++d)
+      {
+        nodes[3 * static_cast<std::size_t>(nodeId) + d] = p[d];
+      }
+    }
+  }
+
+  m_nodes.swap(nodes);
+  m_num_nodes = numUnique;
 }
 
 //------------------------------------------------------------------------------
@@ -202,7 +493,22 @@ int STLReader::read()
   // Clear internal data, check the format and load the data
   this->clear();
 
-  int rc = (isAsciiFormat()) ? readAsciiSTL() : readBinarySTL();
+  utilities::filesystem::MappedFile file(m_fileName);
+  if(!file.isOpen())
+  {
+    SLIC_WARNING("Cannot open the provided STL file [" << m_fileName << "]");
+    return (-1);
+  }
+
+  int rc = isAsciiFormat(file.data(), file.size())
+    ? readAsciiSTL(file.data(), file.size())
+    : readBinarySTL(file.data(), file.size());
+
+  if(rc == 0 && m_weldVertices)
+  {
+    weldVertices();
+  }
+
   return (rc);
 }
 
@@ -211,7 +517,7 @@ void STLReader::getMesh(axom::mint::UnstructuredMesh<mint::SINGLE_SHAPE>* mesh)
 {
   /* Sanity checks */
   SLIC_ERROR_IF(mesh == nullptr, "supplied mesh is null!");
-  SLIC_ERROR_IF(static_cast<axom::IndexType>(m_nodes.size()) != 3 * m_num_nodes,
+  SLIC_ERROR_IF(m_nodes.size() != 3 * static_cast<std::size_t>(m_num_nodes),
                 "nodes vector size doesn't match expected size!");
   SLIC_ERROR_IF(mesh->getDimension() != 3, "STL reader expects a 3D mesh!");
   SLIC_ERROR_IF(mesh->getCellType() != mint::TRIANGLE,
@@ -237,20 +543,22 @@ void STLReader::getMesh(axom::mint::UnstructuredMesh<mint::SINGLE_SHAPE>* mesh)
   // Load the vertices into the mesh
   for(axom::IndexType i = 0; i < m_num_nodes; ++i)
   {
-    const axom::IndexType offset = i * 3;
+    const std::size_t offset = static_cast<std::size_t>(i) * 3;
     x[i] = m_nodes[offset];
     y[i] = m_nodes[offset + 1];
     z[i] = m_nodes[offset + 2];
   }
 
-  // Load the triangles.  Note that the indices are implicitly defined.
+  // Load the triangles.  Note that the indices of a soup of triangles are
+  // implicitly defined.
   axom::IndexType* conn = mesh->getCellNodesArray();
+  const bool isWelded = !m_connectivity.empty();
   for(axom::IndexType i = 0; i < m_num_faces; ++i)
   {
     const axom::IndexType offset = i * 3;
-    conn[offset] = offset;
-    conn[offset + 1] = offset + 1;
-    conn[offset + 2] = offset + 2;
+    conn[offset] = isWelded ? m_connectivity[offset] : offset;
+    conn[offset + 1] = isWelded ? m_connectivity[offset + 1] : offset + 1;
+    conn[offset + 2] = isWelded ? m_connectivity[offset + 2] : offset + 2;
   }
 }
 
@@ -12,8 +12,9 @@
 #include "axom/mint/mesh/UnstructuredMesh.hpp"
 
 // C/C++ includes
-#include <string>  // for std::string
-#include <vector>  // for std::vector
+#include <cstddef>  // for std::size_t
+#include <string>   // for std::string
+#include <vector>   // for std::vector
 
 namespace axom
 {
@@ -27,6 +28,14 @@ namespace quest
  * STL (STereoLithography) is a common file format for triangle meshes.
  * It encodes a "soup of triangles" by explicitly listing the coordinate
  * positions of the three vertices of each triangle.
+ *
+ * The file is memory-mapped and its triangles are parsed in parallel, when
+ * axom is built with OpenMP. By default, the reader returns the soup of
+ * triangles, with three nodes per triangle. When vertex welding is enabled,
+ * coincident vertices are merged during the read, so that the reader
+ * returns an indexed mesh whose triangles share their nodes.
+ *
+ * \see setWeldVertices()
  */
 class STLReader
 {
@@ -47,6 +56,22 @@ public:
    */
   void setFileName(const std::string& fileName) { m_fileName = fileName; };
 
+  /*!
+   * \brief Sets whether the reader welds coincident vertices.
+   *
+   * \param [in] weld if true, the vertices of the triangles that have
+   *  identical coordinates are merged into a single node while reading
+   *
+   * \note Only exactly coincident vertices are welded. Use
+   *  quest::weldTriMeshVertices() to weld vertices within a tolerance.
+   */
+  void setWeldVertices(bool weld) { m_weldVertices = weld; }
+
+  /*!
+   * \brief Checks if the reader welds coincident vertices.
+   */
+  bool getWeldVertices() const { return m_weldVertices; }
+
   /*!
    * \brief Returns the number of nodes of the surface mesh.
    * \return numNodes the number of nodes.
@@ -74,11 +99,21 @@ public:
   /*!
    * \brief Stores the STL data in the supplied unstructured mesh object.
    * \param [in,out] mesh pointer to the unstructured mesh.
+   *
+   * \note When vertex welding is enabled, the triangles of the mesh share
+   *  their nodes. Otherwise, the nodes of triangle i are 3i, 3i+1 and 3i+2.
+   *
    * \pre mesh != nullptr.
    */
   void getMesh(mint::UnstructuredMesh<mint::SINGLE_SHAPE>* mesh);
 
-private:
+protected:
+  /// Size in bytes of the header of a binary STL file
+  static constexpr std::size_t BINARY_HEADER_SIZE = 80;
+
+  /// Size in bytes of a triangle in a binary STL file
+  static constexpr std::size_t BINARY_TRI_SIZE = 50;
+
   /*!
    * \brief A predicate to check if the file is in ascii format
    *
@@ -88,21 +123,49 @@ private:
    * encoding the number of triangles, followed by the triangle data
    * (50 bytes per triangle).
    *
+   * \param [in] data pointer to the contents of the file, or to at least
+   *  its first BINARY_HEADER_SIZE + 4 bytes
+   * \param [in] size the size of the file in bytes
+   *
    * \return True, if the file is ascii encoded, False if it is binary
    */
-  bool isAsciiFormat() const;
+  bool isAsciiFormat(const char* data, std::size_t size) const;
+
+  /*!
+   * \brief Decodes consecutive triangles of a binary-encoded STL file
+   *
+   * \param [in] tris pointer to the first triangle to decode
+   * \param [in] numTris the number of triangles to decode
+   * \param [out] coords buffer of size 9 * numTris, which holds the
+   *  coordinates of the three vertices of each triangle
+   */
+  static void decodeBinaryTriangles(const char* tris,
+                                    axom::IndexType numTris,
+                                    double* coords);
+
+  /*!
+   * \brief Merges the coincident vertices of the soup of triangles
+   *
+   * Builds the connectivity of the triangles into the unique vertices, which
+   * are numbered in the order of their first occurrence in the file.
+   */
+  void weldVertices();
+
+private:
 
   /*!
-   * \brief Reads an ascii-encoded STL file into memory
-   * \note The filename should be set with STLReader::setFileName()
+   * \brief Parses the contents of an ascii-encoded STL file
+   * \param [in] data pointer to the contents of the file
+   * \param [in] size the size of the file in bytes
    */
-  int readAsciiSTL();
+  int readAsciiSTL(const char* data, std::size_t size);
 
   /*!
-   * \brief Reads a binary-encoded STL file into memory
-   * \note The filename should be set with STLReader::setFileName()
+   * \brief Parses the contents of a binary-encoded STL file
+   * \param [in] data pointer to the contents of the file
+   * \param [in] size the size of the file in bytes
    */
-  int readBinarySTL();
+  int readBinarySTL(const char* data, std::size_t size);
 
 protected:
   std::string m_fileName;
@@ -112,6 +175,11 @@ protected:
 
   std::vector<double> m_nodes;
 
+  /// Triangle connectivity, empty unless the vertices have been welded
+  std::vector<axom::IndexType> m_connectivity;
+
+  bool m_weldVertices {false};
+
 private:
   DISABLE_COPY_AND_ASSIGNMENT(STLReader);
   DISABLE_MOVE_AND_ASSIGNMENT(STLReader);
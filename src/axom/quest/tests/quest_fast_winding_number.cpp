@@ -0,0 +1,334 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+#include "axom/primal.hpp"
+
+#include "axom/quest/FastWindingNumber.hpp"
+
+// Google Test includes
+#include "gtest/gtest.h"
+
+// C/C++ includes
+#include <cmath>
+#include <random>
+
+// Aliases
+namespace quest = axom::quest;
+namespace primal = axom::primal;
+
+using Point2D = primal::Point<double, 2>;
+using Point3D = primal::Point<double, 3>;
+using Triangle3D = primal::Triangle<double, 3>;
+using BezierCurve2D = primal::BezierCurve<double, 2>;
+
+//------------------------------------------------------------------------------
+//  HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+/*!
+ * \brief Returns a triangulation of the unit sphere, with outward normals,
+ *  obtained by subdividing the faces of an octahedron \a levels times.
+ */
+axom::Array<Triangle3D> make_sphere_triangles(int levels)
+{
+  axom::Array<Triangle3D> tris;
+  for(int s = 0; s < 8; ++s)
+  {
+    const double sx = (s & 1) ? -1. : 1.;
+    const double sy = (s & 2) ? -1. : 1.;
+    const double sz = (s & 4) ? -1. : 1.;
+    const Point3D a {sx, 0., 0.};
+    const Point3D b {0., sy, 0.};
+    const Point3D c {0., 0., sz};
+    if(sx * sy * sz > 0)
+    {
+      tris.push_back(Triangle3D(a, b, c));
+    }
+    else
+    {
+      tris.push_back(Triangle3D(a, c, b));
+    }
+  }
+
+  auto on_sphere = [](const Point3D& p, const Point3D& q) {
+    const primal::Vector<double, 3> v =
+      primal::Vector<double, 3>(Point3D::midpoint(p, q)).unitVector();
+    return Point3D {v[0], v[1], v[2]};
+  };
+
+  for(int l = 0; l < levels; ++l)
+  {
+    axom::Array<Triangle3D> refined;
+    for(const auto& t : tris)
+    {
+      const Point3D m01 = on_sphere(t[0], t[1]);
+      const Point3D m12 = on_sphere(t[1], t[2]);
+      const Point3D m20 = on_sphere(t[2], t[0]);
+      refined.push_back(Triangle3D(t[0], m01, m20));
+      refined.push_back(Triangle3D(m01, t[1], m12));
+      refined.push_back(Triangle3D(m20, m12, t[2]));
+      refined.push_back(Triangle3D(m01, m12, m20));
+    }
+    tris = std::move(refined);
+  }
+  return tris;
+}
+
+/*!
+ * \brief Returns a counterclockwise unit circle made of \a n rational
+ *  quadratic Bezier arcs.
+ */
+axom::Array<BezierCurve2D> make_circle_curves(int n)
+{
+  axom::Array<BezierCurve2D> curves;
+  const double dtheta = 2. * M_PI / n;
+  for(int i = 0; i < n; ++i)
+  {
+    const double t0 = i * dtheta;
+    const double t1 = t0 + dtheta;
+    const double tm = t0 + 0.5 * dtheta;
+    const double w = std::cos(0.5 * dtheta);
+
+    axom::Array<Point2D> pts {Point2D {std::cos(t0), std::sin(t0)},
+                              Point2D {std::cos(tm) / w, std::sin(tm) / w},
+                              Point2D {std::cos(t1), std::sin(t1)}};
+    axom::Array<double> weights {1., w, 1.};
+    curves.push_back(BezierCurve2D(pts, weights, 2));
+  }
+  return curves;
+}
+
+/// Returns reproducible random query points in the box [lo, hi]^NDIMS
+template <int NDIMS>
+axom::Array<primal::Point<double, NDIMS>> make_query_points(int n,
+                                                            double lo,
+                                                            double hi)
+{
+  std::mt19937_64 gen(42);
+  std::uniform_real_distribution<double> dist(lo, hi);
+
+  axom::Array<primal::Point<double, NDIMS>> pts(n, n);
+  for(int i = 0; i < n; ++i)
+  {
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      pts[i][d] = dist(gen);
+    }
+  }
+  return pts;
+}
+
+/// Computes the winding number by summing over all the elements
+template <typename ElementType, typename PointType>
+double direct_winding_number(const PointType& q,
+                             const axom::Array<ElementType>& elements)
+{
+  double wn = 0.;
+  for(const auto& e : elements)
+  {
+    wn += primal::winding_number(q, e);
+  }
+  return wn;
+}
+
+/// Returns the largest difference between the fast and direct winding numbers
+template <int NDIMS, typename ElementType>
+double max_error(const quest::FastWindingNumber<NDIMS>& fwn,
+                 const axom::Array<ElementType>& elements,
+                 const axom::Array<primal::Point<double, NDIMS>>& queries)
+{
+  double err = 0.;
+  for(const auto& q : queries)
+  {
+    const double exact = direct_winding_number(q, elements);
+    err = axom::utilities::max(
+      err,
+      std::abs(fwn.computeWindingNumber(q) - exact));
+  }
+  return err;
+}
+
+}  // end anonymous namespace
+
+//------------------------------------------------------------------------------
+//  UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(quest_fast_winding_number, sphere_matches_direct_sum)
+{
+  const auto tris = make_sphere_triangles(4);
+  const auto queries = make_query_points<3>(500, -2., 2.);
+
+  quest::FastWindingNumber<3> fwn(tris.view());
+  EXPECT_EQ(tris.size(), fwn.getNumElements());
+  EXPECT_DOUBLE_EQ(2., fwn.getBeta());
+
+  const double err2 = max_error(fwn, tris, queries);
+  EXPECT_LT(err2, 0.1);
+
+  // the error decreases with beta
+  fwn.setBeta(8.);
+  const double err8 = max_error(fwn, tris, queries);
+  EXPECT_LT(err8, err2);
+  EXPECT_LT(err8, 1e-2);
+
+  // only exact evaluations when beta is huge
+  fwn.setBeta(1e12);
+  EXPECT_LT(max_error(fwn, tris, queries), 1e-10);
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_fast_winding_number, sphere_containment)
+{
+  const auto tris = make_sphere_triangles(4);
+  const auto queries = make_query_points<3>(1000, -2., 2.);
+
+  quest::FastWindingNumber<3> fwn(tris.view());
+  for(const auto& q : queries)
+  {
+    const double dist = std::sqrt(primal::squared_distance(Point3D(), q));
+    // skip the points in between the sphere and its triangulation
+    if(std::abs(dist - 1.) < 0.05)
+    {
+      continue;
+    }
+
+    const double expected = dist < 1. ? 1. : 0.;
+    EXPECT_NEAR(expected, fwn.computeWindingNumber(q), 0.1) << q;
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_fast_winding_number, batched_matches_single_queries)
+{
+  const auto tris = make_sphere_triangles(3);
+  const auto queries = make_query_points<3>(200, -2., 2.);
+
+  quest::FastWindingNumber<3> fwn(tris.view(), 3.);
+
+  const int npts = queries.size();
+  axom::Array<double> wn(npts, npts);
+  fwn.computeWindingNumbers(npts, queries.view(), wn.data());
+
+  for(int i = 0; i < npts; ++i)
+  {
+    EXPECT_DOUBLE_EQ(fwn.computeWindingNumber(queries[i]), wn[i]);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_fast_winding_number, circle_matches_direct_sum)
+{
+  const auto curves = make_circle_curves(256);
+  const auto queries = make_query_points<2>(500, -2., 2.);
+
+  quest::FastWindingNumber<2> fwn(curves.view());
+
+  const double err2 = max_error(fwn, curves, queries);
+  EXPECT_LT(err2, 0.1);
+
+  fwn.setBeta(8.);
+  const double err8 = max_error(fwn, curves, queries);
+  EXPECT_LT(err8, err2);
+  EXPECT_LT(err8, 1e-2);
+
+  fwn.setBeta(1e12);
+  EXPECT_LT(max_error(fwn, curves, queries), 1e-10);
+
+  // the circle is exact, so points off of it are classified correctly
+  fwn.setBeta(2.);
+  for(const auto& q : queries)
+  {
+    const double dist = std::sqrt(primal::squared_distance(Point2D(), q));
+    if(std::abs(dist - 1.) < 1e-3)
+    {
+      continue;
+    }
+
+    const double expected = dist < 1. ? 1. : 0.;
+    EXPECT_NEAR(expected, fwn.computeWindingNumber(q), 0.1) << q;
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_fast_winding_number, few_elements)
+{
+  // no elements
+  {
+    axom::Array<Triangle3D> tris;
+    quest::FastWindingNumber<3> fwn(tris.view());
+    EXPECT_EQ(0, fwn.getNumElements());
+    EXPECT_DOUBLE_EQ(0., fwn.computeWindingNumber(Point3D {1., 2., 3.}));
+
+    double wn = 1.;
+    axom::Array<Point3D> queries {Point3D {1., 2., 3.}};
+    fwn.computeWindingNumbers(1, queries.view(), &wn);
+    EXPECT_DOUBLE_EQ(0., wn);
+  }
+
+  // a single element
+  {
+    axom::Array<Triangle3D> tris {Triangle3D(Point3D {0., 0., 1.},
+                                             Point3D {1., 0., 1.},
+                                             Point3D {0., 1., 1.})};
+    quest::FastWindingNumber<3> fwn(tris.view());
+
+    const auto queries = make_query_points<3>(100, -10., 10.);
+    EXPECT_LT(max_error(fwn, tris, queries), 1e-2);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_fast_winding_number, polyhedron_matches_winding_number)
+{
+  using Polyhedron3D = primal::Polyhedron<double, 3>;
+
+  // an octahedron, whose faces are triangles, and a hexahedron, whose faces
+  // are triangulated
+  const Polyhedron3D oct = Polyhedron3D::from_primitive(
+    primal::Octahedron<double, 3>(Point3D {1., 0., 0.},
+                                  Point3D {0., 1., 0.},
+                                  Point3D {0., 0., 1.},
+                                  Point3D {-1., 0., 0.},
+                                  Point3D {0., -1., 0.},
+                                  Point3D {0., 0., -1.}),
+    false);
+  const Polyhedron3D hex = Polyhedron3D::from_primitive(
+    primal::Hexahedron<double, 3>(Point3D {-1., -1., -1.},
+                                  Point3D {1., -1., -1.},
+                                  Point3D {1., 1., -1.},
+                                  Point3D {-1., 1., -1.},
+                                  Point3D {-1., -1., 1.},
+                                  Point3D {1., -1., 1.},
+                                  Point3D {1., 1., 1.},
+                                  Point3D {-1., 1., 1.}),
+    false);
+
+  const auto queries = make_query_points<3>(500, -2., 2.);
+  for(const Polyhedron3D* poly : {&oct, &hex})
+  {
+    quest::FastWindingNumber<3> fwn(*poly, 4.);
+    for(const auto& q : queries)
+    {
+      const int expected = primal::winding_number(q, *poly);
+      EXPECT_NEAR(expected, fwn.computeWindingNumber(q), 0.05) << q;
+    }
+  }
+  EXPECT_EQ(8, quest::FastWindingNumber<3>(oct).getNumElements());
+  EXPECT_EQ(12, quest::FastWindingNumber<3>(hex).getNumElements());
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+
+  axom::slic::SimpleLogger logger;
+
+  return RUN_ALL_TESTS();
+}
@@ -35,6 +35,7 @@ using BlockIndex = Octree3D::BlockIndex;
 
 #include <cstdlib>
 #include <limits>
+#include <sstream>
 
 // Uncomment the line below for true randomized points
 #ifndef INOUT_OCTREE_TESTER_SHOULD_SEED
@@ -240,6 +241,187 @@ TEST(quest_inout_octree, tetrahedron_mesh)
   }
 }
 
+/// Generates \a numPts random points in the box [-1.1,1.1]^3
+axom::Array<SpacePt> generateQueryPoints(int numPts)
+{
+  axom::Array<SpacePt> pts(numPts, numPts);
+  for(auto& pt : pts)
+  {
+    pt = axom::quest::utilities::randomSpacePt<DIM>(-1.1, 1.1);
+  }
+  return pts;
+}
+
+/**
+ * Builds an InOutOctree over an octahedron mesh in the execution space
+ * \a ExecSpace and runs batched containment queries at the points \a pts
+ */
+template <typename ExecSpace>
+axom::Array<bool> queryBatchedOctahedronMesh(const axom::Array<SpacePt>& pts)
+{
+  axom::mint::Mesh* mesh = axom::quest::utilities::make_octahedron_mesh();
+
+  // Use a bounding box that is not aligned with the mesh
+  GeometricBoundingBox bbox(SpacePt(-2.), SpacePt(2.));
+  bbox.shift(SpaceVector(0.01));
+
+  Octree3D octree(bbox, mesh);
+  octree.generateIndex<ExecSpace>();
+
+  const axom::IndexType numPts = pts.size();
+  axom::Array<bool> results(numPts, numPts);
+  octree.within<ExecSpace>(pts.view(), results.view());
+
+  // Compare to the single point query and to the octahedron,
+  // i.e. the unit sphere under the L1 metric
+  for(axom::IndexType i = 0; i < numPts; ++i)
+  {
+    const SpacePt& pt = pts[i];
+    EXPECT_EQ(octree.within(pt), results[i]) << "Point " << pt;
+
+    double absCoordSum = std::abs(pt[0]) + std::abs(pt[1]) + std::abs(pt[2]);
+    if(!axom::utilities::isNearlyEqual(absCoordSum, 1.))
+    {
+      EXPECT_EQ(absCoordSum < 1., results[i]) << "Point " << pt;
+    }
+  }
+
+  delete mesh;
+  return results;
+}
+
+TEST(quest_inout_octree, batched_queries_sequential)
+{
+  SLIC_INFO("*** Tests batched InOutOctree queries on an octahedron mesh.\n");
+
+  axom::Array<SpacePt> pts = generateQueryPoints(NUM_PT_TESTS / 10);
+  queryBatchedOctahedronMesh<axom::SEQ_EXEC>(pts);
+}
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+TEST(quest_inout_octree, batched_queries_omp)
+{
+  SLIC_INFO("*** Tests InOutOctree built and queried with OpenMP "
+            "against the sequential InOutOctree.\n");
+
+  axom::Array<SpacePt> pts = generateQueryPoints(NUM_PT_TESTS / 10);
+  axom::Array<bool> seqResults =
+    queryBatchedOctahedronMesh<axom::SEQ_EXEC>(pts);
+  axom::Array<bool> ompResults =
+    queryBatchedOctahedronMesh<axom::OMP_EXEC>(pts);
+
+  for(axom::IndexType i = 0; i < pts.size(); ++i)
+  {
+    EXPECT_EQ(seqResults[i], ompResults[i]) << "Point " << pts[i];
+  }
+}
+#endif
+
+TEST(quest_inout_octree, forced_vertex_welds)
+{
+  SLIC_INFO("*** Tests that vertices closer than the finest octree blocks "
+            "are welded with a warning.\n");
+
+  namespace slic = axom::slic;
+
+  // Log the warnings to a stream
+  static std::ostringstream warnings;
+  static bool addedStream = false;
+  if(!addedStream)
+  {
+    slic::addStreamToMsgLevel(
+      new slic::GenericOutputStream(&warnings, "<MESSAGE>\n"),
+      slic::message::Warning);
+    addedStream = true;
+  }
+
+  // An octahedron with an extra vertex that is farther than the weld
+  // threshold from the top vertex, but too close to it to be separated
+  using UMesh = axom::mint::UnstructuredMesh<axom::mint::SINGLE_SHAPE>;
+  axom::mint::Mesh* mesh = axom::quest::utilities::make_octahedron_mesh();
+  static_cast<UMesh*>(mesh)->appendNode(1e-20, 0., 1.);
+
+  GeometricBoundingBox bbox(SpacePt(-2.), SpacePt(2.));
+  Octree3D octree(bbox, mesh);
+  octree.setVertexWeldThreshold(1e-30);
+
+  warnings.str("");
+  octree.generateIndex();
+  slic::flushStreams();
+
+  EXPECT_NE(std::string::npos,
+            warnings.str().find("InOutOctree: 1 vertices are farther than the "
+                                "vertex weld threshold"))
+    << warnings.str();
+
+  EXPECT_TRUE(octree.within(SpacePt(0.1)));
+  EXPECT_FALSE(octree.within(SpacePt(0.9)));
+
+  delete mesh;
+}
+
+TEST(quest_inout_octree, frozen_octree)
+{
+  SLIC_INFO("*** Tests queries on a frozen InOutOctree.\n");
+
+  axom::mint::Mesh* mesh = axom::quest::utilities::make_octahedron_mesh();
+
+  GeometricBoundingBox bbox(SpacePt(-2.), SpacePt(2.));
+  bbox.shift(SpaceVector(0.01));
+
+  Octree3D octree(bbox, mesh);
+  octree.generateIndex();
+
+  axom::Array<SpacePt> pts = generateQueryPoints(NUM_PT_TESTS / 10);
+  const axom::IndexType numPts = pts.size();
+  axom::Array<bool> expected(numPts, numPts);
+  octree.within(pts.view(), expected.view());
+
+  EXPECT_FALSE(octree.isFrozen());
+  EXPECT_TRUE(octree.freeze());
+  EXPECT_TRUE(octree.isFrozen());
+
+  // The frozen octree holds the leaves of the octree
+  const auto& frozen = octree.getFrozenOctree();
+  EXPECT_GT(frozen.numGrayLeaves(), 0);
+  EXPECT_GT(frozen.numLeaves(), frozen.numGrayLeaves());
+  for(axom::IndexType i = 1; i < frozen.numLeaves(); ++i)
+  {
+    EXPECT_LT(frozen.mortonIndices()[i - 1], frozen.mortonIndices()[i]);
+  }
+
+  // Queries on the frozen octree find the same leaves and give the same
+  // answers as on the octree
+  axom::Array<bool> results(numPts, numPts);
+  octree.within(pts.view(), results.view());
+  for(axom::IndexType i = 0; i < numPts; ++i)
+  {
+    EXPECT_EQ(expected[i], results[i]) << "Point " << pts[i];
+
+    if(octree.boundingBox().contains(pts[i]))
+    {
+      const BlockIndex leafBlk = octree.findLeafBlock(pts[i]);
+      const axom::IndexType leaf = frozen.findLeaf(
+        octree.findGridCellAtLevel(pts[i], frozen.maxLevel()));
+      EXPECT_EQ(leafBlk, frozen.leafBlock(leaf));
+      EXPECT_EQ(octree[leafBlk].color(), frozen.leafColor(leaf));
+    }
+  }
+
+  // The frozen octree can be copied to another allocator
+  Octree3D::FrozenOctreeType frozenCopy(frozen, axom::getDefaultAllocatorID());
+  EXPECT_EQ(frozen.numLeaves(), frozenCopy.numLeaves());
+  EXPECT_EQ(frozen.numGrayLeaves(), frozenCopy.numGrayLeaves());
+  EXPECT_EQ(frozen.memoryFootprint(), frozenCopy.memoryFootprint());
+  for(axom::IndexType i = 0; i < frozen.numLeaves(); ++i)
+  {
+    EXPECT_EQ(frozen.mortonIndices()[i], frozenCopy.mortonIndices()[i]);
+    EXPECT_EQ(frozen.leafData()[i], frozenCopy.leafData()[i]);
+  }
+
+  delete mesh;
+}
+
 //----------------------------------------------------------------------
 
 int main(int argc, char* argv[])
@@ -192,6 +192,24 @@ TEST(quest_inout_quadtree, circle_mesh)
         100. * (static_cast<double>(outsideCount) / NUM_PT_TESTS),
         100. * (static_cast<double>(uncertainCount) / NUM_PT_TESTS)));
 
+      // Queries on the frozen quadtree give the same answers
+      EXPECT_TRUE(octree.freeze());
+      EXPECT_TRUE(octree.within(queryInside));
+      EXPECT_FALSE(octree.within(queryOutside));
+      for(int i = 0; i < NUM_PT_TESTS / 10; ++i)
+      {
+        SpacePt queryPt = quest::utilities::randomSpacePt<2>(0, 1.25 * radius);
+        const double mag = SpaceVector(queryPt).norm();
+        if(mag < innerConfidence)
+        {
+          EXPECT_TRUE(octree.within(queryPt)) << "Query point: " << queryPt;
+        }
+        else if(mag > outerConfidence)
+        {
+          EXPECT_FALSE(octree.within(queryPt)) << "Query point: " << queryPt;
+        }
+      }
+
       delete mesh;
     }
   }
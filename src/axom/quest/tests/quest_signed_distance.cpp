@@ -20,6 +20,7 @@
 
 // C/C++ includes
 #include <cmath>
+#include <vector>
 
 // Aliases
 namespace mint = axom::mint;
@@ -172,6 +173,73 @@ TEST(quest_signed_distance, sphere_test)
   SLIC_INFO("Done.");
 }
 
+//------------------------------------------------------------------------------
+TEST(quest_signed_distance, moving_sphere_test)
+{
+  constexpr double SPHERE_RADIUS = 0.5;
+  constexpr int SPHERE_THETA_RES = 25;
+  constexpr int SPHERE_PHI_RES = 25;
+  const double SPHERE_CENTER[3] = {0.0, 0.0, 0.0};
+  const double SHIFT[3] = {0.25, -0.125, 0.5};
+
+  SLIC_INFO("Constructing sphere mesh...");
+  UMesh* surface_mesh = new UMesh(3, mint::TRIANGLE);
+  quest::utilities::getSphereSurfaceMesh(surface_mesh,
+                                         SPHERE_CENTER,
+                                         SPHERE_RADIUS,
+                                         SPHERE_THETA_RES,
+                                         SPHERE_PHI_RES);
+
+  mint::UniformMesh* umesh = nullptr;
+  getUniformMesh(surface_mesh, umesh);
+  const int nnodes = umesh->getNumberOfNodes();
+
+  constexpr bool is_watertight = true;
+  constexpr bool compute_signs = true;
+  axom::quest::SignedDistance<3> signed_distance(surface_mesh,
+                                                 is_watertight,
+                                                 compute_signs);
+
+  // supplying the same mesh again keeps the hierarchy of the BVH, which is
+  // refitted when the mesh is supplied a third time
+  SLIC_INFO("Moving sphere mesh...");
+  const axom::IndexType nsurface_nodes = surface_mesh->getNumberOfNodes();
+  for(int step = 0; step < 2; ++step)
+  {
+    for(int dim = 0; dim < 3; ++dim)
+    {
+      double* coords = surface_mesh->getCoordinateArray(dim);
+      for(axom::IndexType inode = 0; inode < nsurface_nodes; ++inode)
+      {
+        coords[inode] += SHIFT[dim];
+      }
+    }
+
+    EXPECT_TRUE(signed_distance.setMesh(surface_mesh));
+  }
+  EXPECT_TRUE(signed_distance.getBVHTree().isRefittable());
+
+  // compare against a signed distance query built from scratch
+  axom::quest::SignedDistance<3> expected_distance(surface_mesh,
+                                                   is_watertight,
+                                                   compute_signs);
+  const double CENTER[3] = {2 * SHIFT[0], 2 * SHIFT[1], 2 * SHIFT[2]};
+  primal::Sphere<double, 3> analytic_sphere(CENTER, SPHERE_RADIUS);
+
+  for(int inode = 0; inode < nnodes; ++inode)
+  {
+    primal::Point<double, 3> pt;
+    umesh->getNode(inode, pt.data());
+
+    const double phi = signed_distance.computeDistance(pt);
+    EXPECT_NEAR(expected_distance.computeDistance(pt), phi, 1.e-12);
+    EXPECT_NEAR(analytic_sphere.computeSignedDistance(pt), phi, 1.e-2);
+  }
+
+  delete surface_mesh;
+  delete umesh;
+}
+
 //------------------------------------------------------------------------------
 TEST(quest_signed_distance, sphere_test_with_normals)
 {
@@ -446,6 +514,257 @@ TEST(quest_signed_distance, sphere_vec_omp_test)
 }
 #endif  // AXOM_USE_OPENMP
 
+//------------------------------------------------------------------------------
+TEST(quest_signed_distance, sphere_test_closest_cells_and_narrow_band)
+{
+  using PointType = primal::Point<double, 3>;
+  using VectorType = primal::Vector<double, 3>;
+  using TriangleType = primal::Triangle<double, 3>;
+  using ZipPoint = primal::ZipIndexable<PointType>;
+
+  constexpr double SPHERE_RADIUS = 0.5;
+  constexpr int SPHERE_THETA_RES = 25;
+  constexpr int SPHERE_PHI_RES = 25;
+  const double SPHERE_CENTER[3] = {0.0, 0.0, 0.0};
+  constexpr double NARROW_BAND = 0.1;
+
+  SLIC_INFO("Constructing sphere mesh...");
+  UMesh* surface_mesh = new UMesh(3, mint::TRIANGLE);
+  quest::utilities::getSphereSurfaceMesh(surface_mesh,
+                                         SPHERE_CENTER,
+                                         SPHERE_RADIUS,
+                                         SPHERE_THETA_RES,
+                                         SPHERE_PHI_RES);
+
+  SLIC_INFO("Generating uniform mesh...");
+  mint::UniformMesh* umesh = nullptr;
+  getUniformMesh(surface_mesh, umesh);
+  const int nnodes = umesh->getNumberOfNodes();
+
+  // store the query points as interleaved coordinates
+  std::vector<double> xyz(3 * nnodes);
+  for(int inode = 0; inode < nnodes; ++inode)
+  {
+    umesh->getNode(inode, &xyz[3 * inode]);
+  }
+  ZipPoint queryPts({xyz.data(), xyz.data() + 1, xyz.data() + 2}, 3);
+
+  constexpr bool is_watertight = true;
+  constexpr bool compute_signs = true;
+  quest::SignedDistance<3> signed_distance(surface_mesh,
+                                           is_watertight,
+                                           compute_signs);
+  EXPECT_FALSE(signed_distance.hasNarrowBand());
+
+  std::vector<double> phi(nnodes);
+  std::vector<PointType> cp(nnodes);
+  std::vector<VectorType> normals(nnodes);
+  std::vector<axom::IndexType> cells(nnodes);
+
+  SLIC_INFO("Compute signed distance with all the outputs...");
+  signed_distance.computeDistances(nnodes,
+                                   queryPts,
+                                   phi.data(),
+                                   cp.data(),
+                                   normals.data(),
+                                   cells.data());
+
+  for(int inode = 0; inode < nnodes; ++inode)
+  {
+    const PointType pt = queryPts[inode];
+
+    // the batched query matches the single point query
+    PointType expected_cp;
+    VectorType expected_normal;
+    const double expected_phi =
+      signed_distance.computeDistance(pt, expected_cp, expected_normal);
+    EXPECT_DOUBLE_EQ(expected_phi, phi[inode]);
+    EXPECT_EQ(expected_cp, cp[inode]);
+    EXPECT_EQ(expected_normal, normals[inode]);
+
+    // the closest point lies on the closest cell
+    ASSERT_GE(cells[inode], 0);
+    ASSERT_LT(cells[inode], surface_mesh->getNumberOfCells());
+    const axom::IndexType* cell = surface_mesh->getCellNodeIDs(cells[inode]);
+    TriangleType tri;
+    for(int i = 0; i < 3; ++i)
+    {
+      surface_mesh->getNode(cell[i], tri[i].data());
+    }
+    EXPECT_NEAR(phi[inode] * phi[inode],
+                primal::squared_distance(pt, tri),
+                1e-8);
+  }
+
+  SLIC_INFO("Compute signed distance in a narrow band...");
+  signed_distance.setNarrowBand(NARROW_BAND);
+  EXPECT_TRUE(signed_distance.hasNarrowBand());
+  EXPECT_EQ(NARROW_BAND, signed_distance.getNarrowBand());
+
+  std::vector<double> band_phi(nnodes);
+  std::vector<axom::IndexType> band_cells(nnodes);
+  signed_distance.computeDistances(nnodes,
+                                   queryPts,
+                                   band_phi.data(),
+                                   nullptr,
+                                   nullptr,
+                                   band_cells.data());
+
+  int numInBand = 0;
+  int numInsideBand = 0;
+  for(int inode = 0; inode < nnodes; ++inode)
+  {
+    if(std::fabs(phi[inode]) < NARROW_BAND)
+    {
+      ++numInBand;
+      EXPECT_DOUBLE_EQ(phi[inode], band_phi[inode]);
+      EXPECT_EQ(cells[inode], band_cells[inode]);
+    }
+    else
+    {
+      // points deep inside the sphere keep their sign
+      const bool inside = phi[inode] < 0.;
+      numInsideBand += inside ? 1 : 0;
+      EXPECT_EQ(inside ? -NARROW_BAND : NARROW_BAND, band_phi[inode]);
+      EXPECT_EQ(-1, band_cells[inode]);
+    }
+  }
+  EXPECT_GT(numInBand, 0);
+  EXPECT_LT(numInBand, nnodes);
+  EXPECT_GT(numInsideBand, 0);
+
+  signed_distance.clearNarrowBand();
+  EXPECT_FALSE(signed_distance.hasNarrowBand());
+
+  delete surface_mesh;
+  delete umesh;
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_signed_distance, sphere_test_serialized_bvh)
+{
+  constexpr double SPHERE_RADIUS = 0.5;
+  constexpr int SPHERE_THETA_RES = 25;
+  constexpr int SPHERE_PHI_RES = 25;
+  const double SPHERE_CENTER[3] = {0.0, 0.0, 0.0};
+
+  SLIC_INFO("Constructing sphere mesh...");
+  UMesh* surface_mesh = new UMesh(3, mint::TRIANGLE);
+  quest::utilities::getSphereSurfaceMesh(surface_mesh,
+                                         SPHERE_CENTER,
+                                         SPHERE_RADIUS,
+                                         SPHERE_THETA_RES,
+                                         SPHERE_PHI_RES);
+
+  SLIC_INFO("Generating uniform mesh...");
+  mint::UniformMesh* umesh = nullptr;
+  getUniformMesh(surface_mesh, umesh);
+  const int nnodes = umesh->getNumberOfNodes();
+
+  constexpr bool is_watertight = true;
+  quest::SignedDistance<3> signed_distance(surface_mesh, is_watertight);
+
+  // the BVH of a query can be shared with other queries, e.g., through a
+  // segment of shared memory, which they access in place
+  const auto& bvh = signed_distance.getBVHTree();
+  std::vector<char> buffer(bvh.getSerializedSize());
+  bvh.serialize(buffer.data());
+
+  quest::SignedDistance<3> attached(surface_mesh,
+                                    buffer.data(),
+                                    buffer.size(),
+                                    is_watertight);
+  EXPECT_EQ(bvh.getBounds(), attached.getBVHTree().getBounds());
+
+  for(int inode = 0; inode < nnodes; ++inode)
+  {
+    double pt[3];
+    umesh->getNode(inode, pt);
+    EXPECT_EQ(signed_distance.computeDistance(pt[0], pt[1], pt[2]),
+              attached.computeDistance(pt[0], pt[1], pt[2]));
+  }
+
+  delete surface_mesh;
+  delete umesh;
+}
+
+//------------------------------------------------------------------------------
+template <axom::spin::BVHType BVHImpl>
+void check_wide_bvh_query()
+{
+  using PointType = primal::Point<double, 3>;
+  using VectorType = primal::Vector<double, 3>;
+
+  constexpr double SPHERE_RADIUS = 0.5;
+  constexpr int SPHERE_THETA_RES = 25;
+  constexpr int SPHERE_PHI_RES = 25;
+  const double SPHERE_CENTER[3] = {0.0, 0.0, 0.0};
+
+  SLIC_INFO("Constructing sphere mesh...");
+  UMesh* surface_mesh = new UMesh(3, mint::TRIANGLE);
+  quest::utilities::getSphereSurfaceMesh(surface_mesh,
+                                         SPHERE_CENTER,
+                                         SPHERE_RADIUS,
+                                         SPHERE_THETA_RES,
+                                         SPHERE_PHI_RES);
+
+  SLIC_INFO("Generating uniform mesh...");
+  mint::UniformMesh* umesh = nullptr;
+  getUniformMesh(surface_mesh, umesh);
+  const int nnodes = umesh->getNumberOfNodes();
+
+  constexpr bool is_watertight = true;
+  constexpr bool compute_signs = true;
+  quest::SignedDistance<3> expected_distance(surface_mesh,
+                                             is_watertight,
+                                             compute_signs);
+  quest::SignedDistance<3, axom::SEQ_EXEC, BVHImpl> signed_distance(
+    surface_mesh,
+    is_watertight,
+    compute_signs);
+
+  for(int inode = 0; inode < nnodes; ++inode)
+  {
+    PointType pt;
+    umesh->getNode(inode, pt.data());
+
+    PointType expected_cp, cp;
+    VectorType expected_normal, normal;
+    const double expected_phi =
+      expected_distance.computeDistance(pt, expected_cp, expected_normal);
+    const double phi = signed_distance.computeDistance(pt, cp, normal);
+
+    EXPECT_NEAR(expected_phi, phi, 1.e-12);
+    for(int dim = 0; dim < 3; ++dim)
+    {
+      EXPECT_NEAR(expected_cp[dim], cp[dim], 1.e-12);
+    }
+  }
+
+  // the hierarchy of a wide BVH is refitted as well
+  EXPECT_TRUE(signed_distance.setMesh(surface_mesh));
+  EXPECT_TRUE(signed_distance.setMesh(surface_mesh));
+  EXPECT_TRUE(signed_distance.getBVHTree().isRefittable());
+  for(int inode = 0; inode < nnodes; ++inode)
+  {
+    PointType pt;
+    umesh->getNode(inode, pt.data());
+    EXPECT_NEAR(expected_distance.computeDistance(pt),
+                signed_distance.computeDistance(pt),
+                1.e-12);
+  }
+
+  delete surface_mesh;
+  delete umesh;
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_signed_distance, sphere_test_wide_bvh)
+{
+  check_wide_bvh_query<axom::spin::BVHType::WideBVH4>();
+  check_wide_bvh_query<axom::spin::BVHType::WideBVH8>();
+}
+
 //------------------------------------------------------------------------------
 #if defined(AXOM_USE_GPU) && defined(AXOM_USE_RAJA)
 TEST(quest_signed_distance, sphere_vec_device_test)
@@ -29,6 +29,7 @@ const char IGNORE_OUTPUT[] = ".*";
 // C/C++ includes
 #include <fstream>
 #include <sstream>
+#include <vector>
 
 // Aliases
 namespace quest = axom::quest;
@@ -331,6 +332,9 @@ TEST(quest_signed_distance_interface_DeathTest, set_params_after_init)
   EXPECT_DEATH_IF_SUPPORTED(quest::signed_distance_set_verbose(true),
                             IGNORE_OUTPUT);
 
+  EXPECT_DEATH_IF_SUPPORTED(quest::signed_distance_use_wide_bvh(true),
+                            IGNORE_OUTPUT);
+
   EXPECT_DEATH_IF_SUPPORTED(
     quest::signed_distance_set_execution_space(quest::SignedDistExec::CPU),
     IGNORE_OUTPUT);
@@ -652,6 +656,135 @@ TEST(quest_signed_distance_interface, analytic_sphere_with_closest_pt_and_normal
   surface_mesh = nullptr;
 }
 
+//------------------------------------------------------------------------------
+TEST(quest_signed_distance_interface, analytic_sphere_batched_interleaved)
+{
+  constexpr int NDIMS = 3;
+  constexpr double SPHERE_RADIUS = 0.5;
+  constexpr int SPHERE_THETA_RES = 25;
+  constexpr int SPHERE_PHI_RES = 25;
+  const double SPHERE_CENTER[3] = {0.0, 0.0, 0.0};
+  constexpr double NARROW_BAND = 0.25;
+
+  using PointType = primal::Point<double, 3>;
+  using VectorType = primal::Vector<double, 3>;
+
+  // STEP 0: generate the sphere mesh and the query points
+  UnstructuredMesh* surface_mesh = new UnstructuredMesh(NDIMS, mint::TRIANGLE);
+  quest::utilities::getSphereSurfaceMesh(surface_mesh,
+                                         SPHERE_CENTER,
+                                         SPHERE_RADIUS,
+                                         SPHERE_THETA_RES,
+                                         SPHERE_PHI_RES);
+
+  mint::UniformMesh* umesh = nullptr;
+  getUniformMesh(surface_mesh, umesh);
+  const int nnodes = static_cast<int>(umesh->getNumberOfNodes());
+
+  // the query points are stored as x0, y0, z0, x1, y1, z1, ...
+  std::vector<double> xyz(3 * nnodes);
+  for(int inode = 0; inode < nnodes; ++inode)
+  {
+    umesh->getNode(inode, &xyz[3 * inode]);
+  }
+
+  // STEP 1: evaluate the signed distance at all the points in one call
+  quest::signed_distance_set_closed_surface(true);
+  quest::signed_distance_init(surface_mesh);
+  EXPECT_TRUE(quest::signed_distance_initialized());
+
+  std::vector<double> phi(nnodes);
+  std::vector<double> cp(3 * nnodes);
+  std::vector<double> normals(3 * nnodes);
+  std::vector<axom::IndexType> cells(nnodes);
+  quest::signed_distance_evaluate(&xyz[0],
+                                  &xyz[1],
+                                  &xyz[2],
+                                  nnodes,
+                                  3,
+                                  phi.data(),
+                                  cp.data(),
+                                  normals.data(),
+                                  cells.data());
+
+  for(int inode = 0; inode < nnodes; ++inode)
+  {
+    PointType closest_point;
+    VectorType normal;
+    const double expected_phi =
+      quest::signed_distance_evaluate(xyz[3 * inode],
+                                      xyz[3 * inode + 1],
+                                      xyz[3 * inode + 2],
+                                      closest_point[0],
+                                      closest_point[1],
+                                      closest_point[2],
+                                      normal[0],
+                                      normal[1],
+                                      normal[2]);
+
+    EXPECT_DOUBLE_EQ(expected_phi, phi[inode]);
+    EXPECT_EQ(closest_point, PointType(&cp[3 * inode]));
+    EXPECT_EQ(normal, VectorType(&normals[3 * inode]));
+    EXPECT_GE(cells[inode], 0);
+  }
+
+  quest::signed_distance_finalize();
+  EXPECT_FALSE(quest::signed_distance_initialized());
+
+  // STEP 2: evaluate the signed distance in a narrow band around the sphere
+  quest::signed_distance_set_narrow_band(NARROW_BAND);
+  quest::signed_distance_init(surface_mesh);
+
+  std::vector<double> band_phi(nnodes);
+  quest::signed_distance_evaluate(&xyz[0],
+                                  &xyz[1],
+                                  &xyz[2],
+                                  nnodes,
+                                  3,
+                                  band_phi.data());
+
+  for(int inode = 0; inode < nnodes; ++inode)
+  {
+    const double expected_phi =
+      std::fabs(phi[inode]) < NARROW_BAND ? phi[inode] : NARROW_BAND;
+    EXPECT_DOUBLE_EQ(expected_phi, band_phi[inode]);
+  }
+
+  quest::signed_distance_finalize();
+  quest::signed_distance_set_narrow_band(-1.);
+
+  // STEP 3: evaluate the signed distance with a wide BVH
+  quest::signed_distance_use_wide_bvh(true);
+  quest::signed_distance_init(surface_mesh);
+  EXPECT_TRUE(quest::signed_distance_initialized());
+
+  std::vector<double> wide_phi(nnodes);
+  std::vector<double> wide_cp(3 * nnodes);
+  quest::signed_distance_evaluate(&xyz[0],
+                                  &xyz[1],
+                                  &xyz[2],
+                                  nnodes,
+                                  3,
+                                  wide_phi.data(),
+                                  wide_cp.data());
+
+  for(int inode = 0; inode < nnodes; ++inode)
+  {
+    EXPECT_NEAR(phi[inode], wide_phi[inode], 1.e-12);
+    for(int dim = 0; dim < 3; ++dim)
+    {
+      EXPECT_NEAR(cp[3 * inode + dim], wide_cp[3 * inode + dim], 1.e-12);
+    }
+  }
+
+  quest::signed_distance_finalize();
+  EXPECT_FALSE(quest::signed_distance_initialized());
+  quest::signed_distance_use_wide_bvh(false);
+
+  delete umesh;
+  delete surface_mesh;
+}
+
 //------------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
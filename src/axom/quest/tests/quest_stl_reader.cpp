@@ -7,6 +7,9 @@
 #include "axom/mint/mesh/UnstructuredMesh.hpp"
 #include "axom/slic.hpp"
 #include "axom/core/NumericLimits.hpp"
+#include "axom/core/utilities/Utilities.hpp"
+
+#include "quest_stl_test_utilities.hpp"
 
 // gtest includes
 #include "gtest/gtest.h"
@@ -15,6 +18,7 @@
 #include <cstdio>
 #include <string>
 #include <fstream>
+#include <vector>
 
 // namespace aliases
 namespace mint = axom::mint;
@@ -50,6 +54,36 @@ void generate_stl_file(const std::string& file)
   ofs.close();
 }
 
+/*!
+ * \brief Checks that the mesh holds the given triangles
+ *
+ * \note The coordinates are compared in single precision, since the
+ *  coordinates of an ascii file are parsed from their decimal representation
+ */
+void check_triangles(const mint::UnstructuredMesh<mint::SINGLE_SHAPE>& mesh,
+                     const std::vector<float>& coords)
+{
+  const axom::IndexType numTris =
+    static_cast<axom::IndexType>(coords.size()) / 9;
+  ASSERT_EQ(mesh.getNumberOfCells(), numTris);
+
+  const double* x = mesh.getCoordinateArray(mint::X_COORDINATE);
+  const double* y = mesh.getCoordinateArray(mint::Y_COORDINATE);
+  const double* z = mesh.getCoordinateArray(mint::Z_COORDINATE);
+
+  for(axom::IndexType t = 0; t < numTris; ++t)
+  {
+    const axom::IndexType* nodes = mesh.getCellNodeIDs(t);
+    for(int v = 0; v < 3; ++v)
+    {
+      const float* pt = &coords[9 * t + 3 * v];
+      EXPECT_EQ(static_cast<float>(x[nodes[v]]), pt[0]);
+      EXPECT_EQ(static_cast<float>(y[nodes[v]]), pt[1]);
+      EXPECT_EQ(static_cast<float>(z[nodes[v]]), pt[2]);
+    }
+  }
+}
+
 } /* end anonymous namespace */
 
 //------------------------------------------------------------------------------
@@ -205,6 +239,120 @@ TEST(quest_stl_reader, read_stl_external)
   axom::utilities::filesystem::removeFile(filename);
 }
 
+//------------------------------------------------------------------------------
+TEST(quest_stl_reader, read_and_weld_stl)
+{
+  // The ascii file spans several of the chunks that are parsed in parallel
+  constexpr int N = 100;
+  const std::vector<float> coords =
+    quest::utilities::generate_grid_triangles(N);
+  const axom::IndexType numTris = 2 * N * N;
+  const axom::IndexType numUniqueVerts = (N + 1) * (N + 1);
+
+  const std::string ascii_filename = "grid_ascii.stl";
+  const std::string binary_filename = "grid_binary.stl";
+  quest::utilities::write_ascii_stl_file(ascii_filename, coords);
+  quest::utilities::write_binary_stl_file(binary_filename, coords);
+
+  for(const std::string& filename : {ascii_filename, binary_filename})
+  {
+    SCOPED_TRACE(filename);
+
+    // read the soup of triangles
+    quest::STLReader reader;
+    reader.setFileName(filename);
+    EXPECT_FALSE(reader.getWeldVertices());
+    EXPECT_EQ(reader.read(), 0);
+    EXPECT_EQ(reader.getNumFaces(), numTris);
+    EXPECT_EQ(reader.getNumNodes(), 3 * numTris);
+
+    mint::UnstructuredMesh<mint::SINGLE_SHAPE> soup(3, mint::TRIANGLE);
+    reader.getMesh(&soup);
+    EXPECT_EQ(soup.getNumberOfNodes(), 3 * numTris);
+    check_triangles(soup, coords);
+
+    // read the indexed mesh
+    reader.setWeldVertices(true);
+    EXPECT_EQ(reader.read(), 0);
+    EXPECT_EQ(reader.getNumFaces(), numTris);
+    EXPECT_EQ(reader.getNumNodes(), numUniqueVerts);
+
+    mint::UnstructuredMesh<mint::SINGLE_SHAPE> mesh(3, mint::TRIANGLE);
+    reader.getMesh(&mesh);
+    EXPECT_EQ(mesh.getNumberOfNodes(), numUniqueVerts);
+    check_triangles(mesh, coords);
+
+    // the nodes are numbered in the order of their first occurrence
+    const double* x = mesh.getCoordinateArray(mint::X_COORDINATE);
+    const double* y = mesh.getCoordinateArray(mint::Y_COORDINATE);
+    EXPECT_EQ(mesh.getCellNodeIDs(0)[0], 0);
+    EXPECT_EQ(mesh.getCellNodeIDs(0)[1], 1);
+    EXPECT_EQ(mesh.getCellNodeIDs(0)[2], 2);
+    EXPECT_EQ(mesh.getCellNodeIDs(1)[0], 0);
+    EXPECT_EQ(mesh.getCellNodeIDs(1)[1], 2);
+    EXPECT_EQ(mesh.getCellNodeIDs(1)[2], 3);
+    EXPECT_EQ(x[3], 0.);
+    EXPECT_EQ(static_cast<float>(y[3]), 1.f / N);
+
+    axom::utilities::filesystem::removeFile(filename);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_stl_reader, weld_signed_zeros)
+{
+  const std::string filename = "signed_zeros.stl";
+
+  std::ofstream ofs(filename.c_str());
+  ofs << "solid zeros\n"
+      << " facet normal 0 0 1\n  outer loop\n"
+      << "   vertex 0.0 0.0 0.0\n   vertex 1.0 0.0 0.0\n"
+      << "   vertex 0.0 1.0 0.0\n"
+      << "  endloop\n endfacet\n"
+      << " facet normal 0 0 1\n  outer loop\n"
+      << "   vertex -0.0 0.0 -0.0\n   vertex 0.0 -1.0 0.0\n"
+      << "   vertex 1.0 0.0 0.0\n"
+      << "  endloop\n endfacet\n"
+      << "endsolid zeros\n";
+  ofs.close();
+
+  quest::STLReader reader;
+  reader.setFileName(filename);
+  reader.setWeldVertices(true);
+  EXPECT_EQ(reader.read(), 0);
+  EXPECT_EQ(reader.getNumFaces(), 2);
+  EXPECT_EQ(reader.getNumNodes(), 4);
+
+  mint::UnstructuredMesh<mint::SINGLE_SHAPE> mesh(3, mint::TRIANGLE);
+  reader.getMesh(&mesh);
+  EXPECT_EQ(mesh.getCellNodeIDs(1)[0], 0);
+  EXPECT_EQ(mesh.getCellNodeIDs(1)[1], 3);
+  EXPECT_EQ(mesh.getCellNodeIDs(1)[2], 1);
+
+  axom::utilities::filesystem::removeFile(filename);
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_stl_reader, read_invalid_ascii_vertex)
+{
+  const std::string filename = "invalid_vertex.stl";
+
+  std::ofstream ofs(filename.c_str());
+  ofs << "solid invalid\n"
+      << " facet normal 0 0 1\n  outer loop\n"
+      << "   vertex 0.0 0.0 0.0\n   vertex 1.0 zero 0.0\n"
+      << "   vertex 0.0 1.0 0.0\n"
+      << "  endloop\n endfacet\n"
+      << "endsolid invalid\n";
+  ofs.close();
+
+  quest::STLReader reader;
+  reader.setFileName(filename);
+  EXPECT_NE(reader.read(), 0);
+
+  axom::utilities::filesystem::removeFile(filename);
+}
+
 //------------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
@@ -0,0 +1,270 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"
+
+#include "axom/core/utilities/FileUtilities.hpp"
+#include "axom/core/utilities/Utilities.hpp"
+#include "axom/mint/mesh/UnstructuredMesh.hpp"
+#include "axom/slic.hpp"
+
+#include "axom/quest/readers/PSTLReader.hpp"
+
+#include "quest_stl_test_utilities.hpp"
+
+#include "gtest/gtest.h"
+
+#include "mpi.h"
+
+// C/C++ includes
+#include <string>
+#include <vector>
+
+// namespace aliases
+namespace mint = axom::mint;
+namespace quest = axom::quest;
+
+//------------------------------------------------------------------------------
+// HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+/*!
+ * \brief Checks that the triangles of the local mesh of each rank are the
+ *  triangles of the file with the given global ids, and that every triangle
+ *  of the file is held by exactly one rank.
+ */
+void check_partitioned_triangles(
+  const mint::UnstructuredMesh<mint::SINGLE_SHAPE>& mesh,
+  const std::vector<axom::IndexType>& faceIds,
+  const std::vector<float>& coords)
+{
+  const axom::IndexType numTris =
+    static_cast<axom::IndexType>(coords.size()) / 9;
+  const axom::IndexType numLocal = mesh.getNumberOfCells();
+  ASSERT_EQ(static_cast<axom::IndexType>(faceIds.size()), numLocal);
+
+  const double* x = mesh.getCoordinateArray(mint::X_COORDINATE);
+  const double* y = mesh.getCoordinateArray(mint::Y_COORDINATE);
+  const double* z = mesh.getCoordinateArray(mint::Z_COORDINATE);
+
+  std::vector<int> owners(numTris, 0);
+  for(axom::IndexType t = 0; t < numLocal; ++t)
+  {
+    const axom::IndexType id = faceIds[t];
+    ASSERT_TRUE(id >= 0 && id < numTris);
+    owners[id] += 1;
+
+    const axom::IndexType* nodes = mesh.getCellNodeIDs(t);
+    for(int v = 0; v < 3; ++v)
+    {
+      const float* pt = &coords[9 * id + 3 * v];
+      EXPECT_EQ(static_cast<float>(x[nodes[v]]), pt[0]);
+      EXPECT_EQ(static_cast<float>(y[nodes[v]]), pt[1]);
+      EXPECT_EQ(static_cast<float>(z[nodes[v]]), pt[2]);
+    }
+  }
+
+  MPI_Allreduce(MPI_IN_PLACE,
+                owners.data(),
+                numTris,
+                MPI_INT,
+                MPI_SUM,
+                MPI_COMM_WORLD);
+  for(axom::IndexType id = 0; id < numTris; ++id)
+  {
+    EXPECT_EQ(owners[id], 1);
+  }
+}
+
+} /* end anonymous namespace */
+
+//------------------------------------------------------------------------------
+TEST(quest_stl_reader_parallel, missing_file)
+{
+  for(auto mode : {quest::PSTLReader::ReadMode::BROADCAST,
+                   quest::PSTLReader::ReadMode::PARTITIONED})
+  {
+    quest::PSTLReader reader(MPI_COMM_WORLD);
+    reader.setReadMode(mode);
+    reader.setFileName("foo.stl");
+    EXPECT_EQ(reader.read(), -1);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_stl_reader_parallel, read_broadcast)
+{
+  int rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  constexpr int N = 8;
+  const std::vector<float> coords =
+    quest::utilities::generate_grid_triangles(N);
+  const std::string filename = "pgrid_broadcast.stl";
+  if(rank == 0)
+  {
+    quest::utilities::write_binary_stl_file(filename, coords);
+  }
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  quest::PSTLReader reader(MPI_COMM_WORLD);
+  EXPECT_EQ(reader.getReadMode(), quest::PSTLReader::ReadMode::BROADCAST);
+  reader.setFileName(filename);
+  reader.setWeldVertices(true);
+  EXPECT_EQ(reader.read(), 0);
+
+  // every rank holds the whole mesh
+  EXPECT_EQ(reader.getNumFaces(), 2 * N * N);
+  EXPECT_EQ(reader.getNumNodes(), (N + 1) * (N + 1));
+  EXPECT_TRUE(reader.getGlobalFaceIds().empty());
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  if(rank == 0)
+  {
+    axom::utilities::filesystem::removeFile(filename);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_stl_reader_parallel, read_partitioned)
+{
+  int rank, nranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &nranks);
+
+  constexpr int N = 32;
+  const std::vector<float> coords =
+    quest::utilities::generate_grid_triangles(N);
+  const axom::IndexType numTris = 2 * N * N;
+
+  const std::string ascii_filename = "pgrid_ascii.stl";
+  const std::string binary_filename = "pgrid_binary.stl";
+  if(rank == 0)
+  {
+    quest::utilities::write_ascii_stl_file(ascii_filename, coords);
+    quest::utilities::write_binary_stl_file(binary_filename, coords);
+  }
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  for(const std::string& filename : {ascii_filename, binary_filename})
+  {
+    for(bool weld : {false, true})
+    {
+      SCOPED_TRACE(filename + (weld ? " (welded)" : ""));
+
+      quest::PSTLReader reader(MPI_COMM_WORLD);
+      reader.setReadMode(quest::PSTLReader::ReadMode::PARTITIONED);
+      reader.setWeldVertices(weld);
+      reader.setFileName(filename);
+      ASSERT_EQ(reader.read(), 0);
+
+      // the triangles are balanced among the ranks
+      axom::IndexType numLocal = reader.getNumFaces();
+      axom::IndexType numGlobal = 0;
+      MPI_Allreduce(&numLocal,
+                    &numGlobal,
+                    1,
+                    axom::mpi_traits<axom::IndexType>::type,
+                    MPI_SUM,
+                    MPI_COMM_WORLD);
+      EXPECT_EQ(numGlobal, numTris);
+      EXPECT_GT(numLocal, numTris / (2 * nranks));
+      EXPECT_LT(numLocal, 2 * numTris / nranks);
+
+      mint::UnstructuredMesh<mint::SINGLE_SHAPE> mesh(3, mint::TRIANGLE);
+      reader.getMesh(&mesh);
+      if(!weld)
+      {
+        EXPECT_EQ(mesh.getNumberOfNodes(), 3 * numLocal);
+      }
+      else
+      {
+        EXPECT_LT(mesh.getNumberOfNodes(), 3 * numLocal);
+      }
+      check_partitioned_triangles(mesh, reader.getGlobalFaceIds(), coords);
+    }
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  if(rank == 0)
+  {
+    axom::utilities::filesystem::removeFile(ascii_filename);
+    axom::utilities::filesystem::removeFile(binary_filename);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_stl_reader_parallel, read_partitioned_is_spatially_coherent)
+{
+  int nranks;
+  MPI_Comm_size(MPI_COMM_WORLD, &nranks);
+
+  int rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  constexpr int N = 32;
+  const std::vector<float> coords =
+    quest::utilities::generate_grid_triangles(N);
+  const std::string filename = "pgrid_coherent.stl";
+  if(rank == 0)
+  {
+    quest::utilities::write_binary_stl_file(filename, coords);
+  }
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  quest::PSTLReader reader(MPI_COMM_WORLD);
+  reader.setReadMode(quest::PSTLReader::ReadMode::PARTITIONED);
+  reader.setFileName(filename);
+  ASSERT_EQ(reader.read(), 0);
+
+  mint::UnstructuredMesh<mint::SINGLE_SHAPE> mesh(3, mint::TRIANGLE);
+  reader.getMesh(&mesh);
+
+  // The triangles of the file are ordered row by row, so a contiguous range
+  // of the file spans whole rows of the grid. The triangles of a rank, which
+  // are grouped along a space-filling curve, cover a compact region instead.
+  const double* x = mesh.getCoordinateArray(mint::X_COORDINATE);
+  const double* y = mesh.getCoordinateArray(mint::Y_COORDINATE);
+  double lo[2] = {1., 1.};
+  double hi[2] = {0., 0.};
+  for(axom::IndexType n = 0; n < mesh.getNumberOfNodes(); ++n)
+  {
+    lo[0] = axom::utilities::min(lo[0], x[n]);
+    lo[1] = axom::utilities::min(lo[1], y[n]);
+    hi[0] = axom::utilities::max(hi[0], x[n]);
+    hi[1] = axom::utilities::max(hi[1], y[n]);
+  }
+
+  if(nranks == 4)
+  {
+    EXPECT_NEAR(hi[0] - lo[0], 0.5, 1e-6);
+    EXPECT_NEAR(hi[1] - lo[1], 0.5, 1e-6);
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  if(rank == 0)
+  {
+    axom::utilities::filesystem::removeFile(filename);
+  }
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+  axom::slic::SimpleLogger logger;
+
+  MPI_Init(&argc, &argv);
+
+  // finalized when exiting main scope
+  result = RUN_ALL_TESTS();
+
+  MPI_Finalize();
+
+  return result;
+}
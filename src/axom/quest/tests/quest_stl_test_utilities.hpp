@@ -0,0 +1,126 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef QUEST_STL_TEST_UTILITIES_HPP_
+#define QUEST_STL_TEST_UTILITIES_HPP_
+
+#include "axom/core/utilities/Utilities.hpp"
+
+#include "gtest/gtest.h"
+
+// C/C++ includes
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/*!
+ * \file quest_stl_test_utilities.hpp
+ *
+ * This file contains utility functions shared by the serial and parallel
+ * STL reader tests to generate the triangles of a grid and write them to
+ * ascii and binary STL files.
+ */
+
+namespace axom
+{
+namespace quest
+{
+namespace utilities
+{
+/*!
+ * \brief Returns the vertex coordinates of the triangles of an N x N grid of
+ *  squares on the XY plane, with two triangles per square
+ */
+std::vector<float> generate_grid_triangles(int N)
+{
+  std::vector<float> coords;
+  coords.reserve(2 * N * N * 9);
+
+  auto add_vertex = [&](int i, int j) {
+    coords.push_back(static_cast<float>(i) / N);
+    coords.push_back(static_cast<float>(j) / N);
+    coords.push_back(0.f);
+  };
+
+  for(int i = 0; i < N; ++i)
+  {
+    for(int j = 0; j < N; ++j)
+    {
+      add_vertex(i, j);
+      add_vertex(i + 1, j);
+      add_vertex(i + 1, j + 1);
+
+      add_vertex(i, j);
+      add_vertex(i + 1, j + 1);
+      add_vertex(i, j + 1);
+    }
+  }
+  return coords;
+}
+
+/*!
+ * \brief Writes the given triangles to an ascii STL file
+ * \param [in] file the name of the file to generate.
+ * \param [in] coords the coordinates of the three vertices of each triangle
+ */
+void write_ascii_stl_file(const std::string& file,
+                          const std::vector<float>& coords)
+{
+  std::ofstream ofs(file.c_str());
+  EXPECT_TRUE(ofs.is_open());
+  ofs.precision(9);
+
+  ofs << "solid grid" << std::endl;
+  for(std::size_t t = 0; t < coords.size() / 9; ++t)
+  {
+    ofs << "  facet normal 0 0 1" << std::endl;
+    ofs << "    outer loop" << std::endl;
+    for(int v = 0; v < 3; ++v)
+    {
+      const float* pt = &coords[9 * t + 3 * v];
+      ofs << "      vertex " << pt[0] << " " << pt[1] << " " << pt[2]
+          << std::endl;
+    }
+    ofs << "    endloop" << std::endl;
+    ofs << "  endfacet" << std::endl;
+  }
+  ofs << "endsolid grid" << std::endl;
+}
+
+/*!
+ * \brief Writes the given triangles to a little-endian binary STL file
+ * \param [in] file the name of the file to generate.
+ * \param [in] coords the coordinates of the three vertices of each triangle
+ */
+void write_binary_stl_file(const std::string& file,
+                           const std::vector<float>& coords)
+{
+  ASSERT_TRUE(axom::utilities::isLittleEndian());
+
+  std::ofstream ofs(file.c_str(), std::ios::out | std::ios::binary);
+  EXPECT_TRUE(ofs.is_open());
+
+  const char header[80] = "binary grid";
+  ofs.write(header, sizeof(header));
+
+  const std::uint32_t numTris = static_cast<std::uint32_t>(coords.size() / 9);
+  ofs.write(reinterpret_cast<const char*>(&numTris), sizeof(numTris));
+
+  const float normal[3] = {0.f, 0.f, 1.f};
+  const std::uint16_t attr = 0;
+  for(std::uint32_t t = 0; t < numTris; ++t)
+  {
+    ofs.write(reinterpret_cast<const char*>(normal), sizeof(normal));
+    ofs.write(reinterpret_cast<const char*>(&coords[9 * t]), 9 * sizeof(float));
+    ofs.write(reinterpret_cast<const char*>(&attr), sizeof(attr));
+  }
+}
+
+}  // end namespace utilities
+}  // end namespace quest
+}  // end namespace axom
+
+#endif  // QUEST_STL_TEST_UTILITIES_HPP_
@@ -1893,78 +1893,96 @@ bool Group::save(const std::string& path,
   ConduitErrorSuppressor checkConduitCall(ds);
   bool retval = false;
 
-  if(protocol == "sidre_hdf5")
+  Node n;
+  if(createSaveLayout(n, protocol, attr))
   {
-    Node n;
-    exportTo(n["sidre"], attr);
-    ds->saveAttributeLayout(n["sidre/attribute"]);
-    createExternalLayout(n["sidre/external"], attr);
-    n["sidre_group_name"] = m_name;
-    checkConduitCall([&] { conduit::relay::io::save(n, path, "hdf5"); });
+    const std::string relay_protocol = getSaveRelayProtocol(protocol);
+    checkConduitCall([&] { conduit::relay::io::save(n, path, relay_protocol); });
     retval = !(getDataStore()->getConduitErrorOccurred());
   }
-  else if(protocol == "sidre_conduit_json")
+  else
   {
-    Node n;
-    exportTo(n["sidre"], attr);
-    ds->saveAttributeLayout(n["sidre/attribute"]);
-    createExternalLayout(n["sidre/external"], attr);
-    n["sidre_group_name"] = m_name;
-    checkConduitCall([&] { conduit::relay::io::save(n, path, "conduit_json"); });
-    retval = !(getDataStore()->getConduitErrorOccurred());
+    SLIC_ERROR(SIDRE_GROUP_LOG_PREPEND << "Invalid protocol '" << protocol
+                                       << "' for file save.");
+    retval = false;
   }
-  else if(protocol == "sidre_json")
+
+  return retval;
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to create the Conduit Node written by save()
+ *
+ *************************************************************************
+ */
+bool Group::createSaveLayout(Node& n,
+                             const std::string& protocol,
+                             const Attribute* attr,
+                             bool for_hdf5_handle) const
+{
+  if(protocol == "sidre_hdf5" ||
+     (!for_hdf5_handle &&
+      (protocol == "sidre_conduit_json" || protocol == "sidre_json")))
   {
-    Node n;
     exportTo(n["sidre"], attr);
-    ds->saveAttributeLayout(n["sidre/attribute"]);
+    if(!for_hdf5_handle)
+    {
+      getDataStore()->saveAttributeLayout(n["sidre/attribute"]);
+    }
     createExternalLayout(n["sidre/external"], attr);
-    n["sidre_group_name"] = m_name;
-    checkConduitCall([&] { conduit::relay::io::save(n, path, "json"); });
-    retval = !(getDataStore()->getConduitErrorOccurred());
   }
-  else if(protocol == "sidre_layout_json")
+  else if(!for_hdf5_handle && protocol == "sidre_layout_json")
   {
-    Node n;
     exportWithoutBufferData(n["sidre"], attr);
-    ds->saveAttributeLayout(n["sidre/attribute"]);
-    n["sidre_group_name"] = m_name;
-    checkConduitCall([&] { conduit::relay::io::save(n, path, "conduit_json"); });
-    retval = !(getDataStore()->getConduitErrorOccurred());
-  }
-  else if(protocol == "conduit_hdf5")
-  {
-    Node n;
-    createNativeLayout(n, attr);
-    n["sidre_group_name"] = m_name;
-    checkConduitCall([&] { conduit::relay::io::save(n, path, "hdf5"); });
-    retval = !(getDataStore()->getConduitErrorOccurred());
+    getDataStore()->saveAttributeLayout(n["sidre/attribute"]);
   }
-  else if(protocol == "conduit_bin" || protocol == "conduit_json" ||
-          protocol == "json")
+  else if(protocol == "conduit_hdf5" ||
+          (!for_hdf5_handle &&
+           (protocol == "conduit_bin" || protocol == "conduit_json" ||
+            protocol == "json")))
   {
-    Node n;
     createNativeLayout(n, attr);
-    n["sidre_group_name"] = m_name;
-    checkConduitCall([&] { conduit::relay::io::save(n, path, protocol); });
-    retval = !(getDataStore()->getConduitErrorOccurred());
   }
-  else if(protocol == "conduit_layout_json")
+  else if(!for_hdf5_handle && protocol == "conduit_layout_json")
   {
-    Node n;
     createNoDataLayout(n, attr);
-    n["sidre_group_name"] = m_name;
-    checkConduitCall([&] { conduit::relay::io::save(n, path, "conduit_json"); });
-    retval = !(getDataStore()->getConduitErrorOccurred());
   }
   else
   {
-    SLIC_ERROR(SIDRE_GROUP_LOG_PREPEND << "Invalid protocol '" << protocol
-                                       << "' for file save.");
-    retval = false;
+    return false;
   }
 
-  return retval;
+  n["sidre_group_name"] = m_name;
+  return true;
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to get the Conduit relay protocol used by save()
+ *
+ *************************************************************************
+ */
+std::string Group::getSaveRelayProtocol(const std::string& protocol)
+{
+  if(protocol == "sidre_hdf5" || protocol == "conduit_hdf5")
+  {
+    return "hdf5";
+  }
+  else if(protocol == "sidre_json")
+  {
+    return "json";
+  }
+  else if(protocol == "conduit_bin" || protocol == "conduit_json" ||
+          protocol == "json")
+  {
+    return protocol;
+  }
+
+  // sidre_conduit_json and the layout-only protocols
+  return "conduit_json";
 }
 
 /*************************************************************************/
@@ -2165,20 +2183,9 @@ bool Group::save(const hid_t& h5_id,
   // supported here:
   // "sidre_hdf5"
   // "conduit_hdf5"
-  if(protocol == "sidre_hdf5")
-  {
-    Node n;
-    exportTo(n["sidre"], attr);
-    createExternalLayout(n["sidre/external"], attr);
-    n["sidre_group_name"] = m_name;
-    checkConduitCall([&] { conduit::relay::io::hdf5_write(n, h5_id); });
-    retval = !(getDataStore()->getConduitErrorOccurred());
-  }
-  else if(protocol == "conduit_hdf5")
+  Node n;
+  if(createSaveLayout(n, protocol, attr, true))
   {
-    Node n;
-    createNativeLayout(n, attr);
-    n["sidre_group_name"] = m_name;
     checkConduitCall([&] { conduit::relay::io::hdf5_write(n, h5_id); });
     retval = !(getDataStore()->getConduitErrorOccurred());
   }
@@ -137,6 +137,7 @@ public:
   //
   friend class DataStore;
   friend class View;
+  friend class IOManager;
 
   using ViewCollection = ItemCollection<View>;
   using GroupCollection = ItemCollection<Group>;
@@ -1852,6 +1853,30 @@ private:
    */
   bool exportWithoutBufferData(conduit::Node& result, const Attribute* attr) const;
 
+  /*!
+   * \brief Private method to create the Conduit Node that save() writes
+   *  for the given protocol.
+   *
+   * The Node refers to the data held by the Buffers and external Views
+   * without copying it.
+   *
+   * \param for_hdf5_handle  If true, create the Node written by the hdf5
+   *                         handle overload of save(), which supports only
+   *                         the sidre_hdf5 and conduit_hdf5 protocols.
+   *
+   * \return False if the protocol is not valid for the save, true otherwise.
+   */
+  bool createSaveLayout(Node& n,
+                        const std::string& protocol,
+                        const Attribute* attr,
+                        bool for_hdf5_handle = false) const;
+
+  /*!
+   * \brief Private method to get the Conduit relay protocol that save()
+   *  uses to write a file with the given protocol.
+   */
+  static std::string getSaveRelayProtocol(const std::string& protocol);
+
   /*!
    * \brief Private method to build a Group hierarchy from Conduit Node.
    *
@@ -96,6 +96,12 @@ public:
    */
   int getNumFiles() const { return m_num_files; }
 
+  /*!
+   * \brief Get the id of the local rank's set, which is also the id of the
+   * file the set's ranks interact with.
+   */
+  int getSetId() const { return m_set_id; }
+
 private:
   DISABLE_COPY_AND_ASSIGNMENT(IOBaton);
 
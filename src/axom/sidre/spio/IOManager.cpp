@@ -32,6 +32,15 @@
   #include "scr.h"
 #endif
 
+// C/C++ includes
+#include <algorithm>  // for std::min
+#include <chrono>     // for std::chrono::seconds
+#include <cstdint>    // for std::uint64_t
+#include <cstring>    // for std::memcpy
+#include <exception>  // for std::exception
+#include <limits>     // for std::numeric_limits
+#include <vector>     // for std::vector
+
 namespace
 {
 /*!
@@ -63,6 +72,184 @@ std::string broadcastString(const std::string& str, MPI_Comm comm, int rank)
   return res;
 }
 
+#ifdef AXOM_USE_HDF5
+/*!
+ *  Utility function to close the group and file of a sidre_hdf5 data file
+ */
+void closeHDF5DataFile(hid_t h5_file_id, hid_t h5_group_id)
+{
+  herr_t status;
+  AXOM_UNUSED_VAR(status);
+
+  status = H5Gclose(h5_group_id);
+  SLIC_ASSERT(status >= 0);
+  status = H5Fflush(h5_file_id, H5F_SCOPE_LOCAL);
+  SLIC_ASSERT(status >= 0);
+  status = H5Fclose(h5_file_id);
+  SLIC_ASSERT(status >= 0);
+}
+
+/*!
+ *  Buffer and external View data smaller than this is always written to
+ *  delta checkpoints, since referring to it in the base saves little
+ */
+const conduit::index_t MIN_DELTA_BYTES = 1024;
+
+/*!
+ *  Utility function to get the paths of the numeric leaves of a tree of
+ *  Conduit objects that hold at least min_bytes bytes
+ */
+void getLeafPaths(const conduit::Node& n,
+                  const std::string& path,
+                  conduit::index_t min_bytes,
+                  std::vector<std::string>& paths)
+{
+  if(n.dtype().is_object())
+  {
+    for(conduit::index_t i = 0; i < n.number_of_children(); ++i)
+    {
+      const conduit::Node& child = n.child(i);
+      getLeafPaths(child,
+                   path.empty() ? child.name() : path + "/" + child.name(),
+                   min_bytes,
+                   paths);
+    }
+  }
+  else if(n.dtype().is_number() && n.dtype().bytes_compact() >= min_bytes)
+  {
+    paths.push_back(path);
+  }
+}
+
+/*!
+ *  Utility function to get the paths of the leaves of a sidre_hdf5 save
+ *  layout that hold the data of Buffers and external Views
+ */
+std::vector<std::string> getDeltaDataPaths(const conduit::Node& layout)
+{
+  std::vector<std::string> paths;
+  if(layout.has_path("sidre/buffers"))
+  {
+    const conduit::Node& buffers = layout.fetch_existing("sidre/buffers");
+    for(conduit::index_t i = 0; i < buffers.number_of_children(); ++i)
+    {
+      const conduit::Node& buffer = buffers.child(i);
+      if(buffer.has_child("data"))
+      {
+        getLeafPaths(buffer.fetch_existing("data"),
+                     "sidre/buffers/" + buffer.name() + "/data",
+                     MIN_DELTA_BYTES,
+                     paths);
+      }
+    }
+  }
+  if(layout.has_path("sidre/external"))
+  {
+    getLeafPaths(layout.fetch_existing("sidre/external"),
+                 "sidre/external",
+                 MIN_DELTA_BYTES,
+                 paths);
+  }
+  return paths;
+}
+
+/*!
+ *  Utility function to hash the data of a numeric Conduit leaf, used to
+ *  find the data that is unchanged since a base checkpoint
+ */
+std::uint64_t hashLeafData(const conduit::Node& n)
+{
+  if(!n.dtype().is_compact())
+  {
+    conduit::Node compact;
+    n.compact_to(compact);
+    return hashLeafData(compact);
+  }
+
+  // Each 8-byte word is scrambled with the 64-bit MurmurHash3 finalizer
+  // and folded into the hash, whose multiplication makes it order-dependent
+  const auto mix = [](std::uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+  };
+  const std::uint64_t prime = 0x9e3779b97f4a7c15ULL;
+
+  const std::size_t num_bytes =
+    static_cast<std::size_t>(n.dtype().bytes_compact());
+  std::uint64_t hash =
+    mix(static_cast<std::uint64_t>(n.dtype().id()) * prime + num_bytes);
+
+  const char* bytes = static_cast<const char*>(n.element_ptr(0));
+  std::size_t i = 0;
+  for(; i + sizeof(std::uint64_t) <= num_bytes; i += sizeof(std::uint64_t))
+  {
+    std::uint64_t word;
+    std::memcpy(&word, bytes + i, sizeof(word));
+    hash = (hash ^ mix(word)) * prime;
+  }
+  if(i < num_bytes)
+  {
+    std::uint64_t word = 0;
+    std::memcpy(&word, bytes + i, num_bytes - i);
+    hash = (hash ^ mix(word)) * prime;
+  }
+
+  return mix(hash);
+}
+
+/*!
+ *  Utility functions to send and receive a buffer of any size. MPI counts
+ *  are ints, so the buffer is transferred in chunks of at most INT_MAX bytes,
+ *  which are matched in order since they share the source, tag and
+ *  communicator.
+ */
+constexpr std::uint64_t MAX_MESSAGE_SIZE = std::numeric_limits<int>::max();
+
+void isendBuffer(const void* buf,
+                 std::uint64_t size,
+                 int dest,
+                 int tag,
+                 MPI_Comm comm,
+                 std::vector<MPI_Request>& requests)
+{
+  const char* ptr = static_cast<const char*>(buf);
+  for(std::uint64_t offset = 0; offset < size; offset += MAX_MESSAGE_SIZE)
+  {
+    const int count =
+      static_cast<int>(std::min(size - offset, MAX_MESSAGE_SIZE));
+    requests.push_back(MPI_REQUEST_NULL);
+    MPI_Isend(ptr + offset, count, MPI_BYTE, dest, tag, comm, &requests.back());
+  }
+}
+
+void irecvBuffer(void* buf,
+                 std::uint64_t size,
+                 int source,
+                 int tag,
+                 MPI_Comm comm,
+                 std::vector<MPI_Request>& requests)
+{
+  char* ptr = static_cast<char*>(buf);
+  for(std::uint64_t offset = 0; offset < size; offset += MAX_MESSAGE_SIZE)
+  {
+    const int count =
+      static_cast<int>(std::min(size - offset, MAX_MESSAGE_SIZE));
+    requests.push_back(MPI_REQUEST_NULL);
+    MPI_Irecv(ptr + offset,
+              count,
+              MPI_BYTE,
+              source,
+              tag,
+              comm,
+              &requests.back());
+  }
+}
+#endif /* AXOM_USE_HDF5 */
+
 }  // end anonymous namespace
 
 namespace axom
@@ -82,6 +269,12 @@ IOManager::IOManager(MPI_Comm comm, bool use_scr)
   , m_baton(nullptr)
   , m_mpi_comm(comm)
   , m_use_scr(use_scr)
+  , m_use_aggregation(false)
+  , m_set_comm(MPI_COMM_NULL)
+  , m_set_comm_num_files(0)
+  , m_delta_base_num_files(0)
+  , m_async_comm(MPI_COMM_NULL)
+  , m_async_baton(nullptr)
 {
   MPI_Comm_size(comm, &m_comm_size);
   MPI_Comm_rank(comm, &m_my_rank);
@@ -105,10 +298,43 @@ IOManager::IOManager(MPI_Comm comm, bool use_scr)
  */
 IOManager::~IOManager()
 {
+  // a destructor must not throw, so errors of a pending write are logged
+  try
+  {
+    wait();
+  }
+  catch(const std::exception& e)
+  {
+    SLIC_WARNING("Pending asynchronous write failed: " << e.what());
+  }
+  catch(...)
+  {
+    SLIC_WARNING("Pending asynchronous write failed with an unknown error");
+  }
+
   if(m_baton)
   {
     delete m_baton;
   }
+
+  if(m_async_baton)
+  {
+    delete m_async_baton;
+  }
+
+  int finalized = 0;
+  MPI_Finalized(&finalized);
+  if(!finalized)
+  {
+    if(m_set_comm != MPI_COMM_NULL)
+    {
+      MPI_Comm_free(&m_set_comm);
+    }
+    if(m_async_comm != MPI_COMM_NULL)
+    {
+      MPI_Comm_free(&m_async_comm);
+    }
+  }
 }
 
 /*
@@ -158,6 +384,8 @@ void IOManager::write(sidre::Group* datagroup,
                       const std::string& protocol,
                       const std::string& tree_pattern)
 {
+  wait();
+
   if(m_baton)
   {
     if(m_baton->getNumFiles() != num_files)
@@ -193,73 +421,409 @@ void IOManager::write(sidre::Group* datagroup,
 #ifdef AXOM_USE_HDF5
     std::string file_pattern = getHDF5FilePattern(root_name);
 
-    int set_id = m_baton->wait();
+    if(m_use_aggregation && num_files < m_comm_size)
+    {
+      conduit::Node layout;
+      datagroup->createSaveLayout(layout, protocol, nullptr, true);
+      writeAggregatedHDF5(layout, num_files, root_name, file_pattern);
+    }
+    else
+    {
+      int set_id = m_baton->wait();
 
-    std::string hdf5_name = getFileNameForRank(file_pattern, root_name, set_id);
+      std::string hdf5_name =
+        getFileNameForRank(file_pattern, root_name, set_id);
 
-    hdf5_name = getSCRPath(hdf5_name);
+      hdf5_name = getSCRPath(hdf5_name);
 
-    hid_t h5_file_id, h5_group_id;
-    if(m_baton->isFirstInGroup())
-    {
-      // no need to create directories in SCR
-      if(!m_use_scr)
-      {
-        std::string dir_name;
-        utilities::filesystem::getDirName(dir_name, hdf5_name);
-        if(!dir_name.empty())
-        {
-          utilities::filesystem::makeDirsForPath(dir_name);
-        }
-      }
-      h5_file_id = conduit::relay::io::hdf5_create_file(hdf5_name);
+      hid_t h5_file_id = createOrOpenHDF5DataFile(*m_baton, hdf5_name);
+
+      std::string group_name = getHDF5DataGroupName(num_files, m_my_rank);
+      hid_t h5_group_id = H5Gcreate(h5_file_id,
+                                    group_name.c_str(),
+                                    H5P_DEFAULT,
+                                    H5P_DEFAULT,
+                                    H5P_DEFAULT);
+      SLIC_ASSERT(h5_group_id >= 0);
+
+      datagroup->save(h5_group_id);
+
+      closeHDF5DataFile(h5_file_id, h5_group_id);
+
+      (void)m_baton->pass();
     }
-    else
+#else
+    SLIC_WARNING("'sidre_hdf5' protocol only available "
+                 << "when axom is configured with hdf5");
+#endif /* AXOM_USE_HDF5 */
+  }
+  else
+  {
+    int set_id = m_baton->wait();
+    std::string file_name = fmt::sprintf("%s_%07d", file_base, set_id);
+
+    std::string obase = file_name + "." + protocol;
+    datagroup->save(obase, protocol);
+
+    (void)m_baton->pass();
+  }
+
+  MPI_Barrier(m_mpi_comm);
+}
+
+/*
+ *************************************************************************
+ *
+ * Start an asynchronous write to file.
+ *
+ *************************************************************************
+ */
+void IOManager::writeAsync(sidre::Group* datagroup,
+                           int num_files,
+                           const std::string& file_base,
+                           const std::string& protocol,
+                           const std::string& tree_pattern)
+{
+  // Only one write is pending at a time, so the staged data can be reused
+  wait();
+
+  int thread_level = MPI_THREAD_SINGLE;
+  MPI_Query_thread(&thread_level);
+  if(thread_level < MPI_THREAD_MULTIPLE)
+  {
+    SLIC_WARNING_ROOT(
+      "IOManager::writeAsync() requires MPI to be initialized with "
+      << "MPI_THREAD_MULTIPLE. The group will be written synchronously.");
+    write(datagroup, num_files, file_base, protocol, tree_pattern);
+    return;
+  }
+
+  if(m_baton)
+  {
+    if(m_baton->getNumFiles() != num_files)
     {
-      h5_file_id = conduit::relay::io::hdf5_open_file_for_read_write(hdf5_name);
+      delete m_baton;
+      m_baton = nullptr;
     }
-    SLIC_ASSERT(h5_file_id >= 0);
+  }
+
+  if(!m_baton)
+  {
+    m_baton = new IOBaton(m_mpi_comm, num_files, m_comm_size);
+  }
+
+  SLIC_ERROR_IF(m_use_scr && num_files != m_comm_size,
+                "SCR requires a file per process");
 
-    std::string group_name = "datagroup";
-    if(m_comm_size != num_files)
+  // The background thread passes its baton over a separate communicator,
+  // so that its messages cannot match the application's messages
+  if(m_async_comm == MPI_COMM_NULL)
+  {
+    MPI_Comm_dup(m_mpi_comm, &m_async_comm);
+  }
+
+  if(m_async_baton)
+  {
+    if(m_async_baton->getNumFiles() != num_files)
     {
-      group_name = fmt::sprintf("datagroup_%07d", m_my_rank);
+      delete m_async_baton;
+      m_async_baton = nullptr;
     }
-    h5_group_id = H5Gcreate(h5_file_id,
-                            group_name.c_str(),
-                            H5P_DEFAULT,
-                            H5P_DEFAULT,
-                            H5P_DEFAULT);
+  }
+
+  if(!m_async_baton)
+  {
+    m_async_baton = new IOBaton(m_async_comm, num_files, m_comm_size);
+  }
+
+  std::string test_file_base(broadcastString(file_base, m_mpi_comm, m_my_rank));
+
+  SLIC_WARNING_IF(test_file_base != file_base,
+                  "IOManager::writeAsync() file_base argument is not identical "
+                    << "on all ranks. This may cause the output files to be "
+                    << "incompatible with a call to IOManager::read().");
+
+  std::string output_base =
+    createRootFile(file_base, num_files, protocol, tree_pattern);
+  MPI_Barrier(m_mpi_comm);
+
+  std::string root_name = output_base + ".root";
+
+  // The file pattern is broadcast from rank 0, so get it on this thread
+  std::string file_pattern;
+#ifdef AXOM_USE_HDF5
+  if(protocol == "sidre_hdf5")
+  {
+    file_pattern = getHDF5FilePattern(root_name);
+  }
+#endif /* AXOM_USE_HDF5 */
+
+  // Stage a deep copy of the data that write() would save for this rank
+  conduit::Node layout;
+  const bool for_hdf5_handle = (protocol == "sidre_hdf5");
+  if(!datagroup->createSaveLayout(layout, protocol, nullptr, for_hdf5_handle))
+  {
+    SLIC_ERROR("IOManager::writeAsync() -- invalid protocol '" << protocol
+                                                               << "'.");
+    return;
+  }
+
+  m_staged_data.reset();
+  layout.compact_to(m_staged_data);
+
+  m_pending_write = std::async(std::launch::async,
+                               &IOManager::writeStagedData,
+                               this,
+                               num_files,
+                               file_base,
+                               protocol,
+                               root_name,
+                               file_pattern);
+}
+
+/*
+ *************************************************************************
+ *
+ * Write the staged data of an asynchronous write to file.
+ *
+ *************************************************************************
+ */
+void IOManager::writeStagedData(int num_files,
+                                const std::string& file_base,
+                                const std::string& protocol,
+                                const std::string& root_name,
+                                const std::string& file_pattern)
+{
+  int set_id = m_async_baton->wait();
+
+  if(protocol == "sidre_hdf5")
+  {
+#ifdef AXOM_USE_HDF5
+    std::string hdf5_name = getFileNameForRank(file_pattern, root_name, set_id);
+
+    hdf5_name = getSCRPath(hdf5_name);
+
+    hid_t h5_file_id = createOrOpenHDF5DataFile(*m_async_baton, hdf5_name);
+
+    std::string group_name = getHDF5DataGroupName(num_files, m_my_rank);
+    hid_t h5_group_id = H5Gcreate(h5_file_id,
+                                  group_name.c_str(),
+                                  H5P_DEFAULT,
+                                  H5P_DEFAULT,
+                                  H5P_DEFAULT);
     SLIC_ASSERT(h5_group_id >= 0);
 
-    datagroup->save(h5_group_id);
-    herr_t status;
-    AXOM_UNUSED_VAR(status);
+    conduit::relay::io::hdf5_write(m_staged_data, h5_group_id);
 
-    status = H5Gclose(h5_group_id);
-    SLIC_ASSERT(status >= 0);
-    status = H5Fflush(h5_file_id, H5F_SCOPE_LOCAL);
-    SLIC_ASSERT(status >= 0);
-    status = H5Fclose(h5_file_id);
-    SLIC_ASSERT(status >= 0);
+    closeHDF5DataFile(h5_file_id, h5_group_id);
 #else
+    AXOM_UNUSED_VAR(num_files);
+    AXOM_UNUSED_VAR(root_name);
+    AXOM_UNUSED_VAR(file_pattern);
     SLIC_WARNING("'sidre_hdf5' protocol only available "
                  << "when axom is configured with hdf5");
 #endif /* AXOM_USE_HDF5 */
   }
   else
   {
-    int set_id = m_baton->wait();
     std::string file_name = fmt::sprintf("%s_%07d", file_base, set_id);
 
     std::string obase = file_name + "." + protocol;
-    datagroup->save(obase, protocol);
+    conduit::relay::io::save(m_staged_data,
+                             obase,
+                             Group::getSaveRelayProtocol(protocol));
   }
-  (void)m_baton->pass();
+  (void)m_async_baton->pass();
+
+  MPI_Barrier(m_async_comm);
+}
+
+/*
+ *************************************************************************
+ *
+ * Wait for a pending asynchronous write.
+ *
+ *************************************************************************
+ */
+void IOManager::wait()
+{
+  if(m_pending_write.valid())
+  {
+    // rethrows any exception raised on the background thread
+    m_pending_write.get();
+  }
+}
+
+/*
+ *************************************************************************
+ *
+ * Test for completion of a pending asynchronous write.
+ *
+ *************************************************************************
+ */
+bool IOManager::test()
+{
+  if(!m_pending_write.valid())
+  {
+    return true;
+  }
+
+  return m_pending_write.wait_for(std::chrono::seconds(0)) ==
+    std::future_status::ready;
+}
+
+/*
+ *************************************************************************
+ *
+ * Write a delta checkpoint, or a base checkpoint for later deltas.
+ *
+ *************************************************************************
+ */
+void IOManager::writeDelta(sidre::Group* datagroup,
+                           int num_files,
+                           const std::string& file_base,
+                           const std::string& tree_pattern)
+{
+  wait();
+
+#ifdef AXOM_USE_HDF5
+  const std::string protocol = "sidre_hdf5";
+
+  if(m_baton)
+  {
+    if(m_baton->getNumFiles() != num_files)
+    {
+      delete m_baton;
+      m_baton = nullptr;
+    }
+  }
+
+  if(!m_baton)
+  {
+    m_baton = new IOBaton(m_mpi_comm, num_files, m_comm_size);
+  }
+
+  SLIC_ERROR_IF(m_use_scr && num_files != m_comm_size,
+                "SCR requires a file per process");
+
+  std::string test_file_base(broadcastString(file_base, m_mpi_comm, m_my_rank));
+
+  SLIC_WARNING_IF(test_file_base != file_base,
+                  "IOManager::writeDelta() file_base argument is not identical "
+                    << "on all ranks. This may cause the output files to be "
+                    << "incompatible with a call to IOManager::read().");
+
+  // A delta must have the base's number of files and must not overwrite
+  // the base; otherwise this checkpoint becomes the new base
+  std::string root_name =
+    utilities::string::removeSuffix(file_base, ".root") + ".root";
+  const bool is_base = m_delta_base_root.empty() ||
+    m_delta_base_num_files != num_files || m_delta_base_root == root_name;
+
+  std::string delta_base;
+  if(!is_base)
+  {
+    // A base in the delta's directory is referred to by its name only,
+    // so that the checkpoints can be moved together
+    axom::Path base_path(m_delta_base_root);
+    delta_base = (base_path.dirName() == axom::Path(root_name).dirName())
+      ? base_path.baseName()
+      : m_delta_base_root;
+  }
+
+  std::string output_base =
+    createRootFile(file_base, num_files, protocol, tree_pattern, delta_base);
+  MPI_Barrier(m_mpi_comm);
+
+  root_name = output_base + ".root";
+
+  std::string file_pattern = getHDF5FilePattern(root_name);
+
+  conduit::Node layout;
+  datagroup->createSaveLayout(layout, protocol, nullptr, true);
+
+  if(is_base)
+  {
+    m_delta_base_root = root_name;
+    m_delta_base_num_files = num_files;
+    m_delta_hashes.clear();
+    for(const auto& path : getDeltaDataPaths(layout))
+    {
+      m_delta_hashes[path] = hashLeafData(layout[path]);
+    }
+  }
+  else
+  {
+    // Data that is unchanged since the base is replaced by a reference to
+    // the base; the base's hashes are kept, so each delta holds all of the
+    // changes since the base
+    for(const auto& path : getDeltaDataPaths(layout))
+    {
+      const auto it = m_delta_hashes.find(path);
+      if(it != m_delta_hashes.end() &&
+         it->second == hashLeafData(layout[path]))
+      {
+        layout.remove(path);
+        layout["sidre_delta/unchanged/" + path] =
+          static_cast<conduit::uint64>(it->second);
+      }
+    }
+  }
+
+  if(m_use_aggregation && num_files < m_comm_size)
+  {
+    writeAggregatedHDF5(layout, num_files, root_name, file_pattern);
+  }
+  else
+  {
+    int set_id = m_baton->wait();
+
+    std::string hdf5_name = getFileNameForRank(file_pattern, root_name, set_id);
+
+    hdf5_name = getSCRPath(hdf5_name);
+
+    hid_t h5_file_id = createOrOpenHDF5DataFile(*m_baton, hdf5_name);
+
+    std::string group_name = getHDF5DataGroupName(num_files, m_my_rank);
+    hid_t h5_group_id = H5Gcreate(h5_file_id,
+                                  group_name.c_str(),
+                                  H5P_DEFAULT,
+                                  H5P_DEFAULT,
+                                  H5P_DEFAULT);
+    SLIC_ASSERT(h5_group_id >= 0);
+
+    conduit::relay::io::hdf5_write(layout, h5_group_id);
+
+    closeHDF5DataFile(h5_file_id, h5_group_id);
+
+    (void)m_baton->pass();
+  }
+#else
+  AXOM_UNUSED_VAR(datagroup);
+  AXOM_UNUSED_VAR(num_files);
+  AXOM_UNUSED_VAR(file_base);
+  AXOM_UNUSED_VAR(tree_pattern);
+  SLIC_WARNING("Delta checkpoints are only available "
+               << "when axom is configured with hdf5");
+#endif /* AXOM_USE_HDF5 */
 
   MPI_Barrier(m_mpi_comm);
 }
 
+/*
+ *************************************************************************
+ *
+ * Make the next delta checkpoint a base checkpoint.
+ *
+ *************************************************************************
+ */
+void IOManager::resetDeltaBase()
+{
+  m_delta_base_root.clear();
+  m_delta_base_num_files = 0;
+  m_delta_hashes.clear();
+}
+
 /*
  *************************************************************************
  *
@@ -272,6 +836,8 @@ void IOManager::read(sidre::Group* datagroup,
                      const std::string& protocol,
                      bool preserve_contents)
 {
+  wait();
+
   MPI_Barrier(m_mpi_comm);
 
   if(protocol == "sidre_hdf5")
@@ -322,6 +888,8 @@ void IOManager::read(sidre::Group* datagroup,
                      const std::string& root_file,
                      bool preserve_contents)
 {
+  wait();
+
   MPI_Barrier(m_mpi_comm);
   std::string protocol = getProtocol(root_file);
   read(datagroup, root_file, protocol, preserve_contents);
@@ -359,9 +927,210 @@ std::string IOManager::getSCRPath(const std::string& path)
 #endif
 }
 
+std::string IOManager::getHDF5DataGroupName(int num_files, int rank) const
+{
+  std::string group_name = "datagroup";
+  if(m_comm_size != num_files)
+  {
+    group_name = fmt::sprintf("datagroup_%07d", rank);
+  }
+  return group_name;
+}
+
+#ifdef AXOM_USE_HDF5
+hid_t IOManager::createOrOpenHDF5DataFile(const IOBaton& baton,
+                                          const std::string& hdf5_name)
+{
+  hid_t h5_file_id;
+  if(baton.isFirstInGroup())
+  {
+    // no need to create directories in SCR
+    if(!m_use_scr)
+    {
+      std::string dir_name;
+      utilities::filesystem::getDirName(dir_name, hdf5_name);
+      if(!dir_name.empty())
+      {
+        utilities::filesystem::makeDirsForPath(dir_name);
+      }
+    }
+    h5_file_id = conduit::relay::io::hdf5_create_file(hdf5_name);
+  }
+  else
+  {
+    h5_file_id = conduit::relay::io::hdf5_open_file_for_read_write(hdf5_name);
+  }
+  SLIC_ASSERT(h5_file_id >= 0);
+
+  return h5_file_id;
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to send the data of a file set to its first rank, which
+ * receives and writes the data of one rank at a time to the set's
+ * sidre_hdf5 data file.
+ *
+ *************************************************************************
+ */
+void IOManager::writeAggregatedHDF5(const conduit::Node& layout,
+                                    int num_files,
+                                    const std::string& root_name,
+                                    const std::string& file_pattern)
+{
+  // Each set of ranks sharing a file gets a communicator, in which the
+  // set's first rank has rank 0 and acts as the set's aggregator
+  if(m_set_comm != MPI_COMM_NULL && m_set_comm_num_files != num_files)
+  {
+    MPI_Comm_free(&m_set_comm);
+  }
+  if(m_set_comm == MPI_COMM_NULL)
+  {
+    MPI_Comm_split(m_mpi_comm, m_baton->getSetId(), m_my_rank, &m_set_comm);
+    m_set_comm_num_files = num_files;
+  }
+
+  int set_size = 1;
+  int set_rank = 0;
+  MPI_Comm_size(m_set_comm, &set_size);
+  MPI_Comm_rank(m_set_comm, &set_rank);
+  const bool is_aggregator = (set_rank == 0);
+
+  const int SCHEMA_TAG = 0;
+  const int DATA_TAG = 1;
+
+  // Serialize the local data as a schema and one contiguous data buffer
+  conduit::Node local_data;
+  layout.compact_to(local_data);
+  const std::string local_schema = local_data.schema().to_json();
+
+  std::uint64_t local_sizes[2] = {
+    static_cast<std::uint64_t>(local_schema.size()),
+    static_cast<std::uint64_t>(local_data.total_bytes_compact())};
+  std::vector<std::uint64_t> sizes(is_aggregator ? 2 * set_size : 0);
+  MPI_Gather(local_sizes,
+             2,
+             MPI_UINT64_T,
+             sizes.data(),
+             2,
+             MPI_UINT64_T,
+             0,
+             m_set_comm);
+
+  if(!is_aggregator)
+  {
+    // The sends complete when the aggregator gets to this rank
+    std::vector<MPI_Request> requests;
+    isendBuffer(local_schema.data(),
+                local_sizes[0],
+                0,
+                SCHEMA_TAG,
+                m_set_comm,
+                requests);
+    isendBuffer(local_data.data_ptr(),
+                local_sizes[1],
+                0,
+                DATA_TAG,
+                m_set_comm,
+                requests);
+    MPI_Waitall(static_cast<int>(requests.size()),
+                requests.data(),
+                MPI_STATUSES_IGNORE);
+    return;
+  }
+
+  // Write each rank's data to its own group, in rank order, exactly as
+  // the ranks would have written it while passing the baton
+  std::string hdf5_name =
+    getFileNameForRank(file_pattern, root_name, m_baton->getSetId());
+
+  hdf5_name = getSCRPath(hdf5_name);
+
+  hid_t h5_file_id = createOrOpenHDF5DataFile(*m_baton, hdf5_name);
+
+  herr_t status;
+  AXOM_UNUSED_VAR(status);
+
+  auto writeRankData = [&](int i, const conduit::Node& rank_data) {
+    std::string group_name = getHDF5DataGroupName(num_files, m_my_rank + i);
+    hid_t h5_group_id = H5Gcreate(h5_file_id,
+                                  group_name.c_str(),
+                                  H5P_DEFAULT,
+                                  H5P_DEFAULT,
+                                  H5P_DEFAULT);
+    SLIC_ASSERT(h5_group_id >= 0);
+
+    conduit::relay::io::hdf5_write(rank_data, h5_group_id);
+
+    status = H5Gclose(h5_group_id);
+    SLIC_ASSERT(status >= 0);
+  };
+
+  // The data of the next rank is received while the data of the current
+  // rank is written, so at most two ranks' data are held at once
+  struct RankBuffer
+  {
+    std::string schema;
+    std::vector<char> data;
+    std::vector<MPI_Request> requests;
+  };
+  RankBuffer buffers[2];
+
+  auto receiveRankData = [&](int i) {
+    RankBuffer& buffer = buffers[i % 2];
+    buffer.schema.resize(sizes[2 * i]);
+    buffer.data.resize(sizes[2 * i + 1]);
+    buffer.requests.clear();
+    irecvBuffer(&buffer.schema[0],
+                sizes[2 * i],
+                i,
+                SCHEMA_TAG,
+                m_set_comm,
+                buffer.requests);
+    irecvBuffer(buffer.data.data(),
+                sizes[2 * i + 1],
+                i,
+                DATA_TAG,
+                m_set_comm,
+                buffer.requests);
+  };
+
+  if(set_size > 1)
+  {
+    receiveRankData(1);
+  }
+  writeRankData(0, local_data);
+
+  for(int i = 1; i < set_size; ++i)
+  {
+    RankBuffer& buffer = buffers[i % 2];
+    MPI_Waitall(static_cast<int>(buffer.requests.size()),
+                buffer.requests.data(),
+                MPI_STATUSES_IGNORE);
+    if(i + 1 < set_size)
+    {
+      receiveRankData(i + 1);
+    }
+
+    conduit::Schema rank_schema(buffer.schema);
+    conduit::Node rank_data;
+    rank_data.set_external(rank_schema, buffer.data.data());
+    writeRankData(i, rank_data);
+  }
+
+  status = H5Fflush(h5_file_id, H5F_SCOPE_LOCAL);
+  SLIC_ASSERT(status >= 0);
+  status = H5Fclose(h5_file_id);
+  SLIC_ASSERT(status >= 0);
+}
+#endif /* AXOM_USE_HDF5 */
+
 void IOManager::loadExternalData(sidre::Group* datagroup,
                                  const std::string& root_file)
 {
+  wait();
+
   int num_files = getNumFilesFromRoot(root_file);
   int num_groups = getNumGroupsFromRoot(root_file);
   SLIC_ASSERT(num_files > 0);
@@ -384,6 +1153,13 @@ void IOManager::loadExternalData(sidre::Group* datagroup,
 #ifdef AXOM_USE_HDF5
   std::string file_pattern = getHDF5FilePattern(root_file);
 
+  std::string delta_base = getDeltaBaseFromRoot(root_file);
+  std::string base_pattern;
+  if(!delta_base.empty())
+  {
+    base_pattern = getHDF5FilePattern(delta_base);
+  }
+
   int set_id = m_baton->wait();
 
   if(num_groups <= m_comm_size)
@@ -410,6 +1186,15 @@ void IOManager::loadExternalData(sidre::Group* datagroup,
       SLIC_ASSERT(h5_group_id >= 0);
 
       datagroup->loadExternalData(h5_group_id);
+      if(!delta_base.empty())
+      {
+        loadDeltaExternalData(datagroup,
+                              h5_group_id,
+                              delta_base,
+                              base_pattern,
+                              set_id,
+                              m_my_rank);
+      }
 
       errv = H5Gclose(h5_group_id);
       SLIC_ASSERT(errv >= 0);
@@ -447,6 +1232,15 @@ void IOManager::loadExternalData(sidre::Group* datagroup,
       Group* one_rank_input = datagroup->getGroup(input_name);
 
       one_rank_input->loadExternalData(h5_group_id);
+      if(!delta_base.empty())
+      {
+        loadDeltaExternalData(one_rank_input,
+                              h5_group_id,
+                              delta_base,
+                              base_pattern,
+                              input_rank,
+                              input_rank);
+      }
 
       errv = H5Gclose(h5_group_id);
       SLIC_ASSERT(errv >= 0);
@@ -475,7 +1269,8 @@ void IOManager::loadExternalData(sidre::Group* datagroup,
 std::string IOManager::createRootFile(const std::string& root_base,
                                       int num_files,
                                       const std::string& protocol,
-                                      const std::string& tree_pattern)
+                                      const std::string& tree_pattern,
+                                      const std::string& delta_base)
 {
   conduit::Node n;
 
@@ -512,6 +1307,11 @@ std::string IOManager::createRootFile(const std::string& root_base,
       n["protocol/name"] = protocol;
       n["protocol/version"] = "0.0";
 
+      if(!delta_base.empty())
+      {
+        n["delta_base"] = delta_base;
+      }
+
       root_file_name = file_base + ".root";
 #else
       SLIC_WARNING("IOManager::createRootFile() -- '"
@@ -714,6 +1514,13 @@ void IOManager::readSidreHDF5(sidre::Group* datagroup,
 
   std::string file_pattern = getHDF5FilePattern(root_file);
 
+  std::string delta_base = getDeltaBaseFromRoot(root_file);
+  std::string base_pattern;
+  if(!delta_base.empty())
+  {
+    base_pattern = getHDF5FilePattern(delta_base);
+  }
+
   int set_id = m_baton->wait();
   if(num_groups <= m_comm_size)
   {
@@ -737,7 +1544,13 @@ void IOManager::readSidreHDF5(sidre::Group* datagroup,
       hid_t h5_group_id = H5Gopen(h5_file_id, group_name.c_str(), 0);
       SLIC_ASSERT(h5_group_id >= 0);
 
-      datagroup->load(h5_group_id, "sidre_hdf5", preserve_contents);
+      loadSidreHDF5Group(datagroup,
+                         h5_group_id,
+                         delta_base,
+                         base_pattern,
+                         set_id,
+                         m_my_rank,
+                         preserve_contents);
 
       errv = H5Gclose(h5_group_id);
       SLIC_ASSERT(errv >= 0);
@@ -775,7 +1588,13 @@ void IOManager::readSidreHDF5(sidre::Group* datagroup,
       std::string input_name = fmt::sprintf("rank_%07d/sidre_input", input_rank);
       Group* one_rank_input = datagroup->createGroup(input_name);
 
-      one_rank_input->load(h5_group_id, "sidre_hdf5", preserve_contents);
+      loadSidreHDF5Group(one_rank_input,
+                         h5_group_id,
+                         delta_base,
+                         base_pattern,
+                         input_rank,
+                         input_rank,
+                         preserve_contents);
 
       errv = H5Gclose(h5_group_id);
       SLIC_ASSERT(errv >= 0);
@@ -786,6 +1605,179 @@ void IOManager::readSidreHDF5(sidre::Group* datagroup,
   }
   (void)m_baton->pass();
 }
+
+/*
+ *************************************************************************
+ *
+ * Get the base checkpoint of a delta checkpoint from its root file.
+ *
+ *************************************************************************
+ */
+std::string IOManager::getDeltaBaseFromRoot(const std::string& root_name)
+{
+  std::string delta_base;
+  if(m_my_rank == 0)
+  {
+    std::string root_path = getSCRPath(root_name);
+
+    hid_t root_file_id = conduit::relay::io::hdf5_open_file_for_read(root_path);
+    SLIC_ASSERT(root_file_id >= 0);
+
+    if(conduit::relay::io::hdf5_has_path(root_file_id, "delta_base"))
+    {
+      conduit::Node n;
+      conduit::relay::io::hdf5_read(root_file_id, "delta_base", n);
+      delta_base = n.as_string();
+
+      // A base referred to by its name only is in the delta's directory
+      if(axom::Path(delta_base).dirName().empty())
+      {
+        delta_base =
+          axom::utilities::string::appendPrefix(axom::Path(root_name).dirName(),
+                                                delta_base,
+                                                '/');
+      }
+    }
+
+    herr_t errv = H5Fclose(root_file_id);
+    AXOM_UNUSED_VAR(errv);
+    SLIC_ASSERT(errv >= 0);
+  }
+  delta_base = broadcastString(delta_base, m_mpi_comm, m_my_rank);
+
+  return delta_base;
+}
+
+/*
+ *************************************************************************
+ *
+ * Load a Group from a sidre_hdf5 data file, which may be a delta.
+ *
+ *************************************************************************
+ */
+void IOManager::loadSidreHDF5Group(sidre::Group* group,
+                                   hid_t h5_group_id,
+                                   const std::string& delta_base,
+                                   const std::string& base_pattern,
+                                   int file_id,
+                                   int input_rank,
+                                   bool preserve_contents)
+{
+  if(delta_base.empty())
+  {
+    group->load(h5_group_id, "sidre_hdf5", preserve_contents);
+    return;
+  }
+
+  // Complete the delta's layout with the unchanged data from the base
+  conduit::Node n;
+  conduit::relay::io::hdf5_read(h5_group_id, n);
+  if(n.has_path("sidre_delta/unchanged"))
+  {
+    readDeltaBaseData(n,
+                      n["sidre_delta/unchanged"],
+                      "",
+                      delta_base,
+                      base_pattern,
+                      file_id,
+                      input_rank);
+  }
+
+  SLIC_ASSERT_MSG(n.has_path("sidre"),
+                  "Delta checkpoint data does not have sidre data for Group "
+                    << group->getPathName() << ".");
+  group->importFrom(n["sidre"], preserve_contents);
+}
+
+/*
+ *************************************************************************
+ *
+ * Load the unchanged external data of a delta checkpoint from its base.
+ *
+ *************************************************************************
+ */
+void IOManager::loadDeltaExternalData(sidre::Group* group,
+                                      hid_t h5_group_id,
+                                      const std::string& delta_base,
+                                      const std::string& base_pattern,
+                                      int file_id,
+                                      int input_rank)
+{
+  const std::string unchanged_path = "sidre_delta/unchanged";
+  if(!conduit::relay::io::hdf5_has_path(h5_group_id,
+                                        unchanged_path + "/sidre/external"))
+  {
+    return;
+  }
+
+  conduit::Node unchanged;
+  conduit::relay::io::hdf5_read(h5_group_id, unchanged_path, unchanged);
+
+  // The external layout points to the Group's external data, so the data
+  // is read from the base directly into it
+  conduit::Node n;
+  group->createExternalLayout(n);
+
+  readDeltaBaseData(n,
+                    unchanged,
+                    "sidre/external/",
+                    delta_base,
+                    base_pattern,
+                    file_id,
+                    input_rank);
+}
+
+/*
+ *************************************************************************
+ *
+ * Read the data that a delta checkpoint refers to from its base.
+ *
+ *************************************************************************
+ */
+void IOManager::readDeltaBaseData(conduit::Node& n,
+                                  const conduit::Node& unchanged,
+                                  const std::string& prefix,
+                                  const std::string& delta_base,
+                                  const std::string& base_pattern,
+                                  int file_id,
+                                  int input_rank)
+{
+  std::vector<std::string> paths;
+  getLeafPaths(unchanged, "", 0, paths);
+
+  std::string hdf5_name = getFileNameForRank(base_pattern, delta_base, file_id);
+
+  hdf5_name = getSCRPath(hdf5_name);
+
+  hid_t h5_file_id = conduit::relay::io::hdf5_open_file_for_read(hdf5_name);
+  SLIC_ASSERT(h5_file_id >= 0);
+
+  std::string group_name = "datagroup";
+  if(H5Lexists(h5_file_id, group_name.c_str(), 0) <= 0)
+  {
+    group_name = fmt::sprintf("datagroup_%07d", input_rank);
+  }
+
+  for(const auto& path : paths)
+  {
+    if(path.compare(0, prefix.size(), prefix) != 0)
+    {
+      continue;
+    }
+
+    const std::string dest_path = path.substr(prefix.size());
+    if(prefix.empty() || n.has_path(dest_path))
+    {
+      conduit::relay::io::hdf5_read(h5_file_id,
+                                    group_name + "/" + path,
+                                    n[dest_path]);
+    }
+  }
+
+  herr_t errv = H5Fclose(h5_file_id);
+  AXOM_UNUSED_VAR(errv);
+  SLIC_ASSERT(errv >= 0);
+}
 #endif /* AXOM_USE_HDF5 */
 
 /*
@@ -854,6 +1846,8 @@ void IOManager::getRankToFileMap(View* rank_to_file_map, int num_files)
  */
 int IOManager::getNumFilesFromRoot(const std::string& root_file)
 {
+  wait();
+
   /*
    * Read num_files from rootfile on rank 0.
    */
@@ -880,6 +1874,8 @@ int IOManager::getNumFilesFromRoot(const std::string& root_file)
 
 int IOManager::getNumGroupsFromRoot(const std::string& root_file)
 {
+  wait();
+
   /*
    * Read number_of_trees from rootfile on rank 0.
    */
@@ -915,6 +1911,8 @@ int IOManager::getNumGroupsFromRoot(const std::string& root_file)
 void IOManager::writeGroupToRootFile(sidre::Group* group,
                                      const std::string& file_name)
 {
+  wait();
+
 #ifdef AXOM_USE_HDF5
   std::string tmp_name = getSCRPath(file_name);
 
@@ -969,6 +1967,8 @@ void IOManager::writeGroupToRootFileAtPath(sidre::Group* group,
                                            const std::string& file_name,
                                            const std::string& group_path)
 {
+  wait();
+
 #ifdef AXOM_USE_HDF5
   std::string tmp_name = getSCRPath(file_name);
 
@@ -1028,6 +2028,8 @@ void IOManager::writeViewToRootFileAtPath(sidre::View* view,
                                           const std::string& file_name,
                                           const std::string& group_path)
 {
+  wait();
+
 #ifdef AXOM_USE_HDF5
   std::string tmp_name = getSCRPath(file_name);
 
@@ -1069,6 +2071,8 @@ void IOManager::writeBlueprintIndexToRootFile(DataStore* datastore,
                                               const std::string& file_name,
                                               const std::string& mesh_path)
 {
+  wait();
+
 #ifdef AXOM_USE_HDF5
   std::string tmp_name = getSCRPath(file_name);
 
@@ -27,6 +27,13 @@
 
 #include "mpi.h"
 
+// C/C++ includes
+#include <cstdint>  // for std::uint64_t
+#include <future>   // for std::future
+#include <map>      // for std::map
+#include <memory>   // for std::unique_ptr
+#include <string>   // for std::string
+
 namespace axom
 {
 namespace sidre
@@ -40,6 +47,10 @@ namespace sidre
  * before calling Group's I/O methods.  It uses IOBaton to control the
  * parallel I/O operations, such that one rank at a time interacts with any
  * particular output file.
+ *
+ * Output may also be written asynchronously with writeAsync(), in which
+ * case the baton-coordinated file writes run on a background thread while
+ * the application continues to modify its Groups.
  */
 class IOManager
 {
@@ -56,6 +67,9 @@ public:
 
   /*!
    * \brief Destructor
+   *
+   * Waits for a pending asynchronous write. If that write failed, a warning
+   * is logged instead of rethrowing its exception.
    */
   ~IOManager();
 
@@ -109,6 +123,144 @@ public:
              const std::string& protocol,
              const std::string& tree_pattern = "datagroup");
 
+  /*!
+   * \brief enable or disable aggregation of the output of write()
+   *
+   * By default, the ranks that share an output file write their data to it
+   * one after another, passing an IOBaton from rank to rank. When
+   * aggregation is enabled, the data of all ranks that share a file is
+   * instead sent to the first rank of the set, which receives and writes the
+   * data of one rank at a time. This replaces the serial chain of file
+   * opens and closes with a single open file per set, and overlaps receiving
+   * a rank's data with writing the previous rank's data. The first rank holds
+   * the data of at most two other ranks at once.
+   *
+   * The files written with aggregation are identical to those written
+   * without it, and are read with read() as usual.
+   *
+   * Aggregation currently applies to the sidre_hdf5 protocol when there are
+   * fewer files than ranks; otherwise write() is unaffected. It is not
+   * used by writeAsync().
+   *
+   * This must be set to the same value on all ranks.
+   */
+  void setUseAggregation(bool use_aggregation)
+  {
+    m_use_aggregation = use_aggregation;
+  }
+
+  /*!
+   * \brief Tells whether the output of write() is aggregated.
+   */
+  bool getUseAggregation() const { return m_use_aggregation; }
+
+  /*!
+   * \brief start an asynchronous write of a Group to output files
+   *
+   * This writes the same root file and data files as write(), with the
+   * same arguments, but returns as soon as the local data has been staged.
+   *
+   * The root file is written before returning. The data of the Group is
+   * then deep copied into a staging buffer owned by this IOManager, so the
+   * Group may be modified or destroyed as soon as this method returns. A
+   * background thread writes the staged data to the data files, passing the
+   * IOBaton between ranks over a duplicate of the communicator.
+   *
+   * At most one asynchronous write is pending at a time; if a previous write
+   * is still pending, this method first waits for it to complete. All other
+   * methods of this class also wait for a pending write before doing any I/O.
+   *
+   * This is an MPI collective call that must be called on all ranks in the
+   * communicator used in this object's constructor.
+   *
+   * \note The background thread makes MPI calls, so MPI must have been
+   * initialized with MPI_THREAD_MULTIPLE. Otherwise, a warning is logged and
+   * the Group is written synchronously, as with write().
+   *
+   * \note When the sidre_hdf5 or conduit_hdf5 protocol is used, the
+   * application must not make its own HDF5 calls while a write is pending,
+   * unless HDF5 was built to be thread-safe.
+   *
+   * \sa write(), wait(), test()
+   */
+  void writeAsync(sidre::Group* group,
+                  int num_files,
+                  const std::string& file_base,
+                  const std::string& protocol,
+                  const std::string& tree_pattern = "datagroup");
+
+  /*!
+   * \brief wait for a pending asynchronous write to complete
+   *
+   * Returns immediately if no write is pending. When this returns, all ranks
+   * have finished writing their data files.
+   *
+   * This is not an MPI collective call.
+   */
+  void wait();
+
+  /*!
+   * \brief check whether a pending asynchronous write has completed
+   *
+   * This is not an MPI collective call and does not block.
+   *
+   * \return true if no write is pending or the pending write has completed
+   * on all ranks, false otherwise.
+   */
+  bool test();
+
+  /*!
+   * \brief write a delta checkpoint of a Group to output files
+   *
+   * The first call writes a complete checkpoint with the sidre_hdf5
+   * protocol, as write() would, which becomes the base for the following
+   * calls. Each of these writes a delta checkpoint in which the data of the
+   * Buffers and external Views that is unchanged since the base is replaced
+   * by a reference to the base. Changes are found by comparing a hash of
+   * each Buffer's and external View's data with its hash at the time of
+   * the base, so they are detected however the data was modified. Small
+   * data arrays, scalar and string Views and the description of the Group
+   * hierarchy are always written.
+   *
+   * A delta always refers to the base, not to the previous delta, so it
+   * holds all changes since the base and the intermediate deltas may be
+   * deleted. The base must be kept as long as its deltas are used. Its root
+   * file is recorded in the delta's root file, by name only when both root
+   * files are in the same directory.
+   *
+   * A delta checkpoint is read with read() and loadExternalData() like any
+   * other checkpoint; the unchanged data is read from the base.
+   *
+   * A new base is written when resetDeltaBase() has been called, when
+   * num_files differs from the base's or when file_base would overwrite the
+   * base.
+   *
+   * This is an MPI collective call that must be called on all ranks in the
+   * communicator used in this object's constructor.
+   *
+   * \note Delta checkpoints are only available when Axom is configured
+   * with hdf5.
+   *
+   * \param group         Group to write to output
+   * \param num_files     number of output data files
+   * \param file_base     base name for output files
+   * \param tree_pattern  Optional tree pattern string placed in root file
+   *
+   * \sa write(), resetDeltaBase()
+   */
+  void writeDelta(sidre::Group* group,
+                  int num_files,
+                  const std::string& file_base,
+                  const std::string& tree_pattern = "datagroup");
+
+  /*!
+   * \brief make the next call to writeDelta() write a new base checkpoint
+   *
+   * This must be called on all ranks in the communicator used in this
+   * object's constructor.
+   */
+  void resetDeltaBase();
+
   /*!
    * \brief write additional group to existing root file
    *
@@ -326,7 +478,8 @@ private:
   std::string createRootFile(const std::string& root_base,
                              int num_files,
                              const std::string& protocol,
-                             const std::string& tree_pattern);
+                             const std::string& tree_pattern,
+                             const std::string& delta_base = "");
 
   std::string getProtocol(const std::string& root_name);
 
@@ -344,6 +497,52 @@ private:
   void readSidreHDF5(sidre::Group* group,
                      const std::string& root_file,
                      bool preserve_contents = false);
+
+  /*!
+   * Collective operation to get the root file of the base checkpoint that
+   * a delta checkpoint refers to, or an empty string if the root file is
+   * not a delta checkpoint's.
+   */
+  std::string getDeltaBaseFromRoot(const std::string& root_name);
+
+  /*!
+   * \brief Load a Group from the group of a sidre_hdf5 data file, reading
+   *  the data that is unchanged in a delta checkpoint from its base.
+   */
+  void loadSidreHDF5Group(sidre::Group* group,
+                          hid_t h5_group_id,
+                          const std::string& delta_base,
+                          const std::string& base_pattern,
+                          int file_id,
+                          int input_rank,
+                          bool preserve_contents);
+
+  /*!
+   * \brief Load the external data that is unchanged in a delta checkpoint
+   *  from its base.
+   */
+  void loadDeltaExternalData(sidre::Group* group,
+                             hid_t h5_group_id,
+                             const std::string& delta_base,
+                             const std::string& base_pattern,
+                             int file_id,
+                             int input_rank);
+
+  /*!
+   * \brief Read the data listed in the unchanged tree of a delta
+   *  checkpoint from the base checkpoint into a Conduit Node.
+   *
+   * Only the paths that start with prefix are read, to the same path in
+   * node with the prefix removed. With a non-empty prefix, paths that do
+   * not exist in node are skipped.
+   */
+  void readDeltaBaseData(conduit::Node& node,
+                         const conduit::Node& unchanged,
+                         const std::string& prefix,
+                         const std::string& delta_base,
+                         const std::string& base_pattern,
+                         int file_id,
+                         int input_rank);
 #endif /* AXOM_USE_HDF5 */
 
   std::string getFileNameForRank(const std::string& file_pattern,
@@ -379,6 +578,43 @@ private:
    */
   std::string getSCRPath(const std::string& path);
 
+  /*!
+   * \brief Get the name of the group that holds the given rank's data in
+   *  a sidre_hdf5 data file.
+   */
+  std::string getHDF5DataGroupName(int num_files, int rank) const;
+
+#ifdef AXOM_USE_HDF5
+  /*!
+   * \brief Create the sidre_hdf5 data file, or open it if a previous rank
+   *  in the baton's set already created it.
+   */
+  hid_t createOrOpenHDF5DataFile(const IOBaton& baton,
+                                 const std::string& hdf5_name);
+
+  /*!
+   * \brief Write the sidre_hdf5 data files in aggregation mode.
+   *
+   * The save layout of each rank of a set of ranks that share a file is
+   * sent to the set's first rank, which receives the layouts one rank at a
+   * time, in rank order, and writes each one as soon as it is received.
+   */
+  void writeAggregatedHDF5(const conduit::Node& layout,
+                           int num_files,
+                           const std::string& root_name,
+                           const std::string& file_pattern);
+#endif /* AXOM_USE_HDF5 */
+
+  /*!
+   * \brief Write the staged data of an asynchronous write; runs on the
+   *  background thread.
+   */
+  void writeStagedData(int num_files,
+                       const std::string& file_base,
+                       const std::string& protocol,
+                       const std::string& root_name,
+                       const std::string& file_pattern);
+
   int m_comm_size;  // num procs in the MPI communicator
   int m_my_rank;    // rank of this proc
 
@@ -387,6 +623,23 @@ private:
   MPI_Comm m_mpi_comm;
 
   bool m_use_scr;
+
+  // State of aggregated writes
+  bool m_use_aggregation;
+  MPI_Comm m_set_comm;
+  int m_set_comm_num_files;
+
+  // State of delta checkpoints: the base's root file, number of files and
+  // the hashes of its data, keyed by path in the save layout
+  std::string m_delta_base_root;
+  int m_delta_base_num_files;
+  std::map<std::string, std::uint64_t> m_delta_hashes;
+
+  // State of asynchronous writes
+  MPI_Comm m_async_comm;
+  IOBaton* m_async_baton;
+  conduit::Node m_staged_data;
+  std::future<void> m_pending_write;
 };
 
 } /* end namespace sidre */
@@ -28,7 +28,9 @@ int main(int argc, char* argv[])
   ::testing::InitGoogleTest(&argc, argv);
   axom::slic::SimpleLogger logger;
 
-  MPI_Init(&argc, &argv);
+  // IOManager::writeAsync() writes from a background thread
+  int provided = MPI_THREAD_SINGLE;
+  MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
   result = RUN_ALL_TESTS();
   MPI_Finalize();
 
@@ -279,6 +279,285 @@ TEST(spio_parallel, write_read_write)
   delete ds;
 }
 
+//----------------------------------------------------------------------
+TEST(spio_parallel, async_writeread)
+{
+  int my_rank, num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  const int num_files = numOutputFiles(num_ranks);
+  const int num_elems = 1000;
+
+  // Create a DataStore with rank-dependent data
+  DataStore* ds = new DataStore();
+  Group* root = ds->getRoot();
+  root->createViewScalar<int>("fields/a/i0", 101 * my_rank);
+  View* view_d1 = root->createViewAndAllocate("fields/b/d1",
+                                              DataType::c_double(num_elems));
+  double* d1_vals = view_d1->getData();
+  for(int i = 0; i < num_elems; ++i)
+  {
+    d1_vals[i] = 0.5 * i + my_rank;
+  }
+
+  // The expected contents, since the data is modified during the writes
+  DataStore expected;
+  expected.getRoot()->deepCopyGroup(root->getGroup("fields"));
+
+  IOManager writer(MPI_COMM_WORLD);
+  EXPECT_TRUE(writer.test());
+
+  // Start the first write, then change the data while it is pending
+  const std::string filename_0 =
+    axom::fmt::format("out_spio_async_{}_0", num_ranks);
+  writer.writeAsync(root, num_files, filename_0, PROTOCOL);
+  for(int i = 0; i < num_elems; ++i)
+  {
+    d1_vals[i] = -1.0;
+  }
+
+  // Starting a second write waits for the first one
+  const std::string filename_1 =
+    axom::fmt::format("out_spio_async_{}_1", num_ranks);
+  writer.writeAsync(root, num_files, filename_1, PROTOCOL);
+
+  // Destroying the written group does not affect the pending write
+  root->destroyGroupAndData("fields");
+
+  writer.wait();
+  EXPECT_TRUE(writer.test());
+
+  // The first files hold the original data
+  {
+    DataStore ds_r;
+    IOManager reader(MPI_COMM_WORLD);
+    reader.read(ds_r.getRoot(), filename_0 + ROOT_EXT);
+
+    EXPECT_TRUE(ds_r.getRoot()->isEquivalentTo(expected.getRoot()));
+
+    double* d1_read = ds_r.getRoot()->getView("fields/b/d1")->getData();
+    for(int i = 0; i < num_elems; ++i)
+    {
+      EXPECT_DOUBLE_EQ(0.5 * i + my_rank, d1_read[i]);
+    }
+  }
+
+  // The second files hold the modified data
+  {
+    DataStore ds_r;
+    IOManager reader(MPI_COMM_WORLD);
+    reader.read(ds_r.getRoot(), filename_1 + ROOT_EXT);
+
+    int i0 = ds_r.getRoot()->getView("fields/a/i0")->getData();
+    EXPECT_EQ(101 * my_rank, i0);
+
+    double* d1_read = ds_r.getRoot()->getView("fields/b/d1")->getData();
+    for(int i = 0; i < num_elems; ++i)
+    {
+      EXPECT_DOUBLE_EQ(-1.0, d1_read[i]);
+    }
+  }
+
+  delete ds;
+}
+
+//----------------------------------------------------------------------
+TEST(spio_parallel, aggregated_writeread)
+{
+  int my_rank, num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  const int num_elems = 10 + my_rank;
+
+  // Create a DataStore with rank-dependent data, including a view whose
+  // size varies with the rank and an empty view
+  DataStore ds;
+  Group* root = ds.getRoot();
+  root->createViewScalar<int>("fields/a/i0", 101 * my_rank);
+  root->createViewString("fields/a/s0", axom::fmt::format("rank {}", my_rank));
+  View* view_d1 = root->createViewAndAllocate("fields/b/d1",
+                                              DataType::c_double(num_elems));
+  double* d1_vals = view_d1->getData();
+  for(int i = 0; i < num_elems; ++i)
+  {
+    d1_vals[i] = 0.5 * i + my_rank;
+  }
+  root->createViewAndAllocate("fields/c/i2", DataType::c_int(0));
+
+  // Write the data with and without aggregation, in sets of ranks of equal
+  // and of uneven sizes
+  IOManager writer(MPI_COMM_WORLD);
+  for(int num_files : {numOutputFiles(num_ranks), std::max(num_ranks - 1, 1)})
+  {
+    const std::string filename =
+      axom::fmt::format("out_spio_agg_{}_{}", num_ranks, num_files);
+    const std::string baton_filename =
+      axom::fmt::format("out_spio_agg_baton_{}_{}", num_ranks, num_files);
+
+    writer.setUseAggregation(false);
+    EXPECT_FALSE(writer.getUseAggregation());
+    writer.write(root, num_files, baton_filename, PROTOCOL);
+
+    writer.setUseAggregation(true);
+    EXPECT_TRUE(writer.getUseAggregation());
+    writer.write(root, num_files, filename, PROTOCOL);
+
+    // Both sets of files read back to the original data
+    for(const auto& name : {filename, baton_filename})
+    {
+      DataStore ds_r;
+      IOManager reader(MPI_COMM_WORLD);
+      EXPECT_EQ(num_files, reader.getNumFilesFromRoot(name + ROOT_EXT));
+      reader.read(ds_r.getRoot(), name + ROOT_EXT);
+
+      EXPECT_TRUE(ds_r.getRoot()->isEquivalentTo(root));
+
+      View* view_r = ds_r.getRoot()->getView("fields/b/d1");
+      ASSERT_EQ(num_elems, view_r->getNumElements());
+      double* d1_read = view_r->getData();
+      for(int i = 0; i < num_elems; ++i)
+      {
+        EXPECT_DOUBLE_EQ(0.5 * i + my_rank, d1_read[i]);
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+#ifdef AXOM_USE_HDF5
+TEST(spio_parallel, delta_writeread)
+{
+  int my_rank, num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  const int num_elems = 1000;
+
+  for(bool use_aggregation : {false, true})
+  {
+    // The aggregated writes use sets of ranks of uneven sizes
+    const int num_files = use_aggregation ? std::max(num_ranks - 1, 1)
+                                          : numOutputFiles(num_ranks);
+
+    // Create a DataStore with two arrays, of which only the second one
+    // changes, and an external array
+    DataStore ds;
+    Group* root = ds.getRoot();
+    root->createViewScalar<int>("cycle", 0);
+    double* d0_vals = root->createViewAndAllocate("fields/d0",
+                                                  DataType::c_double(num_elems))
+                        ->getData();
+    double* d1_vals = root->createViewAndAllocate("fields/d1",
+                                                  DataType::c_double(num_elems))
+                        ->getData();
+    std::vector<int> ext_vals(num_elems);
+    for(int i = 0; i < num_elems; ++i)
+    {
+      d0_vals[i] = 0.5 * i + my_rank;
+      d1_vals[i] = 0.0;
+      ext_vals[i] = i - my_rank;
+    }
+    root->createView("fields/ext",
+                     axom::sidre::INT_ID,
+                     num_elems,
+                     ext_vals.data());
+
+    const std::string prefix =
+      axom::fmt::format("out_spio_delta{}", use_aggregation ? "_agg" : "");
+    const std::string base_name =
+      axom::fmt::format("{}_{}_0", prefix, num_ranks);
+    const std::string delta_name =
+      axom::fmt::format("{}_{}_1", prefix, num_ranks);
+
+    IOManager writer(MPI_COMM_WORLD);
+    writer.setUseAggregation(use_aggregation);
+    writer.writeDelta(root, num_files, base_name);
+
+    // Change the scalar and the second array, and add a new array
+    root->getView("cycle")->setScalar(1);
+    for(int i = 0; i < num_elems; ++i)
+    {
+      d1_vals[i] = -1.0 * i;
+    }
+    root->createViewAndAllocate("fields/d2", DataType::c_int(num_elems));
+
+    writer.writeDelta(root, num_files, delta_name);
+
+    // The delta refers to the base and holds only the changed arrays
+    if(my_rank == 0)
+    {
+      conduit::Node n;
+      conduit::relay::io::load(delta_name + ROOT_EXT + ":delta_base",
+                               "hdf5",
+                               n);
+      EXPECT_EQ(base_name + ROOT_EXT, n.as_string());
+
+      const std::string group_name =
+        num_files == num_ranks ? "datagroup" : "datagroup_0000000";
+      const std::string data_name =
+        axom::fmt::format("{0}/{0}_0000000.hdf5", delta_name);
+      hid_t file_id = conduit::relay::io::hdf5_open_file_for_read(data_name);
+      EXPECT_TRUE(conduit::relay::io::hdf5_has_path(
+        file_id,
+        group_name + "/sidre_delta/unchanged/sidre/external/fields/ext"));
+      conduit::Node buffers;
+      conduit::relay::io::hdf5_read(file_id,
+                                    group_name + "/sidre/buffers",
+                                    buffers);
+      EXPECT_EQ(3, buffers.number_of_children());
+
+      int num_written = 0;
+      for(int i = 0; i < buffers.number_of_children(); ++i)
+      {
+        num_written += buffers.child(i).has_child("data") ? 1 : 0;
+      }
+      EXPECT_EQ(2, num_written);
+      conduit::relay::io::hdf5_close_file(file_id);
+    }
+
+    // Reading the delta restores the full state
+    {
+      DataStore ds_r;
+      Group* root_r = ds_r.getRoot();
+      IOManager reader(MPI_COMM_WORLD);
+      reader.read(root_r, delta_name + ROOT_EXT);
+
+      int cycle = root_r->getView("cycle")->getData();
+      EXPECT_EQ(1, cycle);
+      EXPECT_TRUE(root_r->hasView("fields/d2"));
+
+      double* d0_read = root_r->getView("fields/d0")->getData();
+      double* d1_read = root_r->getView("fields/d1")->getData();
+      for(int i = 0; i < num_elems; ++i)
+      {
+        EXPECT_DOUBLE_EQ(0.5 * i + my_rank, d0_read[i]);
+        EXPECT_DOUBLE_EQ(-1.0 * i, d1_read[i]);
+      }
+
+      std::vector<int> ext_read(num_elems, 0);
+      root_r->getView("fields/ext")->setExternalDataPtr(ext_read.data());
+      reader.loadExternalData(root_r, delta_name + ROOT_EXT);
+      EXPECT_EQ(ext_vals, ext_read);
+    }
+
+    // After a reset, the next checkpoint is a new base
+    writer.resetDeltaBase();
+    const std::string new_base_name =
+      axom::fmt::format("{}_{}_2", prefix, num_ranks);
+    writer.writeDelta(root, num_files, new_base_name);
+    if(my_rank == 0)
+    {
+      hid_t file_id =
+        conduit::relay::io::hdf5_open_file_for_read(new_base_name + ROOT_EXT);
+      EXPECT_FALSE(conduit::relay::io::hdf5_has_path(file_id, "delta_base"));
+      conduit::relay::io::hdf5_close_file(file_id);
+    }
+  }
+}
+#endif /* AXOM_USE_HDF5 */
+
 //------------------------------------------------------------------------------
 TEST(spio_parallel, external_writeread)
 {
@@ -10,9 +10,13 @@
 
 #include "axom/slic/core/LogStream.hpp"
 
+#include "axom/fmt.hpp"
+
 // C/C++ includes
+#include <algorithm>
+#include <cstring>
 #include <ctime>
-#include <sstream>
+#include <utility>
 
 namespace axom
 {
@@ -21,32 +25,67 @@ namespace slic
 //------------------------------------------------------------------------------
 LogStream::LogStream()
   : m_formatString("*****\n[<LEVEL>]\n\n <MESSAGE> \n\n <FILE>\n<LINE>\n****\n")
-{ }
+  , m_timeStampTime(-1)
+{
+  compileFormatString();
+}
 
 //------------------------------------------------------------------------------
 LogStream::~LogStream() { }
 
 //------------------------------------------------------------------------------
-void LogStream::replaceKey(std::string& msg,
-                           const std::string& key,
-                           const std::string& value,
-                           std::size_t pos)
+void LogStream::compileFormatString()
 {
-  if(pos == std::string::npos)
+  const std::pair<const char*, FormatKey> keys[] = {
+    {"<LEVEL>", FormatKey::LEVEL},
+    {"<MESSAGE>", FormatKey::MESSAGE},
+    {"<TAG>", FormatKey::TAG},
+    {"<FILE>", FormatKey::FILE_NAME},
+    {"<RANK>", FormatKey::RANK},
+    {"<RANK_COUNT>", FormatKey::RANK_COUNT},
+    {"<LINE>", FormatKey::LINE},
+    {"<TIMESTAMP>", FormatKey::TIMESTAMP}};
+
+  // Find the first occurrence of each keyword. Since keywords only contain
+  // a single '<', their occurrences cannot overlap.
+  std::vector<FormatToken> keyTokens;
+  for(const auto& key : keys)
   {
-    pos = msg.find(key);
+    const std::size_t pos = m_formatString.find(key.first);
+    if(pos != std::string::npos)
+    {
+      keyTokens.push_back({key.second, pos, std::strlen(key.first)});
+    }
   }
-
-  if(pos != std::string::npos)
+  std::sort(keyTokens.begin(),
+            keyTokens.end(),
+            [](const FormatToken& a, const FormatToken& b) {
+              return a.offset < b.offset;
+            });
+
+  // Interleave the keywords with the literal text between them
+  m_formatTokens.clear();
+  std::size_t literalStart = 0;
+  for(const FormatToken& keyToken : keyTokens)
   {
-    msg = msg.substr(0, pos) + value +
-      msg.substr(pos + key.length(), msg.length() - 1);
-
-  }  // END if
+    if(keyToken.offset > literalStart)
+    {
+      m_formatTokens.push_back(
+        {FormatKey::LITERAL, literalStart, keyToken.offset - literalStart});
+    }
+    m_formatTokens.push_back(keyToken);
+    literalStart = keyToken.offset + keyToken.length;
+  }
+  if(literalStart < m_formatString.size())
+  {
+    m_formatTokens.push_back({FormatKey::LITERAL,
+                              literalStart,
+                              m_formatString.size() - literalStart});
+  }
 }
 
 //------------------------------------------------------------------------------
-std::string LogStream::getTimeStamp()
+const std::string& LogStream::getTimeStamp()
 {
 #ifdef WIN32
   #pragma warning(disable : 4996)  // _CRT_SECURE_NO_WARNINGS
@@ -54,53 +93,71 @@ std::string LogStream::getTimeStamp()
 
   std::time_t t;
   std::time(&t);
-  std::string timestamp(std::asctime(std::localtime(&t)));
-
-  // Remove trailing newline added by previous line
-  if(timestamp[timestamp.size() - 1] == '\n')
+  if(t != m_timeStampTime)
   {
-    timestamp.erase(timestamp.size() - 1);
+    m_timeStampTime = t;
+    m_timeStamp = std::asctime(std::localtime(&t));
+
+    // Remove trailing newline added by previous line
+    if(!m_timeStamp.empty() && m_timeStamp[m_timeStamp.size() - 1] == '\n')
+    {
+      m_timeStamp.erase(m_timeStamp.size() - 1);
+    }
   }
-  return timestamp;
+  return m_timeStamp;
 }
 
 //------------------------------------------------------------------------------
-std::string LogStream::getFormatedMessage(const std::string& msgLevel,
-                                          const std::string& message,
-                                          const std::string& tagName,
-                                          const std::string& rank,
-                                          const std::string& rank_count,
-                                          const std::string& fileName,
-                                          int line)
+const std::string& LogStream::getFormatedMessage(const std::string& msgLevel,
+                                                 const std::string& message,
+                                                 const std::string& tagName,
+                                                 const std::string& rank,
+                                                 const std::string& rank_count,
+                                                 const std::string& fileName,
+                                                 int line)
 {
-  std::string msg = m_formatString;
-
-  this->replaceKey(msg, "<LEVEL>", msgLevel);
-  this->replaceKey(msg, "<MESSAGE>", message);
-  this->replaceKey(msg, "<TAG>", tagName);
-  this->replaceKey(msg, "<FILE>", fileName);
-  this->replaceKey(msg, "<RANK>", rank);
-  this->replaceKey(msg, "<RANK_COUNT>", rank_count);
-
-  if(line != MSG_IGNORE_LINE)
-  {
-    std::ostringstream oss;
-    oss << line;
-
-    this->replaceKey(msg, "<LINE>", oss.str());
-  }
-  else
-  {
-    this->replaceKey(msg, "<LINE>", "");
-  }
+  // Reuse the buffer's capacity from previous messages
+  m_formattedMessage.clear();
 
-  std::size_t pos = msg.find("<TIMESTAMP>");
-  if(pos != std::string::npos)
+  for(const FormatToken& token : m_formatTokens)
   {
-    this->replaceKey(msg, "<TIMESTAMP>", this->getTimeStamp(), pos);
+    switch(token.key)
+    {
+    case FormatKey::LITERAL:
+      m_formattedMessage.append(m_formatString, token.offset, token.length);
+      break;
+    case FormatKey::LEVEL:
+      m_formattedMessage += msgLevel;
+      break;
+    case FormatKey::MESSAGE:
+      m_formattedMessage += message;
+      break;
+    case FormatKey::TAG:
+      m_formattedMessage += tagName;
+      break;
+    case FormatKey::FILE_NAME:
+      m_formattedMessage += fileName;
+      break;
+    case FormatKey::RANK:
+      m_formattedMessage += rank;
+      break;
+    case FormatKey::RANK_COUNT:
+      m_formattedMessage += rank_count;
+      break;
+    case FormatKey::LINE:
+      if(line != MSG_IGNORE_LINE)
+      {
+        const axom::fmt::format_int lineString(line);
+        m_formattedMessage.append(lineString.data(), lineString.size());
+      }
+      break;
+    case FormatKey::TIMESTAMP:
+      m_formattedMessage += getTimeStamp();
+      break;
+    }
   }
 
-  return (msg);
+  return m_formattedMessage;
 }
 
 } /* namespace slic */
@@ -24,7 +24,9 @@
 /// @}
 
 // C/C++ includes
+#include <ctime>   // For std::time_t
 #include <string>  // For STL string
+#include <vector>  // For STL vector
 
 namespace axom
 {
@@ -77,8 +79,16 @@ public:
    *         std::string( "* RANK_COUNT=<RANK_COUNT>\n" ) +
    *         std::string( "***********************************\n" );
    * \endcode
+   *
+   * \note The format string is split into keywords and literal text once,
+   *  when it is set, and only the first occurrence of each keyword is
+   *  replaced.
    */
-  void setFormatString(const std::string& format) { m_formatString = format; }
+  void setFormatString(const std::string& format)
+  {
+    m_formatString = format;
+    compileFormatString();
+  }
 
   /*!
    * \brief Appends the given message to the stream.
@@ -160,36 +170,67 @@ protected:
    *
    * \return str the formatted message string.
    * \post str != "".
+   *
+   * \note The returned string is a buffer owned by this stream, which is
+   *  reused by the next call to getFormatedMessage().
    */
-  std::string getFormatedMessage(const std::string& msgLevel,
-                                 const std::string& message,
-                                 const std::string& tagName,
-                                 const std::string& rank,
-                                 const std::string& rank_count,
-                                 const std::string& fileName,
-                                 int line);
+  const std::string& getFormatedMessage(const std::string& msgLevel,
+                                        const std::string& message,
+                                        const std::string& tagName,
+                                        const std::string& rank,
+                                        const std::string& rank_count,
+                                        const std::string& fileName,
+                                        int line);
 
   /*!
    * \brief Returns a time-stamp.
    *
    * \return str a textual representation of the current time.
+   *
+   * \note The time-stamp has a resolution of one second and is only
+   *  regenerated when the second changes.
    */
-  std::string getTimeStamp();
+  const std::string& getTimeStamp();
 
 private:
+  /*!
+   * \brief Keywords of the format string, or LITERAL for the text between
+   *  keywords.
+   */
+  enum class FormatKey
+  {
+    LITERAL,
+    LEVEL,
+    MESSAGE,
+    TAG,
+    FILE_NAME,
+    RANK,
+    RANK_COUNT,
+    LINE,
+    TIMESTAMP
+  };
+
+  /*!
+   * \brief A keyword or literal text of the format string. Literal text is
+   *  given by its offset and length within m_formatString.
+   */
+  struct FormatToken
+  {
+    FormatKey key;
+    std::size_t offset;
+    std::size_t length;
+  };
+
   std::string m_formatString;
+  std::vector<FormatToken> m_formatTokens;
+  std::string m_formattedMessage;
+  std::string m_timeStamp;
+  std::time_t m_timeStampTime;
 
   /*!
-   * \brief Replaces the given key in the message string with the given value.
-   *
-   * \param [in,out] msg the message string that will be modified.
-   * \param [in] key the key in the message that will be replace.
-   * \param [in] value the value to replace it with.
+   * \brief Splits m_formatString into the tokens used by getFormatedMessage().
    */
-  void replaceKey(std::string& msg,
-                  const std::string& key,
-                  const std::string& value,
-                  std::size_t pos = std::string::npos);
+  void compileFormatString();
 
   DISABLE_COPY_AND_ASSIGNMENT(LogStream);
   DISABLE_MOVE_AND_ASSIGNMENT(LogStream);
@@ -62,6 +62,9 @@ Logger::Logger(const std::string& name)
 //------------------------------------------------------------------------------
 Logger::~Logger()
 {
+  // stop the writer thread before the streams are deleted
+  m_asyncWriter.reset();
+
   for(auto& kv : m_streamObjectsManager)
   {
     delete kv.second;
@@ -133,6 +136,7 @@ void Logger::addStreamToMsgLevel(LogStream* ls,
     return;
   }
 
+  std::lock_guard<std::mutex> lock(m_streamMutex);
   m_logStreams[level].push_back(ls);
 
   if(pass_ownership)
@@ -152,6 +156,7 @@ void Logger::addStreamToTag(LogStream* ls,
     return;
   }
 
+  std::lock_guard<std::mutex> lock(m_streamMutex);
   if(m_taggedStreams.find(tag) == m_taggedStreams.end())
   {
     m_taggedStreams[tag] = std::vector<LogStream*> {ls};
@@ -330,6 +335,38 @@ void Logger::logMessage(message::Level level,
     return;
   }
 
+  if(m_asyncWriter != nullptr && level != message::Error)
+  {
+    m_asyncWriter->enqueue(level,
+                           message,
+                           tagName,
+                           fileName,
+                           line,
+                           filter_duplicates,
+                           tag_stream_only);
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(m_streamMutex);
+  drainAsynchronousMessages();
+  dispatchMessage(level,
+                  message,
+                  tagName,
+                  fileName,
+                  line,
+                  filter_duplicates,
+                  tag_stream_only);
+}
+
+//------------------------------------------------------------------------------
+void Logger::dispatchMessage(message::Level level,
+                             const std::string& message,
+                             const std::string& tagName,
+                             const std::string& fileName,
+                             int line,
+                             bool filter_duplicates,
+                             bool tag_stream_only)
+{
   // Message for message levels
   if(tag_stream_only == false)
   {
@@ -362,9 +399,54 @@ void Logger::logMessage(message::Level level,
   }
 }
 
+//------------------------------------------------------------------------------
+void Logger::enableAsynchronousLogging(int capacity, async::Policy policy)
+{
+  if(capacity <= 0)
+  {
+    std::cerr << "ERROR: asynchronous logging queue capacity must be "
+                 "positive!\n";
+    return;
+  }
+
+  if(m_asyncWriter != nullptr)
+  {
+    return;
+  }
+
+  m_asyncWriter.reset(new internal::AsyncWriter(
+    m_streamMutex,
+    [this](const internal::MessageRecord& record) {
+      this->dispatchMessage(record.level,
+                            record.message,
+                            record.tagName,
+                            record.fileName,
+                            record.line,
+                            record.filter_duplicates,
+                            record.tag_stream_only);
+    },
+    capacity,
+    policy));
+}
+
+//------------------------------------------------------------------------------
+void Logger::disableAsynchronousLogging() { m_asyncWriter.reset(); }
+
+//------------------------------------------------------------------------------
+void Logger::drainAsynchronousMessages()
+{
+  if(m_asyncWriter != nullptr)
+  {
+    m_asyncWriter->drain();
+  }
+}
+
 //------------------------------------------------------------------------------
 void Logger::outputLocalMessages()
 {
+  std::lock_guard<std::mutex> lock(m_streamMutex);
+  drainAsynchronousMessages();
+
   //Output for all message levels
   for(int level = message::Error; level < message::Num_Levels; ++level)
   {
@@ -392,6 +474,9 @@ void Logger::outputLocalMessages()
 //------------------------------------------------------------------------------
 void Logger::flushStreams()
 {
+  std::lock_guard<std::mutex> lock(m_streamMutex);
+  drainAsynchronousMessages();
+
   //Flush for all message levels
   for(int level = message::Error; level < message::Num_Levels; ++level)
   {
@@ -419,6 +504,9 @@ void Logger::flushStreams()
 //------------------------------------------------------------------------------
 void Logger::pushStreams()
 {
+  std::lock_guard<std::mutex> lock(m_streamMutex);
+  drainAsynchronousMessages();
+
   //Push for all message levels
   for(int level = message::Error; level < message::Num_Levels; ++level)
   {
@@ -11,11 +11,15 @@
 #define LOGGER_HPP_
 
 #include "axom/slic/core/MessageLevel.hpp"
+#include "axom/slic/internal/AsyncWriter.hpp"
 
 // C/C++ includes
-#include <string>  // for STL string
-#include <vector>  // for STL vector
-#include <map>     // for STL map
+#include <cstdint>  // for std::uint64_t
+#include <memory>   // for std::unique_ptr
+#include <mutex>    // for std::mutex
+#include <string>   // for STL string
+#include <vector>   // for STL vector
+#include <map>      // for STL map
 
 #include "axom/core/Macros.hpp"
 
@@ -45,6 +49,11 @@ using AbortFunctionPtr = void (*)();
  *  application to use some of the predefined LogStream mechanisms or implement
  *  a custom one by implementing a derivative of the LogStream class.
  *
+ *  Messages may be logged concurrently from multiple threads; appending to
+ *  the LogStreams is serialized by the Logger. Alternatively, asynchronous
+ *  logging may be enabled, in which case each thread queues its messages and
+ *  a background thread appends them to the LogStreams.
+ *
  * \see LogStream MessageType
  */
 class Logger
@@ -309,6 +318,61 @@ public:
                   bool filter_duplicates = false,
                   bool tag_stream_only = false);
 
+  /*!
+   * \brief Enables asynchronous logging.
+   *
+   *  Once enabled, logMessage() copies the message into a bounded queue owned
+   *  by the calling thread and returns. A background thread periodically
+   *  appends the queued messages to the LogStreams. Error messages are not
+   *  queued; they are appended right away, after all queued messages, since
+   *  they typically precede an abort.
+   *
+   *  The queues are also drained by flushStreams(), pushStreams(),
+   *  outputLocalMessages(), abort() and finalize().
+   *
+   * \param [in] capacity number of messages each thread's queue can hold.
+   * \param [in] policy whether a thread waits for room in its queue when it
+   *  is full (async::Block) or discards the message (async::Drop).
+   *
+   * \note Messages that are still queued are lost if the application
+   *  crashes without calling abort() or finalize().
+   * \note LogStream::append() is called from a background thread. Streams
+   *  whose append() makes MPI calls require MPI_THREAD_MULTIPLE; the
+   *  streams provided by slic do not make MPI calls in append().
+   * \note Does nothing if asynchronous logging is already enabled.
+   * \pre capacity > 0
+   * \pre No other thread is logging messages with this Logger.
+   */
+  void enableAsynchronousLogging(int capacity = 1024,
+                                 async::Policy policy = async::Block);
+
+  /*!
+   * \brief Disables asynchronous logging, after appending all queued
+   *  messages to the LogStreams.
+   *
+   * \pre No other thread is logging messages with this Logger.
+   */
+  void disableAsynchronousLogging();
+
+  /*!
+   * \brief Checks if asynchronous logging is enabled.
+   * \return status true if asynchronous logging is enabled, else, false.
+   */
+  bool isAsynchronousLoggingEnabled() const
+  {
+    return m_asyncWriter != nullptr;
+  }
+
+  /*!
+   * \brief Returns the number of messages discarded with the async::Drop
+   *  policy since asynchronous logging was last enabled.
+   */
+  std::uint64_t getNumDroppedMessages() const
+  {
+    return (m_asyncWriter != nullptr) ? m_asyncWriter->getNumDroppedMessages()
+                                      : 0;
+  }
+
   /*!
    * \brief For the current rank, outputs messages from all streams to the
    *        console
@@ -444,6 +508,24 @@ private:
    */
   ~Logger();
 
+  /*!
+   * \brief Appends the given message to the LogStreams it is bound to.
+   * \pre The caller holds m_streamMutex.
+   */
+  void dispatchMessage(message::Level level,
+                       const std::string& message,
+                       const std::string& tagName,
+                       const std::string& fileName,
+                       int line,
+                       bool filter_duplicates,
+                       bool tag_stream_only);
+
+  /*!
+   * \brief Appends all asynchronously queued messages to the LogStreams.
+   * \pre The caller holds m_streamMutex.
+   */
+  void drainAsynchronousMessages();
+
   /// \name Private class members
   ///@{
 
@@ -457,6 +539,9 @@ private:
   std::map<LogStream*, LogStream*> m_streamObjectsManager;
   std::vector<LogStream*> m_logStreams[message::Num_Levels];
 
+  std::mutex m_streamMutex;
+  std::unique_ptr<internal::AsyncWriter> m_asyncWriter;
+
   ///@}
 
   DISABLE_COPY_AND_ASSIGNMENT(Logger);
@@ -213,6 +213,34 @@ int getNumStreamsWithTag(const std::string& tag)
   return Logger::getActiveLogger()->getNumStreamsWithTag(tag);
 }
 
+//------------------------------------------------------------------------------
+void enableAsynchronousLogging(int capacity, async::Policy policy)
+{
+  ensureInitialized();
+  Logger::getActiveLogger()->enableAsynchronousLogging(capacity, policy);
+}
+
+//------------------------------------------------------------------------------
+void disableAsynchronousLogging()
+{
+  ensureInitialized();
+  Logger::getActiveLogger()->disableAsynchronousLogging();
+}
+
+//------------------------------------------------------------------------------
+bool isAsynchronousLoggingEnabled()
+{
+  ensureInitialized();
+  return Logger::getActiveLogger()->isAsynchronousLoggingEnabled();
+}
+
+//------------------------------------------------------------------------------
+std::uint64_t getNumDroppedMessages()
+{
+  ensureInitialized();
+  return Logger::getActiveLogger()->getNumDroppedMessages();
+}
+
 //------------------------------------------------------------------------------
 void logMessage(message::Level level,
                 const std::string& message,
@@ -19,6 +19,7 @@
 #include "axom/export/slic.h"
 
 // C/C++ includes
+#include <cstdint>
 #include <iostream>
 #include <sstream>
 
@@ -275,6 +276,45 @@ void addStreamToAllTags(GenericOutputStream* ls);
 */
 int getNumStreamsWithTag(const std::string& tag);
 
+/*!
+ * \brief Enables asynchronous logging on the active logger.
+ *
+ *  Each thread then queues its messages in a bounded buffer and a background
+ *  thread appends them to the registered streams, so that logging from
+ *  within threaded regions does not wait on slow streams. Error messages are
+ *  appended right away, after all queued messages.
+ *
+ * \param [in] capacity number of messages each thread's queue can hold.
+ * \param [in] policy whether a thread waits for room in its queue when it
+ *  is full (async::Block) or discards the message (async::Drop).
+ *
+ * \pre No other thread is logging messages.
+ * \see Logger::enableAsynchronousLogging()
+ */
+void enableAsynchronousLogging(int capacity = 1024,
+                               async::Policy policy = async::Block);
+
+/*!
+ * \brief Disables asynchronous logging on the active logger, after
+ *  appending all queued messages to the registered streams.
+ *
+ * \pre No other thread is logging messages.
+ */
+void disableAsynchronousLogging();
+
+/*!
+ * \brief Checks if asynchronous logging is enabled on the active logger.
+ *
+ * \return status true if asynchronous logging is enabled, else, false.
+ */
+bool isAsynchronousLoggingEnabled();
+
+/*!
+ * \brief Returns the number of messages the active logger discarded because
+ *  a thread's queue was full and the policy is async::Drop.
+ */
+std::uint64_t getNumDroppedMessages();
+
 /*!
  * \brief Logs the given message to all registered streams.
  *
@@ -0,0 +1,236 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/slic/internal/AsyncWriter.hpp"
+
+// C/C++ includes
+#include <chrono>  // for std::chrono::milliseconds
+
+namespace axom
+{
+namespace slic
+{
+namespace internal
+{
+namespace
+{
+// How long the writer thread sleeps when it has not been woken up
+constexpr std::chrono::milliseconds DRAIN_INTERVAL(10);
+
+// Gives every AsyncWriter a distinct id, so a thread's cached buffer is never
+// used with an AsyncWriter other than the one that created it.
+std::atomic<std::uint64_t> s_nextWriterId(1);
+
+// The calling thread's buffer for the AsyncWriter with the given id
+struct ThreadBufferCache
+{
+  std::uint64_t writerId;
+  MessageRingBuffer* buffer;
+};
+
+thread_local ThreadBufferCache t_bufferCache = {0, nullptr};
+
+}  // end anonymous namespace
+
+//------------------------------------------------------------------------------
+MessageRingBuffer::MessageRingBuffer(int capacity) : m_head(0), m_tail(0)
+{
+  std::uint64_t size = 1;
+  while(size < static_cast<std::uint64_t>(capacity))
+  {
+    size <<= 1;
+  }
+
+  m_slots.resize(size);
+  m_mask = size - 1;
+}
+
+//------------------------------------------------------------------------------
+bool MessageRingBuffer::tryPush(message::Level level,
+                                const std::string& message,
+                                const std::string& tagName,
+                                const std::string& fileName,
+                                int line,
+                                bool filter_duplicates,
+                                bool tag_stream_only)
+{
+  const std::uint64_t tail = m_tail.load(std::memory_order_relaxed);
+  if(tail - m_head.load(std::memory_order_acquire) == m_slots.size())
+  {
+    return false;
+  }
+
+  MessageRecord& record = m_slots[tail & m_mask];
+  record.level = level;
+  record.message.assign(message);
+  record.tagName.assign(tagName);
+  record.fileName.assign(fileName);
+  record.line = line;
+  record.filter_duplicates = filter_duplicates;
+  record.tag_stream_only = tag_stream_only;
+
+  m_tail.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void MessageRingBuffer::drain(
+  const std::function<void(const MessageRecord&)>& dispatch)
+{
+  std::uint64_t head = m_head.load(std::memory_order_relaxed);
+  const std::uint64_t tail = m_tail.load(std::memory_order_acquire);
+
+  for(; head != tail; ++head)
+  {
+    dispatch(m_slots[head & m_mask]);
+
+    // release each slot as soon as it is written, so a blocked producer
+    // can make progress while the rest of the queue is drained
+    m_head.store(head + 1, std::memory_order_release);
+  }
+}
+
+//------------------------------------------------------------------------------
+AsyncWriter::AsyncWriter(std::mutex& streamMutex,
+                         DispatchFunction dispatch,
+                         int capacity,
+                         async::Policy policy)
+  : m_streamMutex(streamMutex)
+  , m_dispatch(std::move(dispatch))
+  , m_capacity(capacity)
+  , m_policy(policy)
+  , m_id(s_nextWriterId.fetch_add(1))
+  , m_numDropped(0)
+  , m_wakeRequested(false)
+  , m_stopRequested(false)
+{
+  m_thread = std::thread(&AsyncWriter::run, this);
+}
+
+//------------------------------------------------------------------------------
+AsyncWriter::~AsyncWriter()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_wakeMutex);
+    m_stopRequested = true;
+  }
+  m_wakeCondition.notify_one();
+
+  // the writer thread drains the queues one last time before it exits
+  m_thread.join();
+}
+
+//------------------------------------------------------------------------------
+void AsyncWriter::enqueue(message::Level level,
+                          const std::string& message,
+                          const std::string& tagName,
+                          const std::string& fileName,
+                          int line,
+                          bool filter_duplicates,
+                          bool tag_stream_only)
+{
+  MessageRingBuffer* buffer = getThreadBuffer();
+
+  while(!buffer->tryPush(level,
+                         message,
+                         tagName,
+                         fileName,
+                         line,
+                         filter_duplicates,
+                         tag_stream_only))
+  {
+    if(m_policy == async::Drop)
+    {
+      m_numDropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+
+    // back-pressure: wait for the writer thread to make room
+    notify();
+    std::this_thread::yield();
+  }
+
+  // wake the writer early once the queue is half full, so that bursts of
+  // messages do not have to wait out the full drain interval
+  if(buffer->size() == buffer->capacity() / 2)
+  {
+    notify();
+  }
+}
+
+//------------------------------------------------------------------------------
+void AsyncWriter::drain()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    m_drainList = m_bufferList;
+  }
+
+  for(MessageRingBuffer* buffer : m_drainList)
+  {
+    buffer->drain(m_dispatch);
+  }
+}
+
+//------------------------------------------------------------------------------
+MessageRingBuffer* AsyncWriter::getThreadBuffer()
+{
+  if(t_bufferCache.writerId == m_id)
+  {
+    return t_bufferCache.buffer;
+  }
+
+  std::lock_guard<std::mutex> lock(m_buffersMutex);
+
+  // a thread id may be reused by a new thread once the old thread exits, in
+  // which case the new thread takes over the old thread's buffer
+  std::unique_ptr<MessageRingBuffer>& buffer =
+    m_buffers[std::this_thread::get_id()];
+  if(buffer == nullptr)
+  {
+    buffer.reset(new MessageRingBuffer(m_capacity));
+    m_bufferList.push_back(buffer.get());
+  }
+
+  t_bufferCache.writerId = m_id;
+  t_bufferCache.buffer = buffer.get();
+  return buffer.get();
+}
+
+//------------------------------------------------------------------------------
+void AsyncWriter::notify()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_wakeMutex);
+    m_wakeRequested = true;
+  }
+  m_wakeCondition.notify_one();
+}
+
+//------------------------------------------------------------------------------
+void AsyncWriter::run()
+{
+  bool stop = false;
+  while(!stop)
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_wakeMutex);
+      m_wakeCondition.wait_for(lock, DRAIN_INTERVAL, [this] {
+        return m_wakeRequested || m_stopRequested;
+      });
+      m_wakeRequested = false;
+      stop = m_stopRequested;
+    }
+
+    std::lock_guard<std::mutex> lock(m_streamMutex);
+    drain();
+  }
+}
+
+} /* namespace internal */
+
+} /* namespace slic */
+
+} /* namespace axom */
@@ -0,0 +1,242 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ * \file AsyncWriter.hpp
+ */
+
+#ifndef SLIC_ASYNCWRITER_HPP_
+#define SLIC_ASYNCWRITER_HPP_
+
+#include "axom/slic/core/MessageLevel.hpp"
+#include "axom/core/Macros.hpp"
+
+// C/C++ includes
+#include <atomic>              // for std::atomic
+#include <condition_variable>  // for std::condition_variable
+#include <cstdint>             // for std::uint64_t
+#include <functional>          // for std::function
+#include <map>                 // for STL map
+#include <memory>              // for std::unique_ptr
+#include <mutex>               // for std::mutex
+#include <string>              // for STL string
+#include <thread>              // for std::thread
+#include <vector>              // for STL vector
+
+namespace axom
+{
+namespace slic
+{
+namespace async
+{
+/*!
+ * \enum Policy
+ *
+ * \brief Enumerates what a thread does when its message queue is full.
+ */
+enum Policy
+{
+  Block,  //!< BLOCK wait for the writer thread to make room in the queue.
+  Drop    //!< DROP discard the new message and count it as dropped.
+};
+
+}  // namespace async
+
+namespace internal
+{
+/*!
+ * \struct MessageRecord
+ *
+ * \brief Holds the arguments of a single Logger::logMessage() call.
+ */
+struct MessageRecord
+{
+  message::Level level;
+  std::string message;
+  std::string tagName;
+  std::string fileName;
+  int line;
+  bool filter_duplicates;
+  bool tag_stream_only;
+};
+
+/*!
+ * \class MessageRingBuffer
+ *
+ * \brief A bounded, lock-free, single-producer/single-consumer queue of
+ *  MessageRecords.
+ *
+ *  The slots are allocated once and reused, so the strings in a slot keep
+ *  their capacity and pushing a message does not allocate once the queue
+ *  has warmed up.
+ */
+class MessageRingBuffer
+{
+public:
+  /*!
+   * \brief Creates a queue that holds at least the given number of records.
+   * \param [in] capacity the requested capacity, rounded up to a power of 2.
+   */
+  explicit MessageRingBuffer(int capacity);
+
+  /*!
+   * \brief Copies the given message into the queue. Producer thread only.
+   * \return status true if the message was queued, false if the queue is full.
+   */
+  bool tryPush(message::Level level,
+               const std::string& message,
+               const std::string& tagName,
+               const std::string& fileName,
+               int line,
+               bool filter_duplicates,
+               bool tag_stream_only);
+
+  /*!
+   * \brief Hands every queued record to the given function, oldest first.
+   *  Consumer thread only.
+   */
+  void drain(const std::function<void(const MessageRecord&)>& dispatch);
+
+  /*!
+   * \brief Returns the number of records currently in the queue.
+   */
+  std::uint64_t size() const
+  {
+    return m_tail.load(std::memory_order_acquire) -
+      m_head.load(std::memory_order_acquire);
+  }
+
+  /*!
+   * \brief Returns the number of records the queue can hold.
+   */
+  std::uint64_t capacity() const { return m_slots.size(); }
+
+private:
+  std::vector<MessageRecord> m_slots;
+  std::uint64_t m_mask;
+
+  // head is advanced by the consumer, tail by the producer; the padding
+  // keeps them on separate cache lines so the two threads do not contend.
+  std::atomic<std::uint64_t> m_head;
+  char m_padding[64];
+  std::atomic<std::uint64_t> m_tail;
+
+  DISABLE_COPY_AND_ASSIGNMENT(MessageRingBuffer);
+  DISABLE_MOVE_AND_ASSIGNMENT(MessageRingBuffer);
+};
+
+/*!
+ * \class AsyncWriter
+ *
+ * \brief Decouples the threads that log messages from the LogStreams that
+ *  write them.
+ *
+ *  Each logging thread gets its own MessageRingBuffer on its first call to
+ *  enqueue(). A background thread periodically drains all buffers, in
+ *  registration order, to the dispatch function while holding the supplied
+ *  stream mutex. Messages from a given thread reach the streams in the order
+ *  they were logged; there is no ordering guarantee across threads.
+ *
+ *  Other threads may drain the buffers as well, e.g., before flushing the
+ *  streams, as long as they hold the stream mutex while calling drain().
+ */
+class AsyncWriter
+{
+public:
+  using DispatchFunction = std::function<void(const MessageRecord&)>;
+
+  /*!
+   * \brief Creates an AsyncWriter and starts its background thread.
+   *
+   * \param [in] streamMutex mutex that serializes access to the LogStreams.
+   * \param [in] dispatch function that writes a record to the LogStreams.
+   * \param [in] capacity number of messages each thread's queue can hold.
+   * \param [in] policy what to do when a thread's queue is full.
+   */
+  AsyncWriter(std::mutex& streamMutex,
+              DispatchFunction dispatch,
+              int capacity,
+              async::Policy policy);
+
+  /*!
+   * \brief Stops the background thread after draining all queued messages.
+   * \pre No other thread is calling enqueue().
+   */
+  ~AsyncWriter();
+
+  /*!
+   * \brief Queues the given message on the calling thread's buffer.
+   *
+   * \note When the buffer is full, this either waits for the writer thread
+   *  or drops the message, depending on the policy.
+   */
+  void enqueue(message::Level level,
+               const std::string& message,
+               const std::string& tagName,
+               const std::string& fileName,
+               int line,
+               bool filter_duplicates,
+               bool tag_stream_only);
+
+  /*!
+   * \brief Dispatches all queued messages.
+   * \pre The caller holds the stream mutex.
+   */
+  void drain();
+
+  /*!
+   * \brief Returns the number of messages dropped because a queue was full.
+   */
+  std::uint64_t getNumDroppedMessages() const
+  {
+    return m_numDropped.load(std::memory_order_relaxed);
+  }
+
+private:
+  /*!
+   * \brief Returns the calling thread's buffer, registering it if needed.
+   */
+  MessageRingBuffer* getThreadBuffer();
+
+  /*!
+   * \brief Wakes up the background thread.
+   */
+  void notify();
+
+  /*!
+   * \brief Main loop of the background thread.
+   */
+  void run();
+
+  std::mutex& m_streamMutex;
+  DispatchFunction m_dispatch;
+  int m_capacity;
+  async::Policy m_policy;
+  std::uint64_t m_id;
+
+  std::mutex m_buffersMutex;
+  std::map<std::thread::id, std::unique_ptr<MessageRingBuffer>> m_buffers;
+  std::vector<MessageRingBuffer*> m_bufferList;
+  std::vector<MessageRingBuffer*> m_drainList;
+
+  std::atomic<std::uint64_t> m_numDropped;
+
+  std::mutex m_wakeMutex;
+  std::condition_variable m_wakeCondition;
+  bool m_wakeRequested;
+  bool m_stopRequested;
+  std::thread m_thread;
+
+  DISABLE_COPY_AND_ASSIGNMENT(AsyncWriter);
+  DISABLE_MOVE_AND_ASSIGNMENT(AsyncWriter);
+};
+
+} /* namespace internal */
+
+} /* namespace slic */
+
+} /* namespace axom */
+
+#endif /* SLIC_ASYNCWRITER_HPP_ */
@@ -190,6 +190,9 @@ public:
    * \note This method doesn't put anything to the console. Instead the
    *  messages are cached locally to each ranks and are dumped to the console
    *  in rank order when flush is called.
+   * \note This method makes no MPI calls, since it may be called from the
+   *  background thread of asynchronous logging. Lumberjack queries the rank
+   *  once, at initialization.
    */
   virtual void append(message::Level msgLevel,
                       const std::string& message,
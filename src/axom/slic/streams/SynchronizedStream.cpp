@@ -47,32 +47,40 @@ struct SynchronizedStream::MessageCache
 //------------------------------------------------------------------------------
 SynchronizedStream::SynchronizedStream(std::ostream* stream, MPI_Comm comm)
   : m_comm(comm)
+  , m_rank(-1)
   , m_cache(new MessageCache())
   , m_stream(stream)
   , m_file_name()
   , m_isOstreamOwnedBySLIC(false)
   , m_opened(false)
-{ }
+{
+  MPI_Comm_rank(m_comm, &m_rank);
+}
 
 //------------------------------------------------------------------------------
 SynchronizedStream::SynchronizedStream(std::ostream* stream,
                                        MPI_Comm comm,
                                        const std::string& format)
   : m_comm(comm)
+  , m_rank(-1)
   , m_cache(new MessageCache)
   , m_stream(stream)
   , m_file_name()
   , m_isOstreamOwnedBySLIC(false)
   , m_opened(false)
 {
+  MPI_Comm_rank(m_comm, &m_rank);
   this->setFormatString(format);
 }
 
 //------------------------------------------------------------------------------
 SynchronizedStream::SynchronizedStream(const std::string stream, MPI_Comm comm)
   : m_comm(comm)
+  , m_rank(-1)
   , m_cache(new MessageCache)
 {
+  MPI_Comm_rank(m_comm, &m_rank);
+
   if(stream == "cout")
   {
     m_stream = &std::cout;
@@ -138,15 +146,12 @@ void SynchronizedStream::append(message::Level msgLevel,
     return;
   }
 
-  int rank = -1;
-  MPI_Comm_rank(m_comm, &rank);
-
   // STEP 1: cache formatted message
   m_cache->messages.push_back(
     this->getFormatedMessage(message::getLevelAsString(msgLevel),
                              message,
                              tagName,
-                             std::to_string(rank),
+                             std::to_string(m_rank),
                              "1",
                              fileName,
                              line));
@@ -205,15 +210,13 @@ void SynchronizedStream::flush()
   openBeforeFlush();
 
   // Collective flush
-  int rank = -1;
   int nranks = 0;
-  MPI_Comm_rank(m_comm, &rank);
   MPI_Comm_size(m_comm, &nranks);
 
-  const int prevrank = rank - 1;
-  const int nextrank = rank + 1;
+  const int prevrank = m_rank - 1;
+  const int nextrank = m_rank + 1;
 
-  if(rank > 0)
+  if(m_rank > 0)
   {
     // wait for signal from previous rank
     MPI_Recv(nullptr, 0, MPI_INT, prevrank, MPI_ANY_TAG, m_comm, MPI_STATUSES_IGNORE);
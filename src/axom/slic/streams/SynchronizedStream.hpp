@@ -119,6 +119,9 @@ public:
    * \note This method doesn't put anything to the console. Instead the
    *  messages are cached locally to each ranks and are dumped to the console
    *  in rank order when flush is called.
+   * \note This method makes no MPI calls, since it may be called from the
+   *  background thread of asynchronous logging. The rank is queried once,
+   *  at construction.
    */
   virtual void append(message::Level msgLevel,
                       const std::string& message,
@@ -153,6 +156,7 @@ private:
   /// @{
 
   MPI_Comm m_comm;
+  int m_rank;
   MessageCache* m_cache;
   std::ostream* m_stream;
   std::string m_file_name;
@@ -173,6 +177,7 @@ private:
    */
   SynchronizedStream()
     : m_comm(MPI_COMM_NULL)
+    , m_rank(-1)
     , m_cache(static_cast<MessageCache*>(nullptr))
     , m_stream(static_cast<std::ostream*>(nullptr))
     , m_file_name()
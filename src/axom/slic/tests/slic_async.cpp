@@ -0,0 +1,286 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+// slic includes
+#include "axom/slic/interface/slic.hpp"
+#include "axom/slic/interface/slic_macros.hpp"
+
+// gtest includes
+#include "gtest/gtest.h"  // for gtest macros
+
+// C/C++ includes
+#include <condition_variable>  // for std::condition_variable
+#include <mutex>               // for std::mutex
+#include <string>              // for C++ string
+#include <thread>              // for std::thread
+#include <vector>              // for STL vector
+
+// namespace alias
+namespace slic = axom::slic;
+
+namespace
+{
+const int NUM_THREADS = 8;
+const int NUM_MESSAGES = 2000;
+
+/*!
+ * \brief A LogStream that records the messages appended to it.
+ *
+ *  The stream is deliberately not thread-safe; the Logger must serialize
+ *  the calls to append().
+ */
+class RecordingStream : public slic::LogStream
+{
+public:
+  void append(slic::message::Level msgLevel,
+              const std::string& message,
+              const std::string& /* tagName */,
+              const std::string& /* fileName */,
+              int /* line */,
+              bool /* filter_duplicates */,
+              bool /* tag_stream_only */) override
+  {
+    levels.push_back(msgLevel);
+    messages.push_back(message);
+  }
+
+  std::vector<slic::message::Level> levels;
+  std::vector<std::string> messages;
+};
+
+/*!
+ * \brief A RecordingStream whose first append() blocks until released,
+ *  which stalls the asynchronous writer thread.
+ */
+class StallingStream : public RecordingStream
+{
+public:
+  void append(slic::message::Level msgLevel,
+              const std::string& message,
+              const std::string& tagName,
+              const std::string& fileName,
+              int line,
+              bool filter_duplicates,
+              bool tag_stream_only) override
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if(!m_stalled)
+    {
+      m_stalled = true;
+      m_condition.notify_all();
+      m_condition.wait(lock, [this] { return m_released; });
+    }
+
+    RecordingStream::append(msgLevel,
+                            message,
+                            tagName,
+                            fileName,
+                            line,
+                            filter_duplicates,
+                            tag_stream_only);
+  }
+
+  void waitUntilStalled()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [this] { return m_stalled; });
+  }
+
+  void release()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_released = true;
+    m_condition.notify_all();
+  }
+
+private:
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  bool m_stalled {false};
+  bool m_released {false};
+};
+
+// Logs NUM_MESSAGES info messages, "<thread>:<message>", from each thread
+void logFromThreads()
+{
+  std::vector<std::thread> threads;
+  for(int t = 0; t < NUM_THREADS; ++t)
+  {
+    threads.emplace_back([t]() {
+      for(int i = 0; i < NUM_MESSAGES; ++i)
+      {
+        SLIC_INFO(t << ":" << i);
+      }
+    });
+  }
+
+  for(auto& thread : threads)
+  {
+    thread.join();
+  }
+}
+
+// Checks that every message arrived, in order for each thread
+void checkAllMessages(const RecordingStream& stream)
+{
+  ASSERT_EQ(NUM_THREADS * NUM_MESSAGES,
+            static_cast<int>(stream.messages.size()));
+
+  std::vector<int> next(NUM_THREADS, 0);
+  for(const auto& message : stream.messages)
+  {
+    const auto pos = message.find(':');
+    ASSERT_NE(std::string::npos, pos);
+
+    const int t = std::stoi(message.substr(0, pos));
+    const int i = std::stoi(message.substr(pos + 1));
+    ASSERT_TRUE(t >= 0 && t < NUM_THREADS);
+    EXPECT_EQ(next[t], i);
+    next[t] = i + 1;
+  }
+}
+
+}  // end anonymous namespace
+
+//------------------------------------------------------------------------------
+TEST(slic_async, synchronous_threaded_logging)
+{
+  slic::initialize();
+  slic::setLoggingMsgLevel(slic::message::Info);
+  auto* stream = new RecordingStream;
+  slic::addStreamToAllMsgLevels(stream);
+
+  EXPECT_FALSE(slic::isAsynchronousLoggingEnabled());
+
+  // Without asynchronous logging, messages are appended while logging
+  logFromThreads();
+  checkAllMessages(*stream);
+
+  slic::finalize();
+}
+
+//------------------------------------------------------------------------------
+TEST(slic_async, asynchronous_threaded_logging)
+{
+  slic::initialize();
+  slic::setLoggingMsgLevel(slic::message::Info);
+  auto* stream = new RecordingStream;
+  slic::addStreamToAllMsgLevels(stream);
+
+  // A small queue makes the threads wait on the writer thread
+  slic::enableAsynchronousLogging(64, slic::async::Block);
+  EXPECT_TRUE(slic::isAsynchronousLoggingEnabled());
+
+  logFromThreads();
+  slic::flushStreams();
+
+  checkAllMessages(*stream);
+  EXPECT_EQ(0u, slic::getNumDroppedMessages());
+
+  slic::disableAsynchronousLogging();
+  EXPECT_FALSE(slic::isAsynchronousLoggingEnabled());
+
+  slic::finalize();
+}
+
+//------------------------------------------------------------------------------
+TEST(slic_async, errors_drain_queued_messages)
+{
+  slic::initialize();
+  slic::disableAbortOnError();
+  slic::setLoggingMsgLevel(slic::message::Debug);
+  auto* stream = new RecordingStream;
+  slic::addStreamToAllMsgLevels(stream);
+
+  slic::enableAsynchronousLogging();
+  slic::logMessage(slic::message::Warning, "first");
+  slic::logMessage(slic::message::Info, "second");
+
+  // Error messages are appended right away, after the queued messages
+  slic::logMessage(slic::message::Error, "third");
+  ASSERT_EQ(3u, stream->messages.size());
+  EXPECT_EQ("first", stream->messages[0]);
+  EXPECT_EQ("second", stream->messages[1]);
+  EXPECT_EQ("third", stream->messages[2]);
+  EXPECT_EQ(slic::message::Error, stream->levels[2]);
+
+  // Disabling asynchronous logging appends the queued messages
+  slic::logMessage(slic::message::Debug, "fourth");
+  slic::disableAsynchronousLogging();
+  ASSERT_EQ(4u, stream->messages.size());
+  EXPECT_EQ("fourth", stream->messages[3]);
+
+  slic::finalize();
+}
+
+//------------------------------------------------------------------------------
+TEST(slic_async, drop_policy)
+{
+  slic::initialize();
+  slic::setLoggingMsgLevel(slic::message::Info);
+  auto* stream = new StallingStream;
+  slic::addStreamToAllMsgLevels(stream);
+
+  const int CAPACITY = 4;
+  const int NUM_EXTRA = 10;
+  slic::enableAsynchronousLogging(CAPACITY, slic::async::Drop);
+
+  // The writer thread stalls on the first message, which keeps its slot
+  // in the queue until the stream is released
+  SLIC_INFO("stall");
+  stream->waitUntilStalled();
+
+  for(int i = 0; i < CAPACITY - 1 + NUM_EXTRA; ++i)
+  {
+    SLIC_INFO("message " << i);
+  }
+  EXPECT_EQ(static_cast<std::uint64_t>(NUM_EXTRA),
+            slic::getNumDroppedMessages());
+
+  stream->release();
+  slic::flushStreams();
+
+  // The oldest messages were kept, the newest were dropped
+  ASSERT_EQ(CAPACITY, static_cast<int>(stream->messages.size()));
+  EXPECT_EQ("stall", stream->messages[0]);
+  for(int i = 1; i < CAPACITY; ++i)
+  {
+    EXPECT_EQ("message " + std::to_string(i - 1), stream->messages[i]);
+  }
+
+  slic::finalize();
+}
+
+//------------------------------------------------------------------------------
+TEST(slic_async, finalize_drains_queues)
+{
+  slic::initialize();
+  slic::setLoggingMsgLevel(slic::message::Info);
+  auto* stream = new RecordingStream;
+  slic::Logger::getActiveLogger()->addStreamToAllMsgLevels(
+    stream,
+    /* pass_ownership */ false);
+
+  slic::enableAsynchronousLogging();
+  logFromThreads();
+
+  // finalize() appends the queued messages before deleting the logger
+  slic::finalize();
+  checkAllMessages(*stream);
+
+  delete stream;
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  result = RUN_ALL_TESTS();
+
+  return result;
+}
@@ -474,6 +474,49 @@ TEST(slic_macros, test_macros_file_output)
 #endif
 }
 
+//------------------------------------------------------------------------------
+TEST(slic_macros, test_format_string)
+{
+  std::ostringstream oss;
+  slic::GenericOutputStream stream(
+    &oss,
+    "<LEVEL>|<MESSAGE>|<TAG>|<FILE>:<LINE>|<LEVEL>|<TIMESTAMP>");
+
+  // Only the first occurrence of each keyword is replaced, and keywords in
+  // the replaced values are kept as is
+  stream.append(slic::message::Warning,
+                "see <FILE>",
+                "myTag",
+                "foo.cpp",
+                42,
+                false,
+                false);
+  std::string msg = oss.str();
+  const std::string expected = "WARNING|see <FILE>|myTag|foo.cpp:42|<LEVEL>|";
+  EXPECT_EQ(msg.substr(0, expected.size()), expected);
+  EXPECT_GT(msg.size(), expected.size());
+  EXPECT_EQ(msg.find('\n'), std::string::npos);
+
+  // The formatted message buffer is reused between messages
+  oss.str("");
+  stream.append(slic::message::Info,
+                "",
+                MSG_IGNORE_TAG,
+                MSG_IGNORE_FILE,
+                MSG_IGNORE_LINE,
+                false,
+                false);
+  msg = oss.str();
+  const std::string expectedIgnored = "INFO|||:|<LEVEL>|";
+  EXPECT_EQ(msg.substr(0, expectedIgnored.size()), expectedIgnored);
+
+  // Changing the format string recompiles it
+  oss.str("");
+  stream.setFormatString("[<LINE>]");
+  stream.append(slic::message::Error, "", "", "", -12345, false, false);
+  EXPECT_EQ(oss.str(), "[-12345]");
+}
+
 //------------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
@@ -20,7 +20,11 @@
 
 #include "axom/primal/operators/intersect.hpp"  // for detail::intersect_ray()
 
+#include "axom/spin/BVHBuildMethod.hpp"
 #include "axom/spin/policy/LinearBVH.hpp"
+#include "axom/spin/policy/WideBVH.hpp"
+#include "axom/spin/internal/linear_bvh/TraversalPredicates.hpp"
+#include "axom/spin/internal/linear_bvh/bvh_find_rays.hpp"
 
 // slic includes
 #include "axom/slic/interface/slic.hpp"  // for SLIC macros
@@ -42,9 +46,20 @@ enum BVHReturnCodes
   BVH_BUILD_OK,           //!< indicates that the BVH was generated successfully
 };
 
+/*!
+ * \brief Enumerates the available BVH implementations.
+ *
+ *  * LinearBVH: a binary BVH
+ *  * WideBVH4, WideBVH8: a BVH with a branching factor of 4 or 8, obtained by
+ *    collapsing the binary BVH. The bounding boxes of the children of a node
+ *    are tested together and leaves may hold several entities, which reduces
+ *    the cost of traversals over large data sets.
+ */
 enum class BVHType
 {
-  LinearBVH
+  LinearBVH,
+  WideBVH4,
+  WideBVH8
 };
 
 template <typename FloatType, int NDIMS, typename ExecType, BVHType Policy>
@@ -56,6 +71,18 @@ struct BVHPolicy<FloatType, NDIMS, ExecType, BVHType::LinearBVH>
   using ImplType = policy::LinearBVH<FloatType, NDIMS, ExecType>;
 };
 
+template <typename FloatType, int NDIMS, typename ExecType>
+struct BVHPolicy<FloatType, NDIMS, ExecType, BVHType::WideBVH4>
+{
+  using ImplType = policy::WideBVH<FloatType, NDIMS, ExecType, 4>;
+};
+
+template <typename FloatType, int NDIMS, typename ExecType>
+struct BVHPolicy<FloatType, NDIMS, ExecType, BVHType::WideBVH8>
+{
+  using ImplType = policy::WideBVH<FloatType, NDIMS, ExecType, 8>;
+};
+
 /*!
  * \class BVH
  *
@@ -73,9 +100,11 @@ struct BVHPolicy<FloatType, NDIMS, ExecType, BVHType::LinearBVH>
  * \tparam NDIMS the number of dimensions, e.g., 2 or 3.
  * \tparam ExecSpace the execution space to use, e.g. SEQ_EXEC, CUDA_EXEC, etc.
  * \tparam FloatType floating precision, e.g., `double` or `float`. Optional.
+ * \tparam BVHImpl the BVH implementation, e.g., BVHType::LinearBVH or
+ *  BVHType::WideBVH4. Optional.
  *
- * \note The last template parameter is optional. Defaults to double precision
- *  if not specified.
+ * \note The last two template parameters are optional. Defaults to a binary
+ *  BVH in double precision if not specified.
  *
  * \pre The spin::BVH class requires RAJA and Umpire with CUDA_EXEC.
  *
@@ -220,6 +249,32 @@ public:
   template <typename BoxIndexable>
   int initialize(const BoxIndexable boxes, IndexType numItems);
 
+  /*!
+   * \brief Updates the BVH for a new set of bounding boxes of the same
+   *  entities, e.g., after the geometry has moved, keeping the hierarchy.
+   *
+   *  Instead of sorting and partitioning the boxes again, the boxes are
+   *  inserted in the existing hierarchy and the bounding boxes of the inner
+   *  nodes are recomputed bottom-up, which is much cheaper than a full build.
+   *  As the geometry deforms, the quality of the hierarchy degrades. If the
+   *  cost of the refitted tree exceeds the rebuild threshold times the cost
+   *  of the tree when it was built, the BVH is rebuilt from scratch.
+   *
+   * \param [in] boxes buffer consisting of bounding boxes for each entity.
+   * \param [in] numItems the total number of items to store in the BVH.
+   *
+   * \return status set to BVH_BUILD_OK on success.
+   *
+   * \note The ith box is expected to bound the same entity as the ith box
+   *  supplied to initialize(). If the BVH has not been initialized, was not
+   *  refittable when it was initialized or the number of items has changed,
+   *  a full build is carried out instead.
+   *
+   * \see setRefittable(), setRebuildThreshold(), getRefitQuality()
+   */
+  template <typename BoxIndexable>
+  int refit(const BoxIndexable boxes, IndexType numItems);
+
   bool isInitialized() const { return m_bvh != nullptr; }
 
   /*!
@@ -248,6 +303,133 @@ public:
    */
   FloatType getScaleFactor() const { return m_scaleFactor; };
 
+  /*!
+   * \brief Sets the method used to build the BVH hierarchy.
+   * \param [in] method the build method, e.g., BVHBuildMethod::BinnedSAH
+   *
+   * \note The default build method is BVHBuildMethod::Morton, which is the
+   *  fastest to build. BVHBuildMethod::BinnedSAH takes longer to build, but
+   *  is typically faster to query, which pays off for BVHs that are queried
+   *  many times. Takes effect on the next call to initialize().
+   */
+  void setBuildMethod(BVHBuildMethod method) { m_buildMethod = method; };
+
+  /*!
+   * \brief Returns the method used to build the BVH hierarchy.
+   * \return method the build method
+   */
+  BVHBuildMethod getBuildMethod() const { return m_buildMethod; };
+
+  /*!
+   * \brief Sets whether the BVH keeps the hierarchy it was built from, so
+   *  that it can be updated by refit().
+   * \param [in] refittable if true, the hierarchy and its cost are kept
+   *
+   * \note Disabled by default, since keeping the hierarchy takes extra
+   *  memory and computing its cost takes extra time in initialize(). When
+   *  disabled, refit() carries out a full build. Takes effect on the next
+   *  call to initialize().
+   */
+  void setRefittable(bool refittable) { m_refittable = refittable; };
+
+  /*!
+   * \brief Returns whether the BVH keeps the hierarchy it was built from.
+   * \see setRefittable()
+   */
+  bool isRefittable() const { return m_refittable; };
+
+  /*!
+   * \brief Sets the threshold on the quality of a refitted BVH, above which
+   *  the BVH is rebuilt from scratch by refit().
+   * \param [in] threshold the maximum ratio between the cost of a refitted
+   *  tree and the cost of the tree when it was built. Rebuilds are disabled
+   *  for values less than or equal to zero.
+   *
+   * \note The default threshold is set to 2.0
+   */
+  void setRebuildThreshold(double threshold)
+  {
+    m_rebuildThreshold = threshold;
+  };
+
+  /*!
+   * \brief Returns the threshold used to trigger rebuilds in refit().
+   * \return threshold the rebuild threshold
+   */
+  double getRebuildThreshold() const { return m_rebuildThreshold; };
+
+  /*!
+   * \brief Returns the quality of the BVH after the last call to refit().
+   *
+   * \return ratio the ratio between the cost of the refitted tree and the
+   *  cost of the tree when it was built, where the cost is the sum of the
+   *  surface areas of the inner nodes, relative to the root. Equal to 1.0
+   *  after a full build; larger values indicate a degraded tree.
+   */
+  double getRefitQuality() const { return m_refitQuality; };
+
+  /*!
+   * \brief Sets the size of the candidate buffers used by the single-pass
+   *  candidate search of findPoints(), findRays(), findBoundingBoxes() and
+   *  findWithinRadius().
+   *
+   *  By default, the candidates are found by traversing the BVH twice: once
+   *  to count the candidates of each query and once to fill them in. With a
+   *  positive buffer size, each query instead stores up to \a bufferSize
+   *  candidates in a scratch buffer in a single traversal, and only the
+   *  queries with more candidates are traversed again. This roughly halves
+   *  the cost of the search when most queries have few candidates, at the
+   *  cost of a scratch buffer of \a bufferSize entries per query.
+   *
+   * \param [in] bufferSize the number of candidates buffered for each query,
+   *  or 0 to use the two-pass search.
+   *
+   * \note The results are the same with either search. Without RAJA, the
+   *  two-pass search is replaced by a single traversal that appends to a
+   *  growing array, so the buffers are mostly useful with RAJA.
+   */
+  void setCandidateBufferSize(IndexType bufferSize)
+  {
+    SLIC_ERROR_IF(bufferSize < 0, "candidate buffer size must be non-negative");
+    m_bufferSize = bufferSize;
+  };
+
+  /*!
+   * \brief Returns the size of the candidate buffers.
+   * \return bufferSize the candidate buffer size, 0 for the two-pass search.
+   * \see setCandidateBufferSize()
+   */
+  IndexType getCandidateBufferSize() const { return m_bufferSize; };
+
+  /*!
+   * \brief Enables or disables the packet traversal of findRays() and
+   *  findNearestHits().
+   *
+   *  With packet traversal, the rays are first sorted into coherent groups,
+   *  by the octant of their direction and the Morton code of their origin,
+   *  and each group of consecutive rays is traversed together with a shared
+   *  stack, testing the bounding box of each visited node against all the
+   *  rays of the group at once. This pays off for large bundles of nearly
+   *  parallel rays from nearby origins, e.g., rays cast from the points of a
+   *  structured grid, which visit mostly the same nodes.
+   *
+   * \param [in] enabled true to traverse packets of rays, false to traverse
+   *  each ray on its own.
+   *
+   * \note Packet traversal is disabled by default. The results are the same
+   *  either way, except for the order of the candidates of each ray. Since
+   *  each packet is processed by a single thread, packet traversal is aimed
+   *  at CPU execution spaces. The single-pass candidate search is not used
+   *  with packet traversal.
+   */
+  void setRayPacketTraversal(bool enabled) { m_rayPackets = enabled; };
+
+  /*!
+   * \brief Checks if packet traversal is enabled for ray queries.
+   * \see setRayPacketTraversal()
+   */
+  bool getRayPacketTraversal() const { return m_rayPackets; };
+
   /*!
    * \brief Sets the tolerance used for querying the BVH.
    * \param [in] TOL the tolerance to use.
@@ -345,6 +527,54 @@ public:
                 IndexType numRays,
                 RayIndexable rays) const;
 
+  /*!
+   * \brief Finds the nearest hit of each of the given rays.
+   *
+   *  The bins whose bounding boxes are hit by a ray are visited in order of
+   *  their entry parameter along the ray, and intersected with the ray by the
+   *  supplied functor. The traversal skips the bins that the ray enters
+   *  beyond the nearest hit found so far, so that, typically, only a few of
+   *  the bins along the ray are intersected.
+   *
+   * \param [in] numRays the total number of rays
+   * \param [in] rays array of the rays to query against the BVH
+   * \param [in] hit functor that intersects a ray with a bin
+   * \param [out] hitIDs the ID of the nearest bin hit by each ray, or -1 if
+   *  the ray does not hit any bin
+   * \param [out] hitParams the ray parameter of the nearest hit of each ray,
+   *  or the largest representable value if the ray does not hit any bin
+   *
+   * \note The functor \a hit is called with the ray, the ID of a bin and a
+   *  reference to a ray parameter, which holds the parameter of the nearest
+   *  hit found so far. If the ray intersects the entity of the bin, it should
+   *  set the parameter to the ray parameter of the intersection and return
+   *  true, and return false otherwise. For instance, the following functor
+   *  finds the nearest bounding box hit by each ray:
+   *  \code
+   *    [=] AXOM_HOST_DEVICE (const RayType& ray,
+   *                           IndexType id,
+   *                           FloatType& t) {
+   *      FloatType tmin = 0., tmax = t;
+   *      return primal::detail::intersect_ray(ray, boxes[id], tmin, tmax, eps)
+   *        ? (t = tmin, true) : false;
+   *    }
+   *  \endcode
+   *  Hits at the same ray parameter are resolved in favor of the smallest ID.
+   *  The functor should access only memory compatible with the execution
+   *  space.
+   *
+   * \pre hitIDs.size() == numRays
+   * \pre hitParams.size() == numRays
+   *
+   * \see setRayPacketTraversal()
+   */
+  template <typename RayIndexable, typename HitFunctor>
+  void findNearestHits(IndexType numRays,
+                       RayIndexable rays,
+                       HitFunctor&& hit,
+                       axom::ArrayView<IndexType> hitIDs,
+                       axom::ArrayView<FloatType> hitParams) const;
+
   /*!
    * \brief Finds the candidate bins that intersect the given bounding boxes.
    *
@@ -371,6 +601,148 @@ public:
                          IndexType numBoxes,
                          BoxIndexable boxes) const;
 
+  /*!
+   * \brief Finds the k nearest bins to each of the query points.
+   *
+   * \param [out] offsets offset to the candidates array for each query point
+   * \param [out] counts stores the number of candidates per query point
+   * \param [out] candidates array of the candidate IDs for each query point
+   * \param [in]  numPts the total number of query points supplied
+   * \param [in]  points array of points to query against the BVH
+   * \param [in]  k the number of neighbors to find for each query point
+   *
+   * \note The distance between a query point and a bin is the distance from
+   *  the point to the bin's bounding box, which is zero for points inside
+   *  the box. Upon completion, the ith query point has:
+   *  * counts[ i ] = min(k, number of bins) candidates, fewer only if some of
+   *    the bins have invalid bounding boxes
+   *  * Stored in the candidates array in the following range:
+   *    [ offsets[ i ], offsets[ i ]+counts[ i ] ], in order of increasing
+   *    distance to the query point; bins at the same distance are ordered by
+   *    their ID
+   *
+   * \pre offsets.size() == numPts
+   * \pre counts.size()  == numPts
+   * \pre k >= 0
+   */
+  template <typename PointIndexable>
+  void findKNearest(axom::ArrayView<IndexType> offsets,
+                    axom::ArrayView<IndexType> counts,
+                    axom::Array<IndexType>& candidates,
+                    IndexType numPts,
+                    PointIndexable points,
+                    IndexType k) const;
+
+  /*!
+   * \brief Finds the bins within a given distance of each of the query points.
+   *
+   * \param [out] offsets offset to the candidates array for each query point
+   * \param [out] counts stores the number of candidates per query point
+   * \param [out] candidates array of the candidate IDs for each query point
+   * \param [in]  numPts the total number of query points supplied
+   * \param [in]  points array of points to query against the BVH
+   * \param [in]  radius the search radius around each query point
+   *
+   * \note A bin is a candidate if the distance from the query point to its
+   *  bounding box is less than or equal to \a radius. The candidates of each
+   *  query point are not sorted. The output follows the same conventions as
+   *  findPoints().
+   *
+   * \pre offsets.size() == numPts
+   * \pre counts.size()  == numPts
+   * \pre radius >= 0
+   */
+  template <typename PointIndexable>
+  void findWithinRadius(axom::ArrayView<IndexType> offsets,
+                        axom::ArrayView<IndexType> counts,
+                        axom::Array<IndexType>& candidates,
+                        IndexType numPts,
+                        PointIndexable points,
+                        FloatType radius) const;
+
+  /*!
+   * \brief Writes the BVH to a binary file, which can be read back with
+   *  load() to skip the build, e.g., for static geometry queried by several
+   *  runs of an application.
+   *
+   * \param [in] fileName the name of the file.
+   * \return status set to BVH_BUILD_OK on success, BVH_BUILD_FAILED otherwise.
+   *
+   * \note The file stores the nodes of the BVH in a flat layout, tagged with
+   *  a version and the byte order of the machine that wrote it. It can be
+   *  read by a BVH of the same dimension and floating point type.
+   *
+   * \note Only supported for BVHType::LinearBVH.
+   *
+   * \pre isInitialized() == true
+   */
+  int save(const std::string& fileName) const;
+
+  /*!
+   * \brief Reads a BVH from a binary file written by save(), replacing the
+   *  current BVH, if any.
+   *
+   * \param [in] fileName the name of the file.
+   * \param [in] memoryMap if true, the nodes of the BVH are accessed in place
+   *  in the memory-mapped file instead of being copied, which avoids reading
+   *  the parts of the BVH that are not visited by the queries. The nodes are
+   *  copied regardless on devices, and for files written on machines with a
+   *  different byte order.
+   *
+   * \return status set to BVH_BUILD_OK on success, BVH_BUILD_FAILED otherwise,
+   *  e.g., if the file does not exist, holds an incompatible BVH, or has
+   *  children or leaves that refer to missing nodes or entities.
+   *
+   * \note The file remains mapped until the BVH is initialized again,
+   *  loaded again, or destroyed. Since the hierarchy the BVH was built from
+   *  is not stored in the file, refit() always rebuilds a loaded BVH.
+   *
+   * \note Only supported for BVHType::LinearBVH.
+   */
+  int load(const std::string& fileName, bool memoryMap = true);
+
+  /*!
+   * \brief Returns the number of bytes needed to serialize the BVH.
+   *
+   * \note Only supported for BVHType::LinearBVH.
+   *
+   * \pre isInitialized() == true
+   */
+  std::size_t getSerializedSize() const;
+
+  /*!
+   * \brief Writes the BVH to a host buffer, in the same layout as the files
+   *  written by save(), e.g., to share a BVH among the processes of a node.
+   *
+   * \param [out] buffer host buffer of at least getSerializedSize() bytes.
+   *
+   * \note Only supported for BVHType::LinearBVH.
+   *
+   * \pre isInitialized() == true
+   * \pre buffer != nullptr
+   */
+  void serialize(void* buffer) const;
+
+  /*!
+   * \brief Reads a BVH from a host buffer written by serialize(), replacing
+   *  the current BVH, if any.
+   *
+   * \param [in] buffer the buffer holding the serialized BVH.
+   * \param [in] size the size of the buffer in bytes.
+   *
+   * \return status set to BVH_BUILD_OK on success, BVH_BUILD_FAILED otherwise,
+   *  e.g., if the buffer holds an incompatible or corrupted BVH.
+   *
+   * \note The nodes of the BVH are accessed in place in the buffer, which
+   *  must remain valid and unmodified until the BVH is initialized again,
+   *  loaded again, or destroyed. The nodes are copied on devices. Since the
+   *  hierarchy the BVH was built from is not serialized, refit() always
+   *  rebuilds an attached BVH.
+   *
+   * \note Only supported for BVHType::LinearBVH.
+   */
+  int attach(const void* buffer, std::size_t size);
+
   /*!
    * \brief Writes the BVH to the specified VTK file for visualization.
    * \param [in] fileName the name of VTK file.
@@ -384,10 +756,20 @@ private:
   static constexpr FloatType DEFAULT_SCALE_FACTOR = 1.000123;
   static constexpr FloatType DEFAULT_TOLERANCE =
     axom::numerics::floating_point_limits<FloatType>::epsilon();
+  static constexpr double DEFAULT_REBUILD_THRESHOLD = 2.0;
+  static constexpr int RAY_PACKET_SIZE = 8;
 
   int m_AllocatorID;
   FloatType m_tolerance {DEFAULT_TOLERANCE};
   FloatType m_scaleFactor {DEFAULT_SCALE_FACTOR};
+  BVHBuildMethod m_buildMethod {BVHBuildMethod::Morton};
+  double m_rebuildThreshold {DEFAULT_REBUILD_THRESHOLD};
+  double m_refitQuality {1.0};
+  IndexType m_numItems {0};
+  IndexType m_bufferSize {0};
+  bool m_refittable {false};
+  bool m_canRefit {false};
+  bool m_rayPackets {false};
   std::unique_ptr<ImplType> m_bvh {};
   /// @}
 };
@@ -411,6 +793,9 @@ int BVH<NDIMS, ExecSpace, FloatType, Impl>::initialize(const BoxIndexable boxes,
 
   // STEP 1: Allocate a BVH, potentially deleting the existing BVH if it exists
   m_bvh.reset(new ImplType);
+  m_numItems = numBoxes;
+  m_refitQuality = 1.0;
+  m_canRefit = m_refittable;
 
   // STEP 1: Handle case when user supplied 0 or 1 bounding boxes.
   BoxType* boxesptr = nullptr;
@@ -436,11 +821,21 @@ int BVH<NDIMS, ExecSpace, FloatType, Impl>::initialize(const BoxIndexable boxes,
           boxesptr[i] = empty_box;
         }
       });
-    m_bvh->buildImpl(boxesptr, numBoxes, m_scaleFactor, m_AllocatorID);
+    m_bvh->buildImpl(boxesptr,
+                     numBoxes,
+                     m_scaleFactor,
+                     m_buildMethod,
+                     m_refittable,
+                     m_AllocatorID);
   }
   else
   {
-    m_bvh->buildImpl(boxes, numBoxes, m_scaleFactor, m_AllocatorID);
+    m_bvh->buildImpl(boxes,
+                     numBoxes,
+                     m_scaleFactor,
+                     m_buildMethod,
+                     m_refittable,
+                     m_AllocatorID);
   }
 
   // STEP 5: deallocate boxesptr if user supplied a single box
@@ -473,16 +868,16 @@ void BVH<NDIMS, ExecSpace, FloatType, Impl>::findPoints(
   SLIC_ASSERT(m_bvh != nullptr);
 
   // Define traversal predicates
-  auto predicate = [=] AXOM_HOST_DEVICE(const PointType& p,
-                                        const BoxType& bb) -> bool {
-    return bb.contains(p);
-  };
+  using PredicateType =
+    internal::linear_bvh::PointInBoxPredicate<FloatType, NDIMS>;
+  const PredicateType predicate {};
 
   candidates = m_bvh->template findCandidatesImpl<PointType>(predicate,
                                                              offsets,
                                                              counts,
                                                              numPts,
                                                              pts,
+                                                             m_bufferSize,
                                                              m_AllocatorID);
 }
 
@@ -508,21 +903,122 @@ void BVH<NDIMS, ExecSpace, FloatType, Impl>::findRays(
 
   const FloatType TOL = m_tolerance;
 
+  if(m_rayPackets)
+  {
+    SLIC_ERROR_IF(offsets.size() != numRays,
+                  "offsets length not equal to numRays");
+    SLIC_ERROR_IF(counts.size() != numRays,
+                  "counts length not equal to numRays");
+
+    candidates = internal::linear_bvh::
+      find_rays_packet<ExecSpace, RAY_PACKET_SIZE, FloatType, NDIMS>(
+        getTraverser(),
+        offsets,
+        counts,
+        numRays,
+        rays,
+        TOL,
+        m_AllocatorID);
+    return;
+  }
+
   // Define traversal predicates
-  auto predicate = [=] AXOM_HOST_DEVICE(const RayType& r,
-                                        const BoxType& bb) -> bool {
-    primal::Point<FloatType, NDIMS> tmp;
-    return primal::detail::intersect_ray(r, bb, tmp, TOL);
-  };
+  using PredicateType =
+    internal::linear_bvh::RayIntersectsPredicate<FloatType, NDIMS>;
+  const PredicateType predicate {TOL};
 
   candidates = m_bvh->template findCandidatesImpl<RayType>(predicate,
                                                            offsets,
                                                            counts,
                                                            numRays,
                                                            rays,
+                                                           m_bufferSize,
                                                            m_AllocatorID);
 }
 
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType, BVHType Impl>
+template <typename RayIndexable, typename HitFunctor>
+void BVH<NDIMS, ExecSpace, FloatType, Impl>::findNearestHits(
+  IndexType numRays,
+  RayIndexable rays,
+  HitFunctor&& hit,
+  axom::ArrayView<IndexType> hitIDs,
+  axom::ArrayView<FloatType> hitParams) const
+{
+  AXOM_ANNOTATE_SCOPE("BVH::findNearestHits");
+
+  using IterBase = typename IteratorTraits<RayIndexable>::BaseType;
+
+  // Ensure that the iterator returns objects convertible to primal::Ray.
+  static_assert(std::is_convertible<IterBase, RayType>::value,
+                "Iterator must return objects convertible to primal::Ray.");
+
+  SLIC_ASSERT(m_bvh != nullptr);
+  SLIC_ERROR_IF(hitIDs.size() != numRays, "hitIDs length not equal to numRays");
+  SLIC_ERROR_IF(hitParams.size() != numRays,
+                "hitParams length not equal to numRays");
+
+  using FloatLimits = axom::numerics::floating_point_limits<FloatType>;
+
+  const FloatType TOL = m_tolerance;
+  const auto traverser = getTraverser();
+  auto hit_functor = hit;
+
+  if(m_rayPackets)
+  {
+    internal::linear_bvh::
+      find_nearest_hits_packet<ExecSpace, RAY_PACKET_SIZE, FloatType, NDIMS>(
+        traverser,
+        numRays,
+        rays,
+        hit_functor,
+        hitIDs,
+        hitParams,
+        TOL,
+        m_AllocatorID);
+    return;
+  }
+
+  AXOM_ANNOTATE_BEGIN("nearest_hit_traversal");
+  for_all<ExecSpace>(
+    numRays,
+    AXOM_LAMBDA(IndexType i) {
+      const RayType ray {rays[i]};
+      IndexType nearest = -1;
+      FloatType nearest_t = FloatLimits::max();
+
+      // skip the bins entered beyond the nearest hit
+      auto predicate = [&](const RayType& r, const BoxType& bb) -> bool {
+        FloatType tmin = FloatLimits::min();
+        FloatType tmax = nearest_t;
+        return primal::detail::intersect_ray(r, bb, tmin, tmax, TOL);
+      };
+
+      auto leafAction = [&](std::int32_t current_node,
+                            const std::int32_t* leaf_nodes) {
+        const IndexType candidate = leaf_nodes[current_node];
+        FloatType t = nearest_t;
+        if(hit_functor(ray, candidate, t))
+        {
+          // ties are broken by the ID of the bins
+          if(t < nearest_t ||
+             (t == nearest_t && (nearest < 0 || candidate < nearest)))
+          {
+            nearest_t = t;
+            nearest = candidate;
+          }
+        }
+      };
+
+      traverser.traverse_tree(ray, leafAction, predicate);
+
+      hitIDs[i] = nearest;
+      hitParams[i] = nearest_t;
+    });
+  AXOM_ANNOTATE_END("nearest_hit_traversal");
+}
+
 //------------------------------------------------------------------------------
 template <int NDIMS, typename ExecSpace, typename FloatType, BVHType Impl>
 template <typename BoxIndexable>
@@ -545,19 +1041,313 @@ void BVH<NDIMS, ExecSpace, FloatType, Impl>::findBoundingBoxes(
   SLIC_ASSERT(m_bvh != nullptr);
 
   // STEP 2: define traversal predicates
-  auto predicate = [=] AXOM_HOST_DEVICE(const BoxType& bb1,
-                                        const BoxType& bb2) -> bool {
-    return bb1.intersectsWith(bb2);
-  };
+  using PredicateType =
+    internal::linear_bvh::BoxIntersectsPredicate<FloatType, NDIMS>;
+  const PredicateType predicate {};
 
   candidates = m_bvh->template findCandidatesImpl<BoxType>(predicate,
                                                            offsets,
                                                            counts,
                                                            numBoxes,
                                                            boxes,
+                                                           m_bufferSize,
                                                            m_AllocatorID);
 }
 
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType, BVHType Impl>
+template <typename PointIndexable>
+void BVH<NDIMS, ExecSpace, FloatType, Impl>::findKNearest(
+  axom::ArrayView<IndexType> offsets,
+  axom::ArrayView<IndexType> counts,
+  axom::Array<IndexType>& candidates,
+  IndexType numPts,
+  PointIndexable pts,
+  IndexType k) const
+{
+  AXOM_ANNOTATE_SCOPE("BVH::findKNearest");
+
+  using IterBase = typename IteratorTraits<PointIndexable>::BaseType;
+
+  // Ensure that the iterator returns objects convertible to primal::Point.
+  static_assert(std::is_convertible<IterBase, PointType>::value,
+                "Iterator must return objects convertible to primal::Point.");
+
+  SLIC_ASSERT(m_bvh != nullptr);
+  SLIC_ERROR_IF(offsets.size() != numPts, "offsets length not equal to numPts");
+  SLIC_ERROR_IF(counts.size() != numPts, "counts length not equal to numPts");
+  SLIC_ERROR_IF(k < 0, "number of neighbors must be non-negative");
+
+  // STEP 1: each query point fills a fixed-size slot of the candidates array
+  // with its nearest bins, sorted by distance
+  const IndexType numNeighbors = axom::utilities::min(k, m_numItems);
+  const IndexType numSlots = numPts * numNeighbors;
+  axom::Array<IndexType> neighbors(numSlots, numSlots, m_AllocatorID);
+  axom::Array<double> sqDists(numSlots, numSlots, m_AllocatorID);
+  const auto neighbors_v = neighbors.view();
+  const auto sqDists_v = sqDists.view();
+
+  const auto traverser = getTraverser();
+
+#ifdef AXOM_USE_RAJA
+  using reduce_pol = typename axom::execution_space<ExecSpace>::reduce_policy;
+  RAJA::ReduceSum<reduce_pol, IndexType> total_count_reduce(0);
+#else
+  static_assert(std::is_same<ExecSpace, axom::SEQ_EXEC>::value,
+                "Only SEQ_EXEC supported without RAJA");
+#endif
+
+  AXOM_ANNOTATE_BEGIN("nearest_traversal");
+  for_all<ExecSpace>(
+    numPts,
+    AXOM_LAMBDA(IndexType i) {
+      const PointType p {pts[i]};
+      IndexType* ids = neighbors_v.data() + i * numNeighbors;
+      double* dists = sqDists_v.data() + i * numNeighbors;
+      IndexType found = 0;
+
+      // prune the bins farther than the current k-th nearest bin
+      auto pruneBound = [&]() -> double {
+        return (numNeighbors > 0 && found == numNeighbors)
+          ? dists[numNeighbors - 1]
+          : axom::numerics::floating_point_limits<double>::max();
+      };
+
+      auto leafAction = [&](std::int32_t current_node,
+                            const std::int32_t* leaf_nodes,
+                            double sq_dist) {
+        const IndexType id = leaf_nodes[current_node];
+        auto closer = [&](IndexType pos) {
+          return sq_dist < dists[pos] ||
+            (sq_dist == dists[pos] && id < ids[pos]);
+        };
+
+        if(numNeighbors == 0 || (found == numNeighbors && !closer(found - 1)))
+        {
+          return;
+        }
+
+        // insertion sort, dropping the farthest bin if the slot is full
+        IndexType pos = (found < numNeighbors) ? found++ : numNeighbors - 1;
+        while(pos > 0 && closer(pos - 1))
+        {
+          ids[pos] = ids[pos - 1];
+          dists[pos] = dists[pos - 1];
+          pos--;
+        }
+        ids[pos] = id;
+        dists[pos] = sq_dist;
+      };
+
+      traverser.traverse_nearest(p, leafAction, pruneBound);
+
+      counts[i] = found;
+#ifdef AXOM_USE_RAJA
+      total_count_reduce += found;
+#endif
+    });
+  AXOM_ANNOTATE_END("nearest_traversal");
+
+  // STEP 2: exclusive scan to get offsets in candidate array for each query
+#ifdef AXOM_USE_RAJA
+    // Intel oneAPI compiler segfaults with OpenMP RAJA scan
+  #ifdef __INTEL_LLVM_COMPILER
+  using exec_policy = typename axom::execution_space<axom::SEQ_EXEC>::loop_policy;
+  #else
+  using exec_policy = typename axom::execution_space<ExecSpace>::loop_policy;
+  #endif
+  RAJA::exclusive_scan<exec_policy>(RAJA::make_span(counts.data(), numPts),
+                                    RAJA::make_span(offsets.data(), numPts),
+                                    RAJA::operators::plus<IndexType> {});
+  const IndexType total_count = total_count_reduce.get();
+#else
+  IndexType total_count = 0;
+  for(IndexType i = 0; i < numPts; ++i)
+  {
+    offsets[i] = total_count;
+    total_count += counts[i];
+  }
+#endif
+
+  // STEP 3: compact the candidates if some of the slots are not full, i.e.,
+  // if some of the bins have invalid bounding boxes
+  if(total_count == numSlots)
+  {
+    candidates = std::move(neighbors);
+    return;
+  }
+
+  candidates = axom::Array<IndexType>(total_count, total_count, m_AllocatorID);
+  const auto candidates_v = candidates.view();
+  for_all<ExecSpace>(
+    numPts,
+    AXOM_LAMBDA(IndexType i) {
+      for(IndexType j = 0; j < counts[i]; ++j)
+      {
+        candidates_v[offsets[i] + j] = neighbors_v[i * numNeighbors + j];
+      }
+    });
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType, BVHType Impl>
+template <typename PointIndexable>
+void BVH<NDIMS, ExecSpace, FloatType, Impl>::findWithinRadius(
+  axom::ArrayView<IndexType> offsets,
+  axom::ArrayView<IndexType> counts,
+  axom::Array<IndexType>& candidates,
+  IndexType numPts,
+  PointIndexable pts,
+  FloatType radius) const
+{
+  AXOM_ANNOTATE_SCOPE("BVH::findWithinRadius");
+
+  using IterBase = typename IteratorTraits<PointIndexable>::BaseType;
+
+  // Ensure that the iterator returns objects convertible to primal::Point.
+  static_assert(std::is_convertible<IterBase, PointType>::value,
+                "Iterator must return objects convertible to primal::Point.");
+
+  SLIC_ASSERT(m_bvh != nullptr);
+  SLIC_ERROR_IF(radius < 0, "search radius must be non-negative");
+
+  // Define traversal predicates
+  using PredicateType =
+    internal::linear_bvh::PointWithinDistancePredicate<FloatType, NDIMS>;
+  const PredicateType predicate {static_cast<double>(radius) * radius};
+
+  candidates = m_bvh->template findCandidatesImpl<PointType>(predicate,
+                                                             offsets,
+                                                             counts,
+                                                             numPts,
+                                                             pts,
+                                                             m_bufferSize,
+                                                             m_AllocatorID);
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType, BVHType Impl>
+template <typename BoxIndexable>
+int BVH<NDIMS, ExecSpace, FloatType, Impl>::refit(const BoxIndexable boxes,
+                                                  IndexType numBoxes)
+{
+  AXOM_ANNOTATE_SCOPE("BVH::refit");
+
+  using IterBase = typename IteratorTraits<BoxIndexable>::BaseType;
+
+  // Ensure that the iterator returns objects convertible to primal::BoundingBox.
+  static_assert(
+    std::is_convertible<IterBase, BoxType>::value,
+    "Iterator must return objects convertible to primal::BoundingBox.");
+
+  // The hierarchy can only be reused for the same number of entities. The
+  // 0 or 1 bounding box cases are cheap enough to always rebuild. BVHs read
+  // from a file do not hold the hierarchy they were built from.
+  if(!m_bvh || !m_canRefit || numBoxes != m_numItems || numBoxes <= 1)
+  {
+    return initialize(boxes, numBoxes);
+  }
+
+  m_refitQuality =
+    m_bvh->refitImpl(boxes, numBoxes, m_scaleFactor, m_AllocatorID);
+
+  if(m_rebuildThreshold > 0. && m_refitQuality > m_rebuildThreshold)
+  {
+    SLIC_DEBUG("Rebuilding BVH, quality of refitted tree: " << m_refitQuality);
+    return initialize(boxes, numBoxes);
+  }
+
+  return BVH_BUILD_OK;
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType, BVHType Impl>
+int BVH<NDIMS, ExecSpace, FloatType, Impl>::save(
+  const std::string& fileName) const
+{
+  AXOM_ANNOTATE_SCOPE("BVH::save");
+  static_assert(Impl == BVHType::LinearBVH,
+                "BVH::save() is only supported for BVHType::LinearBVH");
+
+  SLIC_ASSERT(m_bvh != nullptr);
+
+  return m_bvh->saveImpl(fileName, m_numItems) ? BVH_BUILD_OK
+                                                : BVH_BUILD_FAILED;
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType, BVHType Impl>
+int BVH<NDIMS, ExecSpace, FloatType, Impl>::load(const std::string& fileName,
+                                                 bool memoryMap)
+{
+  AXOM_ANNOTATE_SCOPE("BVH::load");
+  static_assert(Impl == BVHType::LinearBVH,
+                "BVH::load() is only supported for BVHType::LinearBVH");
+
+  std::unique_ptr<ImplType> bvh(new ImplType);
+  IndexType numItems = 0;
+  if(!bvh->loadImpl(fileName, memoryMap, m_AllocatorID, numItems))
+  {
+    return BVH_BUILD_FAILED;
+  }
+
+  m_bvh = std::move(bvh);
+  m_numItems = numItems;
+  m_refitQuality = 1.0;
+  m_canRefit = false;
+  return BVH_BUILD_OK;
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType, BVHType Impl>
+std::size_t BVH<NDIMS, ExecSpace, FloatType, Impl>::getSerializedSize() const
+{
+  static_assert(
+    Impl == BVHType::LinearBVH,
+    "BVH::getSerializedSize() is only supported for BVHType::LinearBVH");
+
+  SLIC_ASSERT(m_bvh != nullptr);
+
+  return m_bvh->getSerializedSizeImpl();
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType, BVHType Impl>
+void BVH<NDIMS, ExecSpace, FloatType, Impl>::serialize(void* buffer) const
+{
+  AXOM_ANNOTATE_SCOPE("BVH::serialize");
+  static_assert(Impl == BVHType::LinearBVH,
+                "BVH::serialize() is only supported for BVHType::LinearBVH");
+
+  SLIC_ASSERT(m_bvh != nullptr);
+  SLIC_ASSERT(buffer != nullptr);
+
+  m_bvh->serializeImpl(buffer, m_numItems);
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType, BVHType Impl>
+int BVH<NDIMS, ExecSpace, FloatType, Impl>::attach(const void* buffer,
+                                                   std::size_t size)
+{
+  AXOM_ANNOTATE_SCOPE("BVH::attach");
+  static_assert(Impl == BVHType::LinearBVH,
+                "BVH::attach() is only supported for BVHType::LinearBVH");
+
+  std::unique_ptr<ImplType> bvh(new ImplType);
+  IndexType numItems = 0;
+  if(!bvh->attachImpl(buffer, size, m_AllocatorID, numItems))
+  {
+    return BVH_BUILD_FAILED;
+  }
+
+  m_bvh = std::move(bvh);
+  m_numItems = numItems;
+  m_refitQuality = 1.0;
+  m_canRefit = false;
+  return BVH_BUILD_OK;
+}
+
 //------------------------------------------------------------------------------
 template <int NDIMS, typename ExecSpace, typename FloatType, BVHType Impl>
 void BVH<NDIMS, ExecSpace, FloatType, Impl>::writeVtkFile(
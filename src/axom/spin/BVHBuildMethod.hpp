@@ -0,0 +1,36 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_BVHBUILDMETHOD_HPP_
+#define AXOM_SPIN_BVHBUILDMETHOD_HPP_
+
+namespace axom
+{
+namespace spin
+{
+/*!
+ * \brief Enumerates the available methods for building the hierarchy of a BVH.
+ *
+ *  * Morton: sorts the bounding boxes along a Morton curve and builds a
+ *    binary radix tree over the sorted codes (LBVH). The build is fast and
+ *    runs in parallel in the BVH's execution space.
+ *  * BinnedSAH: builds the tree top-down, splitting each node where the
+ *    surface area heuristic (SAH), evaluated over a fixed number of bins, is
+ *    minimized. The build is slower and carried out on the host, but usually
+ *    yields trees that are cheaper to query, especially for anisotropic
+ *    geometry, e.g., long and thin surface elements.
+ *
+ * \see BVH::setBuildMethod()
+ */
+enum class BVHBuildMethod
+{
+  Morton,
+  BinnedSAH
+};
+
+} /* namespace spin */
+} /* namespace axom */
+
+#endif /* AXOM_SPIN_BVHBUILDMETHOD_HPP_ */
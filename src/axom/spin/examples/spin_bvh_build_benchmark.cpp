@@ -0,0 +1,368 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*! \file spin_bvh_build_benchmark.cpp
+ *  \brief Compares the build methods of spin::BVH on anisotropic geometry.
+ *
+ *  Generates a soup of long and thin (sliver) triangles with random
+ *  orientations, builds a BVH over their bounding boxes with each of the
+ *  available build methods, and reports the build time, the query time and
+ *  the average number of BVH nodes visited per query for point and ray
+ *  queries. The candidate search of the queries can be switched to the
+ *  single-pass search with the --buffer-size option.
+ */
+
+#include "axom/config.hpp"
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+#include "axom/primal.hpp"
+#include "axom/spin/BVH.hpp"
+
+#include "axom/CLI11.hpp"
+#include "axom/fmt.hpp"
+
+// C/C++ includes
+#include <cmath>
+#include <map>
+#include <string>
+
+// namespace aliases
+namespace primal = axom::primal;
+namespace spin = axom::spin;
+namespace slic = axom::slic;
+namespace utilities = axom::utilities;
+
+namespace
+{
+constexpr int DIM = 3;
+
+using PointType = primal::Point<double, DIM>;
+using VectorType = primal::Vector<double, DIM>;
+using BoxType = primal::BoundingBox<double, DIM>;
+using RayType = primal::Ray<double, DIM>;
+using TriangleType = primal::Triangle<double, DIM>;
+
+enum class ExecPolicy
+{
+  CPU,
+  OpenMP
+};
+
+// clang-format off
+const std::map<std::string, ExecPolicy> validExecPolicies
+{
+    {"seq", ExecPolicy::CPU}
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+  , {"omp", ExecPolicy::OpenMP}
+#endif
+};
+// clang-format on
+
+struct Arguments
+{
+  int num_triangles {100000};
+  int num_queries {100000};
+  double aspect_ratio {100.};
+  int buffer_size {0};
+  ExecPolicy exec_space {ExecPolicy::CPU};
+
+  void parse(int argc, char** argv, axom::CLI::App& app)
+  {
+    std::string pol_info = "Sets execution space of the BVH.\n";
+    pol_info += "Set to 'seq' to use sequential execution policy.";
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+    pol_info += "\nSet to 'omp' to use an OpenMP execution policy.";
+#endif
+
+    app.add_option("-n,--num-triangles", this->num_triangles)
+      ->description("the number of triangles to insert in the BVH")
+      ->capture_default_str()
+      ->check(axom::CLI::PositiveNumber);
+
+    app.add_option("-q,--num-queries", this->num_queries)
+      ->description("the number of point and ray queries")
+      ->capture_default_str()
+      ->check(axom::CLI::PositiveNumber);
+
+    app.add_option("-a,--aspect-ratio", this->aspect_ratio)
+      ->description("the ratio of the length to the width of the triangles")
+      ->capture_default_str()
+      ->check(axom::CLI::Range(1., 1.e6));
+
+    app.add_option("-b,--buffer-size", this->buffer_size)
+      ->description(
+        "the number of candidates buffered per query in the single-pass "
+        "candidate search; 0 selects the two-pass search")
+      ->capture_default_str()
+      ->check(axom::CLI::NonNegativeNumber);
+
+    app.add_option("-e,--exec_space", this->exec_space, pol_info)
+      ->capture_default_str()
+      ->transform(axom::CLI::CheckedTransformer(validExecPolicies));
+
+    app.get_formatter()->column_width(40);
+
+    // could throw an exception
+    app.parse(argc, argv);
+  }
+};
+
+/// Returns a random unit vector
+VectorType random_direction(unsigned int seed)
+{
+  VectorType dir;
+  do
+  {
+    for(int d = 0; d < DIM; ++d)
+    {
+      dir[d] = utilities::random_real(-1., 1., seed);
+    }
+  } while(dir.squared_norm() < 1e-4);
+  return dir.unitVector();
+}
+
+/// Returns a random point in the given box
+PointType random_point(const BoxType& box, unsigned int seed)
+{
+  PointType pt;
+  for(int d = 0; d < DIM; ++d)
+  {
+    pt[d] = utilities::random_real(box.getMin()[d], box.getMax()[d], seed);
+  }
+  return pt;
+}
+
+/*!
+ * \brief Generates sliver triangles in the unit cube, whose longest edge has
+ *  length \a aspect_ratio times their width and a random orientation.
+ */
+axom::Array<BoxType> generate_slivers(int num_triangles,
+                                      double aspect_ratio,
+                                      unsigned int seed)
+{
+  const BoxType unit_cube(PointType(0.), PointType(1.));
+
+  // the average area of the triangles is set such that the triangles
+  // would roughly cover a few planes of the unit cube
+  const double width = std::sqrt(4. / (num_triangles * aspect_ratio));
+  const double length = width * aspect_ratio;
+
+  axom::Array<BoxType> boxes(num_triangles, num_triangles);
+  for(int i = 0; i < num_triangles; ++i)
+  {
+    const PointType center = random_point(unit_cube, seed);
+    const VectorType axis = random_direction(seed);
+    const VectorType normal =
+      VectorType::cross_product(axis, random_direction(seed));
+    const VectorType side =
+      VectorType::cross_product(axis, normal).unitVector();
+
+    const TriangleType tri(center - 0.5 * length * axis,
+                           center + 0.5 * length * axis,
+                           center + width * side);
+    boxes[i] = primal::compute_bounding_box(tri);
+  }
+  return boxes;
+}
+
+/*!
+ * \brief Counts the number of BVH nodes whose bounding box is tested by each
+ *  of the queries and returns the average over all queries.
+ */
+template <typename BVHType, typename QueryType, typename Predicate>
+double average_node_visits(const BVHType& bvh,
+                           const axom::Array<QueryType>& queries,
+                           Predicate&& predicate)
+{
+  using ExecSpace = typename BVHType::ExecSpaceType;
+
+  const int allocatorID = axom::execution_space<ExecSpace>::allocatorID();
+  const axom::IndexType nqueries = queries.size();
+  axom::Array<axom::IndexType> visits(nqueries, nqueries, allocatorID);
+
+  const auto queries_v = queries.view();
+  const auto visits_v = visits.view();
+  auto traverser = bvh.getTraverser();
+
+  axom::for_all<ExecSpace>(
+    nqueries,
+    AXOM_LAMBDA(axom::IndexType i) {
+      axom::IndexType count = 0;
+      auto countingPredicate = [&](const QueryType& q, const BoxType& box) {
+        ++count;
+        return predicate(q, box);
+      };
+      auto noop = [](std::int32_t, const std::int32_t*) { };
+      traverser.traverse_tree(queries_v[i], noop, countingPredicate);
+      visits_v[i] = count;
+    });
+
+  const int hostAllocatorID =
+    axom::execution_space<axom::SEQ_EXEC>::allocatorID();
+  axom::Array<axom::IndexType> visits_h(visits, hostAllocatorID);
+
+  double total = 0.;
+  for(const auto count : visits_h)
+  {
+    total += count;
+  }
+  return total / nqueries;
+}
+
+template <typename ExecSpace>
+void run_benchmark(spin::BVHBuildMethod method,
+                   const std::string& name,
+                   const axom::Array<BoxType>& boxes,
+                   const axom::Array<PointType>& points,
+                   const axom::Array<RayType>& rays,
+                   int buffer_size)
+{
+  const int allocatorID = axom::execution_space<ExecSpace>::allocatorID();
+  const axom::IndexType npts = points.size();
+  const axom::IndexType nrays = rays.size();
+
+  axom::Array<BoxType> boxes_d(boxes, allocatorID);
+  axom::Array<PointType> points_d(points, allocatorID);
+  axom::Array<RayType> rays_d(rays, allocatorID);
+
+  utilities::Timer timer(true);
+  spin::BVH<DIM, ExecSpace> bvh;
+  bvh.setBuildMethod(method);
+  bvh.initialize(boxes_d.view(), boxes_d.size());
+  const double build_time = timer.elapsed();
+
+  bvh.setCandidateBufferSize(buffer_size);
+
+  axom::Array<axom::IndexType> offsets(npts, npts, allocatorID);
+  axom::Array<axom::IndexType> counts(npts, npts, allocatorID);
+  axom::Array<axom::IndexType> candidates(0, 0, allocatorID);
+
+  timer.start();
+  bvh.findPoints(offsets, counts, candidates, npts, points_d.view());
+  const double points_time = timer.elapsed();
+  const axom::IndexType num_point_candidates = candidates.size();
+
+  offsets.resize(nrays);
+  counts.resize(nrays);
+
+  timer.start();
+  bvh.findRays(offsets, counts, candidates, nrays, rays_d.view());
+  const double rays_time = timer.elapsed();
+  const axom::IndexType num_ray_candidates = candidates.size();
+
+  const double tol = bvh.getTolerance();
+  const double point_visits =
+    average_node_visits(bvh,
+                        points_d,
+                        [] AXOM_HOST_DEVICE(const PointType& p,
+                                            const BoxType& box) -> bool {
+                          return box.contains(p);
+                        });
+  const double ray_visits =
+    average_node_visits(bvh,
+                        rays_d,
+                        [=] AXOM_HOST_DEVICE(const RayType& r,
+                                             const BoxType& box) -> bool {
+                          PointType pt;
+                          return primal::detail::intersect_ray(r, box, pt, tol);
+                        });
+
+  SLIC_INFO(axom::fmt::format(
+    axom::utilities::locale(),
+    "{} build:\n"
+    "\tbuild time: {:.4f} s\n"
+    "\tpoint queries: {:.4f} s, {:.1f} node visits/query, {:L} candidates\n"
+    "\tray queries:   {:.4f} s, {:.1f} node visits/query, {:L} candidates",
+    name,
+    build_time,
+    points_time,
+    point_visits,
+    num_point_candidates,
+    rays_time,
+    ray_visits,
+    num_ray_candidates));
+}
+
+template <typename ExecSpace>
+void run_benchmarks(const Arguments& args)
+{
+  constexpr unsigned int SEED = 42;
+
+  axom::Array<BoxType> boxes =
+    generate_slivers(args.num_triangles, args.aspect_ratio, SEED);
+
+  BoxType bounds;
+  for(const auto& box : boxes)
+  {
+    bounds.addBox(box);
+  }
+
+  const int nqueries = args.num_queries;
+  axom::Array<PointType> points(nqueries, nqueries);
+  axom::Array<RayType> rays(nqueries, nqueries);
+  for(int i = 0; i < nqueries; ++i)
+  {
+    points[i] = random_point(bounds, SEED);
+    rays[i] = RayType(random_point(bounds, SEED), random_direction(SEED));
+  }
+
+  SLIC_INFO(axom::fmt::format(
+    axom::utilities::locale(),
+    "Generated {:L} triangles with aspect ratio {} and {:L} queries",
+    args.num_triangles,
+    args.aspect_ratio,
+    nqueries));
+
+  run_benchmark<ExecSpace>(spin::BVHBuildMethod::Morton,
+                           "Morton (LBVH)",
+                           boxes,
+                           points,
+                           rays,
+                           args.buffer_size);
+  run_benchmark<ExecSpace>(spin::BVHBuildMethod::BinnedSAH,
+                           "Binned SAH",
+                           boxes,
+                           points,
+                           rays,
+                           args.buffer_size);
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  slic::SimpleLogger logger(slic::message::Info);
+
+  Arguments args;
+  axom::CLI::App app {"Compares the build methods of spin::BVH"};
+
+  try
+  {
+    args.parse(argc, argv, app);
+  }
+  catch(const axom::CLI::ParseError& e)
+  {
+    int retval = -1;
+    retval = app.exit(e);
+    return retval;
+  }
+
+  switch(args.exec_space)
+  {
+  case ExecPolicy::CPU:
+    run_benchmarks<axom::SEQ_EXEC>(args);
+    break;
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+  case ExecPolicy::OpenMP:
+    run_benchmarks<axom::OMP_EXEC>(args);
+    break;
+#endif
+  default:
+    SLIC_ERROR("Unsupported execution space.");
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,273 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*! \file spin_bvh_ray_packet_benchmark.cpp
+ *  \brief Compares the packet and per-ray traversals of spin::BVH.
+ *
+ *  Generates a soup of random triangles and a grid of nearly parallel rays,
+ *  as cast from a camera, builds each of the BVH variants over the bounding
+ *  boxes of the triangles, and reports the time of the ray queries with and
+ *  without packet traversal. The rays can be given random directions with the
+ *  --incoherent option.
+ */
+
+#include "axom/config.hpp"
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+#include "axom/primal.hpp"
+#include "axom/spin/BVH.hpp"
+
+#include "axom/CLI11.hpp"
+#include "axom/fmt.hpp"
+
+// C/C++ includes
+#include <cmath>
+#include <map>
+#include <string>
+
+// namespace aliases
+namespace primal = axom::primal;
+namespace spin = axom::spin;
+namespace slic = axom::slic;
+namespace utilities = axom::utilities;
+
+namespace
+{
+constexpr int DIM = 3;
+
+using PointType = primal::Point<double, DIM>;
+using VectorType = primal::Vector<double, DIM>;
+using BoxType = primal::BoundingBox<double, DIM>;
+using RayType = primal::Ray<double, DIM>;
+using TriangleType = primal::Triangle<double, DIM>;
+
+enum class ExecPolicy
+{
+  CPU,
+  OpenMP
+};
+
+// clang-format off
+const std::map<std::string, ExecPolicy> validExecPolicies
+{
+    {"seq", ExecPolicy::CPU}
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+  , {"omp", ExecPolicy::OpenMP}
+#endif
+};
+// clang-format on
+
+struct Arguments
+{
+  int num_triangles {100000};
+  int resolution {500};
+  bool incoherent {false};
+  ExecPolicy exec_space {ExecPolicy::CPU};
+
+  void parse(int argc, char** argv, axom::CLI::App& app)
+  {
+    std::string pol_info = "Sets execution space of the BVH.\n";
+    pol_info += "Set to 'seq' to use sequential execution policy.";
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+    pol_info += "\nSet to 'omp' to use an OpenMP execution policy.";
+#endif
+
+    app.add_option("-n,--num-triangles", this->num_triangles)
+      ->description("the number of triangles to insert in the BVH")
+      ->capture_default_str()
+      ->check(axom::CLI::PositiveNumber);
+
+    app.add_option("-r,--resolution", this->resolution)
+      ->description("the number of rays along each side of the ray grid")
+      ->capture_default_str()
+      ->check(axom::CLI::PositiveNumber);
+
+    app.add_flag("-i,--incoherent", this->incoherent)
+      ->description("give the rays random directions")
+      ->capture_default_str();
+
+    app.add_option("-e,--exec_space", this->exec_space, pol_info)
+      ->capture_default_str()
+      ->transform(axom::CLI::CheckedTransformer(validExecPolicies));
+
+    app.get_formatter()->column_width(40);
+
+    // could throw an exception
+    app.parse(argc, argv);
+  }
+};
+
+/// Returns a random unit vector
+VectorType random_direction(unsigned int seed)
+{
+  VectorType dir;
+  do
+  {
+    for(int d = 0; d < DIM; ++d)
+    {
+      dir[d] = utilities::random_real(-1., 1., seed);
+    }
+  } while(dir.squared_norm() < 1e-4);
+  return dir.unitVector();
+}
+
+/// Returns a random point in the unit cube
+PointType random_point(unsigned int seed)
+{
+  PointType pt;
+  for(int d = 0; d < DIM; ++d)
+  {
+    pt[d] = utilities::random_real(0., 1., seed);
+  }
+  return pt;
+}
+
+/// Generates the bounding boxes of random triangles in the unit cube
+axom::Array<BoxType> generate_triangles(int num_triangles, unsigned int seed)
+{
+  // the triangles roughly cover a few planes of the unit cube
+  const double size = std::sqrt(8. / num_triangles);
+
+  axom::Array<BoxType> boxes(num_triangles, num_triangles);
+  for(int i = 0; i < num_triangles; ++i)
+  {
+    const PointType a = random_point(seed);
+    const TriangleType tri(a,
+                           a + size * random_direction(seed),
+                           a + size * random_direction(seed));
+    boxes[i] = primal::compute_bounding_box(tri);
+  }
+  return boxes;
+}
+
+/*!
+ * \brief Generates a grid of rays cast from a camera in front of the unit
+ *  cube through a square window, or from the same origins with random
+ *  directions if \a incoherent is true.
+ */
+axom::Array<RayType> generate_rays(int resolution,
+                                   bool incoherent,
+                                   unsigned int seed)
+{
+  const PointType camera {0.5, 0.5, -2.};
+  const int nrays = resolution * resolution;
+
+  axom::Array<RayType> rays(nrays, nrays);
+  for(int i = 0; i < resolution; ++i)
+  {
+    for(int j = 0; j < resolution; ++j)
+    {
+      const PointType pixel {(i + 0.5) / resolution, (j + 0.5) / resolution, 0.};
+      const VectorType dir =
+        incoherent ? random_direction(seed) : VectorType(camera, pixel);
+      rays[i * resolution + j] = RayType(camera, dir);
+    }
+  }
+  return rays;
+}
+
+template <typename ExecSpace, spin::BVHType Impl>
+void run_benchmark(const std::string& name,
+                   const axom::Array<BoxType>& boxes,
+                   const axom::Array<RayType>& rays)
+{
+  const int allocatorID = axom::execution_space<ExecSpace>::allocatorID();
+  const axom::IndexType nrays = rays.size();
+
+  axom::Array<BoxType> boxes_d(boxes, allocatorID);
+  axom::Array<RayType> rays_d(rays, allocatorID);
+
+  spin::BVH<DIM, ExecSpace, double, Impl> bvh;
+  bvh.initialize(boxes_d.view(), boxes_d.size());
+
+  axom::Array<axom::IndexType> offsets(nrays, nrays, allocatorID);
+  axom::Array<axom::IndexType> counts(nrays, nrays, allocatorID);
+  axom::Array<axom::IndexType> candidates(0, 0, allocatorID);
+
+  double times[2];
+  axom::IndexType num_candidates[2];
+  for(int packets = 0; packets < 2; ++packets)
+  {
+    bvh.setRayPacketTraversal(packets == 1);
+
+    utilities::Timer timer(true);
+    bvh.findRays(offsets, counts, candidates, nrays, rays_d.view());
+    times[packets] = timer.elapsed();
+    num_candidates[packets] = candidates.size();
+  }
+
+  SLIC_WARNING_IF(num_candidates[0] != num_candidates[1],
+                  "Packet traversal returned a different number of candidates");
+
+  SLIC_INFO(axom::fmt::format(axom::utilities::locale(),
+                              "{}: {:L} candidates\n"
+                              "\tper-ray traversal: {:.4f} s\n"
+                              "\tpacket traversal:  {:.4f} s ({:.2f}x)",
+                              name,
+                              num_candidates[0],
+                              times[0],
+                              times[1],
+                              times[0] / times[1]));
+}
+
+template <typename ExecSpace>
+void run_benchmarks(const Arguments& args)
+{
+  constexpr unsigned int SEED = 42;
+
+  const axom::Array<BoxType> boxes =
+    generate_triangles(args.num_triangles, SEED);
+  const axom::Array<RayType> rays =
+    generate_rays(args.resolution, args.incoherent, SEED);
+
+  SLIC_INFO(axom::fmt::format(axom::utilities::locale(),
+                              "Generated {:L} triangles and {:L} {} rays",
+                              args.num_triangles,
+                              rays.size(),
+                              args.incoherent ? "incoherent" : "coherent"));
+
+  run_benchmark<ExecSpace, spin::BVHType::LinearBVH>("LinearBVH", boxes, rays);
+  run_benchmark<ExecSpace, spin::BVHType::WideBVH4>("WideBVH4", boxes, rays);
+  run_benchmark<ExecSpace, spin::BVHType::WideBVH8>("WideBVH8", boxes, rays);
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  slic::SimpleLogger logger(slic::message::Info);
+
+  Arguments args;
+  axom::CLI::App app {
+    "Compares the packet and per-ray traversals of spin::BVH"};
+
+  try
+  {
+    args.parse(argc, argv, app);
+  }
+  catch(const axom::CLI::ParseError& e)
+  {
+    int retval = -1;
+    retval = app.exit(e);
+    return retval;
+  }
+
+  switch(args.exec_space)
+  {
+  case ExecPolicy::CPU:
+    run_benchmarks<axom::SEQ_EXEC>(args);
+    break;
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+  case ExecPolicy::OpenMP:
+    run_benchmarks<axom::OMP_EXEC>(args);
+    break;
+#endif
+  default:
+    SLIC_ERROR("Unsupported execution space.");
+    return 1;
+  }
+
+  return 0;
+}
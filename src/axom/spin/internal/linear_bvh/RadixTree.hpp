@@ -65,6 +65,15 @@ struct RadixTree
     m_leaf_aabbs =
       axom::Array<BoxType>(ArrayOptions::Uninitialized {}, m_size, m_size, allocID);
   }
+
+  // Frees the bounding boxes and Morton codes, keeping only the hierarchy,
+  // which is all that is needed to refit the tree later on.
+  void clearBoxes()
+  {
+    m_mcodes = axom::Array<std::uint32_t>();
+    m_leaf_aabbs = axom::Array<BoxType>();
+    m_inner_aabbs = axom::Array<BoxType>();
+  }
 };
 
 } /* namespace linear_bvh */
@@ -0,0 +1,162 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_TRAVERSALPREDICATES_HPP_
+#define AXOM_SPIN_TRAVERSALPREDICATES_HPP_
+
+#include "axom/config.hpp"
+#include "axom/core/Macros.hpp"
+
+#include "axom/primal/geometry/BoundingBox.hpp"
+#include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/geometry/Ray.hpp"
+#include "axom/primal/operators/squared_distance.hpp"
+#include "axom/primal/operators/detail/intersect_ray_impl.hpp"
+
+#include "axom/spin/internal/linear_bvh/WideBVHNode.hpp"
+
+namespace axom
+{
+namespace spin
+{
+namespace internal
+{
+namespace linear_bvh
+{
+/*!
+ * \brief Traversal predicate that checks if a point is inside a BVH bin.
+ *
+ * \note In addition to the single-box check, the predicates in this file
+ *  provide an overload that tests all the lanes of a WideBVHNode at once.
+ *  This overload is picked up by the wide BVH traversal through lane_mask().
+ */
+template <typename FloatType, int NDIMS>
+struct PointInBoxPredicate
+{
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = primal::Point<FloatType, NDIMS>;
+
+  AXOM_HOST_DEVICE bool operator()(const PointType& p, const BoxType& bb) const
+  {
+    return bb.contains(p);
+  }
+
+  template <int Width>
+  AXOM_HOST_DEVICE std::uint32_t operator()(
+    const PointType& p,
+    const WideBVHNode<FloatType, NDIMS, Width>& node) const
+  {
+    return node.containsMask(p);
+  }
+};
+
+/*!
+ * \brief Traversal predicate that checks if a box intersects a BVH bin.
+ */
+template <typename FloatType, int NDIMS>
+struct BoxIntersectsPredicate
+{
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+
+  AXOM_HOST_DEVICE bool operator()(const BoxType& bb1, const BoxType& bb2) const
+  {
+    return bb1.intersectsWith(bb2);
+  }
+
+  template <int Width>
+  AXOM_HOST_DEVICE std::uint32_t operator()(
+    const BoxType& bb,
+    const WideBVHNode<FloatType, NDIMS, Width>& node) const
+  {
+    return node.intersectsMask(bb);
+  }
+};
+
+/*!
+ * \brief Traversal predicate that checks if a ray intersects a BVH bin.
+ */
+template <typename FloatType, int NDIMS>
+struct RayIntersectsPredicate
+{
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = primal::Point<FloatType, NDIMS>;
+  using RayType = primal::Ray<FloatType, NDIMS>;
+
+  FloatType tol;
+
+  AXOM_HOST_DEVICE bool operator()(const RayType& r, const BoxType& bb) const
+  {
+    PointType tmp;
+    return primal::detail::intersect_ray(r, bb, tmp, tol);
+  }
+
+  template <int Width>
+  AXOM_HOST_DEVICE std::uint32_t operator()(
+    const RayType& r,
+    const WideBVHNode<FloatType, NDIMS, Width>& node) const
+  {
+    return node.rayMask(r, tol);
+  }
+};
+
+/*!
+ * \brief Traversal predicate that checks if a BVH bin is within a given
+ *  distance of a point.
+ */
+template <typename FloatType, int NDIMS>
+struct PointWithinDistancePredicate
+{
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = primal::Point<FloatType, NDIMS>;
+
+  double sq_radius;
+
+  AXOM_HOST_DEVICE bool operator()(const PointType& p, const BoxType& bb) const
+  {
+    return primal::squared_distance(p, bb) <= sq_radius;
+  }
+
+  template <int Width>
+  AXOM_HOST_DEVICE std::uint32_t operator()(
+    const PointType& p,
+    const WideBVHNode<FloatType, NDIMS, Width>& node) const
+  {
+    return node.withinDistanceMask(p, sq_radius);
+  }
+};
+
+/*!
+ * \brief Computes the bitmask of the lanes of a wide BVH node that satisfy
+ *  the given predicate.
+ *
+ *  Uses the vectorized overload of the predicate if it provides one, i.e., if
+ *  it can be invoked with a WideBVHNode, and falls back to applying the
+ *  predicate to each lane's bounding box otherwise.
+ */
+template <typename NodeType, typename Primitive, typename Predicate>
+AXOM_HOST_DEVICE inline auto lane_mask(const NodeType& node,
+                                       const Primitive& p,
+                                       Predicate&& predicate,
+                                       int) -> decltype(predicate(p, node))
+{
+  return predicate(p, node);
+}
+
+/// \overload
+template <typename NodeType, typename Primitive, typename Predicate>
+AXOM_HOST_DEVICE inline std::uint32_t lane_mask(const NodeType& node,
+                                                const Primitive& p,
+                                                Predicate&& predicate,
+                                                long)
+{
+  return node.testLanes(p, predicate);
+}
+
+} /* namespace linear_bvh */
+} /* namespace internal */
+} /* namespace spin */
+} /* namespace axom */
+
+#endif /* AXOM_SPIN_TRAVERSALPREDICATES_HPP_ */
@@ -0,0 +1,388 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_WIDEBVHNODE_HPP_
+#define AXOM_SPIN_WIDEBVHNODE_HPP_
+
+#include "axom/config.hpp"
+#include "axom/core/Macros.hpp"
+#include "axom/core/Types.hpp"
+#include "axom/core/NumericLimits.hpp"
+#include "axom/core/numerics/floating_point_limits.hpp"
+#include "axom/core/utilities/Utilities.hpp"
+
+#include "axom/primal/geometry/BoundingBox.hpp"
+#include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/geometry/Ray.hpp"
+
+namespace axom
+{
+namespace spin
+{
+namespace internal
+{
+namespace linear_bvh
+{
+/*!
+ * \brief WideBVHNode stores the bounding boxes of up to \a Width children of
+ *  a node in a wide (collapsed) BVH.
+ *
+ *  The child bounding boxes are stored in a structure-of-arrays layout, i.e.,
+ *  the min/max coordinates of all children along a given dimension are stored
+ *  contiguously. This allows the box tests for all children of a node to be
+ *  carried out together, with a loop over the lanes that the compiler can
+ *  vectorize.
+ *
+ *  Each lane encodes one of the following:
+ *  * an inner node, children[lane] >= 0 is the index of the child node
+ *  * a leaf, children[lane] < 0 encodes the offset to the first primitive of
+ *    the leaf as -(offset+1), and counts[lane] holds the number of primitives
+ *  * an empty lane, children[lane] == EMPTY_LANE and the box is invalid
+ *
+ * \tparam FloatType the floating point precision, e.g., `double` or `float`
+ * \tparam NDIMS the number of dimensions
+ * \tparam Width the branching factor of the node, e.g., 4 or 8
+ */
+template <typename FloatType, int NDIMS, int Width>
+struct WideBVHNode
+{
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = primal::Point<FloatType, NDIMS>;
+  using RayType = primal::Ray<FloatType, NDIMS>;
+
+  static constexpr int WIDTH = Width;
+  static constexpr std::int32_t EMPTY_LANE =
+    axom::numeric_limits<std::int32_t>::min();
+
+  FloatType lo[NDIMS][Width];
+  FloatType hi[NDIMS][Width];
+  std::int32_t children[Width];
+  std::int32_t counts[Width];
+
+  /// \brief Marks all lanes of this node as empty
+  AXOM_HOST_DEVICE void clear()
+  {
+    for(int lane = 0; lane < Width; ++lane)
+    {
+      for(int d = 0; d < NDIMS; ++d)
+      {
+        lo[d][lane] = BoxType::InvalidMin;
+        hi[d][lane] = BoxType::InvalidMax;
+      }
+      children[lane] = EMPTY_LANE;
+      counts[lane] = 0;
+    }
+  }
+
+  /// \brief Sets the bounding box of the given lane
+  AXOM_HOST_DEVICE void setBox(int lane, const BoxType& box)
+  {
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      lo[d][lane] = box.getMin()[d];
+      hi[d][lane] = box.getMax()[d];
+    }
+  }
+
+  /// \brief Returns the bounding box stored in the given lane
+  AXOM_HOST_DEVICE BoxType getBox(int lane) const
+  {
+    PointType min_pt, max_pt;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      min_pt[d] = lo[d][lane];
+      max_pt[d] = hi[d][lane];
+    }
+    return BoxType {min_pt, max_pt, false};
+  }
+
+  /// \brief Checks if the given lane does not hold a child
+  AXOM_HOST_DEVICE bool isEmpty(int lane) const
+  {
+    return children[lane] == EMPTY_LANE;
+  }
+
+  /// \brief Checks if the given lane holds a leaf
+  AXOM_HOST_DEVICE bool isLeaf(int lane) const
+  {
+    return children[lane] < 0 && children[lane] != EMPTY_LANE;
+  }
+
+  /*!
+   * \brief Evaluates a user-supplied predicate on each non-empty lane.
+   *
+   * \param [in] p the primitive in query
+   * \param [in] predicate functor taking the primitive and a BoundingBox
+   *
+   * \return a bitmask with bit \a lane set if the predicate is satisfied
+   */
+  template <typename Primitive, typename Predicate>
+  AXOM_HOST_DEVICE std::uint32_t testLanes(const Primitive& p,
+                                           Predicate&& predicate) const
+  {
+    std::uint32_t mask = 0;
+    for(int lane = 0; lane < Width; ++lane)
+    {
+      if(!isEmpty(lane))
+      {
+        const BoxType box = getBox(lane);
+        if(box.isValid() && predicate(p, box))
+        {
+          mask |= (1u << lane);
+        }
+      }
+    }
+    return mask;
+  }
+
+  /*!
+   * \brief Tests the point against all lanes at once.
+   * \return a bitmask with bit \a lane set if the lane's box contains \a p
+   */
+  AXOM_HOST_DEVICE std::uint32_t containsMask(const PointType& p) const
+  {
+    bool hit[Width];
+    initValid(hit);
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const FloatType x = p[d];
+      for(int lane = 0; lane < Width; ++lane)
+      {
+        hit[lane] = hit[lane] & (lo[d][lane] <= x) & (x <= hi[d][lane]);
+      }
+    }
+    return toMask(hit);
+  }
+
+  /*!
+   * \brief Tests the box against all lanes at once.
+   * \return a bitmask with bit \a lane set if the lane's box intersects \a box
+   */
+  AXOM_HOST_DEVICE std::uint32_t intersectsMask(const BoxType& box) const
+  {
+    bool hit[Width];
+    initValid(hit);
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const FloatType bmin = box.getMin()[d];
+      const FloatType bmax = box.getMax()[d];
+      for(int lane = 0; lane < Width; ++lane)
+      {
+        hit[lane] = hit[lane] & (lo[d][lane] <= bmax) & (bmin <= hi[d][lane]);
+      }
+    }
+    return toMask(hit);
+  }
+
+  /*!
+   * \brief Tests the ray against all lanes at once, using the slab method.
+   *
+   * \param [in] ray the ray in query
+   * \param [in] EPS tolerance for treating a direction component as zero
+   *
+   * \return a bitmask with bit \a lane set if the ray intersects the lane's box
+   *
+   * \note Yields the same answer as primal::detail::intersect_ray() for
+   *  each of the lanes.
+   */
+  AXOM_HOST_DEVICE std::uint32_t rayMask(const RayType& ray,
+                                         FloatType EPS) const
+  {
+    FloatType tmin[Width];
+    FloatType tmax[Width];
+    bool hit[Width];
+    initValid(hit);
+    for(int lane = 0; lane < Width; ++lane)
+    {
+      tmin[lane] = axom::numerics::floating_point_limits<FloatType>::min();
+      tmax[lane] = axom::numerics::floating_point_limits<FloatType>::max();
+    }
+
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const FloatType x0 = ray.origin()[d];
+      const FloatType n = ray.direction()[d];
+
+      if(axom::utilities::isNearlyEqual(n, FloatType {0}, EPS))
+      {
+        for(int lane = 0; lane < Width; ++lane)
+        {
+          hit[lane] = hit[lane] & (x0 >= lo[d][lane]) & (x0 <= hi[d][lane]);
+        }
+      }
+      else
+      {
+        const FloatType invn = static_cast<FloatType>(1.0) / n;
+        for(int lane = 0; lane < Width; ++lane)
+        {
+          const FloatType t1 = (lo[d][lane] - x0) * invn;
+          const FloatType t2 = (hi[d][lane] - x0) * invn;
+          tmin[lane] =
+            axom::utilities::max(tmin[lane], axom::utilities::min(t1, t2));
+          tmax[lane] =
+            axom::utilities::min(tmax[lane], axom::utilities::max(t1, t2));
+          hit[lane] = hit[lane] & (tmin[lane] <= tmax[lane]);
+        }
+      }
+    }
+    return toMask(hit);
+  }
+
+  /*!
+   * \brief Tests a ray of a packet against all lanes at once, using the slab
+   *  method.
+   *
+   * \param [in] packet the packet of rays, i.e., a RayPacket
+   * \param [in] ray the lane of the ray in the packet
+   * \param [out] t_enter the parameter at which the ray enters the box of
+   *  each lane
+   *
+   * \return a bitmask with bit \a lane set if the ray intersects the lane's
+   *  box at a parameter less than or equal to the maximum parameter of the ray
+   *
+   * \note Yields the same answer as RayPacket::intersect() for each of the
+   *  lanes.
+   */
+  template <typename PacketType>
+  AXOM_HOST_DEVICE std::uint32_t packetRayMask(const PacketType& packet,
+                                               int ray,
+                                               FloatType (&t_enter)[Width]) const
+  {
+    FloatType t_exit[Width];
+    bool hit[Width];
+    initValid(hit);
+    for(int lane = 0; lane < Width; ++lane)
+    {
+      t_enter[lane] = axom::numerics::floating_point_limits<FloatType>::min();
+      t_exit[lane] = packet.t_max[ray];
+    }
+
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const FloatType x0 = packet.origin[d][ray];
+
+      if(packet.parallel[d][ray])
+      {
+        for(int lane = 0; lane < Width; ++lane)
+        {
+          hit[lane] = hit[lane] & (x0 >= lo[d][lane]) & (x0 <= hi[d][lane]);
+        }
+      }
+      else
+      {
+        const FloatType invn = packet.inv_dir[d][ray];
+        for(int lane = 0; lane < Width; ++lane)
+        {
+          const FloatType t1 = (lo[d][lane] - x0) * invn;
+          const FloatType t2 = (hi[d][lane] - x0) * invn;
+          t_enter[lane] =
+            axom::utilities::max(t_enter[lane], axom::utilities::min(t1, t2));
+          t_exit[lane] =
+            axom::utilities::min(t_exit[lane], axom::utilities::max(t1, t2));
+        }
+      }
+    }
+
+    for(int lane = 0; lane < Width; ++lane)
+    {
+      hit[lane] = hit[lane] & (t_enter[lane] <= t_exit[lane]);
+    }
+    return toMask(hit);
+  }
+
+  /*!
+   * \brief Computes the squared distance from the point to the box of each
+   *  lane at once.
+   *
+   * \param [in] p the point in query
+   * \param [out] sq_dist the squared distance to the box of each lane; set to
+   *  the largest representable value for lanes without a valid box
+   *
+   * \return a bitmask with bit \a lane set if the lane holds a valid box
+   */
+  AXOM_HOST_DEVICE std::uint32_t squaredDistances(
+    const PointType& p,
+    double (&sq_dist)[Width]) const
+  {
+    bool valid[Width];
+    initValid(valid);
+    for(int lane = 0; lane < Width; ++lane)
+    {
+      sq_dist[lane] = 0.;
+    }
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const FloatType x = p[d];
+      for(int lane = 0; lane < Width; ++lane)
+      {
+        const double delta = axom::utilities::max(
+          axom::utilities::max(lo[d][lane] - x, x - hi[d][lane]),
+          FloatType {0});
+        sq_dist[lane] += delta * delta;
+      }
+    }
+    for(int lane = 0; lane < Width; ++lane)
+    {
+      if(!valid[lane])
+      {
+        sq_dist[lane] = axom::numerics::floating_point_limits<double>::max();
+      }
+    }
+    return toMask(valid);
+  }
+
+  /*!
+   * \brief Tests the distance from the point to all lanes at once.
+   * \return a bitmask with bit \a lane set if the lane's box is within a
+   *  squared distance of \a sq_radius of \a p
+   */
+  AXOM_HOST_DEVICE std::uint32_t withinDistanceMask(const PointType& p,
+                                                    double sq_radius) const
+  {
+    double sq_dist[Width];
+    const std::uint32_t valid = squaredDistances(p, sq_dist);
+
+    bool hit[Width];
+    for(int lane = 0; lane < Width; ++lane)
+    {
+      hit[lane] = sq_dist[lane] <= sq_radius;
+    }
+    return toMask(hit) & valid;
+  }
+
+private:
+  /// Initializes \a hit with the lanes that hold a valid bounding box
+  AXOM_HOST_DEVICE void initValid(bool (&hit)[Width]) const
+  {
+    for(int lane = 0; lane < Width; ++lane)
+    {
+      hit[lane] = true;
+    }
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      for(int lane = 0; lane < Width; ++lane)
+      {
+        hit[lane] = hit[lane] & (lo[d][lane] <= hi[d][lane]);
+      }
+    }
+  }
+
+  AXOM_HOST_DEVICE static std::uint32_t toMask(const bool (&hit)[Width])
+  {
+    std::uint32_t mask = 0;
+    for(int lane = 0; lane < Width; ++lane)
+    {
+      mask |= static_cast<std::uint32_t>(hit[lane]) << lane;
+    }
+    return mask;
+  }
+};
+
+} /* namespace linear_bvh */
+} /* namespace internal */
+} /* namespace spin */
+} /* namespace axom */
+
+#endif /* AXOM_SPIN_WIDEBVHNODE_HPP_ */
@@ -86,6 +86,41 @@ static inline AXOM_HOST_DEVICE std::int64_t morton64_encode(axom::float32 x,
   return convertPointToMorton<std::int64_t>(integer_pt);
 }
 
+//------------------------------------------------------------------------------
+// Returns the surface area (perimeter in 2D) of the given box, i.e., the
+// cost of visiting a node in the surface area heuristic.
+template <typename FloatType, int NDIMS>
+AXOM_HOST_DEVICE inline double box_surface_area(
+  const primal::BoundingBox<FloatType, NDIMS>& box)
+{
+  if(!box.isValid())
+  {
+    return 0.;
+  }
+
+  const auto r = box.range();
+  return (NDIMS == 2) ? 2. * (r[0] + r[1])
+                      : 2. * (r[0] * r[1] + r[1] * r[NDIMS - 1] +
+                              r[0] * r[NDIMS - 1]);
+}
+
+//------------------------------------------------------------------------------
+// Returns a host-accessible view of the given array, copying it to the host
+// in the supplied buffer only if the execution space resides on the device.
+template <typename ExecSpace, typename T>
+axom::ArrayView<const T> host_view(const axom::Array<T>& array,
+                                   axom::Array<T>& host_buffer)
+{
+  if(axom::execution_space<ExecSpace>::onDevice())
+  {
+    const int hostAllocatorID =
+      axom::execution_space<axom::SEQ_EXEC>::allocatorID();
+    host_buffer = axom::Array<T>(array, hostAllocatorID);
+    return host_buffer.view();
+  }
+  return array.view();
+}
+
 template <typename ExecSpace, typename BoxIndexable, typename FloatType, int NDIMS>
 void transform_boxes(const BoxIndexable boxes,
                      ArrayView<primal::BoundingBox<FloatType, NDIMS>> aabbs,
@@ -641,6 +676,89 @@ void build_radix_tree(const BoxIndexable boxes,
   propagate_aabbs<ExecSpace>(radix_tree, allocatorID);
 }
 
+//------------------------------------------------------------------------------
+// Returns the cost of the tree as the sum of the surface areas of its inner
+// nodes, relative to the surface area of the given bounds. This is the SAH
+// cost of traversing the tree, up to the cost of the leaves, and serves as a
+// measure of its quality, lower is better.
+template <typename ExecSpace, typename FloatType, int NDIMS>
+double compute_tree_cost(const RadixTree<FloatType, NDIMS>& data,
+                         const primal::BoundingBox<FloatType, NDIMS>& bounds)
+{
+  AXOM_ANNOTATE_SCOPE("compute_tree_cost");
+
+  const std::int32_t inner_size = data.m_inner_size;
+  const auto inner_aabb_ptr = data.m_inner_aabbs.view();
+
+#ifdef AXOM_USE_RAJA
+  using reduce_policy = typename axom::execution_space<ExecSpace>::reduce_policy;
+  RAJA::ReduceSum<reduce_policy, double> cost_reduce(0.);
+
+  for_all<ExecSpace>(
+    inner_size,
+    AXOM_LAMBDA(std::int32_t i) {
+      cost_reduce += box_surface_area(inner_aabb_ptr[i]);
+    });
+
+  const double cost = cost_reduce.get();
+#else
+  static_assert(std::is_same<ExecSpace, SEQ_EXEC>::value,
+                "Only SEQ_EXEC supported without RAJA");
+
+  double cost = 0.;
+  for_all<ExecSpace>(inner_size, [&](std::int32_t i) {
+    cost += box_surface_area(inner_aabb_ptr[i]);
+  });
+#endif
+
+  const double root_area = box_surface_area(bounds);
+  return (root_area > 0.) ? cost / root_area : 0.;
+}
+
+//------------------------------------------------------------------------------
+// Updates the bounding boxes of a previously built tree, keeping its topology.
+// The new boxes are sorted in the leaf order of the tree, given by leafs, and
+// the inner node boxes are recomputed bottom-up.
+template <typename ExecSpace, typename BoxIndexable, typename FloatType, int NDIMS>
+void refit_radix_tree(const BoxIndexable boxes,
+                      int size,
+                      const ArrayView<const std::int32_t> leafs,
+                      primal::BoundingBox<FloatType, NDIMS>& bounds,
+                      RadixTree<FloatType, NDIMS>& radix_tree,
+                      FloatType scale_factor,
+                      int allocatorID)
+{
+  AXOM_ANNOTATE_SCOPE("refit_radix_tree");
+
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+
+  // sanity checks
+  SLIC_ASSERT(size == radix_tree.m_size);
+  SLIC_ASSERT(leafs.size() == size);
+
+  const std::int32_t inner_size = radix_tree.m_inner_size;
+  radix_tree.m_leaf_aabbs =
+    Array<BoxType>(ArrayOptions::Uninitialized {}, size, size, allocatorID);
+  if(radix_tree.m_inner_aabbs.size() != inner_size)
+  {
+    radix_tree.m_inner_aabbs = Array<BoxType>(ArrayOptions::Uninitialized {},
+                                              inner_size,
+                                              inner_size,
+                                              allocatorID);
+  }
+
+  transform_boxes<ExecSpace>(boxes,
+                             radix_tree.m_leaf_aabbs.view(),
+                             size,
+                             scale_factor);
+
+  bounds = reduce<ExecSpace, FloatType, NDIMS>(radix_tree.m_leaf_aabbs, size);
+
+  reorder<ExecSpace>(leafs, radix_tree.m_leaf_aabbs, size, allocatorID);
+
+  propagate_aabbs<ExecSpace>(radix_tree, allocatorID);
+}
+
 } /* namespace linear_bvh */
 } /* namespace internal */
 } /* namespace spin */
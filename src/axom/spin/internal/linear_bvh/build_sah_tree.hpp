@@ -0,0 +1,351 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_BUILD_SAH_TREE_HPP_
+#define AXOM_SPIN_BUILD_SAH_TREE_HPP_
+
+#include "axom/config.hpp"
+
+#include "axom/core/Array.hpp"
+#include "axom/core/AnnotationMacros.hpp"
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/utilities/Utilities.hpp"
+
+#include "axom/slic/interface/slic.hpp"
+
+#include "axom/primal/geometry/BoundingBox.hpp"
+#include "axom/primal/geometry/Point.hpp"
+
+#include "axom/spin/internal/linear_bvh/RadixTree.hpp"
+#include "axom/spin/internal/linear_bvh/build_radix_tree.hpp"
+#include "axom/spin/internal/linear_bvh/bvh_traverse.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace axom
+{
+namespace spin
+{
+namespace internal
+{
+namespace linear_bvh
+{
+//------------------------------------------------------------------------------
+/*!
+ * \brief Builds the topology of a binary tree over the given bounding boxes,
+ *  top-down, using the binned surface area heuristic (SAH).
+ *
+ *  The primitives of each node are binned along each axis according to their
+ *  centroids, and the node is split at the bin boundary that minimizes
+ *
+ *    SA(left) * N(left) + SA(right) * N(right),
+ *
+ *  where SA is the surface area of a child's bounding box and N the number of
+ *  primitives it holds. Nodes whose centroids cannot be separated by the bins
+ *  are split in the middle of their range.
+ *
+ *  To bound the depth of the tree, a node is instead split at the median of
+ *  its centroids along their widest axis when a child of the SAH split could
+ *  not be completed within \a max_depth levels as a balanced subtree. This
+ *  only happens for highly skewed distributions, e.g., clusters of
+ *  geometrically shrinking size, for which the SAH would otherwise split off
+ *  a few primitives at a time.
+ *
+ *  The tree is written out in the layout of a RadixTree: the root is inner
+ *  node 0, leaf i is node inner_size + i, and the leaves of every subtree are
+ *  contiguous in the returned primitive ordering.
+ *
+ * \param [in] aabbs the bounding boxes of the primitives, on the host
+ * \param [out] order the primitive IDs, in leaf order
+ * \param [out] lchildren the left child of each inner node
+ * \param [out] rchildren the right child of each inner node
+ * \param [out] parents the parent of each node, -1 for the root
+ * \param [out] inner_aabbs the bounding box of each inner node
+ * \param [in] max_depth the maximum number of inner nodes on the path from the
+ *  root to a leaf, BVH_MAX_DEPTH by default so that the tree can be traversed
+ *
+ * \pre aabbs.size() >= 2
+ * \pre 2^max_depth >= aabbs.size()
+ */
+template <typename FloatType, int NDIMS>
+void build_sah_topology(
+  axom::ArrayView<const primal::BoundingBox<FloatType, NDIMS>> aabbs,
+  axom::ArrayView<std::int32_t> order,
+  axom::ArrayView<std::int32_t> lchildren,
+  axom::ArrayView<std::int32_t> rchildren,
+  axom::ArrayView<std::int32_t> parents,
+  axom::ArrayView<primal::BoundingBox<FloatType, NDIMS>> inner_aabbs,
+  std::int32_t max_depth = BVH_MAX_DEPTH)
+{
+  AXOM_ANNOTATE_SCOPE("build_sah_topology");
+
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = primal::Point<FloatType, NDIMS>;
+
+  constexpr int NUM_BINS = 16;
+
+  const std::int32_t size = static_cast<std::int32_t>(aabbs.size());
+  const std::int32_t inner_size = size - 1;
+  SLIC_ASSERT(size >= 2);
+
+  // depth of a balanced tree over n primitives, i.e., ceil(log2(n))
+  auto balanced_depth = [](std::int32_t n) {
+    std::int32_t depth = 0;
+    while((std::int64_t {1} << depth) < n)
+    {
+      ++depth;
+    }
+    return depth;
+  };
+  SLIC_ASSERT(balanced_depth(size) <= max_depth);
+
+  std::vector<PointType> centroids(size);
+  for(std::int32_t i = 0; i < size; ++i)
+  {
+    centroids[i] = aabbs[i].getCentroid();
+    order[i] = i;
+  }
+
+  // pending inner nodes, each spanning the range [begin, end) of order, along
+  // with their depth, counting the root as 1
+  struct Task
+  {
+    std::int32_t node;
+    std::int32_t begin;
+    std::int32_t end;
+    std::int32_t depth;
+  };
+  std::vector<Task> tasks {{0, 0, size, 1}};
+  std::int32_t num_inner = 1;
+  parents[0] = -1;
+
+  while(!tasks.empty())
+  {
+    const Task task = tasks.back();
+    tasks.pop_back();
+
+    // STEP 1: compute the bounds of the node and of its centroids
+    BoxType node_box, centroid_box;
+    for(std::int32_t i = task.begin; i < task.end; ++i)
+    {
+      node_box.addBox(aabbs[order[i]]);
+      centroid_box.addPoint(centroids[order[i]]);
+    }
+    inner_aabbs[task.node] = node_box;
+
+    // STEP 2: find the split with the lowest cost over all axes
+    int best_axis = -1;
+    int best_bin = -1;
+    double best_cost = std::numeric_limits<double>::max();
+    for(int axis = 0; axis < NDIMS; ++axis)
+    {
+      const double cmin = centroid_box.getMin()[axis];
+      const double extent = centroid_box.getMax()[axis] - cmin;
+      if(!(extent > 0.))
+      {
+        continue;
+      }
+
+      std::int32_t counts[NUM_BINS] = {};
+      BoxType bins[NUM_BINS];
+      for(std::int32_t i = task.begin; i < task.end; ++i)
+      {
+        const std::int32_t prim = order[i];
+        const int bin = axom::utilities::clampVal(
+          static_cast<int>(NUM_BINS * (centroids[prim][axis] - cmin) / extent),
+          0,
+          NUM_BINS - 1);
+        ++counts[bin];
+        bins[bin].addBox(aabbs[prim]);
+      }
+
+      // sweep from the right to get the cost of each right partition
+      double right_cost[NUM_BINS];
+      BoxType right_box;
+      std::int32_t right_count = 0;
+      for(int bin = NUM_BINS - 1; bin > 0; --bin)
+      {
+        right_box.addBox(bins[bin]);
+        right_count += counts[bin];
+        right_cost[bin] = box_surface_area(right_box) * right_count;
+      }
+
+      BoxType left_box;
+      std::int32_t left_count = 0;
+      for(int bin = 0; bin < NUM_BINS - 1; ++bin)
+      {
+        left_box.addBox(bins[bin]);
+        left_count += counts[bin];
+        const std::int32_t nright = (task.end - task.begin) - left_count;
+        if(left_count == 0 || nright == 0)
+        {
+          continue;
+        }
+
+        const double cost =
+          box_surface_area(left_box) * left_count + right_cost[bin + 1];
+        if(cost < best_cost)
+        {
+          best_cost = cost;
+          best_axis = axis;
+          best_bin = bin;
+        }
+      }
+    }
+
+    // STEP 3: partition the primitives of the node
+    std::int32_t mid = task.begin + (task.end - task.begin) / 2;
+    if(best_axis >= 0)
+    {
+      const double cmin = centroid_box.getMin()[best_axis];
+      const double extent = centroid_box.getMax()[best_axis] - cmin;
+      auto it = std::partition(
+        order.begin() + task.begin,
+        order.begin() + task.end,
+        [&](std::int32_t prim) {
+          const int bin = axom::utilities::clampVal(
+            static_cast<int>(NUM_BINS * (centroids[prim][best_axis] - cmin) /
+                             extent),
+            0,
+            NUM_BINS - 1);
+          return bin <= best_bin;
+        });
+      mid = static_cast<std::int32_t>(it - order.begin());
+
+      // fall back to a median split if the tree could exceed max_depth
+      const std::int32_t max_child_depth =
+        task.depth +
+        axom::utilities::max(balanced_depth(mid - task.begin),
+                             balanced_depth(task.end - mid));
+      if(max_child_depth > max_depth)
+      {
+        int axis = 0;
+        for(int d = 1; d < NDIMS; ++d)
+        {
+          if(centroid_box.getMax()[d] - centroid_box.getMin()[d] >
+             centroid_box.getMax()[axis] - centroid_box.getMin()[axis])
+          {
+            axis = d;
+          }
+        }
+
+        mid = task.begin + (task.end - task.begin) / 2;
+        std::nth_element(order.begin() + task.begin,
+                         order.begin() + mid,
+                         order.begin() + task.end,
+                         [&](std::int32_t a, std::int32_t b) {
+                           return centroids[a][axis] < centroids[b][axis];
+                         });
+      }
+    }
+    SLIC_ASSERT(mid > task.begin && mid < task.end);
+
+    // STEP 4: emit the children; single primitives become leaves
+    std::int32_t children[2];
+    const std::int32_t ranges[3] = {task.begin, mid, task.end};
+    for(int c = 0; c < 2; ++c)
+    {
+      if(ranges[c + 1] - ranges[c] == 1)
+      {
+        children[c] = inner_size + ranges[c];
+      }
+      else
+      {
+        children[c] = num_inner++;
+        tasks.push_back(
+          {children[c], ranges[c], ranges[c + 1], task.depth + 1});
+      }
+      parents[children[c]] = task.node;
+    }
+    lchildren[task.node] = children[0];
+    rchildren[task.node] = children[1];
+  }
+
+  SLIC_ASSERT(num_inner == inner_size);
+}
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Builds a RadixTree over the given bounding boxes with the binned
+ *  surface area heuristic.
+ *
+ *  This is a drop-in replacement for build_radix_tree(): the resulting tree
+ *  has the same layout, so the BVH policies emit their nodes from it in the
+ *  same way. The boxes are transformed in the given execution space, whereas
+ *  the hierarchy itself is built on the host.
+ *
+ * \note The Morton codes of the returned tree are not computed.
+ *
+ * \see build_radix_tree
+ */
+template <typename ExecSpace, typename BoxIndexable, typename FloatType, int NDIMS>
+void build_sah_tree(const BoxIndexable boxes,
+                    int size,
+                    primal::BoundingBox<FloatType, NDIMS>& bounds,
+                    RadixTree<FloatType, NDIMS>& radix_tree,
+                    FloatType scale_factor,
+                    int allocatorID)
+{
+  AXOM_ANNOTATE_SCOPE("build_sah_tree");
+
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+
+  // sanity checks
+  SLIC_ASSERT(size > 1);
+
+  radix_tree.allocate(size, allocatorID);
+
+  transform_boxes<ExecSpace>(boxes,
+                             radix_tree.m_leaf_aabbs.view(),
+                             size,
+                             scale_factor);
+
+  // evaluate global bounds
+  bounds = reduce<ExecSpace, FloatType, NDIMS>(radix_tree.m_leaf_aabbs, size);
+
+  // build the tree on the host
+  const int hostAllocatorID =
+    axom::execution_space<axom::SEQ_EXEC>::allocatorID();
+  const std::int32_t inner_size = radix_tree.m_inner_size;
+
+  axom::Array<BoxType> aabbs(radix_tree.m_leaf_aabbs, hostAllocatorID);
+  axom::Array<std::int32_t> order(size, size, hostAllocatorID);
+  axom::Array<std::int32_t> lchildren(inner_size, inner_size, hostAllocatorID);
+  axom::Array<std::int32_t> rchildren(inner_size, inner_size, hostAllocatorID);
+  axom::Array<std::int32_t> parents(inner_size + size,
+                                    inner_size + size,
+                                    hostAllocatorID);
+  axom::Array<BoxType> inner_aabbs(inner_size, inner_size, hostAllocatorID);
+
+  build_sah_topology<FloatType, NDIMS>(aabbs.view(),
+                                       order.view(),
+                                       lchildren.view(),
+                                       rchildren.view(),
+                                       parents.view(),
+                                       inner_aabbs.view());
+
+  radix_tree.m_leafs = axom::Array<std::int32_t>(order, allocatorID);
+  radix_tree.m_left_children =
+    axom::Array<std::int32_t>(lchildren, allocatorID);
+  radix_tree.m_right_children =
+    axom::Array<std::int32_t>(rchildren, allocatorID);
+  radix_tree.m_parents = axom::Array<std::int32_t>(parents, allocatorID);
+  radix_tree.m_inner_aabbs = axom::Array<BoxType>(inner_aabbs, allocatorID);
+
+  // sort the leaf boxes in leaf order
+  reorder<ExecSpace>(radix_tree.m_leafs,
+                     radix_tree.m_leaf_aabbs,
+                     size,
+                     allocatorID);
+}
+
+} /* namespace linear_bvh */
+} /* namespace internal */
+} /* namespace spin */
+} /* namespace axom */
+
+#endif /* AXOM_SPIN_BUILD_SAH_TREE_HPP_ */
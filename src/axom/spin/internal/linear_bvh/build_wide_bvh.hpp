@@ -0,0 +1,260 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_BUILD_WIDE_BVH_HPP_
+#define AXOM_SPIN_BUILD_WIDE_BVH_HPP_
+
+#include "axom/config.hpp"
+
+#include "axom/core/Array.hpp"
+#include "axom/core/AnnotationMacros.hpp"
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/execution/for_all.hpp"
+#include "axom/core/memory_management.hpp"
+
+#include "axom/slic/interface/slic.hpp"
+
+#include "axom/primal/geometry/BoundingBox.hpp"
+
+#include "axom/spin/internal/linear_bvh/RadixTree.hpp"
+#include "axom/spin/internal/linear_bvh/build_radix_tree.hpp"
+#include "axom/spin/internal/linear_bvh/WideBVHNode.hpp"
+
+#include <vector>
+
+namespace axom
+{
+namespace spin
+{
+namespace internal
+{
+namespace linear_bvh
+{
+//------------------------------------------------------------------------------
+/*!
+ * \brief Collapses a binary radix tree into a wide BVH with a branching
+ *  factor of \a Width.
+ *
+ *  Each wide node is formed by starting from the two children of a binary
+ *  node and repeatedly replacing the inner child with the largest surface
+ *  area by its two children, until \a Width children have been gathered.
+ *  Subtrees that hold at most \a max_leaf_size primitives are turned into
+ *  leaves. Since the leaves of each subtree of the radix tree are contiguous
+ *  in leaf order, a leaf is encoded by the offset of its first primitive in
+ *  the sorted leaf arrays and the number of primitives it holds.
+ *
+ * \param [in] radix_tree the binary radix tree
+ * \param [in] max_leaf_size the maximum number of primitives in a leaf
+ * \param [out] lane_nodes the radix tree node of each lane of the returned
+ *  nodes, i.e., lane_nodes[i * Width + lane], or -1 for empty lanes
+ * \param [in] allocatorID the allocator to use for the returned arrays
+ *
+ * \return the wide BVH nodes; the root node is at index 0.
+ *
+ * \note The collapse is carried out on the host, it is linear in the number
+ *  of primitives.
+ */
+template <typename ExecSpace, int Width, typename FloatType, int NDIMS>
+axom::Array<WideBVHNode<FloatType, NDIMS, Width>> collapse_radix_tree(
+  const RadixTree<FloatType, NDIMS>& radix_tree,
+  int max_leaf_size,
+  axom::Array<std::int32_t>& lane_nodes,
+  int allocatorID)
+{
+  AXOM_ANNOTATE_SCOPE("collapse_radix_tree");
+
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+  using NodeType = WideBVHNode<FloatType, NDIMS, Width>;
+
+  AXOM_STATIC_ASSERT_MSG(Width >= 2 && Width <= 32,
+                         "Width of a wide BVH node must be in [2,32]");
+
+  const std::int32_t inner_size = radix_tree.m_inner_size;
+  SLIC_ASSERT(inner_size >= 1);
+
+  axom::Array<std::int32_t> lchildren_buf, rchildren_buf;
+  axom::Array<BoxType> inner_aabbs_buf, leaf_aabbs_buf;
+  const auto lchildren =
+    host_view<ExecSpace>(radix_tree.m_left_children, lchildren_buf);
+  const auto rchildren =
+    host_view<ExecSpace>(radix_tree.m_right_children, rchildren_buf);
+  const auto inner_aabbs =
+    host_view<ExecSpace>(radix_tree.m_inner_aabbs, inner_aabbs_buf);
+  const auto leaf_aabbs =
+    host_view<ExecSpace>(radix_tree.m_leaf_aabbs, leaf_aabbs_buf);
+
+  // Nodes with an index >= inner_size are leaves of the radix tree
+  auto is_inner = [=](std::int32_t node) { return node < inner_size; };
+
+  // STEP 1: compute the range of sorted leaves spanned by each inner node.
+  // The nodes are visited in reverse pre-order, so that children are always
+  // processed before their parents.
+  std::vector<std::int32_t> first(inner_size), last(inner_size);
+  {
+    std::vector<std::int32_t> order;
+    std::vector<std::int32_t> stack {0};
+    order.reserve(inner_size);
+    while(!stack.empty())
+    {
+      const std::int32_t node = stack.back();
+      stack.pop_back();
+      order.push_back(node);
+      if(is_inner(lchildren[node]))
+      {
+        stack.push_back(lchildren[node]);
+      }
+      if(is_inner(rchildren[node]))
+      {
+        stack.push_back(rchildren[node]);
+      }
+    }
+
+    for(auto it = order.rbegin(); it != order.rend(); ++it)
+    {
+      const std::int32_t node = *it;
+      const std::int32_t lchild = lchildren[node];
+      const std::int32_t rchild = rchildren[node];
+      first[node] = is_inner(lchild) ? first[lchild] : lchild - inner_size;
+      last[node] = is_inner(rchild) ? last[rchild] : rchild - inner_size;
+    }
+  }
+
+  auto num_leaves = [&](std::int32_t node) {
+    return is_inner(node) ? last[node] - first[node] + 1 : 1;
+  };
+  auto get_box = [&](std::int32_t node) -> BoxType {
+    return is_inner(node) ? inner_aabbs[node] : leaf_aabbs[node - inner_size];
+  };
+
+  // STEP 2: emit the wide nodes, breadth-first from the root
+  const int hostAllocatorID =
+    axom::execution_space<axom::SEQ_EXEC>::allocatorID();
+  axom::Array<NodeType> nodes(0, inner_size / (Width - 1) + 1, hostAllocatorID);
+
+  std::vector<std::int32_t> pending_binary {0};
+  std::vector<std::int32_t> lane_sources;
+  nodes.emplace_back();
+
+  for(std::size_t wide_idx = 0; wide_idx < pending_binary.size(); ++wide_idx)
+  {
+    const std::int32_t binary_node = pending_binary[wide_idx];
+
+    // gather up to Width children by expanding the largest inner children
+    std::int32_t lanes[Width];
+    int nlanes = 2;
+    lanes[0] = lchildren[binary_node];
+    lanes[1] = rchildren[binary_node];
+    while(nlanes < Width)
+    {
+      int expand = -1;
+      double max_area = -1.;
+      for(int i = 0; i < nlanes; ++i)
+      {
+        if(is_inner(lanes[i]))
+        {
+          const double area = box_surface_area(get_box(lanes[i]));
+          if(area > max_area)
+          {
+            max_area = area;
+            expand = i;
+          }
+        }
+      }
+      if(expand < 0)
+      {
+        break;
+      }
+
+      // replace the expanded node by its two children, preserving the order
+      const std::int32_t node = lanes[expand];
+      for(int i = nlanes; i > expand + 1; --i)
+      {
+        lanes[i] = lanes[i - 1];
+      }
+      lanes[expand] = lchildren[node];
+      lanes[expand + 1] = rchildren[node];
+      ++nlanes;
+    }
+
+    NodeType wide_node;
+    wide_node.clear();
+    lane_sources.resize((wide_idx + 1) * Width, -1);
+    for(int lane = 0; lane < nlanes; ++lane)
+    {
+      const std::int32_t child = lanes[lane];
+      wide_node.setBox(lane, get_box(child));
+      lane_sources[wide_idx * Width + lane] = child;
+
+      const std::int32_t nleaves = num_leaves(child);
+      if(!is_inner(child) || nleaves <= max_leaf_size)
+      {
+        const std::int32_t offset =
+          is_inner(child) ? first[child] : child - inner_size;
+        wide_node.children[lane] = -(offset + 1);
+        wide_node.counts[lane] = nleaves;
+      }
+      else
+      {
+        wide_node.children[lane] = static_cast<std::int32_t>(nodes.size());
+        pending_binary.push_back(child);
+        nodes.emplace_back();
+      }
+    }
+    nodes[wide_idx] = wide_node;
+  }
+
+  const IndexType num_lanes = static_cast<IndexType>(lane_sources.size());
+  lane_nodes = axom::Array<std::int32_t>(num_lanes, num_lanes, allocatorID);
+  axom::copy(lane_nodes.data(),
+             lane_sources.data(),
+             num_lanes * sizeof(std::int32_t));
+
+  return axom::Array<NodeType>(nodes, allocatorID);
+}
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Updates the bounding boxes of a wide BVH from the boxes of the radix
+ *  tree it was collapsed from, e.g., after the radix tree has been refitted.
+ *
+ * \param [in] radix_tree the binary radix tree
+ * \param [in] lane_nodes the radix tree node of each lane, as returned by
+ *  collapse_radix_tree()
+ * \param [in,out] nodes the wide BVH nodes
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS, int Width>
+void refit_wide_nodes(
+  const RadixTree<FloatType, NDIMS>& radix_tree,
+  axom::ArrayView<const std::int32_t> lane_nodes,
+  axom::ArrayView<WideBVHNode<FloatType, NDIMS, Width>> nodes)
+{
+  AXOM_ANNOTATE_SCOPE("refit_wide_nodes");
+
+  SLIC_ASSERT(lane_nodes.size() == nodes.size() * Width);
+
+  const std::int32_t inner_size = radix_tree.m_inner_size;
+  const auto leaf_aabbs = radix_tree.m_leaf_aabbs.view();
+  const auto inner_aabbs = radix_tree.m_inner_aabbs.view();
+
+  for_all<ExecSpace>(
+    lane_nodes.size(),
+    AXOM_LAMBDA(IndexType i) {
+      const std::int32_t node = lane_nodes[i];
+      if(node >= 0)
+      {
+        nodes[i / Width].setBox(i % Width,
+                                node < inner_size
+                                  ? inner_aabbs[node]
+                                  : leaf_aabbs[node - inner_size]);
+      }
+    });
+}
+
+} /* namespace linear_bvh */
+} /* namespace internal */
+} /* namespace spin */
+} /* namespace axom */
+
+#endif /* AXOM_SPIN_BUILD_WIDE_BVH_HPP_ */
@@ -0,0 +1,175 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_BVH_BINARY_IO_HPP_
+#define AXOM_SPIN_BVH_BINARY_IO_HPP_
+
+#include "axom/core/utilities/Utilities.hpp"
+
+#include "axom/slic/interface/slic.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace axom
+{
+namespace spin
+{
+namespace internal
+{
+namespace linear_bvh
+{
+/*!
+ * \brief Header of the binary files written by LinearBVH::saveImpl(), and of
+ *  the buffers written by LinearBVH::serializeImpl().
+ *
+ *  A BVH file consists of this header, which records the number of entities
+ *  the BVH was initialized with and the bounds of the BVH, followed by three
+ *  sections holding the raw contents of the node arrays of a LinearBVH:
+ *
+ *  * the bounding boxes of the children of each inner node, as
+ *    2 * NDIMS values of the floating point type of the BVH per box
+ *  * the (offset or ones-complement leaf) index of the children of each
+ *    inner node, as 32-bit integers
+ *  * the entity ID of each leaf, as 32-bit integers
+ *
+ *  Each section starts at an offset that is a multiple of SECTION_ALIGNMENT
+ *  bytes, so that a memory-mapped file can be used in place. All values are
+ *  stored in the byte order of the machine that wrote the file, which is
+ *  recorded in the endian tag.
+ */
+struct BVHFileHeader
+{
+  static constexpr std::uint32_t VERSION = 1;
+  static constexpr std::uint32_t ENDIAN_TAG = 0x01020304;
+  static constexpr std::uint64_t SECTION_ALIGNMENT = 64;
+  static constexpr int MAX_DIMS = 3;
+
+  char magic[8];
+  std::uint32_t endian_tag;
+  std::uint32_t version;
+  std::uint32_t ndims;
+  std::uint32_t float_size;
+  std::int64_t num_items;
+  std::int64_t num_leaves;
+  std::int64_t num_inner_nodes;
+  double bounds_min[MAX_DIMS];
+  double bounds_max[MAX_DIMS];
+  std::uint64_t inner_nodes_offset;
+  std::uint64_t children_offset;
+  std::uint64_t leaf_nodes_offset;
+
+  /// \brief Returns the magic string identifying BVH files
+  static const char* getMagic() { return "AXOMBVH"; }
+
+  /// \brief Rounds up the given offset to the section alignment
+  static std::uint64_t align(std::uint64_t offset)
+  {
+    return (offset + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT *
+      SECTION_ALIGNMENT;
+  }
+
+  /// \brief Checks if the file was written with the opposite byte order
+  bool isByteSwapped() const
+  {
+    return endian_tag == axom::utilities::byteswap(ENDIAN_TAG);
+  }
+
+  /// \brief Converts all the fields to the opposite byte order
+  void byteswap()
+  {
+    using axom::utilities::byteswap;
+    endian_tag = byteswap(endian_tag);
+    version = byteswap(version);
+    ndims = byteswap(ndims);
+    float_size = byteswap(float_size);
+    num_items = byteswap(num_items);
+    num_leaves = byteswap(num_leaves);
+    num_inner_nodes = byteswap(num_inner_nodes);
+    for(int d = 0; d < MAX_DIMS; ++d)
+    {
+      bounds_min[d] = byteswap(bounds_min[d]);
+      bounds_max[d] = byteswap(bounds_max[d]);
+    }
+    inner_nodes_offset = byteswap(inner_nodes_offset);
+    children_offset = byteswap(children_offset);
+    leaf_nodes_offset = byteswap(leaf_nodes_offset);
+  }
+
+  /*!
+   * \brief Checks that the header describes a valid BVH file of the given
+   *  dimension and floating point type, whose sections fit in \a fileSize.
+   *
+   * \note The header is expected to be in the byte order of this machine.
+   */
+  bool isValid(int expectedDims,
+               std::size_t expectedFloatSize,
+               std::size_t fileSize) const
+  {
+    if(std::strncmp(magic, getMagic(), sizeof(magic)) != 0)
+    {
+      SLIC_WARNING("Not a BVH file: invalid magic string");
+      return false;
+    }
+    if(endian_tag != ENDIAN_TAG || version != VERSION)
+    {
+      SLIC_WARNING("Unsupported BVH file version: " << version);
+      return false;
+    }
+    if(ndims != static_cast<std::uint32_t>(expectedDims) ||
+       float_size != expectedFloatSize)
+    {
+      SLIC_WARNING("BVH file holds a " << ndims << "D BVH with "
+                                        << float_size << "-byte floats, "
+                                        << "expected a " << expectedDims
+                                        << "D BVH with " << expectedFloatSize
+                                        << "-byte floats");
+      return false;
+    }
+    if(num_leaves < 2 || num_inner_nodes != 2 * (num_leaves - 1) ||
+       num_items < 0 || num_items > num_leaves)
+    {
+      SLIC_WARNING("Invalid number of nodes in BVH file");
+      return false;
+    }
+
+    const std::uint64_t box_size = 2 * ndims * float_size;
+    const std::uint64_t ninner = static_cast<std::uint64_t>(num_inner_nodes);
+    const std::uint64_t nleaves = static_cast<std::uint64_t>(num_leaves);
+    const bool fits = inner_nodes_offset % SECTION_ALIGNMENT == 0 &&
+      children_offset % SECTION_ALIGNMENT == 0 &&
+      leaf_nodes_offset % SECTION_ALIGNMENT == 0 &&
+      inner_nodes_offset + ninner * box_size <= fileSize &&
+      children_offset + ninner * sizeof(std::int32_t) <= fileSize &&
+      leaf_nodes_offset + nleaves * sizeof(std::int32_t) <= fileSize;
+    if(!fits)
+    {
+      SLIC_WARNING("BVH file is truncated or corrupted");
+      return false;
+    }
+
+    return true;
+  }
+};
+
+/*!
+ * \brief Reverses the byte order of an array of arithmetic values in place.
+ */
+template <typename T>
+void byteswap_array(T* data, std::uint64_t size)
+{
+  for(std::uint64_t i = 0; i < size; ++i)
+  {
+    data[i] = axom::utilities::byteswap(data[i]);
+  }
+}
+
+} /* namespace linear_bvh */
+} /* namespace internal */
+} /* namespace spin */
+} /* namespace axom */
+
+#endif /* AXOM_SPIN_BVH_BINARY_IO_HPP_ */
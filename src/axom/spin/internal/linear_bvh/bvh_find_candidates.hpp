@@ -0,0 +1,212 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_BVH_FIND_CANDIDATES_HPP_
+#define AXOM_SPIN_BVH_FIND_CANDIDATES_HPP_
+
+#include "axom/config.hpp"
+
+#include "axom/core/Array.hpp"
+#include "axom/core/ArrayView.hpp"
+#include "axom/core/AnnotationMacros.hpp"
+#include "axom/core/Types.hpp"
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/execution/for_all.hpp"
+
+#include "axom/slic/interface/slic.hpp"
+
+#if defined(AXOM_USE_RAJA)
+  #include "RAJA/RAJA.hpp"
+#endif
+
+#include <type_traits>
+
+namespace axom
+{
+namespace spin
+{
+namespace internal
+{
+namespace linear_bvh
+{
+/*!
+ * \brief Finds the candidates for each query primitive with a single
+ *  traversal of the BVH, using bounded per-query buffers.
+ *
+ *  Each query writes up to \a buffer_size candidates to its own slot of a
+ *  scratch buffer while counting all of its candidates. After a scan of the
+ *  counts, the buffered candidates are moved to their final location in the
+ *  candidates array. Only the queries whose candidates did not fit in their
+ *  slot are traversed a second time, writing directly to the candidates
+ *  array.
+ *
+ *  Compared to counting the candidates in a first traversal and filling them
+ *  in a second one, this saves one traversal for all queries whose number of
+ *  candidates does not exceed \a buffer_size, at the cost of a scratch buffer
+ *  of numObjs * buffer_size entries.
+ *
+ * \param [in] traverser the traverser of the BVH
+ * \param [in] predicate traversal predicate functor for bin check.
+ * \param [out] offsets array of offsets into the candidate array for each query primitive
+ * \param [out] counts array of candidate counts for each query primitive
+ * \param [in] numObjs the number of user-supplied query primitives
+ * \param [in] objs array of primitives to query against the BVH
+ * \param [in] buffer_size the number of candidates buffered for each query
+ * \param [in] allocatorID the allocator used for the candidates array
+ *
+ * \return candidates the candidates of all query primitives
+ *
+ * \pre buffer_size > 0
+ */
+template <typename ExecSpace,
+          typename PrimitiveType,
+          typename TraverserType,
+          typename Predicate,
+          typename PrimitiveIndexable>
+axom::Array<IndexType> find_candidates_single_pass(
+  const TraverserType traverser,
+  const Predicate predicate,
+  const axom::ArrayView<IndexType> offsets,
+  const axom::ArrayView<IndexType> counts,
+  IndexType numObjs,
+  PrimitiveIndexable objs,
+  IndexType buffer_size,
+  int allocatorID)
+{
+  AXOM_ANNOTATE_SCOPE("find_candidates_single_pass");
+  SLIC_ASSERT(buffer_size > 0);
+
+  // STEP 1: traverse once, buffering the first candidates of each query
+  const IndexType total_buffer_size = numObjs * buffer_size;
+  axom::Array<IndexType> buffer(axom::ArrayOptions::Uninitialized {},
+                                total_buffer_size,
+                                total_buffer_size,
+                                allocatorID);
+  const auto buffer_v = buffer.view();
+
+#if defined(AXOM_USE_RAJA)
+  using reduce_pol = typename axom::execution_space<ExecSpace>::reduce_policy;
+  RAJA::ReduceSum<reduce_pol, IndexType> total_count_reduce(0);
+  RAJA::ReduceSum<reduce_pol, IndexType> overflow_count_reduce(0);
+#else
+  static_assert(std::is_same<ExecSpace, axom::SEQ_EXEC>::value,
+                "Only SEQ_EXEC supported without RAJA");
+#endif
+
+  AXOM_ANNOTATE_BEGIN("PASS[1]:buffered_traversal");
+  for_all<ExecSpace>(
+    numObjs,
+    AXOM_LAMBDA(IndexType i) {
+      IndexType count = 0;
+      IndexType* slot = buffer_v.data() + i * buffer_size;
+      PrimitiveType primitive {objs[i]};
+
+      auto leafAction = [&](std::int32_t current_node,
+                            const std::int32_t* leafs) {
+        if(count < buffer_size)
+        {
+          slot[count] = leafs[current_node];
+        }
+        count++;
+      };
+
+      traverser.traverse_unordered(primitive, leafAction, predicate);
+
+      counts[i] = count;
+#if defined(AXOM_USE_RAJA)
+      total_count_reduce += count;
+      overflow_count_reduce += (count > buffer_size) ? 1 : 0;
+#endif
+    });
+  AXOM_ANNOTATE_END("PASS[1]:buffered_traversal");
+
+  // STEP 2: exclusive scan to get offsets in candidate array for each query
+  AXOM_ANNOTATE_BEGIN("exclusive_scan");
+#if defined(AXOM_USE_RAJA)
+    // Intel oneAPI compiler segfaults with OpenMP RAJA scan
+  #ifdef __INTEL_LLVM_COMPILER
+  using exec_policy = typename axom::execution_space<axom::SEQ_EXEC>::loop_policy;
+  #else
+  using exec_policy = typename axom::execution_space<ExecSpace>::loop_policy;
+  #endif
+  RAJA::exclusive_scan<exec_policy>(RAJA::make_span(counts.data(), numObjs),
+                                    RAJA::make_span(offsets.data(), numObjs),
+                                    RAJA::operators::plus<IndexType> {});
+  const IndexType total_candidates = total_count_reduce.get();
+  const IndexType num_overflows = overflow_count_reduce.get();
+#else
+  IndexType total_candidates = 0;
+  IndexType num_overflows = 0;
+  for(IndexType i = 0; i < numObjs; ++i)
+  {
+    offsets[i] = total_candidates;
+    total_candidates += counts[i];
+    num_overflows += (counts[i] > buffer_size) ? 1 : 0;
+  }
+#endif
+  AXOM_ANNOTATE_END("exclusive_scan");
+
+  // STEP 3: move the buffered candidates to the candidates array
+  axom::Array<IndexType> candidates(axom::ArrayOptions::Uninitialized {},
+                                    total_candidates,
+                                    total_candidates,
+                                    allocatorID);
+  const auto candidates_v = candidates.view();
+
+  AXOM_ANNOTATE_BEGIN("copy_buffered_candidates");
+  for_all<ExecSpace>(
+    numObjs,
+    AXOM_LAMBDA(IndexType i) {
+      const IndexType count = counts[i];
+      if(count <= buffer_size)
+      {
+        const IndexType offset = offsets[i];
+        const IndexType* slot = buffer_v.data() + i * buffer_size;
+        for(IndexType j = 0; j < count; ++j)
+        {
+          candidates_v[offset + j] = slot[j];
+        }
+      }
+    });
+  AXOM_ANNOTATE_END("copy_buffered_candidates");
+
+  // STEP 4: traverse again for the queries that overflowed their buffer
+  if(num_overflows > 0)
+  {
+    SLIC_DEBUG("Traversing again the " << num_overflows
+                                        << " queries that overflowed their "
+                                        << "candidate buffer");
+
+    AXOM_ANNOTATE_BEGIN("PASS[2]:overflow_traversal");
+    for_all<ExecSpace>(
+      numObjs,
+      AXOM_LAMBDA(IndexType i) {
+        if(counts[i] <= buffer_size)
+        {
+          return;
+        }
+
+        IndexType offset = offsets[i];
+        PrimitiveType primitive {objs[i]};
+        auto leafAction = [&](std::int32_t current_node,
+                              const std::int32_t* leafs) {
+          candidates_v[offset] = leafs[current_node];
+          offset++;
+        };
+
+        traverser.traverse_unordered(primitive, leafAction, predicate);
+      });
+    AXOM_ANNOTATE_END("PASS[2]:overflow_traversal");
+  }
+
+  return candidates;
+}
+
+} /* namespace linear_bvh */
+} /* namespace internal */
+} /* namespace spin */
+} /* namespace axom */
+
+#endif /* AXOM_SPIN_BVH_FIND_CANDIDATES_HPP_ */
@@ -0,0 +1,432 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_BVH_FIND_RAYS_HPP_
+#define AXOM_SPIN_BVH_FIND_RAYS_HPP_
+
+#include "axom/config.hpp"
+
+#include "axom/core/Array.hpp"
+#include "axom/core/ArrayView.hpp"
+#include "axom/core/AnnotationMacros.hpp"
+#include "axom/core/Types.hpp"
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/execution/for_all.hpp"
+#include "axom/core/numerics/floating_point_limits.hpp"
+
+#include "axom/primal/geometry/BoundingBox.hpp"
+#include "axom/primal/geometry/Ray.hpp"
+#include "axom/primal/geometry/Vector.hpp"
+
+#include "axom/spin/internal/linear_bvh/build_radix_tree.hpp"
+#include "axom/spin/internal/linear_bvh/bvh_packet_traverse.hpp"
+
+#if defined(AXOM_USE_RAJA)
+  #include "RAJA/RAJA.hpp"
+#endif
+
+#include <type_traits>
+
+namespace axom
+{
+namespace spin
+{
+namespace internal
+{
+namespace linear_bvh
+{
+/*!
+ * \brief Sorts the given rays into coherent groups.
+ *
+ *  Each ray is assigned a key made of the octant of its direction, in the
+ *  most significant bits, followed by the Morton code of its origin within
+ *  the bounds of all the origins. Consecutive rays in the sorted order thus
+ *  point in a similar direction and start from nearby points, which makes
+ *  them likely to visit the same nodes of a BVH.
+ *
+ * \param [in] rays array of the rays
+ * \param [in] numRays the number of rays
+ * \param [in] allocatorID the allocator used for the returned array
+ *
+ * \return order the indices of the rays, in sorted order
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS, typename RayIndexable>
+axom::Array<std::int32_t> sort_rays(RayIndexable rays,
+                                    std::int32_t numRays,
+                                    int allocatorID)
+{
+  AXOM_ANNOTATE_SCOPE("sort_rays");
+
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+  using VectorType = primal::Vector<FloatType, NDIMS>;
+  using RayType = primal::Ray<FloatType, NDIMS>;
+
+  // STEP 1: compute the bounds of the origins of the rays
+  axom::Array<BoxType> origins(axom::ArrayOptions::Uninitialized {},
+                               numRays,
+                               numRays,
+                               allocatorID);
+  const auto origins_v = origins.view();
+  for_all<ExecSpace>(
+    numRays,
+    AXOM_LAMBDA(std::int32_t i) {
+      const RayType ray {rays[i]};
+      origins_v[i] = BoxType {ray.origin()};
+    });
+
+  const BoxType bounds =
+    reduce<ExecSpace, FloatType, NDIMS>(origins.view(), numRays);
+
+  VectorType inv_extent;
+  const VectorType min_coord(bounds.getMin());
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    const FloatType extent = bounds.getMax()[d] - bounds.getMin()[d];
+    inv_extent[d] = utilities::isNearlyEqual<FloatType>(extent, 0.f)
+      ? 0.f
+      : 1.f / extent;
+  }
+
+  // STEP 2: compute the sort keys
+  axom::Array<std::uint32_t> keys(numRays, numRays, allocatorID);
+  const auto keys_v = keys.view();
+  for_all<ExecSpace>(
+    numRays,
+    AXOM_LAMBDA(std::int32_t i) {
+      const RayType ray {rays[i]};
+
+      std::uint32_t octant = 0;
+      for(int d = 0; d < NDIMS; ++d)
+      {
+        octant |= (ray.direction()[d] < 0 ? 1u : 0u) << d;
+      }
+
+      const VectorType origin(
+        (VectorType(ray.origin()) - min_coord).array() * inv_extent.array());
+      const auto mcode = static_cast<std::uint32_t>(morton32_encode(origin));
+
+      keys_v[i] = (octant << (32 - NDIMS)) | (mcode >> NDIMS);
+    });
+
+  // STEP 3: sort the rays by key
+  axom::Array<std::int32_t> order(numRays, numRays, allocatorID);
+  sort_mcodes<ExecSpace>(keys, numRays, order.view());
+
+  return order;
+}
+
+/*!
+ * \brief Finds the candidate bins that intersect the given rays, traversing
+ *  coherent packets of rays together.
+ *
+ *  The rays are sorted with sort_rays() and traversed in packets of
+ *  \a PacketSize consecutive rays. As in the candidate search of the BVH
+ *  policies, the candidates are counted in a first traversal and filled in a
+ *  second one, or gathered in a single traversal in CPU-only builds without
+ *  RAJA.
+ *
+ * \param [in] traverser the traverser of the BVH, which must provide
+ *  traverse_packet()
+ * \param [out] offsets array of offsets into the candidate array for each ray
+ * \param [out] counts array of candidate counts for each ray
+ * \param [in] numRays the number of rays
+ * \param [in] rays array of the rays
+ * \param [in] EPS tolerance of the ray/box intersection tests
+ * \param [in] allocatorID the allocator used for the candidates array
+ *
+ * \return candidates the candidates of all the rays
+ */
+template <typename ExecSpace,
+          int PacketSize,
+          typename FloatType,
+          int NDIMS,
+          typename TraverserType,
+          typename RayIndexable>
+axom::Array<IndexType> find_rays_packet(
+  const TraverserType traverser,
+  const axom::ArrayView<IndexType> offsets,
+  const axom::ArrayView<IndexType> counts,
+  IndexType numRays,
+  RayIndexable rays,
+  FloatType EPS,
+  int allocatorID)
+{
+  AXOM_ANNOTATE_SCOPE("find_rays_packet");
+
+  using RayType = primal::Ray<FloatType, NDIMS>;
+  using PacketType = RayPacket<FloatType, NDIMS, PacketSize>;
+
+  const axom::Array<std::int32_t> order =
+    sort_rays<ExecSpace, FloatType, NDIMS>(rays, numRays, allocatorID);
+  const auto order_v = order.view();
+  const IndexType numPackets = (numRays + PacketSize - 1) / PacketSize;
+
+#if defined(AXOM_USE_RAJA)
+  // STEP 1: count the candidates of each ray
+  AXOM_ANNOTATE_BEGIN("PASS[1]:count_traversal");
+  for_all<ExecSpace>(
+    numPackets,
+    AXOM_LAMBDA(IndexType packet_idx) {
+      PacketType packet;
+      std::int32_t ids[PacketSize];
+      IndexType packet_counts[PacketSize];
+      for(int lane = 0; lane < PacketSize; ++lane)
+      {
+        const IndexType i = packet_idx * PacketSize + lane;
+        packet_counts[lane] = 0;
+        if(i < numRays)
+        {
+          ids[lane] = order_v[i];
+          packet.setRay(lane, RayType {rays[ids[lane]]}, EPS);
+        }
+      }
+
+      auto leafAction =
+        [&](int lane, std::int32_t, const std::int32_t*, FloatType) {
+          packet_counts[lane]++;
+        };
+      traverser.traverse_packet(packet, leafAction);
+
+      for(int lane = 0; lane < PacketSize; ++lane)
+      {
+        if(packet.active & (1u << lane))
+        {
+          counts[ids[lane]] = packet_counts[lane];
+        }
+      }
+    });
+  AXOM_ANNOTATE_END("PASS[1]:count_traversal");
+
+  // STEP 2: exclusive scan to get offsets in candidate array for each ray
+  AXOM_ANNOTATE_BEGIN("exclusive_scan");
+  using reduce_pol = typename axom::execution_space<ExecSpace>::reduce_policy;
+  RAJA::ReduceSum<reduce_pol, IndexType> total_count_reduce(0);
+  for_all<ExecSpace>(
+    numRays,
+    AXOM_LAMBDA(IndexType i) { total_count_reduce += counts[i]; });
+
+    // Intel oneAPI compiler segfaults with OpenMP RAJA scan
+  #ifdef __INTEL_LLVM_COMPILER
+  using exec_policy = typename axom::execution_space<axom::SEQ_EXEC>::loop_policy;
+  #else
+  using exec_policy = typename axom::execution_space<ExecSpace>::loop_policy;
+  #endif
+  RAJA::exclusive_scan<exec_policy>(RAJA::make_span(counts.data(), numRays),
+                                    RAJA::make_span(offsets.data(), numRays),
+                                    RAJA::operators::plus<IndexType> {});
+  const IndexType total_candidates = total_count_reduce.get();
+  AXOM_ANNOTATE_END("exclusive_scan");
+
+  // STEP 3: fill in the candidates of each ray
+  axom::Array<IndexType> candidates(axom::ArrayOptions::Uninitialized {},
+                                    total_candidates,
+                                    total_candidates,
+                                    allocatorID);
+  const auto candidates_v = candidates.view();
+
+  AXOM_ANNOTATE_BEGIN("PASS[2]:fill_traversal");
+  for_all<ExecSpace>(
+    numPackets,
+    AXOM_LAMBDA(IndexType packet_idx) {
+      PacketType packet;
+      IndexType packet_offsets[PacketSize];
+      for(int lane = 0; lane < PacketSize; ++lane)
+      {
+        const IndexType i = packet_idx * PacketSize + lane;
+        packet_offsets[lane] = 0;
+        if(i < numRays)
+        {
+          const std::int32_t id = order_v[i];
+          packet_offsets[lane] = offsets[id];
+          packet.setRay(lane, RayType {rays[id]}, EPS);
+        }
+      }
+
+      auto leafAction = [&](int lane,
+                            std::int32_t current_node,
+                            const std::int32_t* leafs,
+                            FloatType) {
+        candidates_v[packet_offsets[lane]++] = leafs[current_node];
+      };
+      traverser.traverse_packet(packet, leafAction);
+    });
+  AXOM_ANNOTATE_END("PASS[2]:fill_traversal");
+
+  return candidates;
+#else  // CPU-only and no RAJA: do single traversal
+  static_assert(std::is_same<ExecSpace, axom::SEQ_EXEC>::value,
+                "Only SEQ_EXEC supported without RAJA");
+
+  // STEP 1: do single-pass traversal, gathering the candidates of the rays
+  // in their sorted order
+  AXOM_ANNOTATE_BEGIN("PASS[1]:fill_traversal");
+  axom::Array<IndexType> sorted_candidates;
+  axom::Array<IndexType> sorted_offsets(numRays, numRays);
+  axom::Array<IndexType> packet_candidates[PacketSize];
+  for(IndexType packet_idx = 0; packet_idx < numPackets; ++packet_idx)
+  {
+    PacketType packet;
+    for(int lane = 0; lane < PacketSize; ++lane)
+    {
+      const IndexType i = packet_idx * PacketSize + lane;
+      packet_candidates[lane].clear();
+      if(i < numRays)
+      {
+        packet.setRay(lane, RayType {rays[order_v[i]]}, EPS);
+      }
+    }
+
+    auto leafAction = [&](int lane,
+                          std::int32_t current_node,
+                          const std::int32_t* leafs,
+                          FloatType) {
+      packet_candidates[lane].push_back(leafs[current_node]);
+    };
+    traverser.traverse_packet(packet, leafAction);
+
+    for(int lane = 0; lane < PacketSize; ++lane)
+    {
+      const IndexType i = packet_idx * PacketSize + lane;
+      if(i < numRays)
+      {
+        sorted_offsets[i] = sorted_candidates.size();
+        counts[order_v[i]] = packet_candidates[lane].size();
+        for(const IndexType candidate : packet_candidates[lane])
+        {
+          sorted_candidates.push_back(candidate);
+        }
+      }
+    }
+  }
+  AXOM_ANNOTATE_END("PASS[1]:fill_traversal");
+
+  // STEP 2: copy the candidates back to the order of the rays
+  AXOM_ANNOTATE_BEGIN("reorder_candidates");
+  IndexType total_candidates = 0;
+  for(IndexType i = 0; i < numRays; ++i)
+  {
+    offsets[i] = total_candidates;
+    total_candidates += counts[i];
+  }
+
+  axom::Array<IndexType> candidates(axom::ArrayOptions::Uninitialized {},
+                                    total_candidates,
+                                    total_candidates,
+                                    allocatorID);
+  for(IndexType i = 0; i < numRays; ++i)
+  {
+    const std::int32_t id = order_v[i];
+    for(IndexType j = 0; j < counts[id]; ++j)
+    {
+      candidates[offsets[id] + j] = sorted_candidates[sorted_offsets[i] + j];
+    }
+  }
+  AXOM_ANNOTATE_END("reorder_candidates");
+
+  return candidates;
+#endif
+}
+
+/*!
+ * \brief Finds the nearest hit of each of the given rays, traversing
+ *  coherent packets of rays together.
+ *
+ *  The rays are sorted with sort_rays() and traversed in packets of
+ *  \a PacketSize consecutive rays. The bins are visited in order of
+ *  increasing entry parameter, and the bins that are entered beyond the
+ *  nearest hit found so far by a ray are skipped for that ray.
+ *
+ * \param [in] traverser the traverser of the BVH, which must provide
+ *  traverse_packet()
+ * \param [in] numRays the number of rays
+ * \param [in] rays array of the rays
+ * \param [in] hit functor that intersects a ray with a bin
+ * \param [out] hitIDs the ID of the nearest bin hit by each ray, or -1
+ * \param [out] hitParams the ray parameter of the nearest hit of each ray, or
+ *  the largest representable value if the ray does not hit any bin
+ * \param [in] EPS tolerance of the ray/box intersection tests
+ *
+ * \see BVH::findNearestHits() for the requirements on \a hit
+ */
+template <typename ExecSpace,
+          int PacketSize,
+          typename FloatType,
+          int NDIMS,
+          typename TraverserType,
+          typename RayIndexable,
+          typename HitFunctor>
+void find_nearest_hits_packet(const TraverserType traverser,
+                              IndexType numRays,
+                              RayIndexable rays,
+                              HitFunctor hit,
+                              const axom::ArrayView<IndexType> hitIDs,
+                              const axom::ArrayView<FloatType> hitParams,
+                              FloatType EPS,
+                              int allocatorID)
+{
+  AXOM_ANNOTATE_SCOPE("find_nearest_hits_packet");
+
+  using RayType = primal::Ray<FloatType, NDIMS>;
+  using PacketType = RayPacket<FloatType, NDIMS, PacketSize>;
+
+  const axom::Array<std::int32_t> order =
+    sort_rays<ExecSpace, FloatType, NDIMS>(rays, numRays, allocatorID);
+  const auto order_v = order.view();
+  const IndexType numPackets = (numRays + PacketSize - 1) / PacketSize;
+
+  for_all<ExecSpace>(
+    numPackets,
+    AXOM_LAMBDA(IndexType packet_idx) {
+      PacketType packet;
+      std::int32_t ids[PacketSize];
+      IndexType nearest[PacketSize];
+      for(int lane = 0; lane < PacketSize; ++lane)
+      {
+        const IndexType i = packet_idx * PacketSize + lane;
+        nearest[lane] = -1;
+        if(i < numRays)
+        {
+          ids[lane] = order_v[i];
+          packet.setRay(lane, RayType {rays[ids[lane]]}, EPS);
+        }
+      }
+
+      auto leafAction = [&](int lane,
+                            std::int32_t current_node,
+                            const std::int32_t* leafs,
+                            FloatType) {
+        const IndexType candidate = leafs[current_node];
+        FloatType t = packet.t_max[lane];
+        if(hit(RayType {rays[ids[lane]]}, candidate, t))
+        {
+          // ties are broken by the ID of the bins
+          if(t < packet.t_max[lane] ||
+             (t == packet.t_max[lane] &&
+              (nearest[lane] < 0 || candidate < nearest[lane])))
+          {
+            packet.t_max[lane] = t;
+            nearest[lane] = candidate;
+          }
+        }
+      };
+      traverser.traverse_packet(packet, leafAction);
+
+      for(int lane = 0; lane < PacketSize; ++lane)
+      {
+        if(packet.active & (1u << lane))
+        {
+          hitIDs[ids[lane]] = nearest[lane];
+          hitParams[ids[lane]] = packet.t_max[lane];
+        }
+      }
+    });
+}
+
+} /* namespace linear_bvh */
+} /* namespace internal */
+} /* namespace spin */
+} /* namespace axom */
+
+#endif /* AXOM_SPIN_BVH_FIND_RAYS_HPP_ */
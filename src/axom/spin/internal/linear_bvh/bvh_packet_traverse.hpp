@@ -0,0 +1,291 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_BVH_PACKET_TRAVERSE_HPP_
+#define AXOM_SPIN_BVH_PACKET_TRAVERSE_HPP_
+
+#include "axom/config.hpp"       // compile-time definitions
+#include "axom/core/Macros.hpp"  // for AXOM_HOST_DEVICE
+#include "axom/core/Types.hpp"   // for axom types
+#include "axom/core/numerics/floating_point_limits.hpp"
+#include "axom/core/utilities/Utilities.hpp"
+
+#include "axom/primal/geometry/BoundingBox.hpp"
+#include "axom/primal/geometry/Ray.hpp"
+
+#include "axom/spin/internal/linear_bvh/bvh_traverse.hpp"
+
+#include <cstdint>
+
+namespace axom
+{
+namespace spin
+{
+namespace internal
+{
+namespace linear_bvh
+{
+/*!
+ * \brief A group of rays that are traversed together through a BVH.
+ *
+ *  The origins and inverse directions of the rays are stored in a
+ *  structure-of-arrays layout, so that a bounding box can be tested against
+ *  all the rays of the packet at once with the slab method. Each ray carries
+ *  a maximum parameter, beyond which boxes are not considered hit, which can
+ *  be lowered during a traversal, e.g., to find the nearest hit.
+ *
+ * \tparam PacketSize the maximum number of rays in the packet, at most 32
+ */
+template <typename FloatType, int NDIMS, int PacketSize>
+struct RayPacket
+{
+  AXOM_STATIC_ASSERT_MSG(PacketSize > 0 && PacketSize <= 32,
+                         "packet size must be between 1 and 32");
+
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+  using RayType = primal::Ray<FloatType, NDIMS>;
+
+  FloatType origin[NDIMS][PacketSize];
+  FloatType inv_dir[NDIMS][PacketSize];
+  bool parallel[NDIMS][PacketSize];
+  FloatType t_max[PacketSize];
+  std::uint32_t active {0};
+
+  /*!
+   * \brief Sets the ray of the given lane and marks the lane as active.
+   *
+   * \param [in] lane the lane of the packet
+   * \param [in] ray the ray
+   * \param [in] EPS tolerance below which a component of the direction of the
+   *  ray is considered to be zero
+   */
+  AXOM_HOST_DEVICE void setRay(int lane, const RayType& ray, FloatType EPS)
+  {
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const FloatType n = ray.direction()[d];
+      origin[d][lane] = ray.origin()[d];
+      parallel[d][lane] = axom::utilities::isNearlyEqual(n, FloatType {0}, EPS);
+      inv_dir[d][lane] =
+        parallel[d][lane] ? FloatType {0} : static_cast<FloatType>(1.0) / n;
+    }
+    t_max[lane] = axom::numerics::floating_point_limits<FloatType>::max();
+    active |= (1u << lane);
+  }
+
+  /*!
+   * \brief Tests the given box against all the active rays of the packet.
+   *
+   * \param [in] box the bounding box
+   * \param [out] t_enter the parameter at which each ray enters the box
+   *
+   * \return a bitmask with bit \a lane set if the ray of the lane intersects
+   *  the box at a parameter less than or equal to its maximum parameter
+   *
+   * \note Yields the same answer as primal::detail::intersect_ray() for
+   *  each of the rays, when the maximum parameter of the ray is not set.
+   */
+  AXOM_HOST_DEVICE std::uint32_t intersect(
+    const BoxType& box,
+    FloatType (&t_enter)[PacketSize]) const
+  {
+    bool hit[PacketSize];
+    FloatType t_exit[PacketSize];
+    for(int lane = 0; lane < PacketSize; ++lane)
+    {
+      hit[lane] = true;
+      t_enter[lane] = axom::numerics::floating_point_limits<FloatType>::min();
+      t_exit[lane] = t_max[lane];
+    }
+
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const FloatType lo = box.getMin()[d];
+      const FloatType hi = box.getMax()[d];
+      for(int lane = 0; lane < PacketSize; ++lane)
+      {
+        const FloatType x0 = origin[d][lane];
+        const FloatType t1 = (lo - x0) * inv_dir[d][lane];
+        const FloatType t2 = (hi - x0) * inv_dir[d][lane];
+        const bool inside = (x0 >= lo) & (x0 <= hi);
+        const bool par = parallel[d][lane];
+        t_enter[lane] = par
+          ? t_enter[lane]
+          : axom::utilities::max(t_enter[lane], axom::utilities::min(t1, t2));
+        t_exit[lane] = par
+          ? t_exit[lane]
+          : axom::utilities::min(t_exit[lane], axom::utilities::max(t1, t2));
+        hit[lane] = hit[lane] & (par ? inside : true);
+      }
+    }
+
+    std::uint32_t mask = 0;
+    for(int lane = 0; lane < PacketSize; ++lane)
+    {
+      const bool in_range = hit[lane] & (t_enter[lane] <= t_exit[lane]);
+      mask |= (in_range ? 1u : 0u) << lane;
+    }
+    return mask & active;
+  }
+
+  /*!
+   * \brief Tests the given box against a single ray of the packet.
+   *
+   * \param [in] box the bounding box
+   * \param [in] lane the lane of the ray
+   * \param [out] t_enter the parameter at which the ray enters the box
+   *
+   * \return true if the ray intersects the box at a parameter less than or
+   *  equal to its maximum parameter, as in intersect()
+   */
+  AXOM_HOST_DEVICE bool intersect(const BoxType& box,
+                                  int lane,
+                                  FloatType& t_enter) const
+  {
+    bool hit = true;
+    FloatType t_exit = t_max[lane];
+    t_enter = axom::numerics::floating_point_limits<FloatType>::min();
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const FloatType lo = box.getMin()[d];
+      const FloatType hi = box.getMax()[d];
+      const FloatType x0 = origin[d][lane];
+      if(parallel[d][lane])
+      {
+        hit = hit & (x0 >= lo) & (x0 <= hi);
+      }
+      else
+      {
+        const FloatType t1 = (lo - x0) * inv_dir[d][lane];
+        const FloatType t2 = (hi - x0) * inv_dir[d][lane];
+        t_enter = axom::utilities::max(t_enter, axom::utilities::min(t1, t2));
+        t_exit = axom::utilities::min(t_exit, axom::utilities::max(t1, t2));
+      }
+    }
+    return hit && (t_enter <= t_exit) && (active & (1u << lane));
+  }
+};
+
+/*!
+ * \brief Traverses a binary BVH with a packet of rays at once.
+ *
+ *  The packet shares a single traversal stack. A node is visited if any of
+ *  the active rays of the packet intersects its bounding box, and only the
+ *  rays that intersect the box are carried down to its children. When both
+ *  children of a node are hit, the child that is entered first by the rays
+ *  of the packet is visited first.
+ *
+ * \param [in] inner_nodes pointer to the BVH bins.
+ * \param [in] inner_node_children pointer to pairs of child indices.
+ * \param [in] leaf_nodes pointer to the leaf node IDs.
+ * \param [in,out] packet the packet of rays
+ * \param [in] A functor that defines the leaf action
+ *
+ * \note The supplied functor `A` is called for every leaf whose bounding box
+ *  is hit by a ray of the packet, with the lane of the ray followed by the
+ *  same arguments as in bvh_traverse() and the parameter at which the ray
+ *  enters the bounding box of the leaf. It may lower the maximum parameter
+ *  of the ray in the packet, which prunes the rest of the traversal.
+ *
+ * \see bvh_traverse
+ */
+template <int NDIMS, typename FloatType, int PacketSize, typename LeafAction>
+AXOM_HOST_DEVICE inline void bvh_traverse_packet(
+  axom::ArrayView<const primal::BoundingBox<FloatType, NDIMS>> inner_nodes,
+  axom::ArrayView<const std::int32_t> inner_node_children,
+  axom::ArrayView<const std::int32_t> leaf_nodes,
+  RayPacket<FloatType, NDIMS, PacketSize>& packet,
+  LeafAction&& A)
+{
+  using BBoxType = primal::BoundingBox<FloatType, NDIMS>;
+
+  // setup stack, holding the nodes and the rays that reached them
+  constexpr std::int32_t STACK_SIZE = BVH_STACK_SIZE;
+  std::int32_t todo[STACK_SIZE];
+  std::uint32_t todo_mask[STACK_SIZE];
+  std::int32_t stackptr = 0;
+  todo[stackptr] = 0;
+  todo_mask[stackptr] = packet.active;
+
+  FloatType t_enter[2][PacketSize];
+
+  while(stackptr >= 0)
+  {
+    const std::int32_t current_node = todo[stackptr];
+    const std::uint32_t mask = todo_mask[stackptr] & packet.active;
+    stackptr--;
+
+    if(mask == 0)
+    {
+      continue;
+    }
+
+    std::uint32_t child_mask[2];
+    FloatType child_t[2];
+    for(int c = 0; c < 2; ++c)
+    {
+      const BBoxType& bin = inner_nodes[current_node + c];
+      child_mask[c] = bin.isValid() ? (packet.intersect(bin, t_enter[c]) & mask)
+                                    : 0u;
+
+      // the child entered first by any of the rays is visited first
+      child_t[c] = axom::numerics::floating_point_limits<FloatType>::max();
+      for(int lane = 0; lane < PacketSize; ++lane)
+      {
+        if(child_mask[c] & (1u << lane))
+        {
+          child_t[c] = axom::utilities::min(child_t[c], t_enter[c][lane]);
+        }
+      }
+    }
+
+    const int first = (child_t[1] < child_t[0]) ? 1 : 0;
+    const int order[2] = {first, 1 - first};
+
+    // leaves are processed right away, inner nodes are pushed on the stack
+    // such that the first child is popped first
+    for(int i = 0; i < 2; ++i)
+    {
+      const int c = order[i];
+      const std::int32_t child = inner_node_children[current_node + c];
+      if(child_mask[c] == 0 || !leaf_node(child))
+      {
+        continue;
+      }
+
+      const std::int32_t leaf_idx = -child - 1;
+      for(int lane = 0; lane < PacketSize; ++lane)
+      {
+        if((child_mask[c] & (1u << lane)) &&
+           t_enter[c][lane] <= packet.t_max[lane])
+        {
+          A(lane, leaf_idx, leaf_nodes.data(), t_enter[c][lane]);
+        }
+      }
+    }
+
+    for(int i = 1; i >= 0; --i)
+    {
+      const int c = order[i];
+      const std::int32_t child = inner_node_children[current_node + c];
+      if(child_mask[c] == 0 || leaf_node(child))
+      {
+        continue;
+      }
+
+      stackptr++;
+      check_stack_push(stackptr, STACK_SIZE);
+      todo[stackptr] = child;
+      todo_mask[stackptr] = child_mask[c];
+    }
+  }
+}
+
+} /* namespace linear_bvh */
+} /* namespace internal */
+} /* namespace spin */
+} /* namespace axom */
+
+#endif /* AXOM_SPIN_BVH_PACKET_TRAVERSE_HPP_ */
@@ -11,6 +11,10 @@
 #include "axom/core/Types.hpp"   // for axom types
 #include "axom/slic.hpp"         // for SLIC macros
 
+#include "axom/primal/geometry/BoundingBox.hpp"
+#include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/operators/squared_distance.hpp"
+
 namespace axom
 {
 namespace spin
@@ -27,6 +31,45 @@ namespace linear_bvh
 AXOM_HOST_DEVICE
 inline bool leaf_node(const std::int32_t& nodeIdx) { return (nodeIdx < 0); }
 
+/*!
+ * \brief Capacity of the stacks used by the traversal routines of binary BVHs.
+ */
+constexpr std::int32_t BVH_STACK_SIZE = 64;
+
+/*!
+ * \brief Maximum depth, i.e., number of inner nodes on the path from the root
+ *  to a leaf, of a binary BVH that can be traversed without overflowing a
+ *  stack of BVH_STACK_SIZE entries.
+ */
+constexpr std::int32_t BVH_MAX_DEPTH = BVH_STACK_SIZE - 2;
+
+/*!
+ * \brief Aborts if pushing a node at the given position would overflow a
+ *  traversal stack of the given size.
+ *
+ *  The builders bound the depth of the trees, so this should never trigger.
+ *  The check is kept in release builds, since an overflow would otherwise
+ *  silently corrupt memory.
+ *
+ * \param [in] stackptr the position of the node to push
+ * \param [in] stack_size the capacity of the stack
+ */
+AXOM_HOST_DEVICE
+inline void check_stack_push(std::int32_t stackptr, std::int32_t stack_size)
+{
+  if(stackptr >= stack_size)
+  {
+#if defined(__CUDA_ARCH__)
+    __trap();
+#elif defined(__HIP_DEVICE_COMPILE__)
+    abort();
+#else
+    SLIC_ERROR("BVH traversal overflowed its stack of "
+               << stack_size << " nodes; the tree is too deep.");
+#endif
+  }
+}
+
 /*!
  * \brief Generic BVH traversal routine.
  *
@@ -81,7 +124,7 @@ AXOM_HOST_DEVICE inline void bvh_traverse(
   using BBoxType = primal::BoundingBox<FloatType, NDIMS>;
 
   // setup stack
-  constexpr std::int32_t STACK_SIZE = 64;
+  constexpr std::int32_t STACK_SIZE = BVH_STACK_SIZE;
   constexpr std::int32_t BARRIER = -2000000000;
   std::int32_t todo[STACK_SIZE];
   std::int32_t stackptr = 0;
@@ -122,6 +165,7 @@ AXOM_HOST_DEVICE inline void bvh_traverse(
           }
 
           stackptr++;
+          check_stack_push(stackptr, STACK_SIZE);
           todo[stackptr] = r_child;
         }
       }  // END else
@@ -158,6 +202,172 @@ AXOM_HOST_DEVICE inline void bvh_traverse(
   }  // END while
 }
 
+/*!
+ * \brief BVH traversal routine that visits the leaves closest to a query
+ *  point first, pruning the branches that are farther away than a bound.
+ *
+ * \param [in] inner_nodes pointer to the BVH bins.
+ * \param [in] inner_node_children pointer to pairs of child indices.
+ * \param [in] leaf_nodes pointer to the leaf node IDs.
+ * \param [in] p the query point
+ * \param [in] A functor that defines the leaf action
+ * \param [in] Bound functor that returns the current pruning bound
+ *
+ * \note The supplied functor `A` is called for every leaf whose bounding box
+ *  is within the bound, with the same first two arguments as in
+ *  bvh_traverse(), followed by the squared distance from the query point to
+ *  the bounding box of the leaf.
+ *
+ * \note The supplied functor `Bound` takes no arguments and returns the
+ *  squared distance beyond which bins are skipped. It is re-evaluated
+ *  throughout the traversal, so the bound may shrink as leaves are found,
+ *  e.g., in a k-nearest neighbor search.
+ *
+ * \note The children of each node are visited in order of increasing
+ *  distance to the query point.
+ */
+template <int NDIMS,
+          typename FloatType,
+          typename LeafAction,
+          typename PruneBound>
+AXOM_HOST_DEVICE inline void bvh_traverse_nearest(
+  axom::ArrayView<const primal::BoundingBox<FloatType, NDIMS>> inner_nodes,
+  axom::ArrayView<const std::int32_t> inner_node_children,
+  axom::ArrayView<const std::int32_t> leaf_nodes,
+  const primal::Point<FloatType, NDIMS>& p,
+  LeafAction&& A,
+  PruneBound&& Bound)
+{
+  // setup stack of nodes, along with their distance to the query point
+  constexpr std::int32_t STACK_SIZE = BVH_STACK_SIZE;
+  std::int32_t todo[STACK_SIZE];
+  double todo_dist[STACK_SIZE];
+  std::int32_t stackptr = 0;
+  todo[stackptr] = 0;
+  todo_dist[stackptr] = 0.;
+
+  while(stackptr >= 0)
+  {
+    const std::int32_t current_node = todo[stackptr];
+    const double current_dist = todo_dist[stackptr];
+    stackptr--;
+
+    // skip nodes that became too far away since they were pushed
+    if(current_dist > Bound())
+    {
+      continue;
+    }
+
+    // gather the children with a valid bin, closest first
+    std::int32_t children[2];
+    double dist[2];
+    std::int32_t nchildren = 0;
+    for(int c = 0; c < 2; ++c)
+    {
+      const auto& bin = inner_nodes[current_node + c];
+      if(bin.isValid())
+      {
+        children[nchildren] = inner_node_children[current_node + c];
+        dist[nchildren] = primal::squared_distance(p, bin);
+        nchildren++;
+      }
+    }
+    if(nchildren == 2 && dist[1] < dist[0])
+    {
+      axom::utilities::swap(children[0], children[1]);
+      axom::utilities::swap(dist[0], dist[1]);
+    }
+
+    // process the leaves, closest first
+    for(int c = 0; c < nchildren; ++c)
+    {
+      if(leaf_node(children[c]) && dist[c] <= Bound())
+      {
+        A(-children[c] - 1, leaf_nodes.data(), dist[c]);
+      }
+    }
+
+    // push the inner nodes, so that the closest one is popped first
+    for(int c = nchildren - 1; c >= 0; --c)
+    {
+      if(!leaf_node(children[c]) && dist[c] <= Bound())
+      {
+        stackptr++;
+        check_stack_push(stackptr, STACK_SIZE);
+        todo[stackptr] = children[c];
+        todo_dist[stackptr] = dist[c];
+      }
+    }
+  }  // END while
+}
+
+/*!
+ * \brief BVH traversal routine that passes the index of each node to the
+ *  bin check, e.g., to look up data that is attached to the nodes.
+ *
+ * \param [in] inner_nodes pointer to the BVH bins.
+ * \param [in] inner_node_children pointer to pairs of child indices.
+ * \param [in] leaf_nodes pointer to the leaf node IDs.
+ * \param [in] p the primitive in query, e.g., a point, ray, etc.
+ * \param [in] B functor that defines the check for the bins
+ * \param [in] A functor that defines the leaf action
+ *
+ * \note The supplied functor `B` takes the same arguments as in
+ *  bvh_traverse(), followed by the index of the node in \a inner_nodes.
+ *  The children of a node, including leaves, are visited only if `B`
+ *  returns true for it.
+ *
+ * \note The supplied functor `A` takes the same arguments as in
+ *  bvh_traverse().
+ */
+template <int NDIMS,
+          typename FloatType,
+          typename PrimitiveType,
+          typename InBinCheck,
+          typename LeafAction>
+AXOM_HOST_DEVICE inline void bvh_traverse_nodes(
+  axom::ArrayView<const primal::BoundingBox<FloatType, NDIMS>> inner_nodes,
+  axom::ArrayView<const std::int32_t> inner_node_children,
+  axom::ArrayView<const std::int32_t> leaf_nodes,
+  const PrimitiveType& p,
+  InBinCheck&& B,
+  LeafAction&& A)
+{
+  // setup stack
+  constexpr std::int32_t STACK_SIZE = BVH_STACK_SIZE;
+  std::int32_t todo[STACK_SIZE];
+  std::int32_t stackptr = 0;
+  todo[stackptr] = 0;
+
+  while(stackptr >= 0)
+  {
+    const std::int32_t current_node = todo[stackptr];
+    stackptr--;
+
+    for(int c = 0; c < 2; ++c)
+    {
+      const std::int32_t node = current_node + c;
+      const auto& bin = inner_nodes[node];
+      if(!bin.isValid() || !B(p, bin, node))
+      {
+        continue;
+      }
+
+      const std::int32_t child = inner_node_children[node];
+      if(leaf_node(child))
+      {
+        A(-child - 1, leaf_nodes.data());
+      }
+      else
+      {
+        stackptr++;
+        check_stack_push(stackptr, STACK_SIZE);
+        todo[stackptr] = child;
+      }
+    }
+  }  // END while
+}
+
 } /* namespace linear_bvh */
 } /* namespace internal */
 } /* namespace spin */
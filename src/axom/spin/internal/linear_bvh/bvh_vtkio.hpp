@@ -7,6 +7,7 @@
 #define AXOM_SPIN_LINEAR_BVH_VTKIO_HPP_
 
 #include "axom/primal/geometry/BoundingBox.hpp"
+#include "axom/spin/internal/linear_bvh/WideBVHNode.hpp"
 
 namespace axom
 {
@@ -204,6 +205,51 @@ void write_recursive(ArrayView<const primal::BoundingBox<FloatType, NDIMS>> inne
   }
 }
 
+//------------------------------------------------------------------------------
+template <typename FloatType, int NDIMS, int Width>
+void write_recursive(
+  ArrayView<const WideBVHNode<FloatType, NDIMS, Width>> wide_nodes,
+  std::int32_t current_node,
+  std::int32_t level,
+  std::int32_t& numPoints,
+  std::int32_t& numBins,
+  std::ostringstream& nodes,
+  std::ostringstream& cells,
+  std::ostringstream& levels)
+{
+  const WideBVHNode<FloatType, NDIMS, Width>& node = wide_nodes[current_node];
+
+  // STEP 0: write the bounding boxes of all the children of this node
+  for(int lane = 0; lane < Width; ++lane)
+  {
+    if(!node.isEmpty(lane))
+    {
+      write_box<FloatType, NDIMS>(node.getBox(lane),
+                                  numPoints,
+                                  numBins,
+                                  nodes,
+                                  cells);
+      levels << level << std::endl;
+    }
+  }
+
+  // STEP 1: descend into the inner children
+  for(int lane = 0; lane < Width; ++lane)
+  {
+    if(!node.isEmpty(lane) && !node.isLeaf(lane))
+    {
+      write_recursive<FloatType, NDIMS, Width>(wide_nodes,
+                                               node.children[lane],
+                                               level + 1,
+                                               numPoints,
+                                               numBins,
+                                               nodes,
+                                               cells,
+                                               levels);
+    }
+  }
+}
+
 } /* namespace linear_bvh */
 } /* namespace internal */
 } /* namespace spin */
@@ -0,0 +1,453 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_WIDE_BVH_TRAVERSE_HPP_
+#define AXOM_SPIN_WIDE_BVH_TRAVERSE_HPP_
+
+#include "axom/config.hpp"
+#include "axom/core/Macros.hpp"
+#include "axom/core/Types.hpp"
+#include "axom/core/ArrayView.hpp"
+
+#include "axom/spin/internal/linear_bvh/WideBVHNode.hpp"
+#include "axom/spin/internal/linear_bvh/TraversalPredicates.hpp"
+#include "axom/spin/internal/linear_bvh/bvh_packet_traverse.hpp"
+#include "axom/spin/internal/linear_bvh/bvh_traverse.hpp"
+
+namespace axom
+{
+namespace spin
+{
+namespace internal
+{
+namespace linear_bvh
+{
+/*!
+ * \brief Generic traversal routine for a wide (collapsed) BVH.
+ *
+ * \param [in] nodes the wide BVH nodes, the root is stored at index 0.
+ * \param [in] leaf_aabbs the bounding boxes of the primitives, in leaf order.
+ * \param [in] leaf_nodes the primitive IDs, in leaf order.
+ * \param [in] p the primitive in query, e.g., a point, ray, etc.
+ * \param [in] B functor that defines the check for the bins
+ * \param [in] A functor that defines the leaf action
+ * \param [in] Priority functor used to order the traversal of the children
+ *  of a node that satisfy the predicate
+ *
+ * \note The supplied functor `B` is expected to take the primitive and a
+ *  primal::BoundingBox< FloatType, NDIMS >, as in bvh_traverse(). If it can
+ *  also be invoked with the primitive and a WideBVHNode, returning a bitmask,
+ *  that overload is used to test all the children of a node at once.
+ *
+ * \note The supplied functor `A` is called for every primitive whose bounding
+ *  box satisfies `B`, with the same arguments as in bvh_traverse(): the index
+ *  of the primitive in leaf order and a pointer to the leaf node IDs.
+ *
+ * \note The supplied functor `Priority` takes a child bounding box and the
+ *  primitive being queried and returns a scalar key. Children with a smaller
+ *  key are visited first.
+ *
+ * \see bvh_traverse
+ */
+template <int NDIMS,
+          typename FloatType,
+          int Width,
+          typename PrimitiveType,
+          typename InBinCheck,
+          typename LeafAction,
+          typename TraversePriority>
+AXOM_HOST_DEVICE inline void wide_bvh_traverse(
+  axom::ArrayView<const WideBVHNode<FloatType, NDIMS, Width>> nodes,
+  axom::ArrayView<const primal::BoundingBox<FloatType, NDIMS>> leaf_aabbs,
+  axom::ArrayView<const std::int32_t> leaf_nodes,
+  const PrimitiveType& p,
+  InBinCheck&& B,
+  LeafAction&& A,
+  TraversePriority&& Priority)
+{
+  using NodeType = WideBVHNode<FloatType, NDIMS, Width>;
+
+  // setup stack; a wide node is no deeper than the binary node it was
+  // collapsed from and leaves at most Width - 1 siblings on the stack
+  constexpr std::int32_t STACK_SIZE = (Width - 1) * BVH_STACK_SIZE;
+  std::int32_t todo[STACK_SIZE];
+  std::int32_t stackptr = 0;
+  todo[stackptr] = 0;
+
+  while(stackptr >= 0)
+  {
+    const NodeType& node = nodes[todo[stackptr]];
+    stackptr--;
+
+    const std::uint32_t mask = lane_mask(node, p, B, 0);
+    if(mask == 0)
+    {
+      continue;
+    }
+
+    // Sort the lanes that satisfy the predicate by priority
+    std::int32_t lanes[Width];
+    double keys[Width];
+    std::int32_t nhits = 0;
+    for(std::int32_t lane = 0; lane < Width; ++lane)
+    {
+      if(mask & (1u << lane))
+      {
+        const double key = Priority(node.getBox(lane), p);
+        std::int32_t pos = nhits++;
+        while(pos > 0 && keys[pos - 1] > key)
+        {
+          keys[pos] = keys[pos - 1];
+          lanes[pos] = lanes[pos - 1];
+          pos--;
+        }
+        keys[pos] = key;
+        lanes[pos] = lane;
+      }
+    }
+
+    // Process the leaves in order; inner nodes are pushed in reverse order so
+    // that the one with the highest priority is popped first.
+    for(std::int32_t i = 0; i < nhits; ++i)
+    {
+      const std::int32_t lane = lanes[i];
+      if(!node.isLeaf(lane))
+      {
+        continue;
+      }
+
+      const std::int32_t first = -node.children[lane] - 1;
+      const std::int32_t count = node.counts[lane];
+      if(count == 1)
+      {
+        // lane box is the primitive's box, which already satisfies B
+        A(first, leaf_nodes.data());
+      }
+      else
+      {
+        for(std::int32_t j = first; j < first + count; ++j)
+        {
+          const auto& leaf_box = leaf_aabbs[j];
+          if(leaf_box.isValid() && B(p, leaf_box))
+          {
+            A(j, leaf_nodes.data());
+          }
+        }
+      }
+    }
+
+    for(std::int32_t i = nhits - 1; i >= 0; --i)
+    {
+      const std::int32_t lane = lanes[i];
+      if(!node.isLeaf(lane))
+      {
+        stackptr++;
+        check_stack_push(stackptr, STACK_SIZE);
+        todo[stackptr] = node.children[lane];
+      }
+    }
+  }  // END while
+}
+
+/*!
+ * \brief Traversal routine for a wide BVH that visits the leaves closest to
+ *  a query point first, pruning the branches that are farther away than a
+ *  bound.
+ *
+ * \param [in] nodes the wide BVH nodes, the root is stored at index 0.
+ * \param [in] leaf_aabbs the bounding boxes of the primitives, in leaf order.
+ * \param [in] leaf_nodes the primitive IDs, in leaf order.
+ * \param [in] p the query point
+ * \param [in] A functor that defines the leaf action
+ * \param [in] Bound functor that returns the current pruning bound
+ *
+ * \note The functors `A` and `Bound` are the same as in
+ *  bvh_traverse_nearest(). The distances to all children of a node are
+ *  computed at once, and the children are visited in order of increasing
+ *  distance to the query point.
+ *
+ * \see bvh_traverse_nearest
+ */
+template <int NDIMS,
+          typename FloatType,
+          int Width,
+          typename LeafAction,
+          typename PruneBound>
+AXOM_HOST_DEVICE inline void wide_bvh_traverse_nearest(
+  axom::ArrayView<const WideBVHNode<FloatType, NDIMS, Width>> nodes,
+  axom::ArrayView<const primal::BoundingBox<FloatType, NDIMS>> leaf_aabbs,
+  axom::ArrayView<const std::int32_t> leaf_nodes,
+  const primal::Point<FloatType, NDIMS>& p,
+  LeafAction&& A,
+  PruneBound&& Bound)
+{
+  using NodeType = WideBVHNode<FloatType, NDIMS, Width>;
+
+  // setup stack of nodes, along with their distance to the query point,
+  // sized as in wide_bvh_traverse()
+  constexpr std::int32_t STACK_SIZE = (Width - 1) * BVH_STACK_SIZE;
+  std::int32_t todo[STACK_SIZE];
+  double todo_dist[STACK_SIZE];
+  std::int32_t stackptr = 0;
+  todo[stackptr] = 0;
+  todo_dist[stackptr] = 0.;
+
+  while(stackptr >= 0)
+  {
+    const std::int32_t current_node = todo[stackptr];
+    const double current_dist = todo_dist[stackptr];
+    stackptr--;
+
+    // skip nodes that became too far away since they were pushed
+    if(current_dist > Bound())
+    {
+      continue;
+    }
+
+    const NodeType& node = nodes[current_node];
+    double dist[Width];
+    const std::uint32_t valid = node.squaredDistances(p, dist);
+
+    // Sort the lanes by distance
+    std::int32_t lanes[Width];
+    double keys[Width];
+    std::int32_t nhits = 0;
+    for(std::int32_t lane = 0; lane < Width; ++lane)
+    {
+      if((valid & (1u << lane)) && dist[lane] <= Bound())
+      {
+        const double key = dist[lane];
+        std::int32_t pos = nhits++;
+        while(pos > 0 && keys[pos - 1] > key)
+        {
+          keys[pos] = keys[pos - 1];
+          lanes[pos] = lanes[pos - 1];
+          pos--;
+        }
+        keys[pos] = key;
+        lanes[pos] = lane;
+      }
+    }
+
+    // Process the leaves, closest first
+    for(std::int32_t i = 0; i < nhits; ++i)
+    {
+      const std::int32_t lane = lanes[i];
+      if(!node.isLeaf(lane) || keys[i] > Bound())
+      {
+        continue;
+      }
+
+      const std::int32_t first = -node.children[lane] - 1;
+      const std::int32_t count = node.counts[lane];
+      if(count == 1)
+      {
+        // lane box is the primitive's box
+        A(first, leaf_nodes.data(), keys[i]);
+      }
+      else
+      {
+        for(std::int32_t j = first; j < first + count; ++j)
+        {
+          const auto& leaf_box = leaf_aabbs[j];
+          if(leaf_box.isValid())
+          {
+            const double leaf_dist = primal::squared_distance(p, leaf_box);
+            if(leaf_dist <= Bound())
+            {
+              A(j, leaf_nodes.data(), leaf_dist);
+            }
+          }
+        }
+      }
+    }
+
+    // Push the inner nodes, so that the closest one is popped first
+    for(std::int32_t i = nhits - 1; i >= 0; --i)
+    {
+      const std::int32_t lane = lanes[i];
+      if(!node.isLeaf(lane) && keys[i] <= Bound())
+      {
+        stackptr++;
+        check_stack_push(stackptr, STACK_SIZE);
+        todo[stackptr] = node.children[lane];
+        todo_dist[stackptr] = keys[i];
+      }
+    }
+  }  // END while
+}
+
+/*!
+ * \brief Traverses a wide BVH with a packet of rays at once.
+ *
+ *  As in bvh_traverse_packet(), the packet shares a single traversal stack,
+ *  and only the rays that intersect the box of a child are carried down to
+ *  it. The box of each child of a visited node is tested against all the
+ *  rays of the packet once. The resulting masks and entry parameters are then
+ *  used to order the children, by the smallest entry parameter of their
+ *  rays, and to process the leaves.
+ *
+ * \param [in] nodes the wide BVH nodes, the root is stored at index 0.
+ * \param [in] leaf_aabbs the bounding boxes of the primitives, in leaf order.
+ * \param [in] leaf_nodes the primitive IDs, in leaf order.
+ * \param [in,out] packet the packet of rays
+ * \param [in] A functor that defines the leaf action
+ *
+ * \note The supplied functor `A` takes the same arguments as in
+ *  bvh_traverse_packet(), and may also lower the maximum parameter of the
+ *  rays in the packet.
+ *
+ * \see bvh_traverse_packet
+ */
+template <int NDIMS,
+          typename FloatType,
+          int Width,
+          int PacketSize,
+          typename LeafAction>
+AXOM_HOST_DEVICE inline void wide_bvh_traverse_packet(
+  axom::ArrayView<const WideBVHNode<FloatType, NDIMS, Width>> nodes,
+  axom::ArrayView<const primal::BoundingBox<FloatType, NDIMS>> leaf_aabbs,
+  axom::ArrayView<const std::int32_t> leaf_nodes,
+  RayPacket<FloatType, NDIMS, PacketSize>& packet,
+  LeafAction&& A)
+{
+  using NodeType = WideBVHNode<FloatType, NDIMS, Width>;
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+
+  // setup stack, holding the nodes and the rays that reached them, sized as
+  // in wide_bvh_traverse()
+  constexpr std::int32_t STACK_SIZE = (Width - 1) * BVH_STACK_SIZE;
+  std::int32_t todo[STACK_SIZE];
+  std::uint32_t todo_mask[STACK_SIZE];
+  std::int32_t stackptr = 0;
+  todo[stackptr] = 0;
+  todo_mask[stackptr] = packet.active;
+
+  FloatType t_enter[Width][PacketSize];
+
+  while(stackptr >= 0)
+  {
+    const NodeType& node = nodes[todo[stackptr]];
+    const std::uint32_t mask = todo_mask[stackptr] & packet.active;
+    stackptr--;
+
+    if(mask == 0)
+    {
+      continue;
+    }
+
+    // Test the children against each ray that reached the node, all lanes
+    // at once, and gather the rays that hit each child
+    std::uint32_t child_mask[Width];
+    for(std::int32_t lane = 0; lane < Width; ++lane)
+    {
+      child_mask[lane] = 0;
+    }
+    for(int ray = 0; ray < PacketSize; ++ray)
+    {
+      if(!(mask & (1u << ray)))
+      {
+        continue;
+      }
+
+      FloatType t_ray[Width];
+      const std::uint32_t hits = node.packetRayMask(packet, ray, t_ray);
+      for(std::int32_t lane = 0; lane < Width; ++lane)
+      {
+        t_enter[lane][ray] = t_ray[lane];
+        child_mask[lane] |= ((hits >> lane) & 1u) << ray;
+      }
+    }
+
+    // Sort the children that are hit by the smallest entry parameter of
+    // their rays
+    std::int32_t lanes[Width];
+    FloatType keys[Width];
+    std::int32_t nhits = 0;
+    for(std::int32_t lane = 0; lane < Width; ++lane)
+    {
+      if(child_mask[lane] == 0)
+      {
+        continue;
+      }
+
+      FloatType key = axom::numerics::floating_point_limits<FloatType>::max();
+      for(int ray = 0; ray < PacketSize; ++ray)
+      {
+        if(child_mask[lane] & (1u << ray))
+        {
+          key = axom::utilities::min(key, t_enter[lane][ray]);
+        }
+      }
+
+      std::int32_t pos = nhits++;
+      while(pos > 0 && keys[pos - 1] > key)
+      {
+        keys[pos] = keys[pos - 1];
+        lanes[pos] = lanes[pos - 1];
+        pos--;
+      }
+      keys[pos] = key;
+      lanes[pos] = lane;
+    }
+
+    // Process the leaves in order; inner nodes are pushed in reverse order so
+    // that the one entered first is popped first.
+    for(std::int32_t i = 0; i < nhits; ++i)
+    {
+      const std::int32_t lane = lanes[i];
+      if(!node.isLeaf(lane))
+      {
+        continue;
+      }
+
+      const std::int32_t first = -node.children[lane] - 1;
+      const std::int32_t count = node.counts[lane];
+      for(std::int32_t j = first; j < first + count; ++j)
+      {
+        const BoxType& leaf_box = leaf_aabbs[j];
+        for(int ray = 0; ray < PacketSize; ++ray)
+        {
+          if(!(child_mask[lane] & (1u << ray)))
+          {
+            continue;
+          }
+
+          // lane box is the primitive's box for single-primitive leaves
+          FloatType t_hit = t_enter[lane][ray];
+          if(count > 1 &&
+             !(leaf_box.isValid() && packet.intersect(leaf_box, ray, t_hit)))
+          {
+            continue;
+          }
+
+          if(t_hit <= packet.t_max[ray])
+          {
+            A(ray, j, leaf_nodes.data(), t_hit);
+          }
+        }
+      }
+    }
+
+    for(std::int32_t i = nhits - 1; i >= 0; --i)
+    {
+      const std::int32_t lane = lanes[i];
+      if(!node.isLeaf(lane))
+      {
+        stackptr++;
+        check_stack_push(stackptr, STACK_SIZE);
+        todo[stackptr] = node.children[lane];
+        todo_mask[stackptr] = child_mask[lane];
+      }
+    }
+  }  // END while
+}
+
+} /* namespace linear_bvh */
+} /* namespace internal */
+} /* namespace spin */
+} /* namespace axom */
+
+#endif /* AXOM_SPIN_WIDE_BVH_TRAVERSE_HPP_ */
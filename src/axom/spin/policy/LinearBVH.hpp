@@ -12,17 +12,25 @@
 #include "axom/core/memory_management.hpp"
 #include "axom/core/AnnotationMacros.hpp"
 #include "axom/core/numerics/floating_point_limits.hpp"
+#include "axom/core/utilities/FileUtilities.hpp"
 
 #include "axom/primal/geometry/BoundingBox.hpp"
 #include "axom/primal/geometry/Vector.hpp"
 
+#include "axom/spin/BVHBuildMethod.hpp"
+
 // linear bvh includes
 #include "axom/spin/internal/linear_bvh/RadixTree.hpp"
 #include "axom/spin/internal/linear_bvh/build_radix_tree.hpp"
+#include "axom/spin/internal/linear_bvh/bvh_binary_io.hpp"
+#include "axom/spin/internal/linear_bvh/build_sah_tree.hpp"
+#include "axom/spin/internal/linear_bvh/bvh_find_candidates.hpp"
+#include "axom/spin/internal/linear_bvh/bvh_packet_traverse.hpp"
 #include "axom/spin/internal/linear_bvh/bvh_traverse.hpp"
 #include "axom/spin/internal/linear_bvh/bvh_vtkio.hpp"
 
 // C/C++ includes
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <string>
@@ -102,6 +110,19 @@ public:
   AXOM_HOST_DEVICE void traverse_tree(const Primitive& p,
                                       LeafAction&& lf,
                                       Predicate&& predicate) const
+  {
+    traverse_unordered(p, lf, predicate);
+  }
+
+  /*!
+   * \brief Traverses the tree without any preference on the order in which
+   *  the children of a node are visited, e.g., for searches that visit all
+   *  the leaves satisfying \a predicate.
+   */
+  template <typename Primitive, typename LeafAction, typename Predicate>
+  AXOM_HOST_DEVICE void traverse_unordered(const Primitive& p,
+                                           LeafAction&& lf,
+                                           Predicate&& predicate) const
   {
     auto noTraversePref =
       [](const BoxType& l, const BoxType& r, const Primitive& p) {
@@ -120,6 +141,89 @@ public:
                        noTraversePref);
   }
 
+  /*!
+   * \brief Traverses the tree in order of increasing distance to the query
+   *  point, calling \a lf for each leaf within the squared distance
+   *  returned by \a bound.
+   *
+   * \see internal::linear_bvh::bvh_traverse_nearest
+   */
+  template <typename LeafAction, typename PruneBound>
+  AXOM_HOST_DEVICE void traverse_nearest(const PointType& p,
+                                         LeafAction&& lf,
+                                         PruneBound&& bound) const
+  {
+    lbvh::bvh_traverse_nearest(m_inner_nodes,
+                               m_inner_node_children,
+                               m_leaf_nodes,
+                               p,
+                               lf,
+                               bound);
+  }
+
+  /*!
+   * \brief Traverses the tree with a packet of rays at once, calling \a lf
+   *  for each leaf hit by each of the rays.
+   *
+   * \see internal::linear_bvh::bvh_traverse_packet
+   */
+  template <int PacketSize, typename LeafAction>
+  AXOM_HOST_DEVICE void traverse_packet(
+    lbvh::RayPacket<FloatType, NDIMS, PacketSize>& packet,
+    LeafAction&& lf) const
+  {
+    lbvh::bvh_traverse_packet(m_inner_nodes,
+                              m_inner_node_children,
+                              m_leaf_nodes,
+                              packet,
+                              lf);
+  }
+
+  /*!
+   * \brief Traverses the tree, passing the index of each node to
+   *  \a predicate, e.g., to look up data attached to the nodes.
+   *
+   * \see internal::linear_bvh::bvh_traverse_nodes
+   */
+  template <typename Primitive, typename LeafAction, typename Predicate>
+  AXOM_HOST_DEVICE void traverse_nodes(const Primitive& p,
+                                       LeafAction&& lf,
+                                       Predicate&& predicate) const
+  {
+    lbvh::bvh_traverse_nodes(m_inner_nodes,
+                             m_inner_node_children,
+                             m_leaf_nodes,
+                             p,
+                             predicate,
+                             lf);
+  }
+
+  /*!
+   * \name Accessors to the nodes of the tree
+   *
+   *  Node \a i has the bounding box getInnerNodes()[i]. Its two children are
+   *  nodes \a c and \a c+1, where \a c = getInnerNodeChildren()[i] when it is
+   *  non-negative. Otherwise, node \a i is a leaf holding the entity with
+   *  index getLeafNodes()[-c-1]. The root's children are nodes 0 and 1.
+   *
+   * \note The views are in the memory space of the execution space.
+   */
+  /// @{
+  AXOM_HOST_DEVICE axom::ArrayView<const BoxType> getInnerNodes() const
+  {
+    return m_inner_nodes;
+  }
+  AXOM_HOST_DEVICE axom::ArrayView<const std::int32_t> getInnerNodeChildren()
+    const
+  {
+    return m_inner_node_children;
+  }
+  AXOM_HOST_DEVICE axom::ArrayView<const std::int32_t> getLeafNodes() const
+  {
+    return m_leaf_nodes;
+  }
+  /// @}
+
 private:
   axom::ArrayView<const BoxType> m_inner_nodes;  // BVH bins including leafs
   axom::ArrayView<const std::int32_t> m_inner_node_children;
@@ -151,13 +255,43 @@ public:
    * \param [in] boxes the bounding boxes for each leaf node
    * \param [in] numBoxes the number of bounding boxes
    * \param [in] scaleFactor scale factor applied to each bounding box before insertion into the BVH
+   * \param [in] buildMethod the method used to build the tree hierarchy
+   * \param [in] refittable if true, the hierarchy of the tree and its cost
+   *  are kept for refitImpl()
    */
   template <typename BoxIndexable>
   void buildImpl(const BoxIndexable boxes,
                  IndexType numBoxes,
                  FloatType scaleFactor,
+                 BVHBuildMethod buildMethod,
+                 bool refittable,
                  int allocatorID);
 
+  /*!
+   * \brief Updates the bounding boxes of the BVH, keeping its hierarchy.
+   *
+   * \param [in] boxes the new bounding boxes for each leaf node
+   * \param [in] numBoxes the number of bounding boxes
+   * \param [in] scaleFactor scale factor applied to each bounding box before insertion into the BVH
+   *
+   * \return the ratio of the cost of the refitted tree over the cost of the
+   *  tree when it was built, where the cost is given by compute_tree_cost().
+   *
+   * \pre numBoxes is equal to the number of boxes the BVH was built with
+   * \pre The BVH was built with refittable set to true
+   */
+  template <typename BoxIndexable>
+  double refitImpl(const BoxIndexable boxes,
+                   IndexType numBoxes,
+                   FloatType scaleFactor,
+                   int allocatorID);
+
+  /*!
+   * \brief Emits the BVH nodes from the boxes and hierarchy of a radix tree.
+   * \note Needs to be public to be able to use device lambdas with CUDA.
+   */
+  void emitNodes(const lbvh::RadixTree<FloatType, NDIMS>& radix_tree);
+
   /*!
    * \brief Performs a traversal to find the candidates for each query primitive.
    *
@@ -167,8 +301,12 @@ public:
    * \param [out] candidates array of the potential candidates for intersection with the BVH
    * \param [in] numObjs the number of user-supplied query primitives
    * \param [in] objs array of primitives to query against the BVH
+   * \param [in] bufferSize the number of candidates buffered for each query
+   *  primitive in a single-pass search, or 0 for a two-pass search
    *
    * \return total_count the total count of candidates for all query primitives.
+   *
+   * \see internal::linear_bvh::find_candidates_single_pass
    */
   template <typename PrimitiveType, typename Predicate, typename PrimitiveIndexable>
   axom::Array<IndexType> findCandidatesImpl(
@@ -177,17 +315,82 @@ public:
     const axom::ArrayView<IndexType> counts,
     IndexType numObjs,
     PrimitiveIndexable objs,
+    IndexType bufferSize,
     int allocatorID) const;
 
   void writeVtkFileImpl(const std::string& fileName) const;
 
+  /*!
+   * \brief Writes the nodes of the BVH to a binary file.
+   *
+   * \param [in] fileName the name of the file to write
+   * \param [in] numItems the number of entities the BVH was initialized with
+   * \return true if the file was written successfully, false otherwise
+   *
+   * \see internal::linear_bvh::BVHFileHeader for the layout of the file
+   */
+  bool saveImpl(const std::string& fileName, IndexType numItems) const;
+
+  /*!
+   * \brief Reads the nodes of the BVH from a file written by saveImpl().
+   *
+   * \param [in] fileName the name of the file to read
+   * \param [in] memoryMap if true, the nodes are accessed in place in the
+   *  memory-mapped file, when the execution space can access host memory
+   *  and the file has the byte order of this machine. Otherwise, the nodes
+   *  are copied to arrays allocated with \a allocatorID.
+   * \param [in] allocatorID the allocator used for copied nodes
+   * \param [out] numItems the number of entities the BVH was initialized with
+   *
+   * \return true if the file was read successfully, false otherwise
+   *
+   * \note The hierarchy of the radix tree the BVH was built from is not
+   *  stored in the file, so a loaded BVH cannot be refitted.
+   */
+  bool loadImpl(const std::string& fileName,
+                bool memoryMap,
+                int allocatorID,
+                IndexType& numItems);
+
+  /// \brief Returns the number of bytes written by serializeImpl()
+  std::size_t getSerializedSizeImpl() const;
+
+  /*!
+   * \brief Writes the nodes of the BVH to a buffer, in the same layout as
+   *  the files written by saveImpl().
+   *
+   * \param [out] buffer host buffer of at least getSerializedSizeImpl() bytes
+   * \param [in] numItems the number of entities the BVH was initialized with
+   */
+  void serializeImpl(void* buffer, IndexType numItems) const;
+
+  /*!
+   * \brief Accesses the nodes of the BVH in place in a buffer written by
+   *  serializeImpl(), or copies them when the execution space cannot access
+   *  host memory.
+   *
+   * \param [in] buffer the buffer, which must outlive the BVH
+   * \param [in] size the size of the buffer in bytes
+   * \param [in] allocatorID the allocator used for copied nodes
+   * \param [out] numItems the number of entities the BVH was initialized with
+   *
+   * \return true if the buffer holds a valid BVH, false otherwise
+   */
+  bool attachImpl(const void* buffer,
+                  std::size_t size,
+                  int allocatorID,
+                  IndexType& numItems);
+
+  /// \brief Returns true if the nodes are accessed in a memory-mapped file
+  bool isMemoryMappedImpl() const { return m_file.isOpen(); }
+
   BoundingBoxType getBoundsImpl() const { return m_bounds; }
 
   TraverserType getTraverserImpl() const
   {
-    return TraverserType(m_inner_nodes.view(),
-                         m_inner_node_children.view(),
-                         m_leaf_nodes.view());
+    return TraverserType(m_inner_nodes_v,
+                         m_inner_node_children_v,
+                         m_leaf_nodes_v);
   }
 
 private:
@@ -207,38 +410,145 @@ private:
     m_leaf_nodes = axom::Array<std::int32_t>(size, size, allocID);
   }
 
+  /// \brief Fills in the header describing the serialized nodes of the BVH
+  lbvh::BVHFileHeader makeHeader(IndexType numItems) const;
+
+  /*!
+   * \brief Reads the nodes of the BVH from a buffer in the layout of the
+   *  files written by saveImpl().
+   *
+   * \param [in] inPlace if true, the nodes are accessed in place, when the
+   *  execution space can access host memory and the buffer has the byte
+   *  order of this machine
+   * \param [out] isInPlace true if the nodes are accessed in place
+   */
+  bool readNodes(const char* data,
+                 std::size_t size,
+                 bool inPlace,
+                 int allocatorID,
+                 IndexType& numItems,
+                 bool& isInPlace);
+
+  /// \brief Points the node views used by the queries to the node arrays
+  void updateViews()
+  {
+    m_inner_nodes_v = m_inner_nodes.view();
+    m_inner_node_children_v = m_inner_node_children.view();
+    m_leaf_nodes_v = m_leaf_nodes.view();
+  }
+
   bool m_initialized {false};
   axom::Array<BoundingBoxType> m_inner_nodes;  // BVH bins including leafs
   axom::Array<std::int32_t> m_inner_node_children;
   axom::Array<std::int32_t> m_leaf_nodes;  // leaf data
   primal::BoundingBox<FloatType, NDIMS> m_bounds;
+
+  // views of the nodes, either in the arrays above, in a mapped file or in
+  // an external buffer
+  axom::ArrayView<const BoundingBoxType> m_inner_nodes_v;
+  axom::ArrayView<const std::int32_t> m_inner_node_children_v;
+  axom::ArrayView<const std::int32_t> m_leaf_nodes_v;
+  axom::utilities::filesystem::MappedFile m_file;
+
+  lbvh::RadixTree<FloatType, NDIMS> m_radix_tree;  // hierarchy, for refits
+  double m_build_cost {0.};
 };
 
 template <typename FloatType, int NDIMS, typename ExecSpace>
 template <typename BoxIndexable>
-void LinearBVH<FloatType, NDIMS, ExecSpace>::buildImpl(const BoxIndexable boxes,
-                                                       IndexType numBoxes,
-                                                       FloatType scaleFactor,
-                                                       int allocatorID)
+void LinearBVH<FloatType, NDIMS, ExecSpace>::buildImpl(
+  const BoxIndexable boxes,
+  IndexType numBoxes,
+  FloatType scaleFactor,
+  BVHBuildMethod buildMethod,
+  bool refittable,
+  int allocatorID)
 {
   AXOM_ANNOTATE_SCOPE("LinearBVH::buildImpl");
 
   // STEP 1: Build a RadixTree consisting of the bounding boxes, sorted
-  // by their corresponding morton code.
+  // by their corresponding morton code, or partitioned with the SAH.
   lbvh::RadixTree<FloatType, NDIMS> radix_tree;
   primal::BoundingBox<FloatType, NDIMS> global_bounds;
-  lbvh::build_radix_tree<ExecSpace>(boxes,
+  if(buildMethod == BVHBuildMethod::BinnedSAH)
+  {
+    lbvh::build_sah_tree<ExecSpace>(boxes,
                                     numBoxes,
                                     global_bounds,
                                     radix_tree,
                                     scaleFactor,
                                     allocatorID);
+  }
+  else
+  {
+    lbvh::build_radix_tree<ExecSpace>(boxes,
+                                      numBoxes,
+                                      global_bounds,
+                                      radix_tree,
+                                      scaleFactor,
+                                      allocatorID);
+  }
 
   // STEP 2: emit the BVH data-structure from the radix tree
   m_bounds = global_bounds;
   allocate(numBoxes, allocatorID);
 
   // STEP 3: emit the BVH
+  emitNodes(radix_tree);
+
+  m_leaf_nodes = std::move(radix_tree.m_leafs);
+
+  // STEP 4: keep the hierarchy of the radix tree, so the BVH can be refitted
+  if(refittable)
+  {
+    m_build_cost = lbvh::compute_tree_cost<ExecSpace>(radix_tree, m_bounds);
+    radix_tree.clearBoxes();
+    m_radix_tree = std::move(radix_tree);
+  }
+
+  m_file.close();
+  updateViews();
+  m_initialized = true;
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace>
+template <typename BoxIndexable>
+double LinearBVH<FloatType, NDIMS, ExecSpace>::refitImpl(
+  const BoxIndexable boxes,
+  IndexType numBoxes,
+  FloatType scaleFactor,
+  int allocatorID)
+{
+  AXOM_ANNOTATE_SCOPE("LinearBVH::refitImpl");
+
+  SLIC_ASSERT(m_initialized);
+  SLIC_ASSERT(numBoxes == m_radix_tree.m_size);
+  SLIC_ASSERT(!m_file.isOpen());
+
+  // STEP 1: update the boxes of the radix tree, bottom-up
+  lbvh::refit_radix_tree<ExecSpace>(boxes,
+                                    numBoxes,
+                                    m_leaf_nodes.view(),
+                                    m_bounds,
+                                    m_radix_tree,
+                                    scaleFactor,
+                                    allocatorID);
+
+  // STEP 2: emit the BVH
+  emitNodes(m_radix_tree);
+
+  // STEP 3: evaluate the quality of the refitted tree
+  const double cost =
+    lbvh::compute_tree_cost<ExecSpace>(m_radix_tree, m_bounds);
+  m_radix_tree.clearBoxes();
+
+  return (m_build_cost > 0.) ? cost / m_build_cost : 1.;
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace>
+void LinearBVH<FloatType, NDIMS, ExecSpace>::emitNodes(
+  const lbvh::RadixTree<FloatType, NDIMS>& radix_tree)
+{
   const std::int32_t size = radix_tree.m_size;
   AXOM_UNUSED_VAR(size);
   const std::int32_t inner_size = radix_tree.m_inner_size;
@@ -293,10 +603,6 @@ void LinearBVH<FloatType, NDIMS, ExecSpace>::buildImpl(const BoxIndexable boxes,
       bvh_inner_node_children[out_offset + 1] = rchild;
     });
   AXOM_ANNOTATE_END("emit_bvh_parents");
-
-  m_leaf_nodes = std::move(radix_tree.m_leafs);
-
-  m_initialized = true;
 }
 
 template <typename FloatType, int NDIMS, typename ExecSpace>
@@ -307,6 +613,7 @@ axom::Array<IndexType> LinearBVH<FloatType, NDIMS, ExecSpace>::findCandidatesImp
   const axom::ArrayView<IndexType> counts,
   IndexType numObjs,
   PrimitiveIndexable objs,
+  IndexType bufferSize,
   int allocatorID) const
 
 {
@@ -317,9 +624,22 @@ axom::Array<IndexType> LinearBVH<FloatType, NDIMS, ExecSpace>::findCandidatesImp
   SLIC_ERROR_IF(counts.size() != numObjs, "counts length not equal to numObjs");
   SLIC_ASSERT(m_initialized);
 
-  const auto inner_nodes = m_inner_nodes.view();
-  const auto inner_node_children = m_inner_node_children.view();
-  const auto leaf_nodes = m_leaf_nodes.view();
+  if(bufferSize > 0)
+  {
+    return lbvh::find_candidates_single_pass<ExecSpace, PrimitiveType>(
+      getTraverserImpl(),
+      predicate,
+      offsets,
+      counts,
+      numObjs,
+      objs,
+      bufferSize,
+      allocatorID);
+  }
+
+  const auto inner_nodes = m_inner_nodes_v;
+  const auto inner_node_children = m_inner_node_children_v;
+  const auto leaf_nodes = m_leaf_nodes_v;
 
   auto noTraversePref = [] AXOM_HOST_DEVICE(const BoundingBoxType&,
                                             const BoundingBoxType&,
@@ -461,8 +781,8 @@ void LinearBVH<FloatType, NDIMS, ExecSpace>::writeVtkFileImpl(
 
   // STEP 2: traverse the BVH and dump each bin
   constexpr std::int32_t ROOT = 0;
-  lbvh::write_recursive<FloatType, NDIMS>(m_inner_nodes,
-                                          m_inner_node_children,
+  lbvh::write_recursive<FloatType, NDIMS>(m_inner_nodes_v,
+                                          m_inner_node_children_v,
                                           ROOT,
                                           1,
                                           numPoints,
@@ -499,6 +819,305 @@ void LinearBVH<FloatType, NDIMS, ExecSpace>::writeVtkFileImpl(
   ofs.close();
 }
 
+template <typename FloatType, int NDIMS, typename ExecSpace>
+lbvh::BVHFileHeader LinearBVH<FloatType, NDIMS, ExecSpace>::makeHeader(
+  IndexType numItems) const
+{
+  using HeaderType = lbvh::BVHFileHeader;
+  static_assert(sizeof(BoundingBoxType) == 2 * NDIMS * sizeof(FloatType),
+                "BoundingBox must be laid out as a pair of points");
+  static_assert(NDIMS <= HeaderType::MAX_DIMS, "unsupported dimension");
+
+  SLIC_ASSERT(m_initialized);
+
+  HeaderType header;
+  std::memset(&header, 0, sizeof(HeaderType));
+  std::strncpy(header.magic, HeaderType::getMagic(), sizeof(header.magic));
+  header.endian_tag = HeaderType::ENDIAN_TAG;
+  header.version = HeaderType::VERSION;
+  header.ndims = NDIMS;
+  header.float_size = sizeof(FloatType);
+  header.num_items = numItems;
+  header.num_leaves = m_leaf_nodes_v.size();
+  header.num_inner_nodes = m_inner_nodes_v.size();
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    header.bounds_min[d] = m_bounds.getMin()[d];
+    header.bounds_max[d] = m_bounds.getMax()[d];
+  }
+
+  const std::uint64_t inner_nodes_bytes =
+    m_inner_nodes_v.size() * sizeof(BoundingBoxType);
+  const std::uint64_t children_bytes =
+    m_inner_node_children_v.size() * sizeof(std::int32_t);
+
+  header.inner_nodes_offset = HeaderType::align(sizeof(HeaderType));
+  header.children_offset =
+    HeaderType::align(header.inner_nodes_offset + inner_nodes_bytes);
+  header.leaf_nodes_offset =
+    HeaderType::align(header.children_offset + children_bytes);
+
+  return header;
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace>
+std::size_t
+LinearBVH<FloatType, NDIMS, ExecSpace>::getSerializedSizeImpl() const
+{
+  const lbvh::BVHFileHeader header = makeHeader(0);
+  return header.leaf_nodes_offset +
+    m_leaf_nodes_v.size() * sizeof(std::int32_t);
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace>
+void LinearBVH<FloatType, NDIMS, ExecSpace>::serializeImpl(
+  void* buffer,
+  IndexType numItems) const
+{
+  AXOM_ANNOTATE_SCOPE("LinearBVH::serializeImpl");
+
+  SLIC_ASSERT(buffer != nullptr);
+
+  const lbvh::BVHFileHeader header = makeHeader(numItems);
+  char* data = static_cast<char*>(buffer);
+
+  // zero the padding between the sections, then copy the header and the
+  // nodes, which may reside on the device
+  std::memset(data, 0, getSerializedSizeImpl());
+  std::memcpy(data, &header, sizeof(header));
+  axom::copy(data + header.inner_nodes_offset,
+             m_inner_nodes_v.data(),
+             m_inner_nodes_v.size() * sizeof(BoundingBoxType));
+  axom::copy(data + header.children_offset,
+             m_inner_node_children_v.data(),
+             m_inner_node_children_v.size() * sizeof(std::int32_t));
+  axom::copy(data + header.leaf_nodes_offset,
+             m_leaf_nodes_v.data(),
+             m_leaf_nodes_v.size() * sizeof(std::int32_t));
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace>
+bool LinearBVH<FloatType, NDIMS, ExecSpace>::saveImpl(
+  const std::string& fileName,
+  IndexType numItems) const
+{
+  AXOM_ANNOTATE_SCOPE("LinearBVH::saveImpl");
+
+  std::vector<char> buffer(getSerializedSizeImpl());
+  serializeImpl(buffer.data(), numItems);
+
+  std::ofstream ofs(fileName, std::ios::out | std::ios::binary);
+  if(!ofs.is_open())
+  {
+    SLIC_WARNING("Could not open BVH file '" << fileName << "' for writing");
+    return false;
+  }
+
+  ofs.write(buffer.data(), buffer.size());
+  return ofs.good();
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace>
+bool LinearBVH<FloatType, NDIMS, ExecSpace>::loadImpl(
+  const std::string& fileName,
+  bool memoryMap,
+  int allocatorID,
+  IndexType& numItems)
+{
+  AXOM_ANNOTATE_SCOPE("LinearBVH::loadImpl");
+
+  axom::utilities::filesystem::MappedFile file;
+  if(!file.open(fileName))
+  {
+    SLIC_WARNING("Could not open BVH file '" << fileName << "'");
+    return false;
+  }
+
+  bool inPlace = false;
+  if(!readNodes(file.data(),
+                file.size(),
+                memoryMap,
+                allocatorID,
+                numItems,
+                inPlace))
+  {
+    return false;
+  }
+
+  // keep the file mapped while its nodes are accessed in place
+  if(inPlace)
+  {
+    m_file = std::move(file);
+  }
+  return true;
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace>
+bool LinearBVH<FloatType, NDIMS, ExecSpace>::attachImpl(const void* buffer,
+                                                        std::size_t size,
+                                                        int allocatorID,
+                                                        IndexType& numItems)
+{
+  AXOM_ANNOTATE_SCOPE("LinearBVH::attachImpl");
+
+  bool inPlace = false;
+  return readNodes(static_cast<const char*>(buffer),
+                   size,
+                   true,
+                   allocatorID,
+                   numItems,
+                   inPlace);
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace>
+bool LinearBVH<FloatType, NDIMS, ExecSpace>::readNodes(const char* data,
+                                                       std::size_t size,
+                                                       bool inPlace,
+                                                       int allocatorID,
+                                                       IndexType& numItems,
+                                                       bool& isInPlace)
+{
+  using HeaderType = lbvh::BVHFileHeader;
+  static_assert(sizeof(BoundingBoxType) == 2 * NDIMS * sizeof(FloatType),
+                "BoundingBox must be laid out as a pair of points");
+
+  // STEP 0: check the header
+  if(data == nullptr || size < sizeof(HeaderType))
+  {
+    SLIC_WARNING("BVH data is truncated");
+    return false;
+  }
+
+  HeaderType header;
+  std::memcpy(&header, data, sizeof(HeaderType));
+  const bool swapped = header.isByteSwapped();
+  if(swapped)
+  {
+    header.byteswap();
+  }
+  if(!header.isValid(NDIMS, sizeof(FloatType), size))
+  {
+    return false;
+  }
+
+  const IndexType num_inner = header.num_inner_nodes;
+  const IndexType num_leaves = header.num_leaves;
+  const auto* inner_nodes_ptr =
+    reinterpret_cast<const BoundingBoxType*>(data + header.inner_nodes_offset);
+  const auto* children_ptr =
+    reinterpret_cast<const std::int32_t*>(data + header.children_offset);
+  const auto* leaf_nodes_ptr =
+    reinterpret_cast<const std::int32_t*>(data + header.leaf_nodes_offset);
+
+  // STEP 1: check that the children and leaves refer to existing nodes and
+  // items, so that the traversals of a corrupted BVH stay in bounds.
+  // BVHs of fewer than two items are padded with an invalid leaf.
+  const IndexType num_leaf_ids =
+    (header.num_items < 2) ? num_leaves : header.num_items;
+  auto readIndex = [swapped](const char* ptr, IndexType i) -> IndexType {
+    std::int32_t value;
+    std::memcpy(&value, ptr + i * sizeof(std::int32_t), sizeof(std::int32_t));
+    return swapped ? axom::utilities::byteswap(value) : value;
+  };
+  for(IndexType i = 0; i < num_inner; ++i)
+  {
+    const IndexType child = readIndex(data + header.children_offset, i);
+    if((child >= 0 && child + 1 >= num_inner) ||
+       (child < 0 && -child - 1 >= num_leaves))
+    {
+      SLIC_WARNING("BVH data is corrupted: inner node "
+                   << i << " has an invalid child " << child);
+      return false;
+    }
+  }
+  for(IndexType i = 0; i < num_leaves; ++i)
+  {
+    const IndexType item = readIndex(data + header.leaf_nodes_offset, i);
+    if(item < 0 || item >= num_leaf_ids)
+    {
+      SLIC_WARNING("BVH data is corrupted: leaf "
+                   << i << " refers to an invalid item " << item);
+      return false;
+    }
+  }
+
+  // STEP 2: point to the nodes in place, or copy them
+  m_file.close();
+  isInPlace =
+    inPlace && !swapped && !axom::execution_space<ExecSpace>::onDevice();
+  if(isInPlace)
+  {
+    m_inner_nodes.clear();
+    m_inner_node_children.clear();
+    m_leaf_nodes.clear();
+    m_inner_nodes_v =
+      axom::ArrayView<const BoundingBoxType>(inner_nodes_ptr, num_inner);
+    m_inner_node_children_v =
+      axom::ArrayView<const std::int32_t>(children_ptr, num_inner);
+    m_leaf_nodes_v =
+      axom::ArrayView<const std::int32_t>(leaf_nodes_ptr, num_leaves);
+  }
+  else
+  {
+    const int hostAllocatorID =
+      axom::execution_space<axom::SEQ_EXEC>::allocatorID();
+    axom::Array<BoundingBoxType> inner_nodes(
+      axom::ArrayOptions::Uninitialized {},
+      num_inner,
+      num_inner,
+      hostAllocatorID);
+    axom::Array<std::int32_t> inner_node_children(num_inner,
+                                                  num_inner,
+                                                  hostAllocatorID);
+    axom::Array<std::int32_t> leaf_nodes(num_leaves,
+                                         num_leaves,
+                                         hostAllocatorID);
+
+    std::memcpy(inner_nodes.data(),
+                inner_nodes_ptr,
+                num_inner * sizeof(BoundingBoxType));
+    std::memcpy(inner_node_children.data(),
+                children_ptr,
+                num_inner * sizeof(std::int32_t));
+    std::memcpy(leaf_nodes.data(),
+                leaf_nodes_ptr,
+                num_leaves * sizeof(std::int32_t));
+
+    if(swapped)
+    {
+      lbvh::byteswap_array(reinterpret_cast<FloatType*>(inner_nodes.data()),
+                           num_inner * 2 * NDIMS);
+      lbvh::byteswap_array(inner_node_children.data(), num_inner);
+      lbvh::byteswap_array(leaf_nodes.data(), num_leaves);
+    }
+
+    m_inner_nodes = axom::Array<BoundingBoxType>(inner_nodes, allocatorID);
+    m_inner_node_children =
+      axom::Array<std::int32_t>(inner_node_children, allocatorID);
+    m_leaf_nodes = axom::Array<std::int32_t>(leaf_nodes, allocatorID);
+    updateViews();
+  }
+
+  // STEP 3: restore the bounds; the hierarchy for refits is not available
+  m_bounds.clear();
+  if(header.bounds_min[0] <= header.bounds_max[0])
+  {
+    primal::Point<FloatType, NDIMS> lo, hi;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      lo[d] = static_cast<FloatType>(header.bounds_min[d]);
+      hi[d] = static_cast<FloatType>(header.bounds_max[d]);
+    }
+    m_bounds = BoundingBoxType(lo, hi);
+  }
+  m_radix_tree = lbvh::RadixTree<FloatType, NDIMS>();
+  m_build_cost = 0.;
+  numItems = header.num_items;
+
+  m_initialized = true;
+  return true;
+}
+
 }  // namespace policy
 }  // namespace spin
 }  // namespace axom
@@ -0,0 +1,609 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_POLICY_WIDEBVH_HPP_
+#define AXOM_SPIN_POLICY_WIDEBVH_HPP_
+
+// axom core includes
+#include "axom/core/Types.hpp"
+#include "axom/core/execution/for_all.hpp"
+#include "axom/core/memory_management.hpp"
+#include "axom/core/AnnotationMacros.hpp"
+#include "axom/core/numerics/floating_point_limits.hpp"
+
+#include "axom/primal/geometry/BoundingBox.hpp"
+#include "axom/primal/operators/squared_distance.hpp"
+
+#include "axom/spin/BVHBuildMethod.hpp"
+
+// linear bvh includes
+#include "axom/spin/internal/linear_bvh/RadixTree.hpp"
+#include "axom/spin/internal/linear_bvh/WideBVHNode.hpp"
+#include "axom/spin/internal/linear_bvh/build_radix_tree.hpp"
+#include "axom/spin/internal/linear_bvh/build_sah_tree.hpp"
+#include "axom/spin/internal/linear_bvh/bvh_find_candidates.hpp"
+#include "axom/spin/internal/linear_bvh/build_wide_bvh.hpp"
+#include "axom/spin/internal/linear_bvh/bvh_packet_traverse.hpp"
+#include "axom/spin/internal/linear_bvh/wide_bvh_traverse.hpp"
+#include "axom/spin/internal/linear_bvh/bvh_vtkio.hpp"
+
+// C/C++ includes
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace axom
+{
+namespace spin
+{
+namespace policy
+{
+namespace lbvh = internal::linear_bvh;
+
+/*
+ * \brief Interface for traversing a wide BVH tree.
+ *
+ * Provides the same interface as LinearBVHTraverser, so that code written
+ * against the traverser of a binary BVH works unchanged with a wide BVH. The
+ * leaf action is invoked once for each primitive whose bounding box
+ * satisfies the predicate, even if the primitive is stored in a leaf
+ * together with other primitives.
+ *
+ * \see internal::linear_bvh::wide_bvh_traverse
+ */
+template <typename FloatType, int NDIMS, int Width>
+class WideBVHTraverser
+{
+public:
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = primal::Point<FloatType, NDIMS>;
+  using NodeType = lbvh::WideBVHNode<FloatType, NDIMS, Width>;
+
+  WideBVHTraverser(axom::ArrayView<const NodeType> nodes,
+                   axom::ArrayView<const BoxType> leaf_aabbs,
+                   axom::ArrayView<const std::int32_t> leaf_nodes)
+    : m_nodes(nodes)
+    , m_leaf_aabbs(leaf_aabbs)
+    , m_leaf_nodes(leaf_nodes)
+  { }
+
+  template <typename LeafAction, typename Predicate>
+  AXOM_HOST_DEVICE void traverse_tree(const PointType& p,
+                                      LeafAction&& lf,
+                                      Predicate&& predicate) const
+  {
+    // visit the children closest to the query point first
+    auto traversePriority = [](const BoxType& bb, const PointType& p) {
+      return static_cast<double>(
+        primal::squared_distance(p, bb.getCentroid()));
+    };
+
+    lbvh::wide_bvh_traverse(m_nodes,
+                            m_leaf_aabbs,
+                            m_leaf_nodes,
+                            p,
+                            predicate,
+                            lf,
+                            traversePriority);
+  }
+
+  /*
+   * Functors \a lf and \a predicate should access only memory compatible
+   * with the execution space.  For example, GPU execution should access
+   * only device and unified memory.
+   */
+  template <typename Primitive, typename LeafAction, typename Predicate>
+  AXOM_HOST_DEVICE void traverse_tree(const Primitive& p,
+                                      LeafAction&& lf,
+                                      Predicate&& predicate) const
+  {
+    traverse_unordered(p, lf, predicate);
+  }
+
+  /*!
+   * \brief Traverses the tree without any preference on the order in which
+   *  the children of a node are visited, e.g., for searches that visit all
+   *  the leaves satisfying \a predicate.
+   */
+  template <typename Primitive, typename LeafAction, typename Predicate>
+  AXOM_HOST_DEVICE void traverse_unordered(const Primitive& p,
+                                           LeafAction&& lf,
+                                           Predicate&& predicate) const
+  {
+    auto noTraversePriority = [](const BoxType& bb, const Primitive& p) {
+      AXOM_UNUSED_VAR(bb);
+      AXOM_UNUSED_VAR(p);
+      return 0.;
+    };
+
+    lbvh::wide_bvh_traverse(m_nodes,
+                            m_leaf_aabbs,
+                            m_leaf_nodes,
+                            p,
+                            predicate,
+                            lf,
+                            noTraversePriority);
+  }
+
+  /*!
+   * \brief Traverses the tree in order of increasing distance to the query
+   *  point, calling \a lf for each primitive within the squared distance
+   *  returned by \a bound.
+   *
+   * \see internal::linear_bvh::wide_bvh_traverse_nearest
+   */
+  template <typename LeafAction, typename PruneBound>
+  AXOM_HOST_DEVICE void traverse_nearest(const PointType& p,
+                                         LeafAction&& lf,
+                                         PruneBound&& bound) const
+  {
+    lbvh::wide_bvh_traverse_nearest(m_nodes,
+                                    m_leaf_aabbs,
+                                    m_leaf_nodes,
+                                    p,
+                                    lf,
+                                    bound);
+  }
+
+  /*!
+   * \brief Traverses the tree with a packet of rays, calling \a lf for each
+   *  primitive hit by each of the rays.
+   *
+   *  The rays of the packet share a single stack. Each ray that reaches a
+   *  node is tested against all the child boxes of the node at once, and the
+   *  children are visited in order of increasing entry parameter.
+   *
+   * \see internal::linear_bvh::wide_bvh_traverse_packet
+   */
+  template <int PacketSize, typename LeafAction>
+  AXOM_HOST_DEVICE void traverse_packet(
+    lbvh::RayPacket<FloatType, NDIMS, PacketSize>& packet,
+    LeafAction&& lf) const
+  {
+    lbvh::wide_bvh_traverse_packet(m_nodes,
+                                   m_leaf_aabbs,
+                                   m_leaf_nodes,
+                                   packet,
+                                   lf);
+  }
+
+private:
+  axom::ArrayView<const NodeType> m_nodes;
+  axom::ArrayView<const BoxType> m_leaf_aabbs;
+  axom::ArrayView<const std::int32_t> m_leaf_nodes;
+};
+
+/*!
+ * \brief WideBVH provides a policy for a BVH implementation with a branching
+ *  factor of \a Width, e.g., 4 or 8.
+ *
+ *  The tree is constructed in parallel as a binary radix tree, as in
+ *  LinearBVH, and then collapsed into a tree of wide nodes. The bounding
+ *  boxes of the children of each wide node are stored in a structure-of-arrays
+ *  layout, which allows all of them to be tested against a query primitive at
+ *  once. Small subtrees are collapsed into leaves that hold several
+ *  primitives, which shortens the traversal.
+ *
+ * \note The bounding boxes of the primitives are stored in Morton order, so
+ *  that the primitives of each leaf are stored contiguously.
+ *
+ * \see LinearBVH
+ */
+template <typename FloatType, int NDIMS, typename ExecSpace, int Width>
+class WideBVH
+{
+public:
+  using TraverserType = WideBVHTraverser<FloatType, NDIMS, Width>;
+  using BoundingBoxType = primal::BoundingBox<FloatType, NDIMS>;
+  using NodeType = lbvh::WideBVHNode<FloatType, NDIMS, Width>;
+
+  /// The maximum number of primitives held by a leaf
+  static constexpr int MAX_LEAF_SIZE = Width;
+
+  WideBVH() = default;
+
+  /*!
+   * \brief Builds a wide BVH with the given bounding boxes as leaf nodes.
+   *
+   * \param [in] boxes the bounding boxes for each leaf node
+   * \param [in] numBoxes the number of bounding boxes
+   * \param [in] scaleFactor scale factor applied to each bounding box before insertion into the BVH
+   * \param [in] buildMethod the method used to build the tree hierarchy
+   * \param [in] refittable if true, the hierarchy of the tree and its cost
+   *  are kept for refitImpl()
+   */
+  template <typename BoxIndexable>
+  void buildImpl(const BoxIndexable boxes,
+                 IndexType numBoxes,
+                 FloatType scaleFactor,
+                 BVHBuildMethod buildMethod,
+                 bool refittable,
+                 int allocatorID);
+
+  /*!
+   * \brief Updates the bounding boxes of the BVH, keeping its hierarchy.
+   *
+   * \param [in] boxes the new bounding boxes for each leaf node
+   * \param [in] numBoxes the number of bounding boxes
+   * \param [in] scaleFactor scale factor applied to each bounding box before insertion into the BVH
+   *
+   * \return the ratio of the cost of the refitted tree over the cost of the
+   *  tree when it was built.
+   *
+   * \pre numBoxes is equal to the number of boxes the BVH was built with
+   * \pre The BVH was built with refittable set to true
+   */
+  template <typename BoxIndexable>
+  double refitImpl(const BoxIndexable boxes,
+                   IndexType numBoxes,
+                   FloatType scaleFactor,
+                   int allocatorID);
+
+  /*!
+   * \brief Performs a traversal to find the candidates for each query primitive.
+   *
+   * \param [in] predicate traversal predicate functor for bin check.
+   * \param [out] offsets array of offsets into the candidate array for each query primitive
+   * \param [out] counts array of candidate counts for each query primitive
+   * \param [out] candidates array of the potential candidates for intersection with the BVH
+   * \param [in] numObjs the number of user-supplied query primitives
+   * \param [in] objs array of primitives to query against the BVH
+   * \param [in] bufferSize the number of candidates buffered for each query
+   *  primitive in a single-pass search, or 0 for a two-pass search
+   *
+   * \return total_count the total count of candidates for all query primitives.
+   *
+   * \see internal::linear_bvh::find_candidates_single_pass
+   */
+  template <typename PrimitiveType, typename Predicate, typename PrimitiveIndexable>
+  axom::Array<IndexType> findCandidatesImpl(
+    Predicate&& predicate,
+    const axom::ArrayView<IndexType> offsets,
+    const axom::ArrayView<IndexType> counts,
+    IndexType numObjs,
+    PrimitiveIndexable objs,
+    IndexType bufferSize,
+    int allocatorID) const;
+
+  void writeVtkFileImpl(const std::string& fileName) const;
+
+  BoundingBoxType getBoundsImpl() const { return m_bounds; }
+
+  TraverserType getTraverserImpl() const
+  {
+    return TraverserType(m_nodes.view(),
+                         m_leaf_aabbs.view(),
+                         m_leaf_nodes.view());
+  }
+
+private:
+  bool m_initialized {false};
+  axom::Array<NodeType> m_nodes;
+  axom::Array<BoundingBoxType> m_leaf_aabbs;  // primitive boxes, leaf order
+  axom::Array<std::int32_t> m_leaf_nodes;     // leaf data
+  primal::BoundingBox<FloatType, NDIMS> m_bounds;
+
+  lbvh::RadixTree<FloatType, NDIMS> m_radix_tree;  // hierarchy, for refits
+  axom::Array<std::int32_t> m_lane_nodes;  // radix tree node of each lane
+  double m_build_cost {0.};
+};
+
+template <typename FloatType, int NDIMS, typename ExecSpace, int Width>
+template <typename BoxIndexable>
+void WideBVH<FloatType, NDIMS, ExecSpace, Width>::buildImpl(
+  const BoxIndexable boxes,
+  IndexType numBoxes,
+  FloatType scaleFactor,
+  BVHBuildMethod buildMethod,
+  bool refittable,
+  int allocatorID)
+{
+  AXOM_ANNOTATE_SCOPE("WideBVH::buildImpl");
+
+  // STEP 1: Build a RadixTree consisting of the bounding boxes, sorted
+  // by their corresponding morton code, or partitioned with the SAH.
+  lbvh::RadixTree<FloatType, NDIMS> radix_tree;
+  primal::BoundingBox<FloatType, NDIMS> global_bounds;
+  if(buildMethod == BVHBuildMethod::BinnedSAH)
+  {
+    lbvh::build_sah_tree<ExecSpace>(boxes,
+                                    numBoxes,
+                                    global_bounds,
+                                    radix_tree,
+                                    scaleFactor,
+                                    allocatorID);
+  }
+  else
+  {
+    lbvh::build_radix_tree<ExecSpace>(boxes,
+                                      numBoxes,
+                                      global_bounds,
+                                      radix_tree,
+                                      scaleFactor,
+                                      allocatorID);
+  }
+  m_bounds = global_bounds;
+
+  // STEP 2: collapse the binary radix tree into wide nodes
+  m_nodes = lbvh::collapse_radix_tree<ExecSpace, Width>(radix_tree,
+                                                        MAX_LEAF_SIZE,
+                                                        m_lane_nodes,
+                                                        allocatorID);
+  if(refittable)
+  {
+    m_build_cost = lbvh::compute_tree_cost<ExecSpace>(radix_tree, m_bounds);
+  }
+
+  // STEP 3: keep the sorted leaf data
+  m_leaf_aabbs = std::move(radix_tree.m_leaf_aabbs);
+  m_leaf_nodes = std::move(radix_tree.m_leafs);
+
+  // STEP 4: keep the hierarchy of the radix tree, so the BVH can be refitted
+  if(refittable)
+  {
+    radix_tree.clearBoxes();
+    m_radix_tree = std::move(radix_tree);
+  }
+  else
+  {
+    m_lane_nodes.clear();
+  }
+
+  m_initialized = true;
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace, int Width>
+template <typename BoxIndexable>
+double WideBVH<FloatType, NDIMS, ExecSpace, Width>::refitImpl(
+  const BoxIndexable boxes,
+  IndexType numBoxes,
+  FloatType scaleFactor,
+  int allocatorID)
+{
+  AXOM_ANNOTATE_SCOPE("WideBVH::refitImpl");
+
+  SLIC_ASSERT(m_initialized);
+  SLIC_ASSERT(numBoxes == m_radix_tree.m_size);
+
+  // STEP 1: update the boxes of the radix tree, bottom-up
+  lbvh::refit_radix_tree<ExecSpace>(boxes,
+                                    numBoxes,
+                                    m_leaf_nodes.view(),
+                                    m_bounds,
+                                    m_radix_tree,
+                                    scaleFactor,
+                                    allocatorID);
+
+  // STEP 2: copy the updated boxes to the lanes of the wide nodes
+  lbvh::refit_wide_nodes<ExecSpace>(m_radix_tree,
+                                    m_lane_nodes.view(),
+                                    m_nodes.view());
+
+  // STEP 3: evaluate the quality of the refitted tree
+  const double cost =
+    lbvh::compute_tree_cost<ExecSpace>(m_radix_tree, m_bounds);
+
+  m_leaf_aabbs = std::move(m_radix_tree.m_leaf_aabbs);
+  m_radix_tree.clearBoxes();
+
+  return (m_build_cost > 0.) ? cost / m_build_cost : 1.;
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace, int Width>
+template <typename PrimitiveType, typename Predicate, typename PrimitiveIndexable>
+axom::Array<IndexType>
+WideBVH<FloatType, NDIMS, ExecSpace, Width>::findCandidatesImpl(
+  Predicate&& predicate,
+  const axom::ArrayView<IndexType> offsets,
+  const axom::ArrayView<IndexType> counts,
+  IndexType numObjs,
+  PrimitiveIndexable objs,
+  IndexType bufferSize,
+  int allocatorID) const
+{
+  AXOM_ANNOTATE_SCOPE("WideBVH::findCandidatesImpl");
+
+  SLIC_ERROR_IF(offsets.size() != numObjs,
+                "offsets length not equal to numObjs");
+  SLIC_ERROR_IF(counts.size() != numObjs, "counts length not equal to numObjs");
+  SLIC_ASSERT(m_initialized);
+
+  if(bufferSize > 0)
+  {
+    return lbvh::find_candidates_single_pass<ExecSpace, PrimitiveType>(
+      getTraverserImpl(),
+      predicate,
+      offsets,
+      counts,
+      numObjs,
+      objs,
+      bufferSize,
+      allocatorID);
+  }
+
+  const auto nodes = m_nodes.view();
+  const auto leaf_aabbs = m_leaf_aabbs.view();
+  const auto leaf_nodes = m_leaf_nodes.view();
+
+  auto noTraversePriority = [] AXOM_HOST_DEVICE(const BoundingBoxType&,
+                                                const PrimitiveType&) {
+    return 0.;
+  };
+
+#if defined(AXOM_USE_RAJA)
+  // STEP 1: count number of candidates for each query point
+  using reduce_pol = typename axom::execution_space<ExecSpace>::reduce_policy;
+  RAJA::ReduceSum<reduce_pol, IndexType> total_count_reduce(0);
+
+  AXOM_ANNOTATE_BEGIN("PASS[1]:count_traversal");
+  for_all<ExecSpace>(
+    numObjs,
+    AXOM_LAMBDA(IndexType i) {
+      std::int32_t count = 0;
+      PrimitiveType primitive {objs[i]};
+
+      auto leafAction =
+        [&count](std::int32_t AXOM_UNUSED_PARAM(current_node),
+                 const std::int32_t* AXOM_UNUSED_PARAM(leaf_nodes)) { count++; };
+
+      lbvh::wide_bvh_traverse(nodes,
+                              leaf_aabbs,
+                              leaf_nodes,
+                              primitive,
+                              predicate,
+                              leafAction,
+                              noTraversePriority);
+
+      counts[i] = count;
+      total_count_reduce += count;
+    });
+  AXOM_ANNOTATE_END("PASS[1]:count_traversal");
+
+  // STEP 2: exclusive scan to get offsets in candidate array for each query
+  AXOM_ANNOTATE_BEGIN("exclusive_scan");
+    // Intel oneAPI compiler segfaults with OpenMP RAJA scan
+  #ifdef __INTEL_LLVM_COMPILER
+  using exec_policy = typename axom::execution_space<axom::SEQ_EXEC>::loop_policy;
+  #else
+  using exec_policy = typename axom::execution_space<ExecSpace>::loop_policy;
+  #endif
+  RAJA::exclusive_scan<exec_policy>(RAJA::make_span(counts.data(), numObjs),
+                                    RAJA::make_span(offsets.data(), numObjs),
+                                    RAJA::operators::plus<IndexType> {});
+  AXOM_ANNOTATE_END("exclusive_scan");
+  IndexType total_candidates = total_count_reduce.get();
+
+  // STEP 3: allocate memory for all candidates
+  AXOM_ANNOTATE_BEGIN("allocate_candidates");
+  auto candidates =
+    axom::Array<IndexType>(total_candidates, total_candidates, allocatorID);
+  AXOM_ANNOTATE_END("allocate_candidates");
+  const auto candidates_v = candidates.view();
+
+  // STEP 4: fill in candidates for each point
+  AXOM_ANNOTATE_BEGIN("PASS[2]:fill_traversal");
+  for_all<ExecSpace>(
+    numObjs,
+    AXOM_LAMBDA(IndexType i) {
+      std::int32_t offset = offsets[i];
+
+      PrimitiveType obj {objs[i]};
+      auto leafAction = [&offset, candidates_v](std::int32_t current_node,
+                                                const std::int32_t* leafs) {
+        candidates_v[offset] = leafs[current_node];
+        offset++;
+      };
+
+      lbvh::wide_bvh_traverse(nodes,
+                              leaf_aabbs,
+                              leaf_nodes,
+                              obj,
+                              predicate,
+                              leafAction,
+                              noTraversePriority);
+    });
+  AXOM_ANNOTATE_END("PASS[2]:fill_traversal");
+
+  return candidates;
+#else  // CPU-only and no RAJA: do single traversal
+  AXOM_UNUSED_VAR(allocatorID);
+
+  axom::Array<IndexType> search_candidates;
+  int current_offset = 0;
+
+  // STEP 1: do single-pass traversal with std::vector for candidates
+  AXOM_ANNOTATE_BEGIN("PASS[1]:fill_traversal");
+  for_all<ExecSpace>(numObjs, [&](IndexType i) {
+    int matching_leaves = 0;
+    PrimitiveType obj {objs[i]};
+    offsets[i] = current_offset;
+
+    auto leafAction = [&](std::int32_t current_node, const std::int32_t* leafs) {
+      search_candidates.emplace_back(leafs[current_node]);
+      matching_leaves++;
+      current_offset++;
+    };
+
+    lbvh::wide_bvh_traverse(nodes,
+                            leaf_aabbs,
+                            leaf_nodes,
+                            obj,
+                            predicate,
+                            leafAction,
+                            noTraversePriority);
+    counts[i] = matching_leaves;
+  });
+  AXOM_ANNOTATE_END("PASS[1]:fill_traversal");
+
+  SLIC_ASSERT(current_offset == static_cast<IndexType>(search_candidates.size()));
+
+  return search_candidates;
+#endif
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace, int Width>
+void WideBVH<FloatType, NDIMS, ExecSpace, Width>::writeVtkFileImpl(
+  const std::string& fileName) const
+{
+  std::ostringstream nodes;
+  std::ostringstream cells;
+  std::ostringstream levels;
+
+  // STEP 0: Write VTK header
+  std::ofstream ofs;
+  ofs.open(fileName.c_str());
+  ofs << "# vtk DataFile Version 3.0\n";
+  ofs << " BVHTree \n";
+  ofs << "ASCII\n";
+  ofs << "DATASET UNSTRUCTURED_GRID\n";
+
+  // STEP 1: write root
+  std::int32_t numPoints = 0;
+  std::int32_t numBins = 0;
+  lbvh::write_root(m_bounds, numPoints, numBins, nodes, cells, levels);
+
+  // STEP 2: traverse the BVH and dump each bin
+  constexpr std::int32_t ROOT = 0;
+  lbvh::write_recursive<FloatType, NDIMS, Width>(m_nodes.view(),
+                                                 ROOT,
+                                                 1,
+                                                 numPoints,
+                                                 numBins,
+                                                 nodes,
+                                                 cells,
+                                                 levels);
+
+  // STEP 3: write nodes
+  ofs << "POINTS " << numPoints << " double\n";
+  ofs << nodes.str() << std::endl;
+
+  // STEP 4: write cells
+  const std::int32_t nnodes = (NDIMS == 2) ? 4 : 8;
+  ofs << "CELLS " << numBins << " " << numBins * (nnodes + 1) << std::endl;
+  ofs << cells.str() << std::endl;
+
+  // STEP 5: write cell types
+  ofs << "CELL_TYPES " << numBins << std::endl;
+  const std::int32_t cellType = (NDIMS == 2) ? 9 : 12;
+  for(std::int32_t i = 0; i < numBins; ++i)
+  {
+    ofs << cellType << std::endl;
+  }
+
+  // STEP 6: dump level information
+  ofs << "CELL_DATA " << numBins << std::endl;
+  ofs << "SCALARS level int\n";
+  ofs << "LOOKUP_TABLE default\n";
+  ofs << levels.str() << std::endl;
+  ofs << std::endl;
+
+  // STEP 7: close file
+  ofs.close();
+}
+
+}  // namespace policy
+}  // namespace spin
+}  // namespace axom
+#endif  // AXOM_SPIN_POLICY_WIDEBVH_HPP_
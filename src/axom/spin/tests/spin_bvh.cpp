@@ -15,6 +15,15 @@
 // gtest includes
 #include "gtest/gtest.h"
 
+// C/C++ includes
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <utility>
+#include <vector>
+
 // Uncomment the following for debugging
 //#define VTK_DEBUG
 
@@ -1640,231 +1649,1578 @@ void check_0_or_1_bbox_2d()
   bvh_compute_point_distances_2d(bvh2, src_pts, query_pts, true);
 }
 
-} /* end unnamed namespace */
-
-//------------------------------------------------------------------------------
-// UNIT TESTS
 //------------------------------------------------------------------------------
-TEST(spin_bvh, construct2D_sequential)
+/*!
+ * \brief Copies the candidates returned by a BVH query to the host and sorts
+ *  the candidates of each query, so that the results of different BVH
+ *  implementations can be compared.
+ */
+std::vector<std::vector<IndexType>> sorted_candidates(
+  const axom::Array<IndexType>& offsets_device,
+  const axom::Array<IndexType>& counts_device,
+  const axom::Array<IndexType>& candidates_device)
 {
-  check_build_bvh2d<axom::SEQ_EXEC, double>();
-  check_build_bvh2d<axom::SEQ_EXEC, float>();
-}
+  const int hostAllocatorID =
+    axom::execution_space<axom::SEQ_EXEC>::allocatorID();
+  axom::Array<IndexType> offsets(offsets_device, hostAllocatorID);
+  axom::Array<IndexType> counts(counts_device, hostAllocatorID);
+  axom::Array<IndexType> candidates(candidates_device, hostAllocatorID);
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, construct3D_sequential)
-{
-  check_build_bvh3d<axom::SEQ_EXEC, double>();
-  check_build_bvh3d<axom::SEQ_EXEC, float>();
+  std::vector<std::vector<IndexType>> result(offsets.size());
+  for(IndexType i = 0; i < offsets.size(); ++i)
+  {
+    result[i].assign(candidates.begin() + offsets[i],
+                     candidates.begin() + offsets[i] + counts[i]);
+    std::sort(result[i].begin(), result[i].end());
+  }
+  return result;
 }
 
 //------------------------------------------------------------------------------
-TEST(spin_bvh, find_bounding_boxes_3d_sequential)
+/*!
+ * \brief Computes the distance from each query point to the closest box in
+ *  the BVH, using the BVH traverser with a pruning predicate.
+ */
+template <typename BVHType, typename PointType>
+axom::Array<double> closest_box_distances(
+  const BVHType& bvh,
+  const axom::Array<PointType>& box_centers_host,
+  const axom::Array<PointType>& qpts_host)
 {
-  check_find_bounding_boxes3d<axom::SEQ_EXEC, double>();
-  check_find_bounding_boxes3d<axom::SEQ_EXEC, float>();
-}
+  using ExecSpace = typename BVHType::ExecSpaceType;
+  using BoxType = typename BVHType::BoxType;
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, find_bounding_boxes_2d_sequential)
-{
-  check_find_bounding_boxes2d<axom::SEQ_EXEC, double>();
-  check_find_bounding_boxes2d<axom::SEQ_EXEC, float>();
-}
+  const int hostAllocatorID =
+    axom::execution_space<axom::SEQ_EXEC>::allocatorID();
+  const int deviceAllocatorID = axom::execution_space<ExecSpace>::allocatorID();
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, find_rays_3d_sequential)
-{
-  check_find_rays3d<axom::SEQ_EXEC, double>();
-  check_find_rays3d<axom::SEQ_EXEC, float>();
-}
+  const IndexType npts = qpts_host.size();
+  axom::Array<PointType> box_centers(box_centers_host, deviceAllocatorID);
+  axom::Array<PointType> qpts(qpts_host, deviceAllocatorID);
+  axom::Array<double> dists(npts, npts, deviceAllocatorID);
+  const auto box_centers_view = box_centers.view();
+  const auto qpts_view = qpts.view();
+  const auto dists_view = dists.view();
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, find_rays_2d_sequential)
-{
-  check_find_rays2d<axom::SEQ_EXEC, double>();
-  check_find_rays2d<axom::SEQ_EXEC, float>();
-}
+  auto it = bvh.getTraverser();
+  axom::for_all<ExecSpace>(
+    npts,
+    AXOM_LAMBDA(IndexType idx) {
+      const PointType qpt = qpts_view[idx];
+      double min_sq_dist = numerics::floating_point_limits<double>::max();
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, find_points_3d_sequential)
-{
-  check_find_points3d<axom::SEQ_EXEC, double>();
-  check_find_points3d<axom::SEQ_EXEC, float>();
-}
+      auto checkMinDist = [&](std::int32_t current_node,
+                              const std::int32_t* leaf_nodes) {
+        const PointType& c = box_centers_view[leaf_nodes[current_node]];
+        const double sq_dist = primal::squared_distance(qpt, c);
+        min_sq_dist = sq_dist < min_sq_dist ? sq_dist : min_sq_dist;
+      };
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, find_points_2d_sequential)
-{
-  check_find_points2d<axom::SEQ_EXEC, double>();
-  check_find_points2d<axom::SEQ_EXEC, float>();
-}
+      auto traversePredicate = [&](const PointType& p, const BoxType& bb) {
+        return primal::squared_distance(p, bb) <= min_sq_dist;
+      };
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, single_box2d_sequential)
-{
-  check_single_box2d<axom::SEQ_EXEC, double>();
-  check_single_box2d<axom::SEQ_EXEC, float>();
-}
+      it.traverse_tree(qpt, checkMinDist, traversePredicate);
+      dists_view[idx] = min_sq_dist;
+    });
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, single_box3d_sequential)
-{
-  check_single_box3d<axom::SEQ_EXEC, double>();
-  check_single_box3d<axom::SEQ_EXEC, float>();
+  return axom::Array<double>(dists, hostAllocatorID);
 }
 
 //------------------------------------------------------------------------------
-TEST(spin_bvh, construct3D_sequential_zip)
+/*!
+ * \brief Tests a BVH variant, i.e., a BVH implementation and build method, by
+ *  checking that its queries return the same candidates as the ones of the
+ *  default BVH over a set of random boxes.
+ */
+template <typename ExecSpace,
+          typename FloatType,
+          int NDIMS,
+          spin::BVHType BVHImpl>
+void check_bvh_variant(spin::BVHBuildMethod method)
 {
-  check_build_bvh_zip3d<axom::SEQ_EXEC, double>();
-  check_build_bvh_zip3d<axom::SEQ_EXEC, float>();
-}
+  constexpr IndexType NUM_BOXES = 2000;
+  constexpr IndexType NUM_QUERIES = 500;
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, find_points_2d_sequential_zip)
-{
-  check_find_points_zip2d<axom::SEQ_EXEC, double>();
-  check_find_points_zip2d<axom::SEQ_EXEC, float>();
-}
+  using BoxType = typename primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = typename primal::Point<FloatType, NDIMS>;
+  using VectorType = typename primal::Vector<FloatType, NDIMS>;
+  using RayType = typename primal::Ray<FloatType, NDIMS>;
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, find_points_3d_sequential_zip)
-{
-  check_find_points_zip3d<axom::SEQ_EXEC, double>();
-  check_find_points_zip3d<axom::SEQ_EXEC, float>();
-}
+  const int hostAllocatorID =
+    axom::execution_space<axom::SEQ_EXEC>::allocatorID();
+  const int deviceAllocatorID = axom::execution_space<ExecSpace>::allocatorID();
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, single_bbox_sequential)
-{
-  check_0_or_1_bbox_2d<axom::SEQ_EXEC, double>();
-  check_0_or_1_bbox_2d<axom::SEQ_EXEC, float>();
-}
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<FloatType> coord(0., 10.);
+  std::uniform_real_distribution<FloatType> extent(0., 0.5);
+  std::uniform_real_distribution<FloatType> dir(-1., 1.);
 
-//------------------------------------------------------------------------------
-#if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
+  auto random_point = [&]() {
+    PointType pt;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      pt[d] = coord(gen);
+    }
+    return pt;
+  };
 
-TEST(spin_bvh, construct2D_omp)
-{
-  check_build_bvh2d<axom::OMP_EXEC, double>();
-  check_build_bvh2d<axom::OMP_EXEC, float>();
-}
+  // generate random, possibly overlapping, boxes and queries
+  axom::Array<BoxType> boxes(NUM_BOXES, NUM_BOXES, hostAllocatorID);
+  axom::Array<PointType> centers(NUM_BOXES, NUM_BOXES, hostAllocatorID);
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    const PointType pt = random_point();
+    boxes[i] = BoxType {pt};
+    boxes[i].expand(extent(gen));
+    centers[i] = boxes[i].getCentroid();
+  }
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, construct3D_omp)
-{
-  check_build_bvh3d<axom::OMP_EXEC, double>();
-  check_build_bvh3d<axom::OMP_EXEC, float>();
-}
+  axom::Array<PointType> qpts(NUM_QUERIES, NUM_QUERIES, hostAllocatorID);
+  axom::Array<BoxType> qboxes(NUM_QUERIES, NUM_QUERIES, hostAllocatorID);
+  axom::Array<RayType> qrays(NUM_QUERIES, NUM_QUERIES, hostAllocatorID);
+  for(IndexType i = 0; i < NUM_QUERIES; ++i)
+  {
+    qpts[i] = random_point();
+    qboxes[i] = BoxType {random_point()};
+    qboxes[i].expand(extent(gen));
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, find_bounding_boxes_3d_omp)
-{
-  check_find_bounding_boxes3d<axom::OMP_EXEC, double>();
-  check_find_bounding_boxes3d<axom::OMP_EXEC, float>();
-}
+    VectorType direction;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      direction[d] = dir(gen);
+    }
+    // every fourth ray is axis-aligned
+    if(i % 4 == 0)
+    {
+      direction = VectorType {};
+      direction[i % NDIMS] = 1.;
+    }
+    qrays[i] = RayType {random_point(), direction};
+  }
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, find_bounding_boxes_2d_omp)
-{
-  check_find_bounding_boxes2d<axom::OMP_EXEC, double>();
-  check_find_bounding_boxes2d<axom::OMP_EXEC, float>();
-}
+  axom::Array<BoxType> boxes_device(boxes, deviceAllocatorID);
+  axom::Array<PointType> qpts_device(qpts, deviceAllocatorID);
+  axom::Array<BoxType> qboxes_device(qboxes, deviceAllocatorID);
+  axom::Array<RayType> qrays_device(qrays, deviceAllocatorID);
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, find_rays_3d_omp)
-{
-  check_find_rays3d<axom::OMP_EXEC, double>();
-  check_find_rays3d<axom::OMP_EXEC, float>();
-}
+  spin::BVH<NDIMS, ExecSpace, FloatType> bvh;
+  bvh.initialize(boxes_device.view(), NUM_BOXES);
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, find_rays_2d_omp)
-{
-  check_find_rays2d<axom::OMP_EXEC, double>();
-  check_find_rays2d<axom::OMP_EXEC, float>();
-}
+  spin::BVH<NDIMS, ExecSpace, FloatType, BVHImpl> variant_bvh;
+  variant_bvh.setBuildMethod(method);
+  EXPECT_EQ(method, variant_bvh.getBuildMethod());
+  variant_bvh.initialize(boxes_device.view(), NUM_BOXES);
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, find_points_3d_omp)
-{
-  check_find_points3d<axom::OMP_EXEC, double>();
-  check_find_points3d<axom::OMP_EXEC, float>();
-}
+  // check BVH bounding box
+  const BoxType bounds = bvh.getBounds();
+  const BoxType variant_bounds = variant_bvh.getBounds();
+  for(int idim = 0; idim < NDIMS; ++idim)
+  {
+    EXPECT_NEAR(bounds.getMin()[idim], variant_bounds.getMin()[idim], EPS);
+    EXPECT_NEAR(bounds.getMax()[idim], variant_bounds.getMax()[idim], EPS);
+  }
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, find_points_2d_omp)
-{
-  check_find_points2d<axom::OMP_EXEC, double>();
-  check_find_points2d<axom::OMP_EXEC, float>();
+  axom::Array<IndexType> offsets(NUM_QUERIES, NUM_QUERIES, deviceAllocatorID);
+  axom::Array<IndexType> counts(NUM_QUERIES, NUM_QUERIES, deviceAllocatorID);
+  axom::Array<IndexType> candidates(0, 0, deviceAllocatorID);
+
+  axom::Array<IndexType> variant_offsets(NUM_QUERIES,
+                                         NUM_QUERIES,
+                                         deviceAllocatorID);
+  axom::Array<IndexType> variant_counts(NUM_QUERIES,
+                                        NUM_QUERIES,
+                                        deviceAllocatorID);
+  axom::Array<IndexType> variant_candidates(0, 0, deviceAllocatorID);
+
+  // check point queries
+  bvh.findPoints(offsets, counts, candidates, NUM_QUERIES, qpts_device.view());
+  variant_bvh.findPoints(variant_offsets,
+                         variant_counts,
+                         variant_candidates,
+                         NUM_QUERIES,
+                         qpts_device.view());
+  EXPECT_EQ(sorted_candidates(offsets, counts, candidates),
+            sorted_candidates(variant_offsets,
+                              variant_counts,
+                              variant_candidates));
+
+  // check bounding box queries
+  bvh.findBoundingBoxes(offsets,
+                        counts,
+                        candidates,
+                        NUM_QUERIES,
+                        qboxes_device.view());
+  variant_bvh.findBoundingBoxes(variant_offsets,
+                                variant_counts,
+                                variant_candidates,
+                                NUM_QUERIES,
+                                qboxes_device.view());
+  EXPECT_GT(candidates.size(), 0);
+  EXPECT_EQ(sorted_candidates(offsets, counts, candidates),
+            sorted_candidates(variant_offsets,
+                              variant_counts,
+                              variant_candidates));
+
+  // check ray queries
+  bvh.findRays(offsets, counts, candidates, NUM_QUERIES, qrays_device.view());
+  variant_bvh.findRays(variant_offsets,
+                       variant_counts,
+                       variant_candidates,
+                       NUM_QUERIES,
+                       qrays_device.view());
+  EXPECT_GT(candidates.size(), 0);
+  EXPECT_EQ(sorted_candidates(offsets, counts, candidates),
+            sorted_candidates(variant_offsets,
+                              variant_counts,
+                              variant_candidates));
+
+  // check traversal with a user-supplied predicate
+  axom::Array<double> dists = closest_box_distances(bvh, centers, qpts);
+  axom::Array<double> variant_dists =
+    closest_box_distances(variant_bvh, centers, qpts);
+  for(IndexType i = 0; i < NUM_QUERIES; ++i)
+  {
+    EXPECT_DOUBLE_EQ(dists[i], variant_dists[i]);
+  }
 }
 
 //------------------------------------------------------------------------------
-TEST(spin_bvh, single_box2d_omp)
+/*!
+ * \brief Tests BVH::refit() by moving a set of random boxes and checking that
+ *  the refitted BVH returns the same candidates as a BVH built from scratch
+ *  over the moved boxes.
+ */
+template <typename ExecSpace,
+          typename FloatType,
+          int NDIMS,
+          spin::BVHType BVHImpl>
+void check_bvh_refit(spin::BVHBuildMethod method)
 {
-  check_single_box2d<axom::OMP_EXEC, double>();
-  check_single_box2d<axom::OMP_EXEC, float>();
-}
+  constexpr IndexType NUM_BOXES = 2000;
+  constexpr IndexType NUM_QUERIES = 500;
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, single_box3d_omp)
-{
-  check_single_box3d<axom::OMP_EXEC, double>();
-}
+  using BoxType = typename primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = typename primal::Point<FloatType, NDIMS>;
+  using VectorType = typename primal::Vector<FloatType, NDIMS>;
+  using BVHType = spin::BVH<NDIMS, ExecSpace, FloatType, BVHImpl>;
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, single_bbox_omp)
-{
-  check_0_or_1_bbox_2d<axom::OMP_EXEC, double>();
-  check_0_or_1_bbox_2d<axom::OMP_EXEC, float>();
-}
+  const int hostAllocatorID =
+    axom::execution_space<axom::SEQ_EXEC>::allocatorID();
+  const int deviceAllocatorID = axom::execution_space<ExecSpace>::allocatorID();
 
-#endif
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<FloatType> coord(0., 10.);
+  std::uniform_real_distribution<FloatType> extent(0., 0.5);
 
-//------------------------------------------------------------------------------
-#if defined(AXOM_USE_GPU) && defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
+  auto random_point = [&]() {
+    PointType pt;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      pt[d] = coord(gen);
+    }
+    return pt;
+  };
 
-TEST(spin_bvh, construct2D_device)
-{
-  constexpr int BLOCK_SIZE = 256;
+  axom::Array<BoxType> boxes(NUM_BOXES, NUM_BOXES, hostAllocatorID);
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    boxes[i] = BoxType {random_point()};
+    boxes[i].expand(extent(gen));
+  }
 
-  #if defined(__CUDACC__)
-  using exec = axom::CUDA_EXEC<BLOCK_SIZE>;
-  #elif defined(__HIPCC__)
-  using exec = axom::HIP_EXEC<BLOCK_SIZE>;
-  #else
-  using exec = axom::SEQ_EXEC;
-  #endif
+  axom::Array<BoxType> qboxes(NUM_QUERIES, NUM_QUERIES, hostAllocatorID);
+  for(IndexType i = 0; i < NUM_QUERIES; ++i)
+  {
+    qboxes[i] = BoxType {random_point()};
+    qboxes[i].expand(extent(gen));
+  }
+  axom::Array<BoxType> qboxes_device(qboxes, deviceAllocatorID);
+
+  axom::Array<IndexType> offsets(NUM_QUERIES, NUM_QUERIES, deviceAllocatorID);
+  axom::Array<IndexType> counts(NUM_QUERIES, NUM_QUERIES, deviceAllocatorID);
+  axom::Array<IndexType> candidates(0, 0, deviceAllocatorID);
+
+  // queries the given BVH and a BVH built from scratch over the same boxes
+  auto check_candidates = [&](const BVHType& bvh,
+                              const axom::Array<BoxType>& boxes_device) {
+    BVHType fresh_bvh;
+    fresh_bvh.setBuildMethod(method);
+    fresh_bvh.initialize(boxes_device.view(), NUM_BOXES);
+
+    const BoxType bounds = bvh.getBounds();
+    const BoxType fresh_bounds = fresh_bvh.getBounds();
+    for(int idim = 0; idim < NDIMS; ++idim)
+    {
+      EXPECT_NEAR(bounds.getMin()[idim], fresh_bounds.getMin()[idim], EPS);
+      EXPECT_NEAR(bounds.getMax()[idim], fresh_bounds.getMax()[idim], EPS);
+    }
 
-  check_build_bvh2d<exec, double>();
-  check_build_bvh2d<exec, float>();
-}
+    bvh.findBoundingBoxes(offsets,
+                          counts,
+                          candidates,
+                          NUM_QUERIES,
+                          qboxes_device.view());
+    const auto result = sorted_candidates(offsets, counts, candidates);
+    EXPECT_GT(candidates.size(), 0);
+
+    fresh_bvh.findBoundingBoxes(offsets,
+                                counts,
+                                candidates,
+                                NUM_QUERIES,
+                                qboxes_device.view());
+    EXPECT_EQ(result, sorted_candidates(offsets, counts, candidates));
+  };
 
-//------------------------------------------------------------------------------
-TEST(spin_bvh, construct3D_device)
-{
-  constexpr int BLOCK_SIZE = 256;
+  axom::Array<BoxType> boxes_device(boxes, deviceAllocatorID);
 
-  #if defined(__CUDACC__)
-  using exec = axom::CUDA_EXEC<BLOCK_SIZE>;
-  #elif defined(__HIPCC__)
-  using exec = axom::HIP_EXEC<BLOCK_SIZE>;
-  #else
-  using exec = axom::SEQ_EXEC;
-  #endif
+  BVHType bvh;
+  EXPECT_FALSE(bvh.isRefittable());
+  bvh.setRefittable(true);
+  EXPECT_TRUE(bvh.isRefittable());
+  bvh.setBuildMethod(method);
+  bvh.setRebuildThreshold(0.);
+  bvh.initialize(boxes_device.view(), NUM_BOXES);
+  EXPECT_DOUBLE_EQ(1., bvh.getRefitQuality());
 
-  check_build_bvh3d<exec, double>();
-  check_build_bvh3d<exec, float>();
+  // STEP 1: translating all boxes preserves the quality of the tree
+  VectorType shift;
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    shift[d] = 0.5 * (d + 1);
+  }
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    boxes[i].shift(shift);
+  }
+  boxes_device = axom::Array<BoxType>(boxes, deviceAllocatorID);
+
+  EXPECT_EQ(spin::BVH_BUILD_OK, bvh.refit(boxes_device.view(), NUM_BOXES));
+  EXPECT_NEAR(1., bvh.getRefitQuality(), 1e-3);
+  check_candidates(bvh, boxes_device);
+
+  // STEP 2: scrambling the boxes degrades the quality of the refitted tree,
+  // but the queries are still correct
+  std::shuffle(boxes.begin(), boxes.end(), gen);
+  boxes_device = axom::Array<BoxType>(boxes, deviceAllocatorID);
+
+  EXPECT_EQ(spin::BVH_BUILD_OK, bvh.refit(boxes_device.view(), NUM_BOXES));
+  const double quality = bvh.getRefitQuality();
+  EXPECT_GT(quality, 2.);
+  check_candidates(bvh, boxes_device);
+
+  // a BVH that does not keep its hierarchy is rebuilt instead
+  BVHType rebuilt;
+  rebuilt.setBuildMethod(method);
+  rebuilt.setRebuildThreshold(0.);
+  rebuilt.initialize(boxes_device.view(), NUM_BOXES);
+  std::shuffle(boxes.begin(), boxes.end(), gen);
+  boxes_device = axom::Array<BoxType>(boxes, deviceAllocatorID);
+
+  EXPECT_EQ(spin::BVH_BUILD_OK, rebuilt.refit(boxes_device.view(), NUM_BOXES));
+  EXPECT_DOUBLE_EQ(1., rebuilt.getRefitQuality());
+  check_candidates(rebuilt, boxes_device);
+
+  // STEP 3: with a rebuild threshold, the degraded tree is rebuilt
+  bvh.setRebuildThreshold(quality / 2.);
+  std::shuffle(boxes.begin(), boxes.end(), gen);
+  boxes_device = axom::Array<BoxType>(boxes, deviceAllocatorID);
+
+  EXPECT_EQ(spin::BVH_BUILD_OK, bvh.refit(boxes_device.view(), NUM_BOXES));
+  EXPECT_DOUBLE_EQ(1., bvh.getRefitQuality());
+  check_candidates(bvh, boxes_device);
+
+  // STEP 4: a different number of boxes triggers a full build
+  boxes_device.resize(NUM_BOXES / 2);
+  EXPECT_EQ(spin::BVH_BUILD_OK, bvh.refit(boxes_device.view(), NUM_BOXES / 2));
+  EXPECT_DOUBLE_EQ(1., bvh.getRefitQuality());
 }
 
 //------------------------------------------------------------------------------
-TEST(spin_bvh, find_bounding_boxes_3d_device)
+/*!
+ * \brief Tests the k-nearest neighbor and radius queries of a BVH against a
+ *  brute-force search over a set of random boxes.
+ */
+template <typename ExecSpace,
+          typename FloatType,
+          int NDIMS,
+          spin::BVHType BVHImpl>
+void check_bvh_nearest()
 {
-  constexpr int BLOCK_SIZE = 256;
+  constexpr IndexType NUM_BOXES = 2000;
+  constexpr IndexType NUM_QUERIES = 200;
+  constexpr IndexType INVALID_STRIDE = 97;
 
-  #if defined(__CUDACC__)
-  using exec = axom::CUDA_EXEC<BLOCK_SIZE>;
+  using BoxType = typename primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = typename primal::Point<FloatType, NDIMS>;
+
+  const int hostAllocatorID =
+    axom::execution_space<axom::SEQ_EXEC>::allocatorID();
+  const int deviceAllocatorID = axom::execution_space<ExecSpace>::allocatorID();
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<FloatType> coord(0., 10.);
+  std::uniform_real_distribution<FloatType> extent(0., 0.5);
+
+  auto random_point = [&]() {
+    PointType pt;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      pt[d] = coord(gen);
+    }
+    return pt;
+  };
+
+  // generate random boxes, a few of which are invalid
+  axom::Array<BoxType> boxes(NUM_BOXES, NUM_BOXES, hostAllocatorID);
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    boxes[i] = BoxType {random_point()};
+    boxes[i].expand(extent(gen));
+    if(i % INVALID_STRIDE == 0)
+    {
+      boxes[i].clear();
+    }
+  }
+
+  axom::Array<PointType> qpts(NUM_QUERIES, NUM_QUERIES, hostAllocatorID);
+  for(IndexType i = 0; i < NUM_QUERIES; ++i)
+  {
+    qpts[i] = random_point();
+  }
+
+  axom::Array<BoxType> boxes_device(boxes, deviceAllocatorID);
+  axom::Array<PointType> qpts_device(qpts, deviceAllocatorID);
+
+  spin::BVH<NDIMS, ExecSpace, FloatType, BVHImpl> bvh;
+  bvh.initialize(boxes_device.view(), NUM_BOXES);
+
+  // brute-force distances, to the boxes as they are stored in the BVH
+  std::vector<std::vector<std::pair<double, IndexType>>> sorted_dists(
+    NUM_QUERIES);
+  for(IndexType i = 0; i < NUM_QUERIES; ++i)
+  {
+    for(IndexType j = 0; j < NUM_BOXES; ++j)
+    {
+      BoxType box = boxes[j];
+      if(box.isValid())
+      {
+        box.scale(bvh.getScaleFactor());
+        sorted_dists[i].emplace_back(primal::squared_distance(qpts[i], box), j);
+      }
+    }
+    std::sort(sorted_dists[i].begin(), sorted_dists[i].end());
+  }
+  const IndexType num_valid = sorted_dists[0].size();
+
+  axom::Array<IndexType> offsets(NUM_QUERIES, NUM_QUERIES, deviceAllocatorID);
+  axom::Array<IndexType> counts(NUM_QUERIES, NUM_QUERIES, deviceAllocatorID);
+  axom::Array<IndexType> candidates(0, 0, deviceAllocatorID);
+
+  // check k-nearest neighbor queries, including k larger than the BVH
+  for(IndexType k :
+      {IndexType {0}, IndexType {1}, IndexType {8}, NUM_BOXES + 1})
+  {
+    bvh.findKNearest(offsets,
+                     counts,
+                     candidates,
+                     NUM_QUERIES,
+                     qpts_device.view(),
+                     k);
+
+    const IndexType expected_count = std::min(k, num_valid);
+    EXPECT_EQ(NUM_QUERIES * expected_count, candidates.size());
+
+    axom::Array<IndexType> offsets_h(offsets, hostAllocatorID);
+    axom::Array<IndexType> counts_h(counts, hostAllocatorID);
+    axom::Array<IndexType> candidates_h(candidates, hostAllocatorID);
+    for(IndexType i = 0; i < NUM_QUERIES; ++i)
+    {
+      ASSERT_EQ(expected_count, counts_h[i]);
+      for(IndexType j = 0; j < expected_count; ++j)
+      {
+        EXPECT_EQ(sorted_dists[i][j].second, candidates_h[offsets_h[i] + j]);
+      }
+    }
+  }
+
+  // check radius queries
+  for(FloatType radius : {0., 0.25, 1.})
+  {
+    bvh.findWithinRadius(offsets,
+                         counts,
+                         candidates,
+                         NUM_QUERIES,
+                         qpts_device.view(),
+                         radius);
+
+    const double sq_radius = static_cast<double>(radius) * radius;
+    std::vector<std::vector<IndexType>> expected(NUM_QUERIES);
+    for(IndexType i = 0; i < NUM_QUERIES; ++i)
+    {
+      for(const auto& dist : sorted_dists[i])
+      {
+        if(dist.first <= sq_radius)
+        {
+          expected[i].push_back(dist.second);
+        }
+      }
+      std::sort(expected[i].begin(), expected[i].end());
+    }
+    EXPECT_EQ(expected, sorted_candidates(offsets, counts, candidates));
+  }
+}
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Checks that the single-pass candidate search returns the same
+ *  candidates as the two-pass search, for buffer sizes that make none, some
+ *  or all of the queries overflow their buffer.
+ */
+template <typename ExecSpace,
+          typename FloatType,
+          int NDIMS,
+          spin::BVHType BVHImpl>
+void check_single_pass()
+{
+  constexpr IndexType NUM_BOXES = 2000;
+  constexpr IndexType NUM_QUERIES = 500;
+
+  using BoxType = typename primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = typename primal::Point<FloatType, NDIMS>;
+  using VectorType = typename primal::Vector<FloatType, NDIMS>;
+  using RayType = typename primal::Ray<FloatType, NDIMS>;
+
+  const int hostAllocatorID =
+    axom::execution_space<axom::SEQ_EXEC>::allocatorID();
+  const int deviceAllocatorID = axom::execution_space<ExecSpace>::allocatorID();
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<FloatType> coord(0., 10.);
+  std::uniform_real_distribution<FloatType> extent(0., 1.);
+  std::uniform_real_distribution<FloatType> dir(-1., 1.);
+
+  auto random_point = [&]() {
+    PointType pt;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      pt[d] = coord(gen);
+    }
+    return pt;
+  };
+
+  axom::Array<BoxType> boxes(NUM_BOXES, NUM_BOXES, hostAllocatorID);
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    boxes[i] = BoxType {random_point()};
+    boxes[i].expand(extent(gen));
+  }
+
+  axom::Array<BoxType> qboxes(NUM_QUERIES, NUM_QUERIES, hostAllocatorID);
+  axom::Array<RayType> qrays(NUM_QUERIES, NUM_QUERIES, hostAllocatorID);
+  for(IndexType i = 0; i < NUM_QUERIES; ++i)
+  {
+    qboxes[i] = BoxType {random_point()};
+    qboxes[i].expand(extent(gen));
+
+    VectorType direction;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      direction[d] = dir(gen);
+    }
+    qrays[i] = RayType {random_point(), direction};
+  }
+
+  axom::Array<BoxType> boxes_device(boxes, deviceAllocatorID);
+  axom::Array<BoxType> qboxes_device(qboxes, deviceAllocatorID);
+  axom::Array<RayType> qrays_device(qrays, deviceAllocatorID);
+
+  spin::BVH<NDIMS, ExecSpace, FloatType, BVHImpl> bvh;
+  EXPECT_EQ(0, bvh.getCandidateBufferSize());
+  bvh.initialize(boxes_device.view(), NUM_BOXES);
+
+  axom::Array<IndexType> offsets(NUM_QUERIES, NUM_QUERIES, deviceAllocatorID);
+  axom::Array<IndexType> counts(NUM_QUERIES, NUM_QUERIES, deviceAllocatorID);
+  axom::Array<IndexType> candidates(0, 0, deviceAllocatorID);
+
+  bvh.findBoundingBoxes(offsets,
+                        counts,
+                        candidates,
+                        NUM_QUERIES,
+                        qboxes_device.view());
+  const auto expected_boxes = sorted_candidates(offsets, counts, candidates);
+
+  bvh.findRays(offsets, counts, candidates, NUM_QUERIES, qrays_device.view());
+  const auto expected_rays = sorted_candidates(offsets, counts, candidates);
+
+  for(IndexType bufferSize : {IndexType {1}, IndexType {4}, NUM_BOXES})
+  {
+    bvh.setCandidateBufferSize(bufferSize);
+    EXPECT_EQ(bufferSize, bvh.getCandidateBufferSize());
+
+    bvh.findBoundingBoxes(offsets,
+                          counts,
+                          candidates,
+                          NUM_QUERIES,
+                          qboxes_device.view());
+    EXPECT_EQ(expected_boxes, sorted_candidates(offsets, counts, candidates));
+
+    bvh.findRays(offsets, counts, candidates, NUM_QUERIES, qrays_device.view());
+    EXPECT_EQ(expected_rays, sorted_candidates(offsets, counts, candidates));
+  }
+}
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Checks that a BVH written with save() and read back with load(),
+ *  with and without memory mapping, or serialized to a buffer and attached,
+ *  returns the same candidates as the original BVH.
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS>
+void check_save_load()
+{
+  constexpr IndexType NUM_BOXES = 1000;
+  constexpr IndexType NUM_QUERIES = 200;
+  constexpr IndexType K = 5;
+
+  using BVHType = spin::BVH<NDIMS, ExecSpace, FloatType>;
+  using BoxType = typename primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = typename primal::Point<FloatType, NDIMS>;
+
+  const std::string fileName = "spin_bvh_" + std::to_string(NDIMS) + "d.bvh";
+
+  const int hostAllocatorID =
+    axom::execution_space<axom::SEQ_EXEC>::allocatorID();
+  const int deviceAllocatorID = axom::execution_space<ExecSpace>::allocatorID();
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<FloatType> coord(0., 10.);
+  std::uniform_real_distribution<FloatType> extent(0., 1.);
+
+  auto random_point = [&]() {
+    PointType pt;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      pt[d] = coord(gen);
+    }
+    return pt;
+  };
+
+  axom::Array<BoxType> boxes(NUM_BOXES, NUM_BOXES, hostAllocatorID);
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    boxes[i] = BoxType {random_point()};
+    boxes[i].expand(extent(gen));
+  }
+
+  axom::Array<BoxType> qboxes(NUM_QUERIES, NUM_QUERIES, hostAllocatorID);
+  axom::Array<PointType> qpoints(NUM_QUERIES, NUM_QUERIES, hostAllocatorID);
+  for(IndexType i = 0; i < NUM_QUERIES; ++i)
+  {
+    qboxes[i] = BoxType {random_point()};
+    qboxes[i].expand(extent(gen));
+    qpoints[i] = random_point();
+  }
+
+  axom::Array<BoxType> boxes_device(boxes, deviceAllocatorID);
+  axom::Array<BoxType> qboxes_device(qboxes, deviceAllocatorID);
+  axom::Array<PointType> qpoints_device(qpoints, deviceAllocatorID);
+
+  axom::Array<IndexType> offsets(NUM_QUERIES, NUM_QUERIES, deviceAllocatorID);
+  axom::Array<IndexType> counts(NUM_QUERIES, NUM_QUERIES, deviceAllocatorID);
+  axom::Array<IndexType> candidates(0, 0, deviceAllocatorID);
+
+  // the nearest neighbors of each point are already ordered
+  auto nearest_candidates = [&](const BVHType& bvh) {
+    bvh.findKNearest(offsets,
+                     counts,
+                     candidates,
+                     NUM_QUERIES,
+                     qpoints_device.view(),
+                     K);
+    const axom::Array<IndexType> candidates_h(candidates, hostAllocatorID);
+    return std::vector<IndexType>(candidates_h.begin(), candidates_h.end());
+  };
+
+  BVHType bvh;
+  bvh.initialize(boxes_device.view(), NUM_BOXES);
+
+  bvh.findBoundingBoxes(offsets,
+                        counts,
+                        candidates,
+                        NUM_QUERIES,
+                        qboxes_device.view());
+  const auto expected_boxes = sorted_candidates(offsets, counts, candidates);
+
+  bvh.findPoints(offsets,
+                 counts,
+                 candidates,
+                 NUM_QUERIES,
+                 qpoints_device.view());
+  const auto expected_points = sorted_candidates(offsets, counts, candidates);
+
+  const auto expected_nearest = nearest_candidates(bvh);
+
+  auto check_queries = [&](const BVHType& other) {
+    other.findBoundingBoxes(offsets,
+                            counts,
+                            candidates,
+                            NUM_QUERIES,
+                            qboxes_device.view());
+    EXPECT_EQ(expected_boxes, sorted_candidates(offsets, counts, candidates));
+
+    other.findPoints(offsets,
+                     counts,
+                     candidates,
+                     NUM_QUERIES,
+                     qpoints_device.view());
+    EXPECT_EQ(expected_points, sorted_candidates(offsets, counts, candidates));
+
+    EXPECT_EQ(expected_nearest, nearest_candidates(other));
+  };
+
+  EXPECT_EQ(spin::BVH_BUILD_OK, bvh.save(fileName));
+
+  for(bool memoryMap : {true, false})
+  {
+    BVHType loaded;
+    EXPECT_EQ(spin::BVH_BUILD_OK, loaded.load(fileName, memoryMap));
+    EXPECT_TRUE(loaded.isInitialized());
+    EXPECT_EQ(bvh.getBounds(), loaded.getBounds());
+    check_queries(loaded);
+
+    // a loaded BVH is rebuilt when refitted
+    EXPECT_EQ(spin::BVH_BUILD_OK,
+              loaded.refit(boxes_device.view(), NUM_BOXES));
+    check_queries(loaded);
+  }
+
+  // a serialized BVH is accessed in place in the buffer
+  {
+    std::vector<char> buffer(bvh.getSerializedSize());
+    bvh.serialize(buffer.data());
+
+    BVHType attached;
+    EXPECT_EQ(spin::BVH_BUILD_OK,
+              attached.attach(buffer.data(), buffer.size()));
+    EXPECT_TRUE(attached.isInitialized());
+    EXPECT_EQ(bvh.getBounds(), attached.getBounds());
+    check_queries(attached);
+
+    // truncated buffers are rejected
+    BVHType truncated;
+    EXPECT_EQ(spin::BVH_BUILD_FAILED,
+              truncated.attach(buffer.data(), buffer.size() - 1));
+    EXPECT_FALSE(truncated.isInitialized());
+
+    // buffers and files with out of range children or leaves are rejected
+    spin::internal::linear_bvh::BVHFileHeader header;
+    std::memcpy(&header, buffer.data(), sizeof(header));
+    const std::int32_t num_inner =
+      static_cast<std::int32_t>(header.num_inner_nodes);
+    const std::int32_t num_leaves =
+      static_cast<std::int32_t>(header.num_leaves);
+    const std::vector<std::pair<std::uint64_t, std::int32_t>> corruptions {
+      {header.children_offset, num_inner - 1},
+      {header.children_offset + sizeof(std::int32_t), -num_leaves - 1},
+      {header.leaf_nodes_offset, static_cast<std::int32_t>(NUM_BOXES)},
+      {header.leaf_nodes_offset + sizeof(std::int32_t), -1}};
+    for(const auto& corruption : corruptions)
+    {
+      std::vector<char> corrupted(buffer);
+      std::memcpy(corrupted.data() + corruption.first,
+                  &corruption.second,
+                  sizeof(std::int32_t));
+
+      BVHType attachedCorrupted;
+      EXPECT_EQ(spin::BVH_BUILD_FAILED,
+                attachedCorrupted.attach(corrupted.data(), corrupted.size()));
+      EXPECT_FALSE(attachedCorrupted.isInitialized());
+
+      {
+        std::ofstream ofs(fileName, std::ios::binary);
+        ofs.write(corrupted.data(), corrupted.size());
+      }
+      BVHType loadedCorrupted;
+      EXPECT_EQ(spin::BVH_BUILD_FAILED, loadedCorrupted.load(fileName));
+      EXPECT_FALSE(loadedCorrupted.isInitialized());
+    }
+  }
+
+  // the number of entities is restored for BVHs over a single box
+  bvh.initialize(boxes_device.view(), 1);
+  EXPECT_EQ(spin::BVH_BUILD_OK, bvh.save(fileName));
+  {
+    BVHType loaded;
+    EXPECT_EQ(spin::BVH_BUILD_OK, loaded.load(fileName));
+    loaded.findKNearest(offsets,
+                        counts,
+                        candidates,
+                        NUM_QUERIES,
+                        qpoints_device.view(),
+                        K);
+    EXPECT_EQ(NUM_QUERIES, candidates.size());
+  }
+
+  // files holding a BVH of a different dimension are rejected
+  {
+    spin::BVH<(NDIMS == 2) ? 3 : 2, ExecSpace, FloatType> other;
+    EXPECT_EQ(spin::BVH_BUILD_FAILED, other.load(fileName));
+    EXPECT_FALSE(other.isInitialized());
+  }
+
+  EXPECT_EQ(0, axom::utilities::filesystem::removeFile(fileName));
+  EXPECT_EQ(spin::BVH_BUILD_FAILED, bvh.load(fileName));
+}
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Checks that the packet traversal of rays returns the same candidates
+ *  as the traversal of single rays, and that both find the same nearest hits
+ *  as a brute-force search.
+ */
+template <typename ExecSpace,
+          typename FloatType,
+          int NDIMS,
+          spin::BVHType BVHImpl>
+void check_ray_packets()
+{
+  constexpr IndexType NUM_BOXES = 1000;
+  constexpr IndexType RAYS_PER_SIDE = 20;
+  constexpr IndexType NUM_RAYS = 2 * RAYS_PER_SIDE * RAYS_PER_SIDE + 3;
+
+  using BoxType = typename primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = typename primal::Point<FloatType, NDIMS>;
+  using VectorType = typename primal::Vector<FloatType, NDIMS>;
+  using RayType = typename primal::Ray<FloatType, NDIMS>;
+
+  const int hostAllocatorID =
+    axom::execution_space<axom::SEQ_EXEC>::allocatorID();
+  const int deviceAllocatorID = axom::execution_space<ExecSpace>::allocatorID();
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<FloatType> coord(0., 10.);
+  std::uniform_real_distribution<FloatType> extent(0., .5);
+  std::uniform_real_distribution<FloatType> jitter(-.05, .05);
+
+  axom::Array<BoxType> boxes(NUM_BOXES, NUM_BOXES, hostAllocatorID);
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    PointType pt;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      pt[d] = coord(gen);
+    }
+    boxes[i] = BoxType {pt};
+    boxes[i].expand(extent(gen));
+  }
+
+  // bundles of nearly parallel rays from a grid on two sides of the domain,
+  // and a few rays parallel to the axes
+  axom::Array<RayType> rays(0, NUM_RAYS, hostAllocatorID);
+  for(int side = 0; side < 2; ++side)
+  {
+    for(IndexType i = 0; i < RAYS_PER_SIDE; ++i)
+    {
+      for(IndexType j = 0; j < RAYS_PER_SIDE; ++j)
+      {
+        PointType origin(side == 0 ? -1. : 11.);
+        origin[1] = 10. * i / RAYS_PER_SIDE;
+        origin[NDIMS - 1] = 10. * j / RAYS_PER_SIDE + ((NDIMS == 2) ? 0.5 : 0.);
+
+        VectorType direction(jitter(gen));
+        direction[0] = (side == 0) ? 1. : -1.;
+        rays.push_back(RayType {origin, direction});
+      }
+    }
+  }
+  for(int d = 0; d < 3; ++d)
+  {
+    VectorType direction(0.);
+    direction[d % NDIMS] = 1.;
+    rays.push_back(RayType {PointType(-1. + d), direction});
+  }
+  EXPECT_EQ(NUM_RAYS, rays.size());
+
+  axom::Array<BoxType> boxes_device(boxes, deviceAllocatorID);
+  axom::Array<RayType> rays_device(rays, deviceAllocatorID);
+
+  spin::BVH<NDIMS, ExecSpace, FloatType, BVHImpl> bvh;
+  EXPECT_FALSE(bvh.getRayPacketTraversal());
+  bvh.initialize(boxes_device.view(), NUM_BOXES);
+
+  axom::Array<IndexType> offsets(NUM_RAYS, NUM_RAYS, deviceAllocatorID);
+  axom::Array<IndexType> counts(NUM_RAYS, NUM_RAYS, deviceAllocatorID);
+  axom::Array<IndexType> candidates(0, 0, deviceAllocatorID);
+  axom::Array<IndexType> hitIDs(NUM_RAYS, NUM_RAYS, deviceAllocatorID);
+  axom::Array<FloatType> hitParams(NUM_RAYS, NUM_RAYS, deviceAllocatorID);
+
+  // intersects a ray with the (unscaled) box of a bin
+  const FloatType EPS = bvh.getTolerance();
+  const auto boxes_v = boxes_device.view();
+  auto hitBox = [=] AXOM_HOST_DEVICE(const RayType& ray,
+                                     IndexType id,
+                                     FloatType& t) -> bool {
+    FloatType tmin = numerics::floating_point_limits<FloatType>::min();
+    FloatType tmax = t;
+    if(primal::detail::intersect_ray(ray, boxes_v[id], tmin, tmax, EPS))
+    {
+      t = tmin;
+      return true;
+    }
+    return false;
+  };
+
+  // brute-force nearest hits
+  std::vector<IndexType> expected_ids(NUM_RAYS, -1);
+  std::vector<FloatType> expected_params(
+    NUM_RAYS,
+    numerics::floating_point_limits<FloatType>::max());
+  for(IndexType i = 0; i < NUM_RAYS; ++i)
+  {
+    for(IndexType j = 0; j < NUM_BOXES; ++j)
+    {
+      FloatType tmin = numerics::floating_point_limits<FloatType>::min();
+      FloatType tmax = numerics::floating_point_limits<FloatType>::max();
+      if(primal::detail::intersect_ray(rays[i], boxes[j], tmin, tmax, EPS) &&
+         tmin < expected_params[i])
+      {
+        expected_params[i] = tmin;
+        expected_ids[i] = j;
+      }
+    }
+  }
+
+  std::vector<std::vector<IndexType>> expected_candidates;
+  for(bool packets : {false, true})
+  {
+    bvh.setRayPacketTraversal(packets);
+    EXPECT_EQ(packets, bvh.getRayPacketTraversal());
+
+    bvh.findRays(offsets, counts, candidates, NUM_RAYS, rays_device.view());
+    const auto ray_candidates = sorted_candidates(offsets, counts, candidates);
+    if(!packets)
+    {
+      expected_candidates = ray_candidates;
+    }
+    EXPECT_EQ(expected_candidates, ray_candidates);
+
+    bvh.findNearestHits(NUM_RAYS,
+                        rays_device.view(),
+                        hitBox,
+                        hitIDs.view(),
+                        hitParams.view());
+
+    const axom::Array<IndexType> hitIDs_h(hitIDs, hostAllocatorID);
+    const axom::Array<FloatType> hitParams_h(hitParams, hostAllocatorID);
+    for(IndexType i = 0; i < NUM_RAYS; ++i)
+    {
+      EXPECT_EQ(expected_ids[i], hitIDs_h[i]) << "ray " << i;
+      EXPECT_EQ(expected_params[i], hitParams_h[i]) << "ray " << i;
+
+      // the nearest hit is one of the candidates of the ray
+      const auto& cands = expected_candidates[i];
+      if(expected_ids[i] >= 0)
+      {
+        EXPECT_TRUE(
+          std::binary_search(cands.begin(), cands.end(), expected_ids[i]));
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Checks the traversal that passes the node indices to the predicate,
+ *  and the consistency of the node accessors of the traverser.
+ */
+template <typename FloatType, int NDIMS>
+void check_traverse_nodes()
+{
+  constexpr IndexType NUM_BOXES = 500;
+
+  using BoxType = typename primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = typename primal::Point<FloatType, NDIMS>;
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<FloatType> coord(0., 10.);
+  std::uniform_real_distribution<FloatType> extent(0., 0.5);
+
+  axom::Array<BoxType> boxes(NUM_BOXES, NUM_BOXES);
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    PointType pt;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      pt[d] = coord(gen);
+    }
+    boxes[i] = BoxType {pt};
+    boxes[i].expand(extent(gen));
+  }
+
+  spin::BVH<NDIMS, axom::SEQ_EXEC, FloatType> bvh;
+  bvh.initialize(boxes.view(), NUM_BOXES);
+
+  const auto traverser = bvh.getTraverser();
+  const auto nodes = traverser.getInnerNodes();
+  const auto children = traverser.getInnerNodeChildren();
+  EXPECT_EQ(2 * (NUM_BOXES - 1), nodes.size());
+  EXPECT_EQ(NUM_BOXES, traverser.getLeafNodes().size());
+
+  // the boxes of the children of a node are within the box of the node
+  for(IndexType node = 0; node < nodes.size(); ++node)
+  {
+    const std::int32_t child = children[node];
+    if(child >= 0)
+    {
+      EXPECT_TRUE(nodes[node].contains(nodes[child]));
+      EXPECT_TRUE(nodes[node].contains(nodes[child + 1]));
+    }
+  }
+
+  // visiting every node reaches every leaf once, with the matching boxes
+  std::vector<int> leaf_counts(NUM_BOXES, 0);
+  IndexType num_visited = 0;
+  traverser.traverse_nodes(
+    PointType {},
+    [&](std::int32_t current_node, const std::int32_t* leaf_nodes) {
+      leaf_counts[leaf_nodes[current_node]]++;
+    },
+    [&](const PointType&, const BoxType& bin, std::int32_t node) {
+      EXPECT_EQ(nodes[node], bin);
+      num_visited++;
+      return true;
+    });
+  EXPECT_EQ(nodes.size(), num_visited);
+  EXPECT_EQ(std::vector<int>(NUM_BOXES, 1), leaf_counts);
+}
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Checks that the SAH build bounds the depth of the tree over clusters
+ *  of geometrically shrinking size, and that the resulting BVHs return the
+ *  same candidates as the default BVH.
+ */
+template <typename ExecSpace, spin::BVHType BVHImpl>
+void check_sah_depth()
+{
+  constexpr int NDIMS = 3;
+  constexpr IndexType NUM_CLUSTERS = 100;
+  constexpr IndexType CLUSTER_SIZE = 4;
+  constexpr IndexType NUM_BOXES = NUM_CLUSTERS * CLUSTER_SIZE;
+  constexpr IndexType NUM_QUERIES = NUM_BOXES + 1;
+
+  using FloatType = double;
+  using BoxType = typename primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = typename primal::Point<FloatType, NDIMS>;
+
+  const int hostAllocatorID =
+    axom::execution_space<axom::SEQ_EXEC>::allocatorID();
+  const int deviceAllocatorID = axom::execution_space<ExecSpace>::allocatorID();
+
+  // cluster i is centered at 16^-i, and its boxes are 16^-i times smaller
+  // than those of the first cluster
+  axom::Array<BoxType> boxes(NUM_BOXES, NUM_BOXES, hostAllocatorID);
+  axom::Array<PointType> centers(NUM_QUERIES, NUM_QUERIES, hostAllocatorID);
+  for(IndexType i = 0; i < NUM_CLUSTERS; ++i)
+  {
+    const FloatType scale = std::ldexp(1., -4 * static_cast<int>(i));
+    for(IndexType j = 0; j < CLUSTER_SIZE; ++j)
+    {
+      PointType pt(scale);
+      pt[j % NDIMS] += 0.1 * scale * j;
+      boxes[i * CLUSTER_SIZE + j] = BoxType {pt};
+      boxes[i * CLUSTER_SIZE + j].expand(0.05 * scale);
+      centers[i * CLUSTER_SIZE + j] = pt;
+    }
+  }
+
+  // the depth of a tree given by the parent of each node
+  auto tree_depth = [](const axom::Array<std::int32_t>& parents,
+                       std::int32_t inner_size) {
+    std::int32_t depth = 0;
+    for(std::int32_t leaf = inner_size; leaf < parents.size(); ++leaf)
+    {
+      std::int32_t leaf_depth = 0;
+      for(std::int32_t node = parents[leaf]; node >= 0; node = parents[node])
+      {
+        ++leaf_depth;
+      }
+      depth = std::max(depth, leaf_depth);
+    }
+    return depth;
+  };
+
+  namespace lbvh = spin::internal::linear_bvh;
+  const std::int32_t inner_size = NUM_BOXES - 1;
+  axom::Array<std::int32_t> order(NUM_BOXES, NUM_BOXES);
+  axom::Array<std::int32_t> lchildren(inner_size, inner_size);
+  axom::Array<std::int32_t> rchildren(inner_size, inner_size);
+  axom::Array<std::int32_t> parents(inner_size + NUM_BOXES,
+                                    inner_size + NUM_BOXES);
+  axom::Array<BoxType> inner_aabbs(inner_size, inner_size);
+
+  // without a depth limit, the SAH splits off one cluster at a time
+  lbvh::build_sah_topology<FloatType, NDIMS>(boxes.view(),
+                                             order.view(),
+                                             lchildren.view(),
+                                             rchildren.view(),
+                                             parents.view(),
+                                             inner_aabbs.view(),
+                                             NUM_BOXES);
+  EXPECT_GT(tree_depth(parents, inner_size), lbvh::BVH_MAX_DEPTH);
+
+  lbvh::build_sah_topology<FloatType, NDIMS>(boxes.view(),
+                                             order.view(),
+                                             lchildren.view(),
+                                             rchildren.view(),
+                                             parents.view(),
+                                             inner_aabbs.view());
+  EXPECT_LE(tree_depth(parents, inner_size), lbvh::BVH_MAX_DEPTH);
+
+  // queries on the SAH BVH match the ones of the default BVH; the last box
+  // query overlaps all the boxes, so that every node of the tree is visited
+  axom::Array<BoxType> qboxes(NUM_QUERIES, NUM_QUERIES, hostAllocatorID);
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    qboxes[i] = boxes[i];
+  }
+  qboxes[NUM_BOXES] = BoxType {PointType(-1.), PointType(2.)};
+  centers[NUM_BOXES] = PointType(0.);
+
+  axom::Array<BoxType> boxes_device(boxes, deviceAllocatorID);
+  axom::Array<PointType> centers_device(centers, deviceAllocatorID);
+  axom::Array<BoxType> qboxes_device(qboxes, deviceAllocatorID);
+
+  spin::BVH<NDIMS, ExecSpace, FloatType> bvh;
+  bvh.initialize(boxes_device.view(), NUM_BOXES);
+
+  spin::BVH<NDIMS, ExecSpace, FloatType, BVHImpl> sah_bvh;
+  sah_bvh.setBuildMethod(spin::BVHBuildMethod::BinnedSAH);
+  sah_bvh.initialize(boxes_device.view(), NUM_BOXES);
+
+  axom::Array<IndexType> offsets(NUM_QUERIES, NUM_QUERIES, deviceAllocatorID);
+  axom::Array<IndexType> counts(NUM_QUERIES, NUM_QUERIES, deviceAllocatorID);
+  axom::Array<IndexType> candidates(0, 0, deviceAllocatorID);
+  axom::Array<IndexType> sah_offsets(NUM_QUERIES,
+                                     NUM_QUERIES,
+                                     deviceAllocatorID);
+  axom::Array<IndexType> sah_counts(NUM_QUERIES,
+                                    NUM_QUERIES,
+                                    deviceAllocatorID);
+  axom::Array<IndexType> sah_candidates(0, 0, deviceAllocatorID);
+
+  bvh.findPoints(offsets,
+                 counts,
+                 candidates,
+                 NUM_QUERIES,
+                 centers_device.view());
+  sah_bvh.findPoints(sah_offsets,
+                     sah_counts,
+                     sah_candidates,
+                     NUM_QUERIES,
+                     centers_device.view());
+  EXPECT_GE(candidates.size(), NUM_BOXES);
+  EXPECT_EQ(sorted_candidates(offsets, counts, candidates),
+            sorted_candidates(sah_offsets, sah_counts, sah_candidates));
+
+  bvh.findBoundingBoxes(offsets,
+                        counts,
+                        candidates,
+                        NUM_QUERIES,
+                        qboxes_device.view());
+  sah_bvh.findBoundingBoxes(sah_offsets,
+                            sah_counts,
+                            sah_candidates,
+                            NUM_QUERIES,
+                            qboxes_device.view());
+  const auto sah_result =
+    sorted_candidates(sah_offsets, sah_counts, sah_candidates);
+  EXPECT_EQ(NUM_BOXES,
+            static_cast<IndexType>(sah_result[NUM_BOXES].size()));
+  EXPECT_EQ(sorted_candidates(offsets, counts, candidates), sah_result);
+}
+
+} /* end unnamed namespace */
+
+//------------------------------------------------------------------------------
+// UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(spin_bvh, construct2D_sequential)
+{
+  check_build_bvh2d<axom::SEQ_EXEC, double>();
+  check_build_bvh2d<axom::SEQ_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, construct3D_sequential)
+{
+  check_build_bvh3d<axom::SEQ_EXEC, double>();
+  check_build_bvh3d<axom::SEQ_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_bounding_boxes_3d_sequential)
+{
+  check_find_bounding_boxes3d<axom::SEQ_EXEC, double>();
+  check_find_bounding_boxes3d<axom::SEQ_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_bounding_boxes_2d_sequential)
+{
+  check_find_bounding_boxes2d<axom::SEQ_EXEC, double>();
+  check_find_bounding_boxes2d<axom::SEQ_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_rays_3d_sequential)
+{
+  check_find_rays3d<axom::SEQ_EXEC, double>();
+  check_find_rays3d<axom::SEQ_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_rays_2d_sequential)
+{
+  check_find_rays2d<axom::SEQ_EXEC, double>();
+  check_find_rays2d<axom::SEQ_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_points_3d_sequential)
+{
+  check_find_points3d<axom::SEQ_EXEC, double>();
+  check_find_points3d<axom::SEQ_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_points_2d_sequential)
+{
+  check_find_points2d<axom::SEQ_EXEC, double>();
+  check_find_points2d<axom::SEQ_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, single_box2d_sequential)
+{
+  check_single_box2d<axom::SEQ_EXEC, double>();
+  check_single_box2d<axom::SEQ_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, single_box3d_sequential)
+{
+  check_single_box3d<axom::SEQ_EXEC, double>();
+  check_single_box3d<axom::SEQ_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, construct3D_sequential_zip)
+{
+  check_build_bvh_zip3d<axom::SEQ_EXEC, double>();
+  check_build_bvh_zip3d<axom::SEQ_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_points_2d_sequential_zip)
+{
+  check_find_points_zip2d<axom::SEQ_EXEC, double>();
+  check_find_points_zip2d<axom::SEQ_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_points_3d_sequential_zip)
+{
+  check_find_points_zip3d<axom::SEQ_EXEC, double>();
+  check_find_points_zip3d<axom::SEQ_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, single_bbox_sequential)
+{
+  check_0_or_1_bbox_2d<axom::SEQ_EXEC, double>();
+  check_0_or_1_bbox_2d<axom::SEQ_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, wide_bvh_2d_sequential)
+{
+  constexpr auto MORTON = spin::BVHBuildMethod::Morton;
+  check_bvh_variant<axom::SEQ_EXEC, double, 2, spin::BVHType::WideBVH4>(MORTON);
+  check_bvh_variant<axom::SEQ_EXEC, float, 2, spin::BVHType::WideBVH8>(MORTON);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, wide_bvh_3d_sequential)
+{
+  constexpr auto MORTON = spin::BVHBuildMethod::Morton;
+  check_bvh_variant<axom::SEQ_EXEC, double, 3, spin::BVHType::WideBVH4>(MORTON);
+  check_bvh_variant<axom::SEQ_EXEC, float, 3, spin::BVHType::WideBVH8>(MORTON);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, sah_build_sequential)
+{
+  constexpr auto SAH = spin::BVHBuildMethod::BinnedSAH;
+  check_bvh_variant<axom::SEQ_EXEC, double, 2, spin::BVHType::LinearBVH>(SAH);
+  check_bvh_variant<axom::SEQ_EXEC, double, 3, spin::BVHType::LinearBVH>(SAH);
+  check_bvh_variant<axom::SEQ_EXEC, float, 3, spin::BVHType::LinearBVH>(SAH);
+  check_bvh_variant<axom::SEQ_EXEC, double, 3, spin::BVHType::WideBVH4>(SAH);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, sah_depth_sequential)
+{
+  check_sah_depth<axom::SEQ_EXEC, spin::BVHType::LinearBVH>();
+  check_sah_depth<axom::SEQ_EXEC, spin::BVHType::WideBVH4>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, refit_sequential)
+{
+  constexpr auto MORTON = spin::BVHBuildMethod::Morton;
+  constexpr auto SAH = spin::BVHBuildMethod::BinnedSAH;
+  check_bvh_refit<axom::SEQ_EXEC, double, 2, spin::BVHType::LinearBVH>(MORTON);
+  check_bvh_refit<axom::SEQ_EXEC, double, 3, spin::BVHType::LinearBVH>(MORTON);
+  check_bvh_refit<axom::SEQ_EXEC, float, 3, spin::BVHType::LinearBVH>(SAH);
+  check_bvh_refit<axom::SEQ_EXEC, double, 3, spin::BVHType::WideBVH4>(MORTON);
+  check_bvh_refit<axom::SEQ_EXEC, double, 3, spin::BVHType::WideBVH8>(SAH);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, nearest_neighbors_sequential)
+{
+  check_bvh_nearest<axom::SEQ_EXEC, double, 2, spin::BVHType::LinearBVH>();
+  check_bvh_nearest<axom::SEQ_EXEC, double, 3, spin::BVHType::LinearBVH>();
+  check_bvh_nearest<axom::SEQ_EXEC, float, 3, spin::BVHType::LinearBVH>();
+  check_bvh_nearest<axom::SEQ_EXEC, double, 3, spin::BVHType::WideBVH4>();
+  check_bvh_nearest<axom::SEQ_EXEC, float, 2, spin::BVHType::WideBVH8>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, single_pass_search_sequential)
+{
+  check_single_pass<axom::SEQ_EXEC, double, 2, spin::BVHType::LinearBVH>();
+  check_single_pass<axom::SEQ_EXEC, double, 3, spin::BVHType::LinearBVH>();
+  check_single_pass<axom::SEQ_EXEC, float, 3, spin::BVHType::WideBVH4>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, save_load_sequential)
+{
+  check_save_load<axom::SEQ_EXEC, double, 2>();
+  check_save_load<axom::SEQ_EXEC, double, 3>();
+  check_save_load<axom::SEQ_EXEC, float, 3>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, traverse_nodes_sequential)
+{
+  check_traverse_nodes<double, 2>();
+  check_traverse_nodes<double, 3>();
+  check_traverse_nodes<float, 3>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, ray_packets_sequential)
+{
+  check_ray_packets<axom::SEQ_EXEC, double, 2, spin::BVHType::LinearBVH>();
+  check_ray_packets<axom::SEQ_EXEC, double, 3, spin::BVHType::LinearBVH>();
+  check_ray_packets<axom::SEQ_EXEC, float, 3, spin::BVHType::LinearBVH>();
+  check_ray_packets<axom::SEQ_EXEC, double, 3, spin::BVHType::WideBVH4>();
+  check_ray_packets<axom::SEQ_EXEC, double, 2, spin::BVHType::WideBVH4>();
+  check_ray_packets<axom::SEQ_EXEC, float, 3, spin::BVHType::WideBVH8>();
+}
+
+//------------------------------------------------------------------------------
+#if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
+
+TEST(spin_bvh, construct2D_omp)
+{
+  check_build_bvh2d<axom::OMP_EXEC, double>();
+  check_build_bvh2d<axom::OMP_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, construct3D_omp)
+{
+  check_build_bvh3d<axom::OMP_EXEC, double>();
+  check_build_bvh3d<axom::OMP_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_bounding_boxes_3d_omp)
+{
+  check_find_bounding_boxes3d<axom::OMP_EXEC, double>();
+  check_find_bounding_boxes3d<axom::OMP_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_bounding_boxes_2d_omp)
+{
+  check_find_bounding_boxes2d<axom::OMP_EXEC, double>();
+  check_find_bounding_boxes2d<axom::OMP_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_rays_3d_omp)
+{
+  check_find_rays3d<axom::OMP_EXEC, double>();
+  check_find_rays3d<axom::OMP_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_rays_2d_omp)
+{
+  check_find_rays2d<axom::OMP_EXEC, double>();
+  check_find_rays2d<axom::OMP_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_points_3d_omp)
+{
+  check_find_points3d<axom::OMP_EXEC, double>();
+  check_find_points3d<axom::OMP_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_points_2d_omp)
+{
+  check_find_points2d<axom::OMP_EXEC, double>();
+  check_find_points2d<axom::OMP_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, single_box2d_omp)
+{
+  check_single_box2d<axom::OMP_EXEC, double>();
+  check_single_box2d<axom::OMP_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, single_box3d_omp)
+{
+  check_single_box3d<axom::OMP_EXEC, double>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, single_bbox_omp)
+{
+  check_0_or_1_bbox_2d<axom::OMP_EXEC, double>();
+  check_0_or_1_bbox_2d<axom::OMP_EXEC, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, ray_packets_omp)
+{
+  check_ray_packets<axom::OMP_EXEC, double, 3, spin::BVHType::LinearBVH>();
+  check_ray_packets<axom::OMP_EXEC, float, 3, spin::BVHType::WideBVH8>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, nearest_neighbors_omp)
+{
+  check_bvh_nearest<axom::OMP_EXEC, double, 3, spin::BVHType::LinearBVH>();
+  check_bvh_nearest<axom::OMP_EXEC, float, 2, spin::BVHType::LinearBVH>();
+  check_bvh_nearest<axom::OMP_EXEC, double, 3, spin::BVHType::WideBVH4>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, single_pass_search_omp)
+{
+  check_single_pass<axom::OMP_EXEC, double, 3, spin::BVHType::LinearBVH>();
+  check_single_pass<axom::OMP_EXEC, float, 3, spin::BVHType::WideBVH4>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, wide_bvh_2d_omp)
+{
+  constexpr auto MORTON = spin::BVHBuildMethod::Morton;
+  check_bvh_variant<axom::OMP_EXEC, double, 2, spin::BVHType::WideBVH4>(MORTON);
+  check_bvh_variant<axom::OMP_EXEC, float, 2, spin::BVHType::WideBVH8>(MORTON);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, wide_bvh_3d_omp)
+{
+  constexpr auto MORTON = spin::BVHBuildMethod::Morton;
+  check_bvh_variant<axom::OMP_EXEC, double, 3, spin::BVHType::WideBVH4>(MORTON);
+  check_bvh_variant<axom::OMP_EXEC, float, 3, spin::BVHType::WideBVH8>(MORTON);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, sah_build_omp)
+{
+  constexpr auto SAH = spin::BVHBuildMethod::BinnedSAH;
+  check_bvh_variant<axom::OMP_EXEC, double, 2, spin::BVHType::LinearBVH>(SAH);
+  check_bvh_variant<axom::OMP_EXEC, float, 3, spin::BVHType::LinearBVH>(SAH);
+  check_bvh_variant<axom::OMP_EXEC, double, 3, spin::BVHType::WideBVH4>(SAH);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, sah_depth_omp)
+{
+  check_sah_depth<axom::OMP_EXEC, spin::BVHType::LinearBVH>();
+  check_sah_depth<axom::OMP_EXEC, spin::BVHType::WideBVH4>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, refit_omp)
+{
+  constexpr auto MORTON = spin::BVHBuildMethod::Morton;
+  constexpr auto SAH = spin::BVHBuildMethod::BinnedSAH;
+  check_bvh_refit<axom::OMP_EXEC, double, 3, spin::BVHType::LinearBVH>(MORTON);
+  check_bvh_refit<axom::OMP_EXEC, float, 3, spin::BVHType::LinearBVH>(SAH);
+  check_bvh_refit<axom::OMP_EXEC, double, 3, spin::BVHType::WideBVH4>(MORTON);
+  check_bvh_refit<axom::OMP_EXEC, double, 3, spin::BVHType::WideBVH8>(SAH);
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+#if defined(AXOM_USE_GPU) && defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
+
+TEST(spin_bvh, construct2D_device)
+{
+  constexpr int BLOCK_SIZE = 256;
+
+  #if defined(__CUDACC__)
+  using exec = axom::CUDA_EXEC<BLOCK_SIZE>;
+  #elif defined(__HIPCC__)
+  using exec = axom::HIP_EXEC<BLOCK_SIZE>;
+  #else
+  using exec = axom::SEQ_EXEC;
+  #endif
+
+  check_build_bvh2d<exec, double>();
+  check_build_bvh2d<exec, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, construct3D_device)
+{
+  constexpr int BLOCK_SIZE = 256;
+
+  #if defined(__CUDACC__)
+  using exec = axom::CUDA_EXEC<BLOCK_SIZE>;
+  #elif defined(__HIPCC__)
+  using exec = axom::HIP_EXEC<BLOCK_SIZE>;
+  #else
+  using exec = axom::SEQ_EXEC;
+  #endif
+
+  check_build_bvh3d<exec, double>();
+  check_build_bvh3d<exec, float>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, find_bounding_boxes_3d_device)
+{
+  constexpr int BLOCK_SIZE = 256;
+
+  #if defined(__CUDACC__)
+  using exec = axom::CUDA_EXEC<BLOCK_SIZE>;
   #elif defined(__HIPCC__)
   using exec = axom::HIP_EXEC<BLOCK_SIZE>;
   #else
@@ -2086,6 +3442,166 @@ TEST(spin_bvh, single_bbox_device)
   check_0_or_1_bbox_2d<exec, float>();
 }
 
+//------------------------------------------------------------------------------
+TEST(spin_bvh, nearest_neighbors_device)
+{
+  constexpr int BLOCK_SIZE = 256;
+
+  #if defined(__CUDACC__)
+  using exec = axom::CUDA_EXEC<BLOCK_SIZE>;
+  #elif defined(__HIPCC__)
+  using exec = axom::HIP_EXEC<BLOCK_SIZE>;
+  #else
+  using exec = axom::SEQ_EXEC;
+  #endif
+
+  check_bvh_nearest<exec, double, 3, spin::BVHType::LinearBVH>();
+  check_bvh_nearest<exec, float, 2, spin::BVHType::LinearBVH>();
+  check_bvh_nearest<exec, double, 3, spin::BVHType::WideBVH4>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, single_pass_search_device)
+{
+  constexpr int BLOCK_SIZE = 256;
+
+  #if defined(__CUDACC__)
+  using exec = axom::CUDA_EXEC<BLOCK_SIZE>;
+  #elif defined(__HIPCC__)
+  using exec = axom::HIP_EXEC<BLOCK_SIZE>;
+  #else
+  using exec = axom::SEQ_EXEC;
+  #endif
+
+  check_single_pass<exec, double, 3, spin::BVHType::LinearBVH>();
+  check_single_pass<exec, float, 3, spin::BVHType::WideBVH4>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, save_load_device)
+{
+  constexpr int BLOCK_SIZE = 256;
+
+  #if defined(__CUDACC__)
+  using exec = axom::CUDA_EXEC<BLOCK_SIZE>;
+  #elif defined(__HIPCC__)
+  using exec = axom::HIP_EXEC<BLOCK_SIZE>;
+  #else
+  using exec = axom::SEQ_EXEC;
+  #endif
+
+  check_save_load<exec, double, 3>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, ray_packets_device)
+{
+  constexpr int BLOCK_SIZE = 256;
+
+  #if defined(__CUDACC__)
+  using exec = axom::CUDA_EXEC<BLOCK_SIZE>;
+  #elif defined(__HIPCC__)
+  using exec = axom::HIP_EXEC<BLOCK_SIZE>;
+  #else
+  using exec = axom::SEQ_EXEC;
+  #endif
+
+  check_ray_packets<exec, double, 3, spin::BVHType::LinearBVH>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, wide_bvh_2d_device)
+{
+  constexpr int BLOCK_SIZE = 256;
+
+  #if defined(__CUDACC__)
+  using exec = axom::CUDA_EXEC<BLOCK_SIZE>;
+  #elif defined(__HIPCC__)
+  using exec = axom::HIP_EXEC<BLOCK_SIZE>;
+  #else
+  using exec = axom::SEQ_EXEC;
+  #endif
+
+  constexpr auto MORTON = spin::BVHBuildMethod::Morton;
+  check_bvh_variant<exec, double, 2, spin::BVHType::WideBVH4>(MORTON);
+  check_bvh_variant<exec, float, 2, spin::BVHType::WideBVH8>(MORTON);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, wide_bvh_3d_device)
+{
+  constexpr int BLOCK_SIZE = 256;
+
+  #if defined(__CUDACC__)
+  using exec = axom::CUDA_EXEC<BLOCK_SIZE>;
+  #elif defined(__HIPCC__)
+  using exec = axom::HIP_EXEC<BLOCK_SIZE>;
+  #else
+  using exec = axom::SEQ_EXEC;
+  #endif
+
+  constexpr auto MORTON = spin::BVHBuildMethod::Morton;
+  check_bvh_variant<exec, double, 3, spin::BVHType::WideBVH4>(MORTON);
+  check_bvh_variant<exec, float, 3, spin::BVHType::WideBVH8>(MORTON);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, sah_build_device)
+{
+  constexpr int BLOCK_SIZE = 256;
+
+  #if defined(__CUDACC__)
+  using exec = axom::CUDA_EXEC<BLOCK_SIZE>;
+  #elif defined(__HIPCC__)
+  using exec = axom::HIP_EXEC<BLOCK_SIZE>;
+  #else
+  using exec = axom::SEQ_EXEC;
+  #endif
+
+  constexpr auto SAH = spin::BVHBuildMethod::BinnedSAH;
+  check_bvh_variant<exec, double, 2, spin::BVHType::LinearBVH>(SAH);
+  check_bvh_variant<exec, float, 3, spin::BVHType::LinearBVH>(SAH);
+  check_bvh_variant<exec, double, 3, spin::BVHType::WideBVH4>(SAH);
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, sah_depth_device)
+{
+  constexpr int BLOCK_SIZE = 256;
+
+  #if defined(__CUDACC__)
+  using exec = axom::CUDA_EXEC<BLOCK_SIZE>;
+  #elif defined(__HIPCC__)
+  using exec = axom::HIP_EXEC<BLOCK_SIZE>;
+  #else
+  using exec = axom::SEQ_EXEC;
+  #endif
+
+  check_sah_depth<exec, spin::BVHType::LinearBVH>();
+  check_sah_depth<exec, spin::BVHType::WideBVH4>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, refit_device)
+{
+  constexpr int BLOCK_SIZE = 256;
+
+  #if defined(__CUDACC__)
+  using exec = axom::CUDA_EXEC<BLOCK_SIZE>;
+  #elif defined(__HIPCC__)
+  using exec = axom::HIP_EXEC<BLOCK_SIZE>;
+  #else
+  using exec = axom::SEQ_EXEC;
+  #endif
+
+  constexpr auto MORTON = spin::BVHBuildMethod::Morton;
+  constexpr auto SAH = spin::BVHBuildMethod::BinnedSAH;
+  check_bvh_refit<exec, double, 3, spin::BVHType::LinearBVH>(MORTON);
+  check_bvh_refit<exec, float, 3, spin::BVHType::LinearBVH>(SAH);
+  check_bvh_refit<exec, double, 3, spin::BVHType::WideBVH4>(MORTON);
+  check_bvh_refit<exec, double, 3, spin::BVHType::WideBVH8>(SAH);
+}
+
 #endif /* AXOM_USE_GPU && AXOM_USE_RAJA && AXOM_USE_UMPIRE */
 
 //------------------------------------------------------------------------------
@@ -114,6 +114,25 @@ else()
     message(STATUS "HDF5 support is OFF")
 endif()
 
+#------------------------------------------------------------------------------
+# zlib
+#------------------------------------------------------------------------------
+if (ZLIB_DIR)
+    axom_assert_is_directory(DIR_VARIABLE ZLIB_DIR)
+    # Note: zlib may have already been found as a dependency of HDF5
+    if (NOT TARGET ZLIB::ZLIB)
+        set(ZLIB_ROOT ${ZLIB_DIR})
+        find_package(ZLIB REQUIRED)
+    endif()
+    axom_assert_find_succeeded(PROJECT_NAME zlib
+                               TARGET       ZLIB::ZLIB
+                               DIR_VARIABLE ZLIB_DIR)
+    set(ZLIB_FOUND TRUE)
+else()
+    message(STATUS "zlib support is OFF")
+    set(ZLIB_FOUND FALSE)
+endif()
+
 #------------------------------------------------------------------------------
 # MFEM
 #------------------------------------------------------------------------------